@@ -0,0 +1,195 @@
+/**
+ * @file CFDAsyncChannel.h
+ * @brief Shared-memory channel between CFDCoupler and an external CFD solver
+ *
+ * Phase 9: Track C - CFD Coupling (asynchronous mode)
+ *
+ * A named shared-memory region holds two single-producer/single-consumer
+ * rings:
+ * - boundary ring: coupler -> solver, one CFDBoundaryMessage per export
+ * - result ring:   solver -> coupler, a CFDResultHeader followed by one
+ *                  array of num_points doubles per CFDField
+ *
+ * Ring indices are lock-free 64-bit atomics, so producer and consumer can
+ * live in different processes (or threads, for in-process testing).
+ */
+
+#ifndef CHEMSI_CFD_ASYNC_CHANNEL_H
+#define CHEMSI_CFD_ASYNC_CHANNEL_H
+
+#include "CFDInterface.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vfep {
+
+/**
+ * @brief Zone state sent to the solver as boundary conditions
+ *
+ * Arrays are indexed by zone: 0 = upper, 1 = middle, 2 = lower.
+ */
+struct CFDBoundaryMessage {
+    uint64_t sequence;
+    double sim_time_s;             ///< Coupling time the conditions apply to
+    double zone_T_K[3];
+    double zone_rho_kg_m3[3];
+    double zone_P_Pa[3];
+    double zone_w_m_s[3];          ///< Buoyancy velocity estimate
+};
+
+/**
+ * @brief Solver result header (field arrays follow in the slot)
+ */
+struct CFDResultHeader {
+    uint64_t sequence;             ///< Sequence of the boundary message answered
+    double sim_time_s;             ///< Simulation time the fields are valid for
+    double solver_time_ms;         ///< Wall time spent producing the result
+    int32_t nx, ny, nz, reserved;
+    double x_min, y_min, z_min;
+    double dx, dy, dz;
+};
+
+class CFDAsyncChannel {
+public:
+    CFDAsyncChannel() = default;
+    ~CFDAsyncChannel() { close(); }
+
+    CFDAsyncChannel(const CFDAsyncChannel&) = delete;
+    CFDAsyncChannel& operator=(const CFDAsyncChannel&) = delete;
+
+    /**
+     * @brief Create (and own) a new channel
+     * @param name Channel name (portable identifier, no slashes)
+     * @param slots Ring capacity for each direction
+     * @param max_points Largest grid a result may carry
+     * @return true if successful
+     */
+    bool create(const std::string& name, uint32_t slots, uint32_t max_points);
+
+    /// Attach to a channel created by another process
+    bool open(const std::string& name);
+
+    /// Unmap; the creator also removes the shared-memory object
+    void close();
+
+    /// Channel name unique to this process (prefix + pid + counter)
+    static std::string uniqueName(const std::string& prefix);
+
+    bool isOpen() const { return base_ != nullptr; }
+    const std::string& name() const { return name_; }
+    uint32_t maxPoints() const;
+
+    // Boundary ring (coupler produces, solver consumes)
+    bool pushBoundary(const CFDBoundaryMessage& msg);   ///< false if ring full
+    bool popBoundary(CFDBoundaryMessage& msg);          ///< false if ring empty
+
+    /**
+     * @brief Reserve the next result slot for writing
+     * @param fields Output: CFDField::Count arrays of maxPoints() doubles
+     * @return Header to fill, or nullptr if the ring is full
+     */
+    CFDResultHeader* beginResult(double* fields[static_cast<size_t>(CFDField::Count)]);
+    void commitResult();
+
+    /**
+     * @brief Oldest unread result (zero-copy, valid until releaseResult())
+     * @return nullptr if the ring is empty
+     */
+    const CFDResultHeader* peekResult(const double* fields[static_cast<size_t>(CFDField::Count)]) const;
+    void releaseResult();
+
+    // Lifecycle flags
+    void setSolverReady();
+    bool solverReady() const;
+    void requestShutdown();
+    bool shutdownRequested() const;
+
+private:
+    struct Header;
+
+    Header* header() const { return reinterpret_cast<Header*>(base_); }
+    uint8_t* boundarySlot(uint64_t index) const;
+    uint8_t* resultSlot(uint64_t index) const;
+    size_t resultSlotBytes() const;
+
+    uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    std::string name_;
+    bool owner_ = false;
+#if defined(_WIN32)
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+/**
+ * @brief Child process running an external solver
+ */
+class CFDSolverProcess {
+public:
+    CFDSolverProcess() = default;
+    ~CFDSolverProcess();
+
+    CFDSolverProcess(const CFDSolverProcess&) = delete;
+    CFDSolverProcess& operator=(const CFDSolverProcess&) = delete;
+
+    /// Start `executable` with `args`; returns false if it cannot be spawned
+    bool launch(const std::string& executable, const std::vector<std::string>& args);
+
+    bool isRunning() const;
+
+    /// Wait up to timeout_ms for exit, then terminate forcibly
+    void stop(int timeout_ms);
+
+private:
+#if defined(_WIN32)
+    void* process_handle_ = nullptr;
+#else
+    long pid_ = -1;
+#endif
+};
+
+/**
+ * @brief Zone a height in the mock CFD domain belongs to
+ *
+ * The blocking mock (CFDCoupler) and the stand-in solver build their grids
+ * from the same zone state with this mapping: upper above 2 m, middle
+ * above 1 m, lower below.
+ *
+ * @return Zone index as in CFDBoundaryMessage (0 = upper, 1 = middle, 2 = lower)
+ */
+int mockCFDZoneAt(double z_m);
+
+/// Buoyancy velocity estimate the mock domain assigns to a zone
+double mockCFDZoneW(int zone);
+
+/**
+ * @brief Options for the built-in stand-in solver
+ */
+struct CFDStandInOptions {
+    double latency_ms = 0.0;   ///< Artificial solver cost per result
+    int nx = 3, ny = 3, nz = 3;
+    double length_x_m = 1.0, length_y_m = 1.0, height_m = 3.0;
+};
+
+/**
+ * @brief Serve boundary messages with the mock CFD step until shutdown
+ *
+ * Implements the same zone-to-grid mapping (mockCFDZoneAt) and sinusoidal
+ * perturbation as the blocking mock in CFDCoupler. Used by the CFDStandInSolver executable;
+ * tests may run it on a thread against the same channel.
+ *
+ * @param channel Opened channel
+ * @param options Grid and latency settings
+ * @param stop Optional extra stop flag (in-process use)
+ * @return Number of results published
+ */
+uint64_t runCFDStandInSolver(CFDAsyncChannel& channel, const CFDStandInOptions& options,
+                             const std::atomic<bool>* stop = nullptr);
+
+} // namespace vfep
+
+#endif // CHEMSI_CFD_ASYNC_CHANNEL_H
@@ -18,10 +18,45 @@
 
 #include "CFDInterface.h"
 #include "ThreeZoneModel.h"
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace vfep {
 
+class CFDTimeSeries;
+
+/**
+ * @brief Settings for asynchronous (pipelined) coupling
+ */
+struct CFDAsyncConfig {
+    std::string channel_name;        ///< Shared-memory channel; empty = generated
+    std::string solver_executable;   ///< Launched with "--channel <name>"; empty = attach only
+    uint32_t ring_slots = 8;         ///< Messages in flight per direction
+    uint32_t max_points = 4096;      ///< Largest CFD grid a result may carry
+    float max_staleness_s = 1.0f;    ///< Result age (sim time) before synchronize() waits
+    int max_wait_ms = 2000;          ///< Upper bound on that wait (wall time)
+    int startup_timeout_ms = 5000;   ///< Wait for the solver to signal ready (0 = skip)
+    bool extrapolate = true;         ///< Linear extrapolation from the last two results
+};
+
+/**
+ * @brief Lag telemetry for asynchronous coupling
+ */
+struct CFDAsyncStats {
+    uint64_t boundaries_sent = 0;
+    uint64_t boundaries_dropped = 0;  ///< Boundary ring full at export
+    uint64_t results_applied = 0;
+    uint64_t blocking_waits = 0;      ///< Syncs that hit the staleness bound
+    uint64_t stale_syncs = 0;         ///< Of those, waits that timed out
+    float last_lag_s = 0.0f;          ///< Sim time from a result's valid time to its use
+    float max_lag_s = 0.0f;
+    float staleness_s = 0.0f;         ///< Age of the newest result at the last sync
+    double last_solver_ms = 0.0;      ///< Solver wall time for the newest result
+    double mean_solver_ms = 0.0;
+    double total_wait_ms = 0.0;       ///< Zone-model time spent blocked on the solver
+};
+
 class CFDCoupler {
 public:
     CFDCoupler();
@@ -38,6 +73,12 @@ public:
     
     // Import CFD results
     void importCFDResults(const CFDInterface& cfd);
+    void importCFDResults(CFDInterface&& cfd);
+
+    // Live CFD state; adapters update fields in place through
+    // CFDInterface::mutableFieldData() / swapFieldBuffer()
+    CFDInterface& cfdInterface() { return cfd_interface_; }
+    const CFDInterface& cfdInterface() const { return cfd_interface_; }
     
     // Synchronization
     bool isSynchronized() const;
@@ -50,6 +91,37 @@ public:
     bool exportCouplingCSV(const std::string& filename,
                            float time_s,
                            const ThreeZoneModel& zones) const;
+
+    /**
+     * @brief Switch to asynchronous coupling through a shared-memory channel
+     *
+     * exportBoundaryConditions() then posts zone state to the solver without
+     * waiting, and synchronize() applies whatever results have arrived,
+     * extrapolating in time between them. synchronize() only blocks when the
+     * newest result is older than max_staleness_s.
+     *
+     * @return false if the channel cannot be created, the solver cannot be
+     *         launched, or it does not become ready in time
+     * @throws std::invalid_argument on invalid configuration
+     */
+    bool startAsyncCoupling(const CFDAsyncConfig& config);
+    void stopAsyncCoupling();
+    bool isAsyncCoupling() const { return async_ != nullptr; }
+    const CFDAsyncStats& asyncStats() const;
+    std::string asyncChannelName() const;
+
+    /**
+     * @brief Replay a recorded transient CFD run instead of the mock step
+     *
+     * synchronize() samples the series at sim_time_s + time_offset_s,
+     * blending the two bracketing frames; frames are paged in on demand.
+     *
+     * @throws std::invalid_argument if the series is null or empty
+     * @throws std::logic_error while asynchronous coupling is active
+     */
+    void startReplay(std::shared_ptr<CFDTimeSeries> series, double time_offset_s = 0.0);
+    void stopReplay();
+    bool isReplaying() const { return replay_ != nullptr; }
     
     // TODO: Full implementation
     
@@ -60,9 +132,21 @@ private:
     int remesh_frequency_;
     int sync_count_;
     
+    struct AsyncState;
+    std::unique_ptr<AsyncState> async_;
+
+    std::shared_ptr<CFDTimeSeries> replay_;
+    double replay_offset_s_;
+
     void mapZoneToCFDDomain(const ThreeZoneModel& zones);
     void mapCFDDomainToZones();
     void runMockCFDStep(float sim_time_s);
+
+    // Asynchronous mode
+    void publishBoundaryConditions(const ThreeZoneModel& zones);
+    void synchronizeAsync(float sim_time_s);
+    bool applyPendingResults(float sim_time_s);
+    void updateExtrapolatedFields(float sim_time_s);
 };
 
 } // namespace vfep
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -7,6 +12,9 @@
 
 namespace vfep {
 
+struct VTKDataset;
+class OctreeField;
+
 /**
  * @brief Single grid point in CFD field
  */
@@ -18,6 +26,22 @@ struct GridPoint {
     double P_Pa;           ///< Pressure (Pa)
 };
 
+/**
+ * @brief Per-point fields held by a structured grid
+ *
+ * Structured grids store each field as its own contiguous array indexed
+ * i + j*nx + k*nx*ny; coordinates are implicit from origin and spacing.
+ */
+enum class CFDField : int {
+    Temperature = 0,   ///< T_K (K)
+    VelocityU,         ///< u (m/s)
+    VelocityV,         ///< v (m/s)
+    VelocityW,         ///< w (m/s)
+    Density,           ///< rho_kg_m3 (kg/m³)
+    Pressure,          ///< P_Pa (Pa)
+    Count
+};
+
 /**
  * @brief Comparison statistics between VFEP and CFD results
  */
@@ -29,6 +53,19 @@ struct ComparisonStats {
     int num_points;         ///< Number of comparison points
 };
 
+/**
+ * @brief Axis-aligned box selecting points for a per-region breakdown
+ */
+struct ComparisonRegion {
+    std::string name;
+    double x_min, y_min, z_min;
+    double x_max, y_max, z_max;
+
+    bool contains(double x, double y, double z) const {
+        return x >= x_min && x <= x_max && y >= y_min && y <= y_max && z >= z_min && z <= z_max;
+    }
+};
+
 /**
  * @brief CFD coupling interface for VFEP
  * 
@@ -44,6 +81,10 @@ class CFDInterface {
 public:
     CFDInterface();
     ~CFDInterface() = default;
+    CFDInterface(const CFDInterface&) = default;
+    CFDInterface& operator=(const CFDInterface&) = default;
+    CFDInterface(CFDInterface&&) = default;
+    CFDInterface& operator=(CFDInterface&&) = default;
     
     /**
      * @brief Import velocity field from VTK file
@@ -99,6 +140,21 @@ public:
      */
     void interpolateVelocity(double x, double y, double z,
                             double& u, double& v, double& w) const;
+
+    /**
+     * @brief Interpolate temperature at many probe points
+     *
+     * Equivalent to calling interpolateTemperature() per probe. Probes are
+     * processed in blocks (cell lookup, corner gather, blend) so the index
+     * and blend loops vectorize; large batches are split across threads.
+     * Unstructured grids are sampled from the octree per probe.
+     *
+     * @param x, y, z Probe coordinates (m), `count` entries each
+     * @param count Number of probes
+     * @param out Output: interpolated temperatures (K), `count` entries
+     */
+    void interpolateTemperatureBatch(const double* x, const double* y, const double* z,
+                                     size_t count, double* out) const;
     
     /**
      * @brief Compare temperature fields between VFEP and CFD
@@ -111,12 +167,66 @@ public:
     
     /**
      * @brief Compare velocity fields between VFEP and CFD
+     *
+     * Errors and correlation are taken on the velocity magnitude.
+     *
      * @param vfep_points VFEP results
      * @param cfd_points CFD results (must correspond 1:1)
      * @return Comparison statistics
      */
     ComparisonStats compareVelocity(const std::vector<GridPoint>& vfep_points,
                                    const std::vector<GridPoint>& cfd_points) const;
+
+    /**
+     * @brief Compare two scalar arrays (e.g. fieldData() of two grids)
+     *
+     * All comparison routines make one parallel pass: points are reduced in
+     * small blocks (two-pass mean/co-moment in cache), or one at a time per
+     * region for the by-region variants, and partials are merged with the
+     * pairwise update of Chan et al., so large fields keep full precision.
+     *
+     * @param vfep, cfd `count` values each
+     * @param mask Optional: only points with mask[i] != 0 are compared
+     */
+    ComparisonStats compareFields(const double* vfep, const double* cfd, size_t count,
+                                  const uint8_t* mask = nullptr) const;
+
+    /**
+     * @brief Velocity magnitude comparison over u/v/w arrays
+     * @param vfep_uvw, cfd_uvw Component arrays, `count` values each
+     * @param mask Optional point mask as in compareFields()
+     */
+    ComparisonStats compareVelocityFields(const double* const vfep_uvw[3],
+                                          const double* const cfd_uvw[3], size_t count,
+                                          const uint8_t* mask = nullptr) const;
+
+    /**
+     * @brief Per-region breakdown of a scalar comparison
+     * @param labels Region index per point; values >= num_regions are skipped
+     * @return num_regions statistics (num_points = 0 for empty regions)
+     */
+    std::vector<ComparisonStats> compareFieldsByRegion(const double* vfep, const double* cfd,
+                                                       size_t count, const uint16_t* labels,
+                                                       size_t num_regions) const;
+
+    /**
+     * @brief Per-region temperature comparison of point records
+     *
+     * Points are assigned to the first region containing the CFD point.
+     */
+    std::vector<ComparisonStats> compareTemperatureByRegion(const std::vector<GridPoint>& vfep_points,
+                                                            const std::vector<GridPoint>& cfd_points,
+                                                            const std::vector<ComparisonRegion>& regions) const;
+
+    /**
+     * @brief Region index of every loaded grid point
+     *
+     * First containing region wins; points outside all regions get
+     * regions.size(). Use with compareFieldsByRegion() over fieldData().
+     *
+     * @throws std::invalid_argument if there are 65535 or more regions
+     */
+    std::vector<uint16_t> regionLabels(const std::vector<ComparisonRegion>& regions) const;
     
     /**
      * @brief Generate mock CFD data for testing
@@ -135,9 +245,85 @@ public:
      * @brief Get number of grid points loaded
      * @return Number of grid points
      */
-    size_t gridPointCount() const { return grid_.size(); }
+    size_t gridPointCount() const {
+        return structured_ ? fields_[0].size() : grid_.size();
+    }
+
+    /**
+     * @brief Grid points as GridPoint records
+     *
+     * For structured grids this is materialized from the field arrays on
+     * first access after a change; prefer fieldData() on hot paths. Safe to
+     * call from several threads at once, like the other const accessors.
+     */
+    const std::vector<GridPoint>& gridPoints() const;
 
-    const std::vector<GridPoint>& gridPoints() const { return grid_; }
+    /// True when fields are stored as per-field arrays on a regular lattice
+    bool isStructured() const { return structured_; }
+
+    /// Contiguous array for one field (structured grids only, else nullptr)
+    const double* fieldData(CFDField field) const {
+        return structured_ ? fields_[static_cast<size_t>(field)].data() : nullptr;
+    }
+
+    /**
+     * @brief Writable array for one field (structured grids only, else nullptr)
+     *
+     * Updates made through the pointer are seen by interpolation immediately.
+     * The gridPoints() cache is invalidated by this call, so finish writing
+     * before the next gridPoints() access (or call this again afterwards).
+     */
+    double* mutableFieldData(CFDField field);
+
+    /**
+     * @brief Exchange a field array with a caller-owned buffer (O(1))
+     *
+     * For double-buffered producers: fill `buffer` with the next state while
+     * readers use the current one, then swap. On return `buffer` holds the
+     * previous array and can be reused for the following step.
+     *
+     * @return false if the grid is not structured or sizes differ
+     */
+    bool swapFieldBuffer(CFDField field, std::vector<double>& buffer);
+
+    /**
+     * @brief Writable points of an unstructured grid
+     *
+     * Drops the octree; call rebuildOctree() once the edits are done.
+     *
+     * @throws std::logic_error if the grid is structured (use mutableFieldData)
+     */
+    std::vector<GridPoint>& mutableGridPoints();
+
+    /**
+     * @brief Octree resampling of an unstructured grid (nullptr if structured)
+     *
+     * Unstructured or locally refined inputs are resampled into a sparse
+     * octree when loaded, so interpolation works without a regular lattice.
+     */
+    const OctreeField* octree() const { return octree_.get(); }
+
+    /// Resample the unstructured points into the octree again
+    void rebuildOctree();
+
+    /**
+     * @brief Octree limits used when resampling unstructured points
+     * @param max_depth Deepest refinement level (1..21)
+     * @param max_points_per_leaf Split cells holding more points than this
+     * @throws std::invalid_argument on out-of-range values
+     */
+    void setOctreeResolution(int max_depth, size_t max_points_per_leaf);
+
+    /**
+     * @brief Define a structured grid in place, reusing existing field storage
+     *
+     * Field contents are kept when the point count is unchanged, so a
+     * producer may overwrite only what changed; fill them through
+     * mutableFieldData().
+     */
+    void resizeStructuredGrid(int nx, int ny, int nz,
+                              double x_min, double y_min, double z_min,
+                              double dx, double dy, double dz);
     int gridNx() const { return nx_; }
     int gridNy() const { return ny_; }
     int gridNz() const { return nz_; }
@@ -166,7 +352,34 @@ public:
                       double dx, double dy, double dz);
     
 private:
-    std::vector<GridPoint> grid_;  ///< Loaded grid points
+    std::vector<GridPoint> grid_;  ///< Loaded grid points (unstructured only)
+
+    // Structured storage: one array per CFDField, no coordinates
+    bool structured_;
+    std::array<std::vector<double>, static_cast<size_t>(CFDField::Count)> fields_;
+
+    // gridPoints() view of fields_, built by the first reader after a change.
+    // Copies start empty and rebuild on demand.
+    struct AosCache {
+        std::vector<GridPoint> points;
+        std::atomic<bool> valid{false};
+        std::mutex mu;
+
+        AosCache() = default;
+        AosCache(const AosCache&) {}
+        AosCache& operator=(const AosCache&) {
+            points.clear();
+            valid.store(false, std::memory_order_relaxed);
+            return *this;
+        }
+    };
+    mutable AosCache aos_cache_;
+
+    // Unstructured storage is resampled here for interpolation. Shared and
+    // immutable once built, so copies of the interface stay cheap.
+    std::shared_ptr<const OctreeField> octree_;
+    int octree_depth_;
+    size_t octree_leaf_points_;
     
     // Grid dimensions for structured grids
     int nx_, ny_, nz_;
@@ -174,11 +387,21 @@ private:
     double x_min_, y_min_, z_min_;
     
     /**
-     * @brief Parse VTK file (simplified parser)
+     * @brief Parse VTK file (legacy ASCII/BINARY or XML, memory-mapped)
      * @param vtk_file Path to VTK file
      * @return true if successful
      */
     bool parseVTK(const std::string& vtk_file);
+
+    /**
+     * @brief Build the structured grid from a parsed dataset
+     *
+     * Image data is used directly. Rectilinear, structured and point-set
+     * inputs are mapped onto a uniform lattice when their points lie on one
+     * (i-fastest ordering, as written by writeVTK); otherwise the points are
+     * kept unstructured and resampled into the octree.
+     */
+    bool loadDataset(const VTKDataset& ds);
     
     /**
      * @brief Write VTK file (simplified writer)
@@ -197,6 +420,12 @@ private:
      */
     bool findCell(double x, double y, double z,
                  int& i0, int& j0, int& k0) const;
+
+    /**
+     * @brief Switch to structured storage and size the field arrays
+     * @param n Number of points (nx*ny*nz)
+     */
+    void allocateFields(size_t n);
     
     /**
      * @brief Trilinear interpolation helper
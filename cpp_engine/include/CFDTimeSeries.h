@@ -0,0 +1,125 @@
+/**
+ * @file CFDTimeSeries.h
+ * @brief Transient CFD results as a lazily loaded series of VTK frames
+ *
+ * Phase 8: CFD Interface - Transient fields
+ *
+ * A directory of timestep files (one VTK file per output time) is indexed
+ * without reading it. Frames are memory-mapped and decoded on first use,
+ * and at most max_resident_frames of them are kept in memory, evicting the
+ * least recently used. Fields at an arbitrary time are blended linearly
+ * between the two bracketing frames.
+ *
+ * Not thread-safe: one series per consumer (e.g. one CFDCoupler).
+ */
+
+#ifndef CHEMSI_CFD_TIME_SERIES_H
+#define CHEMSI_CFD_TIME_SERIES_H
+
+#include "CFDInterface.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vfep {
+
+/**
+ * @brief Paging counters for a CFDTimeSeries
+ */
+struct CFDTimeSeriesStats {
+    uint64_t page_ins = 0;        ///< Frames read from disk
+    uint64_t evictions = 0;       ///< Frames dropped by the LRU cap
+    uint64_t hits = 0;            ///< Frame requests served from memory
+    uint64_t load_failures = 0;   ///< Files that could not be parsed
+};
+
+class CFDTimeSeries {
+public:
+    /**
+     * @param max_resident_frames LRU cap on decoded frames (>= 2)
+     * @throws std::invalid_argument if the cap is below 2
+     */
+    explicit CFDTimeSeries(size_t max_resident_frames = 4);
+
+    /**
+     * @brief Index every VTK file (.vtk/.vti/.vtr/.vts/.vtu) in a directory
+     *
+     * Frame time is the last number in the file name times `time_scale`,
+     * e.g. "fire_0042.vti" with time_scale 0.05 is t = 2.1 s. Files without
+     * a number are skipped; of several files with the same frame time, the
+     * first by path is kept. Nothing is read until a frame is needed.
+     *
+     * @return false if the directory cannot be listed or holds no frames
+     */
+    bool openDirectory(const std::string& directory, double time_scale = 1.0);
+
+    /**
+     * @brief Add one timestep file (kept sorted by time)
+     * @throws std::invalid_argument on a non-finite or duplicate time
+     */
+    void addFrame(const std::string& path, double time_s);
+
+    void clear();
+
+    size_t frameCount() const { return frames_.size(); }
+    double frameTime(size_t index) const { return frames_[index].time_s; }
+    const std::string& framePath(size_t index) const { return frames_[index].path; }
+    double startTime() const;
+    double endTime() const;
+
+    /// Change the LRU cap (evicts immediately if needed)
+    void setMaxResidentFrames(size_t max_resident_frames);
+    size_t maxResidentFrames() const { return max_resident_; }
+    size_t residentFrames() const { return resident_; }
+
+    /**
+     * @brief Decoded frame, paged in if necessary
+     * @return nullptr if the file cannot be read
+     */
+    std::shared_ptr<const CFDInterface> frame(size_t index);
+
+    /**
+     * @brief Fields at time t, blended between the bracketing frames
+     *
+     * Times outside the series are clamped to the first/last frame.
+     * Structured frames on the same lattice are blended into `out`'s
+     * existing arrays without reallocating; otherwise (unstructured or
+     * changing grids) the nearer frame is copied.
+     *
+     * @return false if the series is empty or a frame cannot be read
+     */
+    bool sample(double t, CFDInterface& out);
+
+    /// Point temperature at time t (ambient outside the grid or on failure)
+    double interpolateTemperature(double t, double x, double y, double z);
+
+    const CFDTimeSeriesStats& stats() const { return stats_; }
+
+    /// Last number (integer or decimal) in a file name's stem
+    static bool parseFrameNumber(const std::string& file_name, double& value);
+
+private:
+    struct Frame {
+        std::string path;
+        double time_s;
+        std::shared_ptr<const CFDInterface> data;
+        uint64_t last_use;
+    };
+
+    std::vector<Frame> frames_;
+    size_t max_resident_;
+    size_t resident_;
+    uint64_t use_clock_;
+    CFDTimeSeriesStats stats_;
+
+    /// Frames i0 <= i1 around t and blend weight of i1
+    void bracket(double t, size_t& i0, size_t& i1, double& alpha) const;
+    void evictExcept(size_t keep0, size_t keep1);
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_CFD_TIME_SERIES_H
@@ -0,0 +1,86 @@
+/**
+ * @file Crc32.h
+ * @brief CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+ *
+ * Shared by the run signatures in Simulation.cpp and the chunk checksums of
+ * binary telemetry recordings. crc32_update(0, p, n) is the standard CRC-32
+ * of n bytes, and feeding a buffer in pieces gives the same result as
+ * feeding it at once.
+ *
+ * Short inputs run inline with slicing-by-8 over constexpr tables (8 bytes
+ * per step, no initialization at run time). Inputs of kCrc32FoldMinBytes or
+ * more call out to Crc32.cpp, which folds 64 bytes per step with carry-less
+ * multiplies (PCLMULQDQ) when the CPU has them; note SSE4.2's crc32
+ * instruction computes CRC-32C, a different polynomial, so it is not used.
+ * No mutable state: safe to call from any number of threads.
+ */
+
+#ifndef CHEMSI_CRC32_H
+#define CHEMSI_CRC32_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace vfep {
+
+/// Inputs at least this long take the folded (out-of-line) path
+constexpr std::size_t kCrc32FoldMinBytes = 128;
+
+namespace detail {
+
+using Crc32Tables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+constexpr Crc32Tables makeCrc32Tables() {
+    Crc32Tables t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        t[0][i] = c;
+    }
+    // t[k][i]: CRC of byte i followed by k zero bytes
+    for (std::size_t k = 1; k < 8; ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+            t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFFu];
+        }
+    }
+    return t;
+}
+
+inline constexpr Crc32Tables kCrc32Tables = makeCrc32Tables();
+
+/// Slicing-by-8 on the inverted register `c` (no pre/post conditioning)
+inline std::uint32_t crc32Slice8(std::uint32_t c, const std::uint8_t* p, std::size_t len) {
+    const auto& t = kCrc32Tables;
+    for (; len >= 8; p += 8, len -= 8) {
+        const std::uint32_t lo = c ^ (std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 |
+                                      std::uint32_t(p[2]) << 16 | std::uint32_t(p[3]) << 24);
+        c = t[7][lo & 0xFFu] ^ t[6][(lo >> 8) & 0xFFu] ^ t[5][(lo >> 16) & 0xFFu] ^ t[4][lo >> 24] ^
+            t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+    }
+    for (; len > 0; ++p, --len) {
+        c = t[0][(c ^ *p) & 0xFFu] ^ (c >> 8);
+    }
+    return c;
+}
+
+/// Folded path for len >= kCrc32FoldMinBytes (Crc32.cpp); same contract as crc32Slice8
+std::uint32_t crc32Folded(std::uint32_t c, const std::uint8_t* p, std::size_t len);
+
+} // namespace detail
+
+inline std::uint32_t crc32_update(std::uint32_t crc, const void* data, std::size_t len) {
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(data);
+    std::uint32_t c = crc ^ 0xFFFFFFFFu;
+    c = len >= kCrc32FoldMinBytes ? detail::crc32Folded(c, p, len) : detail::crc32Slice8(c, p, len);
+    return c ^ 0xFFFFFFFFu;
+}
+
+/// True if crc32_update uses carry-less multiply folding on this CPU
+bool crc32Accelerated();
+
+} // namespace vfep
+
+#endif // CHEMSI_CRC32_H
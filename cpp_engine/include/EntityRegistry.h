@@ -0,0 +1,135 @@
+#pragma once
+
+#include "ObjectModel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vfep {
+namespace obj {
+
+// Dense, handle-indexed view of the entities the mechanics tick touches.
+//
+// ObjectStore keys everything by string, which is convenient for config
+// and RPCs but means hashing in every inner loop. The registry interns each
+// ID once to a per-type uint32 handle, keeps the per-tick state in
+// contiguous arrays (one array per field), and precomputes the relations
+// the tick follows (vfep -> tank/interlock/coverage racks, rack -> open
+// incident), so a tick is a set of linear scans.
+//
+// The registry also keeps pointers to the store entries it mirrors:
+// load() copies the dynamic fields store -> arrays, save() copies them back
+// (and adds incidents the tick opened). Neither hashes. Rebuild after
+// adding or erasing entities in the store.
+
+constexpr std::uint32_t kNoHandle = 0xFFFFFFFFu;
+
+// String ID <-> dense handle for one entity type
+class IdTable {
+public:
+    std::uint32_t intern(const std::string& id);
+    std::uint32_t find(const std::string& id) const;  // kNoHandle if absent
+    const std::string& id(std::uint32_t handle) const { return ids_[handle]; }
+    std::uint32_t size() const { return static_cast<std::uint32_t>(ids_.size()); }
+    void clear();
+
+private:
+    std::unordered_map<std::string, std::uint32_t> index_;
+    std::vector<std::string> ids_;
+};
+
+struct RackComponents {
+    IdTable ids;                              // Racks with telemetry
+    std::vector<std::uint8_t> on_fire;
+    std::vector<double> surface_temp_C;
+    std::vector<double> risk_pct;
+    std::vector<std::uint32_t> open_incident; // Incident handle or kNoHandle
+    std::vector<std::uint8_t> suppressing;    // A VFEP discharged onto it this tick (not saved)
+    std::vector<double> agent_flow_kg_s;      // External fire model's delivered agent (not saved)
+    std::vector<std::string> room_id;         // Only read when an incident opens
+    std::vector<RackTelemetry*> store;
+};
+
+struct ArmComponents {
+    IdTable ids;                              // Arms with config and telemetry
+    std::vector<double> parking_s, s_min, s_max, v_max, a_max;
+    std::vector<double> s, v, target_s;
+    std::vector<std::uint8_t> has_target;
+    std::vector<ArmDeploymentState> state;
+    std::vector<ArmTelemetry*> store;
+};
+
+struct NozzleComponents {
+    IdTable ids;                              // Nozzles with config and telemetry
+    std::vector<double> pan_min, pan_max, tilt_min, tilt_max;
+    std::vector<double> pan, tilt, target_pan, target_tilt;
+    std::vector<std::uint8_t> has_target;
+    std::vector<NozzleTelemetry*> store;
+};
+
+struct TankComponents {
+    IdTable ids;
+    std::vector<double> initial_mass_kg, regulator_setpoint_bar;
+    std::vector<double> pressure_bar, regulator_bar, remaining_kg, flow_kg_s;
+    std::vector<std::uint8_t> depleted, discharging;
+    std::vector<TankTelemetry*> store;
+};
+
+struct VFEPComponents {
+    IdTable ids;
+    std::vector<std::uint8_t> suppression_active;
+    std::vector<std::uint32_t> selected_rack;     // Rack handle or kNoHandle
+    std::vector<std::uint32_t> tank;              // First tank of the VFEP
+    std::vector<std::uint32_t> interlock;         // First interlock of the VFEP
+    std::vector<std::uint32_t> coverage_begin;    // CSR into coverage_racks (size n + 1)
+    std::vector<std::uint32_t> coverage_racks;
+    std::vector<std::string> selected_rack_id;    // Last resolved selection
+    std::vector<VFEPConfig*> store;
+};
+
+struct InterlockComponents {
+    IdTable ids;
+    std::vector<std::uint8_t> allow_arm, allow_suppress;
+    std::vector<std::uint64_t> updated_ms;
+    std::vector<InterlockStatus*> store;
+};
+
+struct IncidentComponents {
+    IdTable ids;
+    std::vector<std::uint32_t> rack;              // Rack handle or kNoHandle
+    std::vector<IncidentState> state;
+    std::vector<double> started_at_s, resolved_at_s;
+    std::vector<Incident*> store;                 // nullptr until save() adds it
+};
+
+class EntityRegistry {
+public:
+    // Index `store` (which must outlive the registry) and load its state
+    void build(ObjectStore& store);
+    bool built() const { return store_ != nullptr; }
+
+    // store -> arrays (e.g. after commands edited the store)
+    void load();
+    // arrays -> store; new incidents are upserted
+    void save();
+
+    // Open an incident for a rack (mechanics tick; not yet in the store)
+    std::uint32_t openIncident(std::uint32_t rack, double sim_time_s);
+
+    RackComponents racks;
+    ArmComponents arms;
+    NozzleComponents nozzles;
+    TankComponents tanks;
+    VFEPComponents vfeps;
+    InterlockComponents interlocks;
+    IncidentComponents incidents;
+
+private:
+    ObjectStore* store_ = nullptr;
+};
+
+} // namespace obj
+} // namespace vfep
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "EntityRegistry.h"
+#include "Simulation.h"
+#include "WorkerPool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vfep {
+namespace mech {
+
+// Couples the high-fidelity vfep::Simulation to the mechanics tick: every
+// burning rack owns one Simulation (one rack-scale reactor), and the rack's
+// telemetry comes from its Observation instead of the fixed cooling model.
+//
+// Per tick: racks that caught fire get a Simulation (reset to the
+// data-center rack scenario and ignited), racks that a VFEP is discharging
+// onto (RackComponents::suppressing, set by tick_suppression) get agent
+// delivery, and all active Simulations are stepped by dt in parallel on a
+// persistent WorkerPool (the step already runs on a WorldHost worker, so
+// starting threads per tick would oversubscribe a host with many worlds).
+// Each Simulation is independent, so the result does not depend on the
+// thread count. Mapping back:
+//   surface_temp_C  <- T_K - 273.15
+//   risk_pct        <- HRR_W as a share of full_risk_HRR_W
+//   agent_flow_kg_s <- agent_mdot_kgps while suppressing (the tanks draw this)
+// A suppressed fire whose HRR grew past extinguished_HRR_W and then fell
+// back below it (or whose Simulation concludes) is out: the rack stops
+// burning, its open incident is resolved, and the Simulation goes back to a
+// pool. Constructing a Simulation is ~100x the cost of stepping one, so
+// they are reused.
+//
+// Use with MechanicsParams::external_rack_fire = true and call step() after
+// mech::tick() and before reg.save().
+struct FireBridgeParams {
+    double max_substep_s = 0.05;          // Longest single Simulation::step
+    double extinguished_HRR_W = 10000.0;  // Suppressed fire below this is out
+    double full_risk_HRR_W = 250000.0;    // HRR that maps to 100 % risk
+    std::size_t min_fires_per_thread = 8; // Parallel grain
+    WorkerPool* pool = nullptr;           // nullptr: WorkerPool::shared()
+};
+
+class FireSimBridge {
+public:
+    explicit FireSimBridge(FireBridgeParams p = {});
+
+    FireSimBridge(const FireSimBridge&) = delete;
+    FireSimBridge& operator=(const FireSimBridge&) = delete;
+
+    void step(vfep::obj::EntityRegistry& reg, double sim_time_s, double dt);
+
+    // Drop all fires (e.g. after the registry was rebuilt); keeps the pool
+    void clear();
+
+    std::size_t activeFires() const { return fires_.size(); }
+    std::size_t pooledSimulations() const { return pool_.size(); }
+
+    // Simulation of a burning rack, or nullptr
+    const vfep::Simulation* simulationFor(std::uint32_t rack) const;
+
+private:
+    struct Fire {
+        std::uint32_t rack = vfep::obj::kNoHandle;
+        std::unique_ptr<vfep::Simulation> sim;  // nullptr until started
+        bool started = false;
+        bool suppressing = false;
+        bool suppressed = false;  // Ever received agent
+        bool developed = false;   // HRR reached extinguished_HRR_W
+        bool out = false;
+        vfep::Observation obs;
+    };
+
+    FireBridgeParams p_;
+    std::vector<Fire> fires_;
+    std::vector<std::uint32_t> fire_of_rack_;  // Index into fires_ or kNoHandle
+    std::vector<std::unique_ptr<vfep::Simulation>> pool_;
+};
+
+} // namespace mech
+} // namespace vfep
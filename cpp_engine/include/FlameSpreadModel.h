@@ -9,13 +9,16 @@
  * - Surface flame propagation
  * - Heat feedback to fire growth model
  * - Material property handling (HRRPUA)
- * 
- * TODO: Implementation
+ * - Event-queue ignition prediction (surfaces are only re-evaluated when
+ *   their neighborhood flux changes or their predicted ignition time arrives)
  */
 
 #ifndef CHEMSI_FLAME_SPREAD_MODEL_H
 #define CHEMSI_FLAME_SPREAD_MODEL_H
 
+#include <cstdint>
+#include <queue>
+#include <unordered_map>
 #include <vector>
 
 namespace vfep {
@@ -63,15 +66,59 @@ public:
     // Status queries
     bool isSurfaceBurning(int surface_id) const;
     int getNumBurningSurfaces() const;
-    
-    // TODO: Full implementation
+    int getNumSurfaces() const { return static_cast<int>(surfaces_.size()); }
+    float getSurfaceTemperature(int surface_id) const;
+
+    // Ignition prediction
+    // Seconds until the surface is predicted to reach its ignition threshold
+    // under the current incident flux (+infinity if it is not heating).
+    float getTimeToIgnition(int surface_id) const;
+    float getIncidentHeatFluxWm2(int surface_id) const;
+    double getModelTime() const { return time_s_; }
     
 private:
+    struct Neighbor {
+        int id;
+        float view_coeff;          // 1 / (4*pi*r^2), r clamped to MIN_SPREAD_DISTANCE
+    };
+
+    struct IgnitionEvent {
+        double time_s;
+        int surface_id;
+        uint32_t generation;
+        bool operator>(const IgnitionEvent& o) const {
+            if (time_s != o.time_s) return time_s > o.time_s;
+            return surface_id > o.surface_id;
+        }
+    };
+
     std::vector<FlammableSurface> surfaces_;
-    
-    void checkIgnitionCriteria(float dt);
-    bool canIgnite(int surface_id) const;
-    void propagateFlame(float dt);
+
+    // Per-surface event state (indexed by surface ID)
+    std::vector<std::vector<Neighbor>> neighbors_;
+    std::vector<float> incident_flux_W_m2_;   // Sum over burning neighbors
+    std::vector<int> burning_neighbors_;      // Count of burning neighbors
+    std::vector<double> temp_ref_time_s_;     // Time at which temperature_K was last materialized
+    std::vector<float> published_power_W_;    // Source power last pushed to neighbors
+    std::vector<uint32_t> generation_;        // Invalidates stale queue entries
+    std::vector<int> burning_slot_;           // Index into burning_ids_ or -1
+
+    std::vector<int> burning_ids_;
+    std::priority_queue<IgnitionEvent, std::vector<IgnitionEvent>,
+                        std::greater<IgnitionEvent>> ignition_queue_;
+    std::unordered_map<int64_t, std::vector<int>> spatial_grid_;
+    double time_s_ = 0.0;
+
+    void linkNeighbors(int surface_id);
+    void setBurning(int surface_id, bool burning);
+    void publishSourcePower(int surface_id, float power_W);
+    float sourcePower(int surface_id) const;
+
+    float heatingRate(int surface_id) const;
+    float ignitionThreshold(int surface_id) const;
+    void materializeTemperature(int surface_id);
+    void predictIgnition(int surface_id);
+    void processIgnitionQueue();
 };
 
 } // namespace vfep
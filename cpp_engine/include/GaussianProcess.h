@@ -0,0 +1,74 @@
+/**
+ * @file GaussianProcess.h
+ * @brief Small Gaussian-process regressor for surrogate-assisted UQ
+ *
+ * Ordinary kriging - a constant mean estimated by generalized least squares,
+ * its uncertainty included in the predictive variance - with a
+ * squared-exponential kernel, one length scale per input (ARD). Inputs are expected in the unit
+ * cube. The signal variance is profiled out of the likelihood, and the
+ * length scales are fitted by coordinate search on a log grid of the
+ * concentrated log marginal likelihood - enough for the tens of points a
+ * UQ design produces, with no optimizer dependency. The nugget (noise
+ * variance relative to the signal) is searched by decades alongside them:
+ * near 1e-8 the GP interpolates, larger values let it smooth a response
+ * that is rough on the scale of the design - time-stepped event times, for
+ * instance. It also grows automatically if the factorization fails.
+ */
+
+#ifndef CHEMSI_GAUSSIAN_PROCESS_H
+#define CHEMSI_GAUSSIAN_PROCESS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace vfep {
+
+class GaussianProcess {
+public:
+    GaussianProcess() = default;
+
+    /**
+     * @brief Fit hyperparameters and condition on n points
+     * @param x n x dim inputs, row-major
+     * @throws std::invalid_argument if the shapes disagree, n is 0 or a value is not finite
+     */
+    void fit(const std::vector<double>& x, size_t dim, const std::vector<double>& y);
+
+    /// Condition on one more point, keeping the fitted hyperparameters
+    void addPoint(const double* x, double y);
+
+    size_t size() const { return y_.size(); }
+    size_t dim() const { return dim_; }
+    const std::vector<double>& lengthScales() const { return length_; }
+    double signalVariance() const { return sigma2_; }
+    double noiseVariance() const { return sigma2_ * nugget_; }
+
+    /// Posterior mean and variance of the latent function at x (dim values); add
+    /// noiseVariance() for the spread of a new observation
+    void predict(const double* x, double& mean, double& variance) const;
+
+    /// Root-mean-square leave-one-out residual (closed form, mean and hyperparameters held fixed)
+    double leaveOneOutRmse() const;
+
+private:
+    size_t dim_ = 0;
+    std::vector<double> x_;       // n x dim
+    std::vector<double> y_;
+    std::vector<double> length_;
+    double nugget_ = 1e-8;
+    double mean_ = 0.0;
+    double sigma2_ = 1.0;
+    std::vector<double> chol_;    // Lower Cholesky factor of R + nugget I, n x n
+    std::vector<double> alpha_;   // (R + nugget I)^-1 (y - mean)
+    std::vector<double> rinv_one_;  // (R + nugget I)^-1 1, for the mean's share of the variance
+    double one_rinv_one_ = 1.0;
+
+    double correlation(const double* a, const double* b) const;
+    bool factor();                               // false if not positive definite
+    double concentratedNegLogLikelihood();       // Factors with the current length scales
+    void condition();                            // Factor, growing the nugget until it succeeds
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_GAUSSIAN_PROCESS_H
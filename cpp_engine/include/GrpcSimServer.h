@@ -4,27 +4,66 @@
 #include "MechanicsSim.h"
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
-#include <thread>
 
 namespace vfep {
 namespace grpcsim {
 
-// Simple synchronous gRPC server wrapper.
+// gRPC server wrapper (callback API).
 // Intended for Unity integration (Option B: gRPC + Protobuf) and streaming telemetry.
+// Hosts many worlds (training / what-if sessions) on one port: each has its
+// own store, clock and telemetry, addressed by world_id ("default" when
+// empty), and all are ticked by a shared worker pool (see WorldHost.h).
+// Slow clients skip ticks (drop-to-latest) instead of buffering them.
 class GrpcSimServer {
 public:
     GrpcSimServer();
     ~GrpcSimServer();
 
-    // Starts the server and a fixed-timestep sim thread.
+    // Starts the server with the "default" world ticking at tick_hz (also
+    // the rate for created worlds that do not ask for one).
     // Blocks until Stop() is called (or process exits).
     bool Run(const std::string& bind_addr, int port, int tick_hz);
 
     void Stop();
 
+    // Cap on frames per second per telemetry stream (0 = every tick).
+    // Call before Run().
+    void setMaxStreamHz(double hz);
+
+    // Worker threads shared by all worlds (0 = one per hardware thread).
+    // Call before Run().
+    void setWorkerThreads(std::size_t n);
+
+    // Cap on hosted worlds and on any world's tick rate. Call before Run().
+    void setWorldLimits(std::size_t max_worlds, double max_tick_hz);
+
+    // Run the high-fidelity Simulation for burning racks in the default
+    // world (created worlds ask for it per world). Call before Run().
+    void setDefaultFireSim(bool enabled);
+
+    // Tick timing over all worlds. Workers own a world's ObjectStore while
+    // stepping it; RPCs read published snapshots and queue commands, which
+    // are applied at the start of the world's next step.
+    struct LoopStats {
+        std::uint64_t ticks = 0;
+        std::uint64_t overruns = 0;          // Paced ticks started more than one period late
+        double tick_jitter_p50_us = 0.0;     // Actual minus scheduled start (paced ticks)
+        double tick_jitter_p99_us = 0.0;
+        double tick_jitter_max_us = 0.0;
+        std::uint64_t commands = 0;
+        double command_latency_p50_us = 0.0; // SendCommand enqueue to applied
+        double command_latency_p99_us = 0.0;
+        double command_latency_max_us = 0.0;
+        std::size_t subscribers = 0;         // Open telemetry streams
+        std::size_t worlds = 0;
+        std::size_t ticking_worlds = 0;      // Worlds with subscribers (or queued commands)
+    };
+    LoopStats loopStats() const;  // Safe to call from any thread
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
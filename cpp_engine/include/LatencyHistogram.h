@@ -0,0 +1,52 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Lock-free log-linear histogram for timing percentiles
+ *
+ * Values (nanoseconds) fall into power-of-two ranges, each split into
+ * 16 linear sub-buckets, so any recorded value is reported within ~6%.
+ * record() is a few relaxed atomic increments and may be called from any
+ * thread; percentile queries scan the buckets and may run concurrently
+ * (they see a slightly stale but consistent-enough view).
+ */
+
+#ifndef CHEMSI_LATENCY_HISTOGRAM_H
+#define CHEMSI_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace vfep {
+
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    void record(uint64_t value_ns);
+    void reset();
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    double mean() const;
+
+    /// Value at quantile q in [0, 1] (bucket midpoint); 0 when empty
+    uint64_t percentile(double q) const;
+
+    /// Bucket index for a value, and the [lo, hi] range it covers
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketLow(size_t index);
+    static uint64_t bucketHigh(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_LATENCY_HISTOGRAM_H
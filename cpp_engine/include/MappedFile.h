@@ -0,0 +1,53 @@
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory-mapped file (POSIX mmap / Win32 file mapping)
+ *
+ * Used by the geometry and CFD importers so large binary inputs can be
+ * parsed in place without copying through iostreams.
+ */
+
+#ifndef CHEMSI_MAPPED_FILE_H
+#define CHEMSI_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace vfep {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map the whole file read-only
+     * @return false if the file cannot be opened or mapped (empty files map
+     *         successfully with size() == 0)
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return is_open_; }
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_MAPPED_FILE_H
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "EntityRegistry.h"
 #include "ObjectModel.h"
+#include "WorkerPool.h"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -13,12 +16,28 @@ struct MechanicsParams {
     double nozzle_slew_deg_per_s = 90.0;   // simple slew
     double cooling_degC_per_s = 15.0;      // rack cooling when suppressing
     double risk_reduction_pct_per_s = 12.0;
+    // Per-subsystem loops split across threads once they reach this many
+    // entities per worker; the default keeps small stores single-threaded.
+    // A whole tick costs ~7 ns per rack and a pool dispatch a few us, so a
+    // chunk this size keeps dispatch well under a fifth of its work.
+    std::size_t min_entities_per_thread = 16384;
+    vfep::WorkerPool* pool = nullptr;      // Runs those loops; nullptr: WorkerPool::shared()
+    // Rack fire state comes from an external model (FireSimBridge): the
+    // tick only routes agent to racks, and tanks draw the agent flow that
+    // model reported on the previous tick.
+    bool external_rack_fire = false;
+    double agent_flow_kg_s = 0.5;          // per discharging VFEP (built-in model)
 };
 
 // Returns current wallclock ms (helper for traceability fields).
 std::uint64_t now_ms();
 
-// Applies a single fixed timestep update in-place.
+// Applies a single fixed timestep update to the registry's arrays (no
+// string lookups). Call reg.save() to publish the result to the store.
+void tick(vfep::obj::EntityRegistry& reg, double sim_time_s, double dt, const MechanicsParams& p);
+
+// Applies a single fixed timestep update in-place. Indexes the store on
+// every call; loops should keep an EntityRegistry instead.
 void tick(vfep::obj::ObjectStore& store, double sim_time_s, double dt, const MechanicsParams& p);
 
 } // namespace mech
@@ -0,0 +1,114 @@
+/**
+ * @file MlpSurrogate.h
+ * @brief Native inference for the surrogate MLP trained in python_interface
+ *
+ * Loads the JSON written by SurrogateModel.save() (surrogate_model.py):
+ * weights[k] is fan_in x fan_out, biases[k] fan_out, plus input/output
+ * standardization and - for models saved by current trainers - the
+ * input_min/input_max of the training data. Hidden layers use the saved
+ * activation (relu, tanh or identity); the output layer is linear, as in
+ * SurrogateModel._forward.
+ *
+ * Evaluation is batched: samples are processed kSurrogateLanes at a time
+ * with activations laid out neuron-major, so each weight is broadcast once
+ * across the block. Weights and activations are float32 and the AVX2/FMA
+ * kernel is chosen at runtime (surrogateAccelerated()); the portable kernel
+ * sums in the same order but rounds separately, so the two agree to float
+ * precision. Standardization and the output transform stay in double.
+ *
+ * A surrogate is only trusted inside its training envelope; predictOrRun
+ * routes samples outside it to a caller-supplied full simulation.
+ */
+
+#ifndef CHEMSI_MLP_SURROGATE_H
+#define CHEMSI_MLP_SURROGATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace vfep {
+
+constexpr size_t kSurrogateLanes = 8;
+
+/// True when the AVX2/FMA kernel is in use on this CPU
+bool surrogateAccelerated();
+
+class MlpSurrogate {
+public:
+    enum class Activation { Identity, Relu, Tanh };
+
+    /// Fallback for one sample outside the envelope: inputs -> outputs
+    using FullSimulation = std::function<void(const double* inputs, double* outputs)>;
+
+    MlpSurrogate() = default;
+
+    /**
+     * @brief Load a SurrogateModel.save() file
+     * @return false if the file cannot be read, is not valid JSON, or does not
+     *         describe a trained model with consistent shapes; error gets the reason
+     */
+    bool loadFile(const std::string& path, std::string* error = nullptr);
+    bool loadJson(const std::string& text, std::string* error = nullptr);
+
+    bool loaded() const { return !layers_.empty(); }
+    size_t inputCount() const { return input_mean_.size(); }
+    size_t outputCount() const { return output_mean_.size(); }
+    const std::vector<std::string>& inputNames() const { return input_names_; }
+    const std::vector<std::string>& outputNames() const { return output_names_; }
+    Activation activation() const { return activation_; }
+
+    /// Index of a named output, or outputCount() if absent
+    size_t outputIndex(const std::string& name) const;
+
+    /**
+     * @brief Training envelope per input: input_min/input_max when saved,
+     *        else mean +- envelopeSigmas() standard deviations
+     */
+    double envelopeLow(size_t input) const { return env_lo_[input]; }
+    double envelopeHigh(size_t input) const { return env_hi_[input]; }
+    static constexpr double envelopeSigmas() { return 3.0; }
+
+    /// Widen (margin > 0) or shrink the envelope by a fraction of its span
+    void setEnvelopeMargin(double fraction_of_span);
+
+    bool inEnvelope(const double* inputs) const;
+
+    /**
+     * @brief Evaluate `rows` samples (row-major inputs, row-major outputs)
+     * @throws std::logic_error if no model is loaded
+     */
+    void predictBatch(const double* inputs, size_t rows, double* outputs) const;
+    void predict(const double* inputs, double* outputs) const { predictBatch(inputs, 1, outputs); }
+
+    /**
+     * @brief predictBatch, but rows outside the envelope go to full_sim
+     * @param used_surrogate optional per-row flag (1 = surrogate, 0 = full_sim)
+     * @return rows sent to full_sim
+     */
+    size_t predictOrRun(const double* inputs, size_t rows, double* outputs, const FullSimulation& full_sim,
+                        uint8_t* used_surrogate = nullptr) const;
+
+private:
+    struct Layer {
+        size_t in = 0;
+        size_t out = 0;
+        std::vector<float> w;  // out x in: one contiguous row per output neuron
+        std::vector<float> b;
+    };
+
+    std::vector<Layer> layers_;
+    Activation activation_ = Activation::Relu;
+    size_t max_width_ = 0;
+    std::vector<double> input_mean_, input_inv_std_;
+    std::vector<double> output_mean_, output_std_;
+    std::vector<double> env_lo_, env_hi_;
+    std::vector<double> trained_lo_, trained_hi_;
+    std::vector<std::string> input_names_, output_names_;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_MLP_SURROGATE_H
@@ -0,0 +1,98 @@
+/**
+ * @file MpscQueue.h
+ * @brief Lock-free multi-producer / single-consumer queue
+ *
+ * Intrusive linked-list queue (Vyukov): push() is one atomic exchange plus
+ * one release store, so producers never wait on each other or on the
+ * consumer. Only one thread may call pop(). A pop() racing a push() that
+ * has swapped the head but not yet linked its node returns false; the item
+ * shows up on the next pop(), which is fine for per-tick draining.
+ */
+
+#ifndef CHEMSI_MPSC_QUEUE_H
+#define CHEMSI_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+namespace vfep {
+
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    ~MpscQueue() {
+        T discard;
+        while (pop(discard)) {}
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /// Any thread
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /// Consumer thread only. Returns false if the queue is (momentarily) empty.
+    bool pop(T& out) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (!next) return false;
+            tail_ = next;
+            tail = next;
+            next = tail->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            tail_ = next;
+            out = std::move(tail->value);
+            delete tail;
+            return true;
+        }
+        if (tail != head_.load(std::memory_order_acquire)) {
+            return false;  // Producer between exchange and link
+        }
+        // Last node: re-insert the stub so it can be detached
+        stub_.next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = head_.exchange(&stub_, std::memory_order_acq_rel);
+        prev->next.store(&stub_, std::memory_order_release);
+        next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        tail_ = next;
+        out = std::move(tail->value);
+        delete tail;
+        return true;
+    }
+
+    /// Pop everything currently visible; returns the number of items handled
+    template <typename Fn>
+    size_t drain(Fn&& fn) {
+        size_t n = 0;
+        T item;
+        while (pop(item)) {
+            fn(std::move(item));
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        explicit Node(T v) : value(std::move(v)) {}
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    alignas(64) std::atomic<Node*> head_;  // Producers
+    alignas(64) Node* tail_;               // Consumer
+    Node stub_;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_MPSC_QUEUE_H
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <cstddef>
 #include <cstdint>
 
 namespace vfep {
@@ -361,5 +362,10 @@ std::unordered_map<std::string, DataCenterRoomTelemetry> room_telemetry;
 
 ObjectStore makeDefault4x4ObjectStore();
 
+// Mechanics-only store of arbitrary size for scaling tests and benchmarks:
+// racks on a grid, one VFEP (tank, interlock, two arms/nozzles) per
+// `racks_per_vfep` racks. No sensors, cameras or catalog objects.
+ObjectStore makeSyntheticObjectStore(std::size_t rack_count, std::size_t racks_per_vfep = 16);
+
 } // namespace obj
 } // namespace vfep
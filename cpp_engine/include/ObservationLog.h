@@ -0,0 +1,122 @@
+/**
+ * @file ObservationLog.h
+ * @brief Asynchronous VFEP_Sim run log (CSV, flat binary or columnar recording)
+ *
+ * The simulation thread only copies each logged Observation into a
+ * lock-free SPSC ring; a writer thread drains the ring, formats rows and
+ * writes them in large blocks. Formats:
+ *
+ *   csv           The classic high_fidelity_ml.csv columns, formatted with
+ *                 std::to_chars (byte-identical to std::fixed with
+ *                 setprecision(6))
+ *   bin           "VFEPLOG1", column count, 32-byte column names, then one
+ *                 little-endian float64 per column per row - readable with
+ *                 numpy.fromfile(path, '<f8', offset=dataOffset())
+ *   parquet-lite  A TelemetryRecording (Observation schema): columnar,
+ *                 compressed chunks with a time index
+ *
+ * Rows are never dropped: if the writer is a whole ring behind, push()
+ * yields until a slot frees up (counted in producerStalls()).
+ */
+
+#ifndef CHEMSI_OBSERVATION_LOG_H
+#define CHEMSI_OBSERVATION_LOG_H
+
+#include "Simulation.h"
+#include "SpscRing.h"
+#include "TelemetryRecording.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vfep {
+
+enum class ObservationLogFormat {
+    Csv,
+    Binary,
+    ParquetLite,
+};
+
+/// "csv", "bin" or "parquet-lite"; false for anything else
+bool parseObservationLogFormat(const std::string& name, ObservationLogFormat& out);
+
+/// Conventional file extension for a format (".csv", ".bin", ".vfrec")
+const char* observationLogExtension(ObservationLogFormat format);
+
+class ObservationLogWriter {
+public:
+    /// Row in the simulation-to-writer ring
+    struct Row {
+        double t_s = 0.0;
+        Observation obs;
+    };
+
+    /**
+     * @param ring_capacity rows the simulation may run ahead of the writer
+     * @throws std::invalid_argument if ring_capacity is 0
+     */
+    explicit ObservationLogWriter(size_t ring_capacity = 4096);
+    ~ObservationLogWriter();
+
+    ObservationLogWriter(const ObservationLogWriter&) = delete;
+    ObservationLogWriter& operator=(const ObservationLogWriter&) = delete;
+
+    /**
+     * @brief Create (truncate) the log and start the writer thread
+     * @return false if the file cannot be created or a log is open
+     */
+    bool open(const std::string& path, ObservationLogFormat format);
+
+    /// Simulation thread; no-op while no log is open
+    void push(double t_s, const Observation& obs);
+
+    /**
+     * @brief Write every queued row, flush and join the writer
+     * @return false if any write failed
+     */
+    bool close();
+
+    bool isOpen() const { return thread_.joinable(); }
+    ObservationLogFormat format() const { return format_; }
+    uint64_t rowsPushed() const { return rows_pushed_; }
+    uint64_t rowsWritten() const { return rows_written_.load(); }
+    uint64_t producerStalls() const { return stalls_; }
+
+    /// CSV / binary column names, in file order
+    static const std::vector<std::string>& columnNames();
+
+    /// Byte offset of the first row in a binary log
+    static size_t dataOffset();
+
+private:
+    void writerLoop();
+    void writeRow(const Row& row);
+    void flushBuffer();
+
+    SpscRing<Row> ring_;
+    ObservationLogFormat format_ = ObservationLogFormat::Csv;
+    std::atomic<bool> closing_{false};
+    std::thread thread_;
+
+    // Producer side
+    uint64_t rows_pushed_ = 0;
+    uint64_t stalls_ = 0;
+
+    // Writer thread only (until joined)
+    std::ofstream out_;
+    std::vector<char> buf_;
+    size_t used_ = 0;
+    TelemetryRecorder recorder_;
+
+    std::atomic<uint64_t> rows_written_{0};
+    std::atomic<bool> failed_{false};
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_OBSERVATION_LOG_H
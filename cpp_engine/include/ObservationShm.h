@@ -0,0 +1,200 @@
+/**
+ * @file ObservationShm.h
+ * @brief Shared-memory ring of Observation frames for co-located readers
+ *
+ * The simulation publishes every Observation into a fixed ring in a
+ * memory-mapped file (on Linux, a path under /dev/shm keeps it in RAM).
+ * Readers - ObservationShmReader, a dashboard, or numpy.memmap via
+ * python_interface/observation_shm.py - map the same file read-only and
+ * consume frames in place: no file I/O, no serialization.
+ *
+ * Layout (little-endian, version kObservationShmVersion):
+ *
+ *   [0, kObservationShmHeaderBytes)  ObservationShmHeader, then
+ *                                    field_count ObservationShmField
+ *                                    descriptors at descriptor_offset
+ *   then capacity slots of slot_bytes: uint64 seq + ObservationFrameV1
+ *
+ * ObservationFrameV1 is generated from the CHEMSI_OBSERVATION_FRAME_V1_*
+ * lists below, which name Observation members in Simulation.h; every
+ * column is float64 (integer and bool members are converted), sector
+ * arrays become name_0 .. name_3. Appending to the lists is the only
+ * compatible change; anything else bumps the version. The descriptors
+ * make the file self-describing, and layout_hash lets a reader reject a
+ * layout it was not built for.
+ *
+ * Frame n goes to slot n % capacity. Its seq is 2n+1 while being written
+ * and 2n+2 once complete, and the header's `published` counter becomes
+ * n+1 after that. A reader copies a frame and accepts it only if seq was
+ * 2n+2 both before and after the copy (a seqlock), so the writer never
+ * waits: a reader more than `capacity` frames behind loses the oldest
+ * frames and can tell how many.
+ */
+
+#ifndef CHEMSI_OBSERVATION_SHM_H
+#define CHEMSI_OBSERVATION_SHM_H
+
+#include "Simulation.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scalar Observation members, in frame order
+#define CHEMSI_OBSERVATION_FRAME_V1_FIELDS(X) \
+    X(T_K) X(HRR_W) X(O2_volpct) X(CO2_volpct) X(H2O_volpct) X(fuel_kg) \
+    X(inhibitor_kgm3) X(inert_kgm3) X(ACH) X(agent_mdot_kgps) \
+    X(hotspot_pos_m_x) X(hotspot_pos_m_y) X(hotspot_pos_m_z) \
+    X(vfep_rpm) X(hit_efficiency_0_1) \
+    X(spray_dir_unit_x) X(spray_dir_unit_y) X(spray_dir_unit_z) \
+    X(draft_vel_mps_x) X(draft_vel_mps_y) X(draft_vel_mps_z) \
+    X(jet_momentum_N) X(draft_drag_N) \
+    X(delivered_mdot_kgps) X(net_delivered_mdot_kgps) X(exposure_kg) X(knockdown_0_1) \
+    X(raw_HRR_W) X(effective_HRR_W) X(suppression_regime) \
+    X(utilization_U_0_1) X(effective_exposure_kg) X(EC50_adj_kg) X(agent_type) \
+    X(occ_avg_0_1) X(occ_max_0_1) X(loa_avg_0_1) X(loa_min_0_1) \
+    X(sum_raw_mdot_kgps) X(sum_net_mdot_kgps) \
+    X(blocked_sector_count) X(shielded_sector_count) X(glancing_sector_count) X(direct_sector_count) \
+    X(headline_state) X(warn_fully_blocked) X(warn_glancing_hold) X(reward)
+
+// Per-sector Observation arrays (Observation::kNumSuppressionSectors each)
+#define CHEMSI_OBSERVATION_FRAME_V1_SECTOR_FIELDS(X) \
+    X(sector_delivered_mdot_kgps) X(sector_exposure_kg) X(sector_knockdown_0_1) \
+    X(sector_occlusion_0_1) X(sector_line_attack_0_1) X(sector_net_delivered_mdot_kgps) \
+    X(sector_shield_0_1) X(sector_raw_delivered_mdot_kgps) X(sector_knockdown_target_0_1)
+
+namespace vfep {
+
+constexpr uint32_t kObservationShmVersion = 1;
+constexpr size_t kObservationShmHeaderBytes = 8192;
+
+struct ObservationFrameV1 {
+    double t_s;
+#define CHEMSI_FRAME_SCALAR(name) double name;
+#define CHEMSI_FRAME_SECTOR(name) double name[Observation::kNumSuppressionSectors];
+    CHEMSI_OBSERVATION_FRAME_V1_FIELDS(CHEMSI_FRAME_SCALAR)
+    CHEMSI_OBSERVATION_FRAME_V1_SECTOR_FIELDS(CHEMSI_FRAME_SECTOR)
+#undef CHEMSI_FRAME_SCALAR
+#undef CHEMSI_FRAME_SECTOR
+};
+
+/// Fill a frame from an Observation (the generated member-by-member copy)
+void toObservationFrame(double t_s, const Observation& obs, ObservationFrameV1& out);
+
+/// Column descriptor in the file header; offset is from the start of a slot
+struct ObservationShmField {
+    char name[48];
+    uint32_t offset;
+    uint32_t type;  // 1 = float64
+};
+
+struct ObservationShmHeader {
+    char magic[8];               // "VFEPOBS1"
+    uint32_t version;
+    uint32_t header_bytes;       // Offset of slot 0
+    uint32_t slot_bytes;         // 8-byte seq + frame
+    uint32_t capacity;           // Slots (power of two)
+    uint32_t field_count;
+    uint32_t descriptor_offset;  // First ObservationShmField
+    uint64_t layout_hash;
+    uint64_t writer_pid;
+    alignas(64) std::atomic<uint64_t> published;  // Frames completed
+    std::atomic<uint32_t> writer_open;            // 0 after the writer closes
+};
+
+/// Column descriptors of ObservationFrameV1 (t_s first), slot-relative offsets
+const std::vector<ObservationShmField>& observationShmFields();
+
+/// FNV-1a over version, slot size and every descriptor
+uint64_t observationShmLayoutHash();
+
+class ObservationShmWriter {
+public:
+    ObservationShmWriter() = default;
+    ~ObservationShmWriter();
+
+    ObservationShmWriter(const ObservationShmWriter&) = delete;
+    ObservationShmWriter& operator=(const ObservationShmWriter&) = delete;
+
+    /**
+     * @brief Create (truncate) and map the ring file
+     * @param capacity frames kept; rounded up to a power of two
+     * @return false if the file cannot be created or mapped, or a ring is open
+     * @throws std::invalid_argument if capacity is 0
+     */
+    bool open(const std::string& path, size_t capacity = 4096);
+
+    /// Wait-free; no-op while closed
+    void publish(double t_s, const Observation& obs);
+
+    /// Unmap; the file stays so late readers still see the final frames
+    void close();
+
+    bool isOpen() const { return header_ != nullptr; }
+    uint64_t published() const { return next_; }
+    size_t capacity() const { return capacity_; }
+
+    /// /dev/shm/vfep_observations on Linux, vfep_observations.shm elsewhere
+    static std::string defaultPath();
+
+private:
+    ObservationShmHeader* header_ = nullptr;
+    uint8_t* slots_ = nullptr;
+    size_t capacity_ = 0;
+    uint64_t next_ = 0;
+    void* map_ = nullptr;
+    size_t map_bytes_ = 0;
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+class ObservationShmReader {
+public:
+    ObservationShmReader() = default;
+    ~ObservationShmReader();
+
+    ObservationShmReader(const ObservationShmReader&) = delete;
+    ObservationShmReader& operator=(const ObservationShmReader&) = delete;
+
+    /**
+     * @brief Map a ring read-only
+     * @return false if it cannot be mapped, is too small, or its version or
+     *         layout hash differ from this build's
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return header_ != nullptr; }
+    size_t capacity() const { return capacity_; }
+    uint64_t published() const;
+    bool writerOpen() const;
+
+    /// Copy frame n; false if it is not written yet or was overwritten
+    bool read(uint64_t n, ObservationFrameV1& out) const;
+
+    /**
+     * @brief Append every frame from `cursor` to the newest and advance cursor
+     * @param dropped if non-null, receives frames lost to overwriting
+     * @return frames appended
+     */
+    size_t poll(uint64_t& cursor, std::vector<ObservationFrameV1>& out, uint64_t* dropped = nullptr) const;
+
+private:
+    const ObservationShmHeader* header_ = nullptr;
+    const uint8_t* slots_ = nullptr;
+    size_t capacity_ = 0;
+    void* map_ = nullptr;
+    size_t map_bytes_ = 0;
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_OBSERVATION_SHM_H
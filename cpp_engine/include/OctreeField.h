@@ -0,0 +1,109 @@
+/**
+ * @file OctreeField.h
+ * @brief Sparse octree (AMR) container for CFD point fields
+ *
+ * Phase 8: CFD Interface - Multi-resolution fields
+ *
+ * The domain box is subdivided only where requested, so memory scales with
+ * the number of refined cells rather than the bounding-box volume. Leaves
+ * are stored in Morton (Z-order) sequence with their locational code at the
+ * finest level; point location is a binary search over those codes.
+ * Each leaf holds the CFDField values at its 8 corners and is interpolated
+ * trilinearly. Neighbouring leaves of different size are not forced to
+ * agree on shared faces (no hanging-node constraints).
+ */
+
+#ifndef CHEMSI_OCTREE_FIELD_H
+#define CHEMSI_OCTREE_FIELD_H
+
+#include "CFDInterface.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vfep {
+
+class OctreeField {
+public:
+    static constexpr int MAX_DEPTH = 21;   ///< 3 x 21 bits fit a 64-bit Morton code
+    static constexpr size_t NUM_FIELDS = static_cast<size_t>(CFDField::Count);
+
+    /// Fill values[NUM_FIELDS] (CFDField order) at a point
+    using Sampler = std::function<void(double x, double y, double z, double* values)>;
+    /// Return true to subdivide the cell [lo, hi] at `level` (root = 0)
+    using RefinePredicate = std::function<bool(const double lo[3], const double hi[3], int level)>;
+
+    OctreeField() = default;
+
+    /**
+     * @brief Build by adaptive refinement of a box
+     * @param lo, hi Domain corners (m)
+     * @param max_depth Deepest level allowed (<= MAX_DEPTH)
+     * @param refine Subdivision predicate
+     * @param sample Field values at leaf corners
+     * @throws std::invalid_argument on an empty box or bad depth
+     */
+    void build(const double lo[3], const double hi[3], int max_depth,
+               const RefinePredicate& refine, const Sampler& sample);
+
+    /**
+     * @brief Resample scattered points (unstructured or refined CFD output)
+     *
+     * Cells are split while they hold more than `max_points_per_leaf`
+     * points. Leaf corners take inverse-distance-weighted values from the
+     * leaf's points (or its parent's, for empty leaves).
+     *
+     * @throws std::invalid_argument on empty input or bad depth
+     */
+    void buildFromPoints(const std::vector<GridPoint>& points, int max_depth,
+                         size_t max_points_per_leaf);
+
+    void clear();
+
+    bool empty() const { return keys_.empty(); }
+    size_t leafCount() const { return keys_.size(); }
+    int maxDepth() const { return depth_; }
+
+    /// Leaf containing the point, or -1 outside the domain
+    long long findLeaf(double x, double y, double z) const;
+
+    void leafBounds(size_t leaf, double lo[3], double hi[3]) const;
+    int leafLevel(size_t leaf) const { return levels_[leaf]; }
+    uint64_t leafKey(size_t leaf) const { return keys_[leaf]; }
+
+    /**
+     * @brief Trilinear interpolation within the containing leaf
+     * @param values Output: NUM_FIELDS values (untouched when outside)
+     * @return false if the point is outside the domain
+     */
+    bool interpolate(double x, double y, double z, double* values) const;
+
+    /// Single field, `fallback` outside the domain
+    double interpolate(CFDField field, double x, double y, double z, double fallback) const;
+
+    /// Approximate heap footprint (keys, levels, corner values)
+    size_t memoryBytes() const;
+
+    /// Interleave the low 21 bits of x, y, z (x in bit 0)
+    static uint64_t mortonEncode(uint32_t x, uint32_t y, uint32_t z);
+
+private:
+    double lo_[3] = {0.0, 0.0, 0.0};
+    double size_[3] = {0.0, 0.0, 0.0};
+    int depth_ = 0;
+
+    std::vector<uint64_t> keys_;     ///< Morton code of each leaf's min corner at depth_
+    std::vector<uint8_t> levels_;
+    std::array<std::vector<double>, NUM_FIELDS> corners_;  ///< 8 per leaf, corner c = x | y<<1 | z<<2
+
+    void setDomain(const double lo[3], const double hi[3], int max_depth);
+    void addLeaf(int level, uint32_t ix, uint32_t iy, uint32_t iz, const double* corner_values);
+    void cellBounds(int level, uint32_t ix, uint32_t iy, uint32_t iz, double lo[3], double hi[3]) const;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_OCTREE_FIELD_H
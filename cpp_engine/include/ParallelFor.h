@@ -0,0 +1,61 @@
+/**
+ * @file ParallelFor.h
+ * @brief Minimal fork-join helper for splitting index ranges across threads
+ *
+ * Used by importers and field operations that touch millions of elements.
+ * Work is split into contiguous [begin, end) ranges so each worker streams
+ * through memory; the calling thread processes the first range itself.
+ */
+
+#ifndef CHEMSI_PARALLEL_FOR_H
+#define CHEMSI_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace vfep {
+
+/// Number of workers to use for `n` items when each worker should get at
+/// least `min_grain` items.
+inline size_t parallelWorkerCount(size_t n, size_t min_grain) {
+    size_t hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+    size_t by_grain = std::max<size_t>(1, n / std::max<size_t>(1, min_grain));
+    return std::min(hw, by_grain);
+}
+
+/// Invoke fn(chunk_index, begin, end) over [0, n) split into contiguous chunks.
+/// Returns the number of chunks used (chunk_index ranges over [0, chunks)).
+template <typename Fn>
+size_t parallelForChunks(size_t n, size_t min_grain, Fn&& fn) {
+    const size_t workers = parallelWorkerCount(n, min_grain);
+    if (workers <= 1) {
+        fn(size_t(0), size_t(0), n);
+        return 1;
+    }
+
+    const size_t chunk = (n + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t w = 1; w < workers; ++w) {
+        const size_t begin = std::min(n, w * chunk);
+        const size_t end = std::min(n, begin + chunk);
+        threads.emplace_back([&fn, w, begin, end]() { fn(w, begin, end); });
+    }
+    fn(size_t(0), size_t(0), std::min(n, chunk));
+    for (auto& t : threads) {
+        t.join();
+    }
+    return workers;
+}
+
+/// Invoke fn(begin, end) over [0, n) split into contiguous chunks.
+template <typename Fn>
+void parallelFor(size_t n, size_t min_grain, Fn&& fn) {
+    parallelForChunks(n, min_grain, [&fn](size_t, size_t begin, size_t end) { fn(begin, end); });
+}
+
+} // namespace vfep
+
+#endif // CHEMSI_PARALLEL_FOR_H
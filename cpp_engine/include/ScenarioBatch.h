@@ -0,0 +1,91 @@
+/**
+ * @file ScenarioBatch.h
+ * @brief Run many fire scenarios from a parameter matrix, in parallel
+ *
+ * One scenario = one Simulation driven through the data-center rack
+ * scenario with a scheduled ignition and optional suppression (the same
+ * drive as MonteCarloUQ). Parameters and metrics are flat row-major double
+ * matrices with the column orders below, so they map directly onto numpy
+ * arrays through the C ABI (chemsi_c.h) without any per-row marshalling.
+ *
+ * Scenarios are independent; runScenarioBatch hands rows to worker
+ * threads one at a time, so uneven run lengths still balance. Results do
+ * not depend on the thread count.
+ */
+
+#ifndef CHEMSI_SCENARIO_BATCH_H
+#define CHEMSI_SCENARIO_BATCH_H
+
+#include "Simulation.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vfep {
+
+/// Parameter columns, in matrix order
+struct ScenarioParams {
+    double dt_s = 0.05;
+    double t_end_s = 120.0;
+    double ignite_at_s = 2.0;
+    double suppress_at_s = -1.0;            ///< < 0: no suppression
+    double ach_1_per_h = -1.0;              ///< <= 0: scenario default
+    double pyrolysis_max_kgps = 0.03;
+    double heat_release_J_per_mol = 1.0e5;  ///< <= 0: scenario default
+    double volume_m3 = 120.0;
+    double area_m2 = 180.0;
+    double h_W_m2K = 10.0;
+};
+
+/// Metric columns, in matrix order
+struct ScenarioMetrics {
+    double peak_T_K = 0.0;
+    double peak_HRR_W = 0.0;
+    double t_peak_HRR_s = 0.0;
+    double final_T_K = 0.0;
+    double final_HRR_W = 0.0;
+    double min_O2_volpct = 0.0;
+    double final_fuel_kg = 0.0;
+    double steps = 0.0;
+};
+
+constexpr size_t kScenarioParamCount = sizeof(ScenarioParams) / sizeof(double);
+constexpr size_t kScenarioMetricCount = sizeof(ScenarioMetrics) / sizeof(double);
+
+const char* scenarioParamName(size_t column);   ///< nullptr past the last column
+const char* scenarioMetricName(size_t column);
+
+/**
+ * @brief Row of a parameter matrix; columns past `cols` keep their defaults
+ * @throws std::invalid_argument if dt_s or t_end_s is not positive and finite
+ */
+ScenarioParams scenarioParamsFromRow(const double* row, size_t cols);
+
+/// Reset to the data-center rack scenario and apply the non-scheduled parameters
+void configureScenario(Simulation& sim, const ScenarioParams& params);
+
+/**
+ * @brief Run one scenario
+ * @param telemetry optional: the oldest telemetry_cap retained v1 samples (10 Hz),
+ *        from t = 0 unless the run outgrew the full-rate history
+ * @param telemetry_rows receives the number of samples written (may be null)
+ */
+ScenarioMetrics runScenario(const ScenarioParams& params, TelemetrySampleV1* telemetry = nullptr,
+                            size_t telemetry_cap = 0, size_t* telemetry_rows = nullptr);
+
+/**
+ * @brief Run `rows` scenarios
+ * @param params   rows x param_cols, row-major (param_cols <= kScenarioParamCount)
+ * @param metrics  rows x kScenarioMetricCount, row-major
+ * @param telemetry optional rows x telemetry_cap x 8 floats (TelemetrySampleV1 rows)
+ * @param telemetry_rows optional per-row count of samples written
+ * @param threads  0 = one per core
+ * @throws std::invalid_argument for a bad matrix shape or row (nothing is run)
+ */
+void runScenarioBatch(const double* params, size_t rows, size_t param_cols, double* metrics,
+                      float* telemetry = nullptr, size_t telemetry_cap = 0, int32_t* telemetry_rows = nullptr,
+                      size_t threads = 0);
+
+} // namespace vfep
+
+#endif // CHEMSI_SCENARIO_BATCH_H
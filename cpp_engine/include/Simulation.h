@@ -3,6 +3,7 @@
 #include <vector>
 #include <array>
 #include <cstdint>
+#include <memory>
 
 #include "Chemistry.h"
 #include "Reactor.h"
@@ -13,6 +14,8 @@
 
 namespace vfep {
 
+class TelemetryHistory;
+
 // ============================================================
 // Phase 3B.1: Deterministic safety harness (verification + schema contracts)
 //
@@ -39,6 +42,7 @@ struct TelemetrySampleV1 {
     float KD_actual_0_1 = 0.0f;
     float HRR_kW = 0.0f; // effective HRR in kW
 };
+static_assert(sizeof(TelemetrySampleV1) == 8 * sizeof(float), "TelemetrySampleV1 is CRC'd as packed bytes");
 
 // ============================================================
 // Phase 3CA: Telemetry schema v2 (additive; v1 is immutable)
@@ -361,6 +365,7 @@ bool calibration_mode = false;
 class Simulation {
 public:
     Simulation();
+    ~Simulation();
 
     Simulation(const Simulation&) = delete;
     Simulation& operator=(const Simulation&) = delete;
@@ -386,6 +391,7 @@ public:
     RunSignatures getRunSignatures() const;
     RunSignatures getLastExpectedSignatures() const;
     std::uint32_t getLatestEvents();
+    // Oldest-first copy of (at most) the last kTelemetryWindow samples
     int getTelemetrySamples(TelemetrySampleV1* out_ptr, int cap) const;
 
     // Phase 3CA: extended monitoring (v2+). v1 remains authoritative for verification.
@@ -393,6 +399,15 @@ public:
     bool telemetryV2Enabled() const { return telemetry_v2_enabled_; }
     int getTelemetrySamplesV2(TelemetrySampleV2* out_ptr, int cap) const;
 
+    // Phase 3CA: tiered telemetry history (see TelemetryHistory.h). Allocated on
+    // the first sample; disabling frees it and stops recording (signatures and
+    // events are unaffected). Batch drivers that never read telemetry disable it.
+    static constexpr int kTelemetryWindow = 2048;
+    void enableTelemetryHistory(bool enabled);
+    bool telemetryHistoryEnabled() const { return telemetry_history_enabled_; }
+    const TelemetryHistory* telemetryHistory() const { return telemetry_history_.get(); }      // nullptr until used
+    const TelemetryHistory* telemetryHistoryV2() const { return telemetry_v2_history_.get(); }
+
     // Phase 3CA: autonomy seams (deterministic control input surface)
     void setControlInputs(const ControlInputsV1& in);
     ControlInputsV1 getControlInputs() const { return control_inputs_; }
@@ -430,6 +445,7 @@ public:
 
     void commandIgniteOrIncreasePyrolysis();
     void commandStartSuppression();
+    void commandStopSuppression(); // Close the valve; agent already delivered stays
 
     // dt must be positive and finite; invalid dt is ignored.
     void step(double dt);
@@ -451,6 +467,7 @@ private:
 
     static std::vector<Species> buildDefaultSpecies();
     void seedAmbient(Reactor& r);
+    void clearTelemetry();  // v1 + v2 histories
 
     ChemistryIndex idx_;
 
@@ -587,20 +604,15 @@ std::uint32_t telemetry_crc_u32_ = 0;
     RunSignatures expected_signatures_{};
     std::uint32_t latest_events_bits_ = 0;
 
-    // Telemetry ring buffer (fixed capacity, no dynamic alloc during step)
-    static constexpr int kTelemetryCapacity_ = 2048;
-    std::array<TelemetrySampleV1, kTelemetryCapacity_> telemetry_rb_{};
-    int telemetry_head_ = 0;   // next write
-    int telemetry_count_ = 0;  // number valid
+    // Telemetry history (hot ring + compressed tiers; allocated on first sample)
+    bool telemetry_history_enabled_ = true;
+    std::unique_ptr<TelemetryHistory> telemetry_history_;
     double telemetry_dt_s_ = 0.10;
     double telemetry_next_t_s_ = 0.0;
 
-    // ---- Phase 3CA: Telemetry v2 ring buffer (derived monitoring; never hashed) ----
+    // ---- Phase 3CA: Telemetry v2 history (derived monitoring; never hashed) ----
     bool telemetry_v2_enabled_ = false;
-    static constexpr int kTelemetryV2Capacity_ = 2048;
-    std::array<TelemetrySampleV2, kTelemetryV2Capacity_> telemetry_v2_rb_{};
-    int telemetry_v2_head_ = 0;
-    int telemetry_v2_count_ = 0;
+    std::unique_ptr<TelemetryHistory> telemetry_v2_history_;
 
     // ---- Phase 3CA: autonomy seams ----
     ControlInputsV1 control_inputs_{};
@@ -0,0 +1,84 @@
+/**
+ * @file SpscRing.h
+ * @brief Lock-free single-producer / single-consumer bounded ring
+ *
+ * Fixed power-of-two array of slots with one atomic index per side. Each
+ * side keeps a cached copy of the other side's index and only reloads it
+ * when the ring looks full (producer) or empty (consumer), so in steady
+ * state a push or pop touches no shared cache line but its own. Items are
+ * copied in and consumed in place (front() / pop()); nothing is allocated
+ * after construction.
+ */
+
+#ifndef CHEMSI_SPSC_RING_H
+#define CHEMSI_SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace vfep {
+
+template <typename T>
+class SpscRing {
+public:
+    /// @throws std::invalid_argument if capacity is 0 (rounded up to a power of two)
+    explicit SpscRing(size_t capacity) {
+        if (capacity == 0) throw std::invalid_argument("SpscRing: capacity must be > 0");
+        size_t n = 1;
+        while (n < capacity) n <<= 1;
+        slots_.resize(n);
+        mask_ = n - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    size_t capacity() const { return slots_.size(); }
+
+    /// Producer thread only. Returns false if the ring is full.
+    bool tryPush(const T& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == slots_.size()) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == slots_.size()) return false;
+        }
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer thread only. Oldest item, or nullptr if the ring is empty.
+    const T* front() {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return nullptr;
+        }
+        return &slots_[head & mask_];
+    }
+
+    /// Consumer thread only; releases the slot returned by front()
+    void pop() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// Any thread; exact only when both sides are quiescent
+    size_t sizeApprox() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T> slots_;
+    size_t mask_ = 0;
+
+    alignas(64) std::atomic<size_t> tail_{0};  // Producer
+    size_t head_cache_ = 0;
+    alignas(64) std::atomic<size_t> head_{0};  // Consumer
+    size_t tail_cache_ = 0;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_SPSC_RING_H
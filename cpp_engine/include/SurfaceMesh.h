@@ -0,0 +1,87 @@
+/**
+ * @file SurfaceMesh.h
+ * @brief STL geometry import and coarsening into physics surface patches
+ * 
+ * Phase 9: Track E - Geometry Import
+ * 
+ * Provides:
+ * - Memory-mapped binary STL reader with parallel triangle parsing
+ * - ASCII STL fallback
+ * - Coarsening of triangles into patches of a target area
+ * - Population of FlameSpreadModel and RadiationModel with matching IDs
+ */
+
+#ifndef CHEMSI_SURFACE_MESH_H
+#define CHEMSI_SURFACE_MESH_H
+
+#include <string>
+#include <vector>
+#include "FlameSpreadModel.h"
+#include "RadiationModel.h"
+
+namespace vfep {
+
+struct MeshVec3 {
+    float x, y, z;
+};
+
+struct MeshTriangle {
+    MeshVec3 normal;               // As stored in the file (may be zero)
+    MeshVec3 v0, v1, v2;
+};
+
+struct SurfacePatch {
+    MeshVec3 centroid;             // Area-weighted centroid (m)
+    MeshVec3 normal;               // Area-weighted unit normal
+    float area_m2;                 // Summed triangle area
+    int triangle_count;            // Triangles merged into this patch
+};
+
+class SurfaceMesh {
+public:
+    SurfaceMesh();
+    ~SurfaceMesh();
+    
+    void reset();
+    
+    // Loading (binary/ASCII auto-detected). unit_scale converts file units to
+    // metres, e.g. 0.001 for models exported in millimetres.
+    bool loadSTL(const std::string& path, float unit_scale = 1.0f);
+    
+    // Geometry access
+    const std::vector<MeshTriangle>& getTriangles() const { return triangles_; }
+    int getNumTriangles() const { return static_cast<int>(triangles_.size()); }
+    MeshVec3 getBoundsMin() const { return bounds_min_; }
+    MeshVec3 getBoundsMax() const { return bounds_max_; }
+    float getTotalArea() const;
+    bool isBinarySource() const { return binary_source_; }
+    
+    // Coarsening: merge triangles sharing a grid cell of side sqrt(target
+    // area) and the same dominant normal direction. Patch order follows the
+    // first triangle of each patch, so IDs are stable for a given file.
+    std::vector<SurfacePatch> coarsenToPatches(float target_patch_area_m2) const;
+    
+    // Add one surface per patch to each non-null model. Both models must hold
+    // the same number of surfaces beforehand so patch i gets the same ID in
+    // each. Fuel load and mass loss rate in `material` are per square metre
+    // and scaled by patch area. Returns the ID of the first added patch.
+    static int populateModels(const std::vector<SurfacePatch>& patches,
+                              const FlammableSurface& material,
+                              const Surface& radiative,
+                              FlameSpreadModel* flame_model,
+                              RadiationModel* radiation_model);
+    
+private:
+    std::vector<MeshTriangle> triangles_;
+    MeshVec3 bounds_min_;
+    MeshVec3 bounds_max_;
+    bool binary_source_;
+    
+    bool parseBinary(const unsigned char* data, size_t size, float unit_scale);
+    bool parseASCII(const char* data, size_t size, float unit_scale);
+    void computeBounds();
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_SURFACE_MESH_H
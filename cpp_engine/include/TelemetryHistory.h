@@ -0,0 +1,167 @@
+/**
+ * @file TelemetryHistory.h
+ * @brief Tiered, compressed in-memory history of telemetry sample streams
+ *
+ * Phase 3CA: Telemetry history (replaces the fixed 2048-sample rings)
+ *
+ * The newest samples sit uncompressed in a small hot ring. Every sample
+ * that leaves the ring is appended to three tiers:
+ *
+ *   tier 0   full rate
+ *   tier 1   10x:  min / max / mean of each column over 10 samples
+ *   tier 2   100x: min / max / mean over 10 tier-1 summaries
+ *
+ * Each tier fills an open chunk of chunk_rows rows and compresses it with
+ * the recording column codec once full. Tiers 0 and 1 keep at most their
+ * chunk budget and drop their oldest chunk beyond it; tier 2 is unbounded,
+ * so a run of any length keeps its whole span at 100x resolution. With the
+ * defaults and 10 Hz sampling that is the last ~27 min at full rate and
+ * ~4.5 h at 10x.
+ *
+ * Summaries cover complete groups only: samples still in the hot ring, or
+ * in a group of fewer than 10, are not summarized yet. Column 0 is t_s, so
+ * a summary's min / max there are its first / last sample time.
+ *
+ * Nothing is allocated before the first push(). Not thread-safe.
+ */
+
+#ifndef CHEMSI_TELEMETRY_HISTORY_H
+#define CHEMSI_TELEMETRY_HISTORY_H
+
+#include "TelemetryRecording.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+namespace vfep {
+
+struct TelemetryHistoryConfig {
+    size_t hot_rows = 256;          ///< Uncompressed newest samples
+    size_t chunk_rows = 256;        ///< Rows per compressed chunk (all tiers)
+    size_t full_rate_chunks = 64;   ///< Tier 0 budget
+    size_t decimated_chunks = 64;   ///< Tier 1 budget
+};
+
+/**
+ * @brief Per-column min / max / mean over `rows` consecutive samples
+ */
+struct TelemetrySummary {
+    uint32_t rows = 0;
+    std::vector<float> min;
+    std::vector<float> max;
+    std::vector<float> mean;
+};
+
+class TelemetryHistory {
+public:
+    static constexpr size_t kDecimation = 10;  ///< Samples per summary, per tier step
+
+    /**
+     * @param schema TelemetryV1 or TelemetryV2 (4-byte columns)
+     * @throws std::invalid_argument for another schema or a zero size in cfg
+     */
+    explicit TelemetryHistory(RecordingSchema schema, TelemetryHistoryConfig cfg = {});
+
+    /**
+     * @brief Append the newest sample
+     * @throws std::invalid_argument if the sample size does not match the schema
+     */
+    template <typename Sample>
+    void push(const Sample& sample) {
+        static_assert(std::is_trivially_copyable<Sample>::value, "sample must be trivially copyable");
+        pushRow(&sample, sizeof(Sample));
+    }
+
+    /// Drop every sample and free the tiers (the hot ring stays allocated)
+    void clear();
+
+    RecordingSchema schema() const { return schema_; }
+    const TelemetryHistoryConfig& config() const { return cfg_; }
+
+    uint64_t totalRows() const { return total_rows_; }   ///< Ever pushed since clear()
+    size_t fullRateRows() const;                          ///< Hot ring + retained tier 0
+
+    /**
+     * @brief Copy full-rate samples [first, first + count), oldest = index 0
+     * @return rows copied (clamped to fullRateRows()); the copy stops short at
+     *         a compressed chunk that fails to decode
+     * @throws std::invalid_argument if the sample size does not match the schema
+     */
+    template <typename Sample>
+    size_t copyFullRate(size_t first, size_t count, Sample* out) const {
+        static_assert(std::is_trivially_copyable<Sample>::value, "sample must be trivially copyable");
+        checkRowBytes(sizeof(Sample));
+        return copyRows(first, count, out);
+    }
+
+    /**
+     * @brief Retained summaries of tier 1 (10x) or tier 2 (100x), oldest first
+     * @return false for another tier
+     */
+    bool summaries(int tier, std::vector<TelemetrySummary>& out) const;
+
+    /// Heap bytes held (hot ring, open chunks, compressed chunks)
+    size_t memoryBytes() const;
+
+private:
+#ifdef CHEMSI_TELEMETRY_HISTORY_TEST_ACCESS
+    friend struct TelemetryHistoryTestAccess;  // Defined by the NumericIntegrity build only
+#endif
+
+    struct Packed {
+        uint32_t rows = 0;
+        std::vector<uint8_t> bytes;
+    };
+
+    struct Tier {
+        size_t words = 0;    // uint32 words per row
+        size_t budget = 0;   // Max packed chunks; 0 = unbounded
+        std::vector<uint32_t> open;  // Row-major, up to chunk_rows rows
+        size_t open_rows = 0;
+        std::deque<Packed> chunks;
+        size_t packed_rows = 0;
+    };
+
+    struct Accumulator {
+        uint32_t rows = 0;
+        std::vector<float> min;
+        std::vector<float> max;
+        std::vector<double> sum;
+    };
+
+    void pushRow(const void* row, size_t bytes);
+    void checkRowBytes(size_t bytes) const;
+    size_t copyRows(size_t first, size_t count, void* out) const;
+
+    void evict(const uint32_t* row);
+    void append(Tier& tier, const uint32_t* row);
+    void pack(Tier& tier);
+    bool unpack(const Tier& tier, const Packed& chunk, std::vector<uint32_t>& rows) const;
+    float valueOf(uint32_t word, size_t column) const;
+    void accumulate(Accumulator& acc, const float* min, const float* max, const float* mean, uint32_t rows);
+    void emit(Accumulator& acc, std::vector<uint32_t>& row);
+
+    RecordingSchema schema_;
+    TelemetryHistoryConfig cfg_;
+    std::vector<bool> is_u32_;  // Per column: uint32 rather than float
+    size_t words_ = 0;          // Columns per sample
+
+    std::vector<uint32_t> hot_;  // Row-major ring, allocated on first push
+    size_t hot_head_ = 0;        // Next write
+    size_t hot_count_ = 0;
+    uint64_t total_rows_ = 0;
+
+    std::array<Tier, 3> tiers_;
+    Accumulator acc1_;  // Raw samples -> tier 1
+    Accumulator acc2_;  // Tier-1 summaries -> tier 2
+    std::vector<uint32_t> scratch_;  // Summary row being emitted
+    std::vector<float> values_;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_TELEMETRY_HISTORY_H
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "ObjectModel.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vfep {
+namespace telemetry {
+
+// Per-tick telemetry publication for streaming clients.
+//
+// The sim thread calls TelemetryPublisher::publish() once per tick. It copies
+// the dynamic telemetry out of the ObjectStore into an immutable
+// TelemetrySnapshot, and every stream shares that snapshot through a
+// shared_ptr, so each reader sees a consistent tick without touching the
+// store. The latest pointer is swapped atomically (RCU-style): readers
+// never take a lock the sim thread needs, and a snapshot stays alive for
+// as long as some reader holds it.
+//
+// Each string ID gets a stable integer handle the first time it is seen.
+// Handles are never reused, so a delta stream only needs to send an ID the
+// first time its handle appears.
+
+// VFEP fields that change at runtime (VFEPConfig also holds static metadata)
+struct VFEPOrchestration {
+    obj::VFEPStatus status = obj::VFEPStatus::Normal;
+    std::string selected_rack_id;
+    int selected_hotspot_u = 0;
+    bool suppression_active = false;
+};
+
+template <class T>
+struct Handled {
+    std::uint32_t handle;
+    T value;
+};
+
+enum class EntityKind : std::size_t {
+    Rack = 0, Tank, Arm, Nozzle, Interlock, Incident, Alert, VFEP, Count
+};
+constexpr std::size_t kEntityKinds = static_cast<std::size_t>(EntityKind::Count);
+
+struct TelemetrySnapshot {
+    std::uint64_t tick = 0;              // 1 for the first published tick
+    double sim_time_s = 0.0;
+    std::shared_ptr<const std::vector<std::string>> ids;  // handle -> string ID
+
+    // Sorted by handle
+    std::vector<Handled<obj::RackTelemetry>> racks;
+    std::vector<Handled<obj::TankTelemetry>> tanks;
+    std::vector<Handled<obj::ArmTelemetry>> arms;
+    std::vector<Handled<obj::NozzleTelemetry>> nozzles;
+    std::vector<Handled<obj::InterlockStatus>> interlocks;
+    std::vector<Handled<obj::Incident>> incidents;
+    std::vector<Handled<obj::Alert>> alerts;
+    std::vector<Handled<VFEPOrchestration>> vfeps;
+
+    const std::string& id(std::uint32_t handle) const { return (*ids)[handle]; }
+    std::uint32_t handleCount() const { return ids ? static_cast<std::uint32_t>(ids->size()) : 0u; }
+    std::size_t entityCount(EntityKind kind) const;
+};
+
+// Changes between two snapshots. Entries index into the newer snapshot's
+// arrays; handles in [first_new_handle, end_new_handle) were first seen
+// after the base snapshot.
+struct TelemetryDelta {
+    std::uint64_t base_tick = 0;         // 0 = keyframe (every entity listed)
+    std::uint64_t tick = 0;
+    std::array<std::vector<std::uint32_t>, kEntityKinds> changed;
+    std::vector<std::uint32_t> removed_handles;
+    std::uint32_t first_new_handle = 0;
+    std::uint32_t end_new_handle = 0;
+
+    std::size_t changedCount() const;
+};
+
+// Keyframe (base == nullptr) or delta between two snapshots of the same publisher.
+// Only fields carried by the V1 telemetry messages are compared.
+TelemetryDelta computeDelta(const TelemetrySnapshot* base, const TelemetrySnapshot& cur);
+
+class TelemetryPublisher {
+public:
+    TelemetryPublisher();
+
+    // Sim thread: snapshot the store's telemetry (caller holds whatever
+    // protects the store) and wake waiting streams.
+    std::shared_ptr<const TelemetrySnapshot> publish(const obj::ObjectStore& store, double sim_time_s);
+
+    // Latest snapshot, or nullptr before the first publish (lock-free)
+    std::shared_ptr<const TelemetrySnapshot> latest() const;
+
+    // Block until a snapshot newer than `after_tick` exists, the timeout
+    // expires, or close() is called. Returns the latest snapshot (which may
+    // not be newer on timeout/close).
+    std::shared_ptr<const TelemetrySnapshot> waitForNewer(std::uint64_t after_tick, int timeout_ms) const;
+
+    // Wake all waiters permanently (server shutdown)
+    void close();
+    bool closed() const;
+
+    // Handle for an ID, assigning one if new (sim thread only)
+    std::uint32_t handleFor(const std::string& id);
+
+private:
+    mutable std::mutex mu_;               // Guards closed_ and the wait predicate
+    mutable std::condition_variable cv_;
+    std::shared_ptr<const TelemetrySnapshot> latest_;  // std::atomic_load/atomic_store only
+    bool closed_ = false;
+
+    // Owned by the publishing thread
+    std::uint64_t tick_ = 0;
+    std::unordered_map<std::string, std::uint32_t> handles_;
+    std::shared_ptr<std::vector<std::string>> ids_;  // Copy-on-write when IDs are added
+    bool ids_shared_ = false;
+};
+
+// Per-subscriber delivery policy: at most one write in flight, and writes
+// spaced at least 1/max_hz apart. A snapshot that cannot go out
+// immediately is held; a newer one replaces it (drop-to-latest), so a
+// slow client skips ticks instead of queueing them. Not thread-safe; the
+// owning stream serializes calls.
+class StreamGate {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit StreamGate(double max_hz = 0.0);  // 0 = every tick
+
+    // New snapshot. Returns what to write now, or nullptr if it was held
+    // (or is not newer than the last one offered).
+    std::shared_ptr<const TelemetrySnapshot> offer(std::shared_ptr<const TelemetrySnapshot> snap, Clock::time_point now);
+
+    // The in-flight write completed. Returns a held snapshot to write now, or nullptr.
+    std::shared_ptr<const TelemetrySnapshot> writeDone(Clock::time_point now);
+
+    bool writing() const { return in_flight_; }
+    std::uint64_t sent() const { return sent_; }
+    std::uint64_t dropped() const { return dropped_; }  // Held snapshots replaced before they went out
+
+private:
+    std::shared_ptr<const TelemetrySnapshot> release(Clock::time_point now);
+
+    Clock::duration min_interval_{0};
+    Clock::time_point last_write_{};
+    bool in_flight_ = false;
+    std::uint64_t last_tick_ = 0;
+    std::shared_ptr<const TelemetrySnapshot> held_;
+    std::uint64_t sent_ = 0;
+    std::uint64_t dropped_ = 0;
+};
+
+// One thread that waits on a publisher and hands each snapshot published
+// after construction to every subscriber, so neither the sim thread nor a
+// thread per client does the waiting. A subscriber that falls behind the
+// fan-out thread sees only the newest tick. Callbacks run on the fan-out thread and must not block. After
+// the publisher closes, each subscriber gets one final nullptr.
+//
+// With own_thread = false nothing waits: whoever publishes calls deliver()
+// afterwards and the callbacks run on that thread (used when many
+// publishers share a worker pool).
+class TelemetryFanout {
+public:
+    using Callback = std::function<void(const std::shared_ptr<const TelemetrySnapshot>&)>;
+
+    explicit TelemetryFanout(const TelemetryPublisher& publisher, bool own_thread = true);
+    ~TelemetryFanout();
+
+    TelemetryFanout(const TelemetryFanout&) = delete;
+    TelemetryFanout& operator=(const TelemetryFanout&) = delete;
+
+    std::uint64_t subscribe(Callback cb);
+
+    // Once this returns the callback is not running and will not run again
+    // (also safe to call from inside the callback itself).
+    void unsubscribe(std::uint64_t id);
+
+    std::size_t subscriberCount() const;
+
+    // Lockstep bookkeeping: the subscriber has consumed `tick` (a new
+    // subscriber starts at the tick published when it subscribed).
+    void ack(std::uint64_t id, std::uint64_t tick);
+    // Every subscriber has acked `tick` (true with none)
+    bool allAcked(std::uint64_t tick) const;
+
+    // Hand the latest snapshot to every subscriber if it is newer than the
+    // last one delivered (or the final nullptr once the publisher closed).
+    // Any thread; calls are serialized. Only needed without own_thread.
+    void deliver();
+
+    // Join the fan-out thread (waits for the publisher to close)
+    void stop();
+
+private:
+    struct Entry {
+        Callback fn;
+        std::atomic<bool> active{true};
+        std::atomic<std::uint64_t> acked{0};
+    };
+
+    void run();
+    void dispatch(const std::shared_ptr<const TelemetrySnapshot>& snap);  // dispatch_mu_ held
+
+    const TelemetryPublisher& publisher_;
+    mutable std::mutex subs_mu_;
+    std::unordered_map<std::uint64_t, std::shared_ptr<Entry>> subs_;
+    std::uint64_t next_id_ = 1;
+    std::mutex dispatch_mu_;  // Held while callbacks run
+    std::uint64_t last_tick_; // Last tick dispatched (dispatch_mu_)
+    bool close_sent_ = false; // Final nullptr dispatched (dispatch_mu_)
+    std::atomic<std::thread::id> dispatching_{};  // Thread inside dispatch()
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+};
+
+} // namespace telemetry
+} // namespace vfep
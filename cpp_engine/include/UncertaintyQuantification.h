@@ -58,6 +58,39 @@ public:
     UQSummary runMonteCarlo(const ScenarioConfig& scenario, int num_samples = 100) const;
     UQSummary runMonteCarlo(int num_samples = 100) const;
 
+    // Adaptive mode: after an initial LHS design, a Gaussian-process surrogate
+    // per metric (GaussianProcess.h) decides where the remaining full
+    // simulations go - the population points with the largest predictive
+    // variance, alternating with points whose peak T is within two standard
+    // deviations of flashover_T_K. Statistics are taken over `population`
+    // LHS points evaluated on the final surrogates, plus a draw of any noise
+    // the surrogate fitted, so a metric it had to smooth keeps its spread.
+    struct AdaptiveOptions {
+        int initial_samples = 12;
+        int max_simulations = 40;
+        int batch_size = 4;              // Full simulations per refinement round
+        int population = 4096;
+        double std_tolerance = 0.15;     // Stop once mean predictive std < this x each metric's spread
+        double flashover_T_K = 873.15;   // 600 C; <= 0 disables threshold refinement
+        unsigned seed = 1337u;
+        int threads = 0;                 // Full-simulation workers, 0 = one per core
+    };
+
+    struct AdaptiveUQSummary {
+        UQSummary summary{};
+        int simulations = 0;
+        int rounds = 0;
+        double flashover_probability = 0.0;
+        double flashover_uncertain_fraction = 0.0;  // Population share within 2 sigma of flashover
+        double mean_relative_std = 0.0;             // Worst metric's mean predictive std / spread at the end
+        double loo_rmse_peak_T_K = 0.0;             // Leave-one-out surrogate error per metric; HRR and
+        double loo_rmse_log_peak_HRR = 0.0;         // its timing are modelled as logs
+        double loo_rmse_log_t_peak_HRR = 0.0;
+    };
+
+    AdaptiveUQSummary runAdaptiveMonteCarlo(const ScenarioConfig& scenario, const AdaptiveOptions& options) const;
+    AdaptiveUQSummary runAdaptiveMonteCarlo(const AdaptiveOptions& options) const;
+
 private:
     struct SampleMetrics {
         double peak_T_K = 0.0;
@@ -69,6 +102,8 @@ private:
     UQRanges ranges_{};
 
     SampleMetrics runScenario(const ScenarioConfig& scenario) const;
+    // Scenario at a point of the unit cube (heat release, h, volume, pyrolysis)
+    ScenarioConfig scenarioAt(const ScenarioConfig& base, const double* u) const;
     UQResult summarize(const std::vector<double>& values) const;
 };
 
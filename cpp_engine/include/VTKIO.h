@@ -0,0 +1,155 @@
+/**
+ * @file VTKIO.h
+ * @brief VTK field readers/writers for CFD import (legacy + XML image data)
+ *
+ * Phase 8: CFD Interface - Field I/O
+ *
+ * Supported inputs:
+ * - Legacy VTK (ASCII and BINARY): STRUCTURED_POINTS, RECTILINEAR_GRID,
+ *   STRUCTURED_GRID, UNSTRUCTURED_GRID and POLYDATA point sets
+ * - XML VTK (.vti, .vtr, .vts, .vtu) with raw-appended, inline ASCII or
+ *   inline base64 (uncompressed) arrays
+ *
+ * Files are memory-mapped. Binary arrays are exposed as zero-copy views into
+ * the mapping (decoded element-wise, including byte swapping for big-endian
+ * legacy files). ASCII arrays are parsed in parallel into owned buffers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace vfep {
+
+enum class VTKScalarType {
+    Unknown,
+    Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+    Float32, Float64
+};
+
+/// Size in bytes of one element of `type` (0 for Unknown)
+size_t vtkScalarSize(VTKScalarType type);
+
+/**
+ * @brief Non-owning typed view of a VTK data array
+ *
+ * Points either into a memory-mapped file or into a buffer owned by the
+ * VTKDataset that produced it; valid for the lifetime of that dataset.
+ */
+struct VTKFieldView {
+    const uint8_t* data = nullptr;
+    size_t num_tuples = 0;
+    int num_components = 1;
+    VTKScalarType type = VTKScalarType::Unknown;
+    bool swap_bytes = false;   ///< Stored in non-native byte order
+
+    bool valid() const { return data != nullptr && type != VTKScalarType::Unknown; }
+    size_t size() const { return num_tuples * static_cast<size_t>(num_components); }
+
+    /// Decode flat element i
+    double get(size_t i) const;
+    double get(size_t tuple, int component) const {
+        return get(tuple * static_cast<size_t>(num_components) + component);
+    }
+
+    /// Decode one component of every tuple into out[0..num_tuples)
+    void copyComponent(int component, double* out) const;
+    void copyComponent(int component, float* out) const;
+
+    /// Direct pointer when the array is native-endian, aligned and of type T
+    template <typename T>
+    const T* nativePointer() const;
+};
+
+/**
+ * @brief Parsed VTK dataset: geometry description plus point/cell arrays
+ */
+struct VTKDataset {
+    enum class Kind {
+        None,
+        ImageData,        ///< Uniform grid: dims + origin + spacing
+        RectilinearGrid,  ///< Per-axis coordinate arrays
+        StructuredGrid,   ///< dims + explicit points
+        PointSet          ///< Explicit points without structure
+    };
+
+    VTKDataset() = default;
+    VTKDataset(VTKDataset&&) = default;
+    VTKDataset& operator=(VTKDataset&&) = default;
+    VTKDataset(const VTKDataset&) = delete;            ///< Views alias owned buffers
+    VTKDataset& operator=(const VTKDataset&) = delete;
+
+    Kind kind = Kind::None;
+    int dims[3] = {0, 0, 0};
+    double origin[3] = {0.0, 0.0, 0.0};
+    double spacing[3] = {1.0, 1.0, 1.0};
+    VTKFieldView points;       ///< StructuredGrid / PointSet (3 components)
+    VTKFieldView coords[3];    ///< RectilinearGrid x/y/z coordinates
+
+    std::map<std::string, VTKFieldView> point_data;
+    std::map<std::string, VTKFieldView> cell_data;
+
+    bool binary_source = false;
+
+    size_t numPoints() const;
+
+    /// First point array whose name matches one of `names` (case-insensitive)
+    /// and that has `components` components (0 = any).
+    const VTKFieldView* findPointField(std::initializer_list<const char*> names,
+                                       int components = 0) const;
+
+    // Backing storage (views above point into these)
+    std::shared_ptr<MappedFile> mapping;
+    std::vector<std::vector<uint8_t>> owned;
+};
+
+class VTKReader {
+public:
+    /**
+     * @brief Read a legacy (.vtk) or XML (.vti/.vtr/.vts/.vtu) file
+     * @param path Input file
+     * @param out Dataset (replaced)
+     * @param error Optional: receives a description on failure
+     * @return true if successful
+     */
+    static bool read(const std::string& path, VTKDataset& out, std::string* error = nullptr);
+
+    /// Parse `count` whitespace-separated numbers starting at `p` into `out`
+    /// (Float32 or Float64). Runs in parallel for large arrays.
+    /// @return Pointer just past the last number, or nullptr on failure
+    static const char* parseAsciiNumbers(const char* p, const char* end, size_t count,
+                                         VTKScalarType out_type, uint8_t* out);
+};
+
+/// One named point array for the writers (tuple-major, num_components per point)
+struct VTKWriteField {
+    std::string name;
+    int num_components;
+    const double* data;
+};
+
+class VTKWriter {
+public:
+    /// Legacy STRUCTURED_POINTS (Float32 arrays), ASCII or big-endian BINARY
+    static bool writeLegacyStructuredPoints(const std::string& path,
+                                            const int dims[3], const double origin[3],
+                                            const double spacing[3],
+                                            const std::vector<VTKWriteField>& fields,
+                                            bool binary);
+
+    /// XML ImageData (.vti) with Float32 arrays in a raw appended block
+    static bool writeImageData(const std::string& path,
+                               const int dims[3], const double origin[3],
+                               const double spacing[3],
+                               const std::vector<VTKWriteField>& fields);
+};
+
+} // namespace vfep
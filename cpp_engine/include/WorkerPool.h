@@ -0,0 +1,105 @@
+/**
+ * @file WorkerPool.h
+ * @brief Persistent fork-join pool for loops that run every tick
+ *
+ * parallelFor (ParallelFor.h) starts and joins its threads on every call,
+ * which is fine for a one-off import but not for a loop that runs at the
+ * tick rate on a WorldHost worker: with many worlds each tick would start
+ * its own threads and oversubscribe the machine. A WorkerPool keeps its
+ * helper threads alive, and the calling thread claims chunks of its own
+ * job alongside them, so a call never waits on a busy pool - with every
+ * helper occupied (or none at all) the caller simply runs the whole loop.
+ * That also makes nested or concurrent calls from several threads safe.
+ *
+ * Chunking matches parallelForChunks: contiguous [begin, end) ranges, the
+ * chunk count fixed by n, min_grain and the pool size alone, so results
+ * that combine per-chunk partials in chunk order do not depend on which
+ * thread ran what.
+ */
+
+#ifndef CHEMSI_WORKER_POOL_H
+#define CHEMSI_WORKER_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vfep {
+
+class WorkerPool {
+public:
+    /// helpers = threads besides the caller; 0 runs every loop inline
+    explicit WorkerPool(size_t helpers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Process-wide pool with hardware_concurrency() - 1 helpers, started on first use
+    static WorkerPool& shared();
+
+    size_t helperCount() const { return threads_.size(); }
+
+    /// Chunks a loop over n items uses when each should get at least min_grain
+    size_t chunkCount(size_t n, size_t min_grain) const {
+        const size_t by_grain = std::max<size_t>(1, n / std::max<size_t>(1, min_grain));
+        return std::min(threads_.size() + 1, by_grain);
+    }
+
+    /// Invoke fn(chunk_index, begin, end) over [0, n) split into contiguous
+    /// chunks; returns the chunk count. The first exception thrown by fn is
+    /// rethrown here once every chunk has finished.
+    template <typename Fn>
+    size_t parallelForChunks(size_t n, size_t min_grain, Fn&& fn) {
+        const size_t chunks = chunkCount(n, min_grain);
+        if (chunks <= 1) {
+            fn(size_t(0), size_t(0), n);
+            return 1;
+        }
+        const size_t chunk = (n + chunks - 1) / chunks;
+        const std::function<void(size_t)> run = [&fn, n, chunk](size_t c) {
+            const size_t begin = std::min(n, c * chunk);
+            fn(c, begin, std::min(n, begin + chunk));
+        };
+        execute(chunks, run);
+        return chunks;
+    }
+
+    /// Invoke fn(begin, end) over [0, n) split into contiguous chunks
+    template <typename Fn>
+    void parallelFor(size_t n, size_t min_grain, Fn&& fn) {
+        parallelForChunks(n, min_grain, [&fn](size_t, size_t begin, size_t end) { fn(begin, end); });
+    }
+
+private:
+    struct Job {
+        const std::function<void(size_t)>* run = nullptr;
+        size_t chunks = 0;
+        std::atomic<size_t> next{0};   // Next unclaimed chunk
+        std::atomic<size_t> users{0};  // Helpers inside claim(); raised under the pool mutex only
+        std::mutex mu;
+        std::condition_variable cv;
+        std::exception_ptr error;
+    };
+
+    void execute(size_t chunks, const std::function<void(size_t)>& run);
+    static void claim(Job& job);
+    void helperLoop();
+
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::deque<Job*> jobs_;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+};
+
+} // namespace vfep
+
+#endif // CHEMSI_WORKER_POOL_H
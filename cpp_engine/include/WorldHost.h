@@ -0,0 +1,229 @@
+#pragma once
+
+#include "EntityRegistry.h"
+#include "FireSimBridge.h"
+#include "LatencyHistogram.h"
+#include "MechanicsSim.h"
+#include "MpscQueue.h"
+#include "ObjectModel.h"
+#include "TelemetryPublisher.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vfep {
+namespace host {
+
+// Many independent simulated worlds (ObjectStore + clock + telemetry) ticked
+// by one shared worker pool.
+//
+// Scheduling is earliest-deadline-first: every ticking world sits in a heap
+// keyed by its next due time, and a worker pops the most overdue one, runs a
+// single tick, and re-inserts it one period later. A world therefore never
+// ticks faster than its own tick_hz, a busy world cannot starve the others,
+// and no world is ever ticked by two workers at once. Under overload every
+// world slows down together; a world more than one period behind skips the
+// missed ticks instead of bursting to catch up.
+//
+// A world ticks only while someone listens: with no telemetry subscribers
+// it leaves the heap (queued commands are still applied, but its clock
+// stands still) and subscribe() puts it back.
+//
+// Each world has its own clock (ClockMode): paced to wall-clock time at
+// 1x or N x, back-to-back ticks (max throughput), or lockstep, where the
+// next tick waits until every subscriber has acked the previous frame.
+// Any world can be paused, single-stepped and sought forward; explicit
+// steps and seeks run even with nobody listening. Back-to-back worlds
+// re-enter the heap due "now", so they use spare worker time without
+// delaying paced worlds by more than one tick.
+//
+// A fire_sim world also steps a FireSimBridge (one vfep::Simulation per
+// burning rack) inside each tick, on the worker that owns the world.
+
+using Clock = std::chrono::steady_clock;
+
+// Queued change to a world's store. Runs on the worker that owns the world
+// at the start of its next step, or with nullptr if the world was destroyed
+// first.
+struct WorldCommand {
+    std::function<void(vfep::obj::ObjectStore* store)> run;
+    Clock::time_point enqueued = Clock::now();
+};
+
+enum class ClockMode {
+    RealTime,       // tick_hz of wall-clock time
+    Scaled,         // speed x real time
+    MaxThroughput,  // next tick as soon as a worker is free
+    Lockstep,       // next tick once every subscriber acked the last frame
+};
+
+struct ClockState {
+    ClockMode mode = ClockMode::RealTime;
+    double speed = 1.0;               // Scaled only
+    bool paused = false;
+    std::uint64_t pending_steps = 0;  // Single steps still to run
+    double seek_to_s = -1.0;          // Running to this sim time; < 0: not seeking
+};
+
+struct WorldConfig {
+    std::string world_id;             // Empty: the host assigns "world-N"
+    double tick_hz = 20.0;            // Clamped to the host's max_tick_hz
+    std::size_t synthetic_racks = 0;  // 0: default 4x4 layout
+    bool fire_sim = false;            // Burning racks run a vfep::Simulation
+};
+
+class World {
+public:
+    World(std::string id, std::uint64_t serial, vfep::obj::ObjectStore store, double tick_hz, bool fire_sim = false);
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    const std::string& id() const { return id_; }
+    std::uint64_t serial() const { return serial_; }  // Unique per host, never reused
+    double tickHz() const { return tick_hz_; }
+    bool fireSim() const { return fire_ != nullptr; }
+    std::size_t activeFires() const { return active_fires_.load(std::memory_order_relaxed); }
+
+    // Static layout as created (any thread)
+    const std::shared_ptr<const vfep::obj::ObjectStore>& layout() const { return layout_; }
+    const vfep::telemetry::TelemetryPublisher& publisher() const { return publisher_; }
+    vfep::telemetry::TelemetryFanout& fanout() { return fanout_; }
+
+    std::uint64_t ticks() const { return ticks_.load(std::memory_order_relaxed); }
+    bool destroyed() const { return destroyed_.load(); }
+
+private:
+    friend class WorldHost;
+
+    const std::string id_;
+    const std::uint64_t serial_;
+    const double tick_hz_;
+    const std::shared_ptr<const vfep::obj::ObjectStore> layout_;
+
+    // Owned by whichever worker is stepping the world
+    vfep::obj::ObjectStore store_;
+    vfep::obj::EntityRegistry registry_;
+    vfep::mech::MechanicsParams params_;
+    std::unique_ptr<vfep::mech::FireSimBridge> fire_;  // fire_sim worlds only
+    double sim_time_s_ = 0.0;
+    bool finalized_ = false;  // Pending commands cancelled after destroy
+
+    vfep::MpscQueue<std::unique_ptr<WorldCommand>> commands_;
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::uint64_t> ticks_{0};
+    std::atomic<std::size_t> active_fires_{0};
+    std::atomic<bool> destroyed_{false};
+
+    vfep::telemetry::TelemetryPublisher publisher_;
+    vfep::telemetry::TelemetryFanout fanout_;  // Delivered by the stepping worker
+
+    // Host scheduler state (host mutex)
+    ClockState clock_;
+    bool scheduled_ = false;  // In the heap or being stepped
+};
+
+class WorldHost {
+public:
+    // workers = 0: one per hardware thread
+    explicit WorldHost(std::size_t workers = 0, double max_tick_hz = 100.0, std::size_t max_worlds = 1024);
+    ~WorldHost();
+
+    WorldHost(const WorldHost&) = delete;
+    WorldHost& operator=(const WorldHost&) = delete;
+
+    // nullptr (and *error set) if the ID is taken or the host is full
+    std::shared_ptr<World> create(const WorldConfig& cfg, std::string* error = nullptr);
+
+    // Close the world's streams and cancel its queued commands. Holders of
+    // the shared_ptr keep a valid (frozen) object. False if unknown.
+    bool destroy(const std::string& world_id);
+
+    std::shared_ptr<World> find(const std::string& world_id) const;
+    std::vector<std::shared_ptr<World>> list() const;  // Sorted by ID
+
+    // Subscribe to a world's telemetry and start it ticking
+    std::uint64_t subscribe(const std::shared_ptr<World>& world, vfep::telemetry::TelemetryFanout::Callback cb);
+    void unsubscribe(const std::shared_ptr<World>& world, std::uint64_t subscriber);
+
+    // Subscriber has consumed the frame for `tick`; releases a lockstep world
+    void ack(const std::shared_ptr<World>& world, std::uint64_t subscriber, std::uint64_t tick);
+
+    // Clock control. False (and *error set) for a non-positive Scaled speed
+    // or a seek behind the world's current sim time.
+    bool setClockMode(const std::shared_ptr<World>& world, ClockMode mode, double speed = 1.0, std::string* error = nullptr);
+    void setPaused(const std::shared_ptr<World>& world, bool paused);
+    void stepTicks(const std::shared_ptr<World>& world, std::uint64_t ticks);  // Pauses, then runs `ticks`
+    bool seek(const std::shared_ptr<World>& world, double sim_time_s, std::string* error = nullptr);
+    ClockState clock(const World& world) const;
+
+    // Queue a command; the world is stepped soon even if idle
+    void enqueue(const std::shared_ptr<World>& world, std::unique_ptr<WorldCommand> cmd);
+
+    bool ticking(const World& world) const;
+    std::size_t worldCount() const;
+    std::size_t tickingCount() const;  // Worlds in the schedule (listening or with commands)
+
+    // Close every world's telemetry (streams finish) but keep applying
+    // commands; for a graceful server drain before stop()
+    void closeTelemetry();
+
+    // Destroy all worlds and join the workers
+    void stop();
+
+    // Aggregate timing over all worlds
+    const vfep::LatencyHistogram& tickJitter() const { return tick_jitter_; }         // Start minus due time
+    const vfep::LatencyHistogram& commandLatency() const { return command_latency_; } // Enqueue to applied
+    std::uint64_t ticks() const { return ticks_.load(std::memory_order_relaxed); }
+    std::uint64_t overruns() const { return overruns_.load(std::memory_order_relaxed); }  // Paced ticks only
+
+private:
+    struct Due {
+        Clock::time_point due;
+        std::uint64_t seq;  // FIFO among equal deadlines
+        std::shared_ptr<World> world;
+        bool operator>(const Due& o) const { return due != o.due ? due > o.due : seq > o.seq; }
+    };
+
+    enum class Advance { No, Paced, Free };  // Free: seek/step/back-to-back
+
+    void wakeLocked(const std::shared_ptr<World>& world, Clock::time_point due);
+    bool readyLocked(const World& world) const;  // Would tick now (ignores pacing)
+    Advance takeAdvanceLocked(World& world);     // Consumes a pending step
+    void endSeekLocked(World& world);
+    Clock::duration pacedPeriodLocked(const World& world) const;
+    void workerLoop();
+    void step(World& world, Clock::time_point due, Advance advance, Clock::duration period);
+
+    const double max_tick_hz_;
+    const std::size_t max_worlds_;
+
+    mutable std::mutex mu_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, std::shared_ptr<World>> worlds_;
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> heap_;
+    std::uint64_t next_seq_ = 0;
+    std::uint64_t next_serial_ = 1;
+    std::size_t ticking_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    vfep::LatencyHistogram tick_jitter_;
+    vfep::LatencyHistogram command_latency_;
+    std::atomic<std::uint64_t> ticks_{0};
+    std::atomic<std::uint64_t> overruns_{0};
+};
+
+} // namespace host
+} // namespace vfep
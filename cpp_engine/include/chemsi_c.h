@@ -0,0 +1,118 @@
+/**
+ * @file chemsi_c.h
+ * @brief C ABI of the simulation engine (shared library chemsi_c)
+ *
+ * A plain-C surface for foreign-function callers - the Python bindings in
+ * python_interface/chemsi_native.py load it with ctypes and pass numpy
+ * buffers straight through. Two entry points:
+ *
+ *   - chemsi_sim_*: one Simulation behind an opaque handle, stepped from
+ *     the caller (observe() and telemetry copied into caller buffers)
+ *   - chemsi_run_batch: many scenarios from a row-major parameter matrix,
+ *     run on worker threads, metrics written to a row-major matrix
+ *     (vfep::runScenarioBatch; column names from chemsi_param_name /
+ *     chemsi_metric_name)
+ *
+ * No C++ exception crosses the boundary: functions return CHEMSI_OK or a
+ * negative CHEMSI_E_* code (or NULL), and chemsi_last_error() holds the
+ * message for the calling thread. A handle is not thread-safe; distinct
+ * handles and concurrent chemsi_run_batch calls are independent.
+ */
+
+#ifndef CHEMSI_C_H
+#define CHEMSI_C_H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(CHEMSI_C_BUILD)
+#    define CHEMSI_C_API __declspec(dllexport)
+#  else
+#    define CHEMSI_C_API __declspec(dllimport)
+#  endif
+#else
+#  define CHEMSI_C_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bumped on any incompatible change to this header */
+#define CHEMSI_C_ABI_VERSION 1
+
+#define CHEMSI_OK 0
+#define CHEMSI_E_INVALID (-1)   /**< Bad argument or configuration */
+#define CHEMSI_E_INTERNAL (-2)  /**< Unexpected engine failure */
+
+typedef struct chemsi_sim chemsi_sim;
+
+CHEMSI_C_API int chemsi_abi_version(void);
+
+/** Message of the last failure on this thread ("" if none) */
+CHEMSI_C_API const char* chemsi_last_error(void);
+
+/* ---- Single simulation ------------------------------------------------ */
+
+/** New simulation in the data-center rack scenario; NULL on failure */
+CHEMSI_C_API chemsi_sim* chemsi_sim_create(void);
+CHEMSI_C_API void chemsi_sim_destroy(chemsi_sim* sim);
+
+/**
+ * Reset to the rack scenario and apply a parameter row (same columns as
+ * chemsi_run_batch; the schedule columns dt_s .. suppress_at_s are ignored,
+ * columns past `cols` keep their defaults). params may be NULL if cols is 0.
+ */
+CHEMSI_C_API int chemsi_sim_configure(chemsi_sim* sim, const double* params, int cols);
+
+/** Ignite (or raise pyrolysis); pyrolysis_kgps > 0 also sets the rate */
+CHEMSI_C_API int chemsi_sim_ignite(chemsi_sim* sim, double pyrolysis_kgps);
+
+/** Start suppression; agent_mdot_kgps / knockdown_0_1 < 0 keep the scenario's values */
+CHEMSI_C_API int chemsi_sim_start_suppression(chemsi_sim* sim, double agent_mdot_kgps, double knockdown_0_1);
+
+/** Advance n_steps steps of dt_s */
+CHEMSI_C_API int chemsi_sim_step(chemsi_sim* sim, double dt_s, int64_t n_steps);
+
+CHEMSI_C_API double chemsi_sim_time(const chemsi_sim* sim);
+
+/** Observation columns (ObservationFrameV1 order, t_s first) */
+CHEMSI_C_API int chemsi_observation_column_count(void);
+CHEMSI_C_API const char* chemsi_observation_column_name(int column);
+
+/** Copy the current observation; returns columns written (<= cap) or a CHEMSI_E_* code */
+CHEMSI_C_API int chemsi_sim_observe(const chemsi_sim* sim, double* out, int cap);
+
+/**
+ * Copy the recent v1 telemetry window (oldest first), 8 floats per row in
+ * TelemetrySampleV1 order; returns rows written (<= cap_rows) or CHEMSI_E_*
+ */
+CHEMSI_C_API int chemsi_sim_telemetry(const chemsi_sim* sim, float* out, int cap_rows);
+
+/* ---- Batched scenarios ------------------------------------------------ */
+
+CHEMSI_C_API int chemsi_param_count(void);
+CHEMSI_C_API const char* chemsi_param_name(int column);
+CHEMSI_C_API double chemsi_param_default(int column);
+CHEMSI_C_API int chemsi_metric_count(void);
+CHEMSI_C_API const char* chemsi_metric_name(int column);
+
+/**
+ * Run `rows` scenarios.
+ *
+ * params:    rows x param_cols doubles, row-major (param_cols <= chemsi_param_count())
+ * metrics:   rows x chemsi_metric_count() doubles, row-major
+ * telemetry: optional rows x telemetry_cap x 8 floats; telemetry_rows
+ *            (optional) receives the samples written per row
+ * threads:   0 = one per core
+ *
+ * Every row is validated before any runs; returns CHEMSI_OK or CHEMSI_E_*.
+ */
+CHEMSI_C_API int chemsi_run_batch(const double* params, int64_t rows, int param_cols, double* metrics,
+                                  float* telemetry, int telemetry_cap, int32_t* telemetry_rows, int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHEMSI_C_H */
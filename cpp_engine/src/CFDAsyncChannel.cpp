@@ -0,0 +1,505 @@
+/**
+ * @file CFDAsyncChannel.cpp
+ * @brief Shared-memory rings, solver process control and stand-in solver
+ *
+ * Phase 9: Track C - CFD Coupling (asynchronous mode)
+ */
+
+#include "CFDAsyncChannel.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <signal.h>
+  #include <spawn.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+extern char** environ;
+#endif
+
+namespace vfep {
+
+namespace {
+
+constexpr uint32_t CHANNEL_MAGIC = 0x44464356;  // "VCFD"
+constexpr uint32_t CHANNEL_VERSION = 1;
+constexpr size_t CACHE_LINE = 64;
+constexpr size_t NUM_FIELDS = static_cast<size_t>(CFDField::Count);
+
+constexpr size_t roundUp(size_t n) { return (n + CACHE_LINE - 1) & ~(CACHE_LINE - 1); }
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared-memory rings require lock-free 64-bit atomics");
+
+} // namespace
+
+// Shared header; producer and consumer indices sit on separate cache lines
+struct CFDAsyncChannel::Header {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slots;
+    uint32_t max_points;
+    uint64_t total_bytes;
+    alignas(CACHE_LINE) std::atomic<uint64_t> boundary_head;  // Next to read
+    alignas(CACHE_LINE) std::atomic<uint64_t> boundary_tail;  // Next to write
+    alignas(CACHE_LINE) std::atomic<uint64_t> result_head;
+    alignas(CACHE_LINE) std::atomic<uint64_t> result_tail;
+    alignas(CACHE_LINE) std::atomic<uint32_t> solver_ready;
+    std::atomic<uint32_t> shutdown;
+};
+
+// ============================================================================
+// MAPPING
+// ============================================================================
+
+std::string CFDAsyncChannel::uniqueName(const std::string& prefix) {
+    static std::atomic<uint32_t> counter{0};
+#if defined(_WIN32)
+    const unsigned long pid = GetCurrentProcessId();
+#else
+    const unsigned long pid = static_cast<unsigned long>(getpid());
+#endif
+    return prefix + "_" + std::to_string(pid) + "_" + std::to_string(counter.fetch_add(1));
+}
+
+size_t CFDAsyncChannel::resultSlotBytes() const {
+    return roundUp(sizeof(CFDResultHeader) +
+                   NUM_FIELDS * static_cast<size_t>(header()->max_points) * sizeof(double));
+}
+
+uint8_t* CFDAsyncChannel::boundarySlot(uint64_t index) const {
+    const size_t offset = roundUp(sizeof(Header)) +
+                          static_cast<size_t>(index % header()->slots) * roundUp(sizeof(CFDBoundaryMessage));
+    return base_ + offset;
+}
+
+uint8_t* CFDAsyncChannel::resultSlot(uint64_t index) const {
+    const size_t offset = roundUp(sizeof(Header)) +
+                          header()->slots * roundUp(sizeof(CFDBoundaryMessage)) +
+                          static_cast<size_t>(index % header()->slots) * resultSlotBytes();
+    return base_ + offset;
+}
+
+uint32_t CFDAsyncChannel::maxPoints() const {
+    return base_ ? header()->max_points : 0;
+}
+
+#if defined(_WIN32)
+
+bool CFDAsyncChannel::create(const std::string& name, uint32_t slots, uint32_t max_points) {
+    close();
+    if (slots == 0 || max_points == 0) return false;
+
+    const size_t bytes = roundUp(sizeof(Header)) + slots * roundUp(sizeof(CFDBoundaryMessage)) +
+                         slots * roundUp(sizeof(CFDResultHeader) + NUM_FIELDS * max_points * sizeof(double));
+    const std::string os_name = "Local\\" + name;
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(static_cast<uint64_t>(bytes) >> 32),
+                                        static_cast<DWORD>(bytes & 0xFFFFFFFFu), os_name.c_str());
+    if (!mapping || GetLastError() == ERROR_ALREADY_EXISTS) {
+        if (mapping) CloseHandle(mapping);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_handle_ = mapping;
+    base_ = static_cast<uint8_t*>(view);
+    size_ = bytes;
+    name_ = name;
+    owner_ = true;
+
+    Header* h = new (base_) Header();
+    h->version = CHANNEL_VERSION;
+    h->slots = slots;
+    h->max_points = max_points;
+    h->total_bytes = bytes;
+    h->magic.store(CHANNEL_MAGIC, std::memory_order_release);
+    return true;
+}
+
+bool CFDAsyncChannel::open(const std::string& name) {
+    close();
+    const std::string os_name = "Local\\" + name;
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, os_name.c_str());
+    if (!mapping) return false;
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_handle_ = mapping;
+    base_ = static_cast<uint8_t*>(view);
+    name_ = name;
+    owner_ = false;
+    if (header()->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC ||
+        header()->version != CHANNEL_VERSION) {
+        close();
+        return false;
+    }
+    size_ = static_cast<size_t>(header()->total_bytes);
+    return true;
+}
+
+void CFDAsyncChannel::close() {
+    if (base_) {
+        UnmapViewOfFile(base_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    mapping_handle_ = nullptr;
+    base_ = nullptr;
+    size_ = 0;
+    owner_ = false;
+}
+
+#else
+
+bool CFDAsyncChannel::create(const std::string& name, uint32_t slots, uint32_t max_points) {
+    close();
+    if (slots == 0 || max_points == 0) return false;
+
+    const size_t bytes = roundUp(sizeof(Header)) + slots * roundUp(sizeof(CFDBoundaryMessage)) +
+                         slots * roundUp(sizeof(CFDResultHeader) + NUM_FIELDS * max_points * sizeof(double));
+    const std::string os_name = "/" + name;
+    const int fd = shm_open(os_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        ::close(fd);
+        shm_unlink(os_name.c_str());
+        return false;
+    }
+    void* view = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        shm_unlink(os_name.c_str());
+        return false;
+    }
+    base_ = static_cast<uint8_t*>(view);
+    size_ = bytes;
+    name_ = name;
+    owner_ = true;
+
+    Header* h = new (base_) Header();
+    h->version = CHANNEL_VERSION;
+    h->slots = slots;
+    h->max_points = max_points;
+    h->total_bytes = bytes;
+    h->magic.store(CHANNEL_MAGIC, std::memory_order_release);
+    return true;
+}
+
+bool CFDAsyncChannel::open(const std::string& name) {
+    close();
+    const std::string os_name = "/" + name;
+    const int fd = shm_open(os_name.c_str(), O_RDWR, 0600);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < roundUp(sizeof(Header))) {
+        ::close(fd);
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(st.st_size);
+    void* view = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+
+    base_ = static_cast<uint8_t*>(view);
+    size_ = bytes;
+    name_ = name;
+    owner_ = false;
+    if (header()->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC ||
+        header()->version != CHANNEL_VERSION || header()->total_bytes != bytes) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CFDAsyncChannel::close() {
+    if (base_) {
+        munmap(base_, size_);
+        if (owner_) {
+            shm_unlink(("/" + name_).c_str());
+        }
+    }
+    base_ = nullptr;
+    size_ = 0;
+    owner_ = false;
+}
+
+#endif
+
+// ============================================================================
+// RINGS
+// ============================================================================
+
+bool CFDAsyncChannel::pushBoundary(const CFDBoundaryMessage& msg) {
+    Header* h = header();
+    const uint64_t tail = h->boundary_tail.load(std::memory_order_relaxed);
+    if (tail - h->boundary_head.load(std::memory_order_acquire) >= h->slots) {
+        return false;
+    }
+    std::memcpy(boundarySlot(tail), &msg, sizeof(msg));
+    h->boundary_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool CFDAsyncChannel::popBoundary(CFDBoundaryMessage& msg) {
+    Header* h = header();
+    const uint64_t head = h->boundary_head.load(std::memory_order_relaxed);
+    if (head == h->boundary_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::memcpy(&msg, boundarySlot(head), sizeof(msg));
+    h->boundary_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+CFDResultHeader* CFDAsyncChannel::beginResult(double* fields[NUM_FIELDS]) {
+    Header* h = header();
+    const uint64_t tail = h->result_tail.load(std::memory_order_relaxed);
+    if (tail - h->result_head.load(std::memory_order_acquire) >= h->slots) {
+        return nullptr;
+    }
+    uint8_t* slot = resultSlot(tail);
+    double* arrays = reinterpret_cast<double*>(slot + sizeof(CFDResultHeader));
+    for (size_t f = 0; f < NUM_FIELDS; ++f) {
+        fields[f] = arrays + f * h->max_points;
+    }
+    return reinterpret_cast<CFDResultHeader*>(slot);
+}
+
+void CFDAsyncChannel::commitResult() {
+    Header* h = header();
+    h->result_tail.store(h->result_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+const CFDResultHeader* CFDAsyncChannel::peekResult(const double* fields[NUM_FIELDS]) const {
+    Header* h = header();
+    const uint64_t head = h->result_head.load(std::memory_order_relaxed);
+    if (head == h->result_tail.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    const uint8_t* slot = resultSlot(head);
+    const double* arrays = reinterpret_cast<const double*>(slot + sizeof(CFDResultHeader));
+    for (size_t f = 0; f < NUM_FIELDS; ++f) {
+        fields[f] = arrays + f * h->max_points;
+    }
+    return reinterpret_cast<const CFDResultHeader*>(slot);
+}
+
+void CFDAsyncChannel::releaseResult() {
+    Header* h = header();
+    h->result_head.store(h->result_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void CFDAsyncChannel::setSolverReady() {
+    header()->solver_ready.store(1, std::memory_order_release);
+}
+
+bool CFDAsyncChannel::solverReady() const {
+    return base_ && header()->solver_ready.load(std::memory_order_acquire) != 0;
+}
+
+void CFDAsyncChannel::requestShutdown() {
+    if (base_) {
+        header()->shutdown.store(1, std::memory_order_release);
+    }
+}
+
+bool CFDAsyncChannel::shutdownRequested() const {
+    return !base_ || header()->shutdown.load(std::memory_order_acquire) != 0;
+}
+
+// ============================================================================
+// SOLVER PROCESS
+// ============================================================================
+
+CFDSolverProcess::~CFDSolverProcess() {
+    stop(0);
+}
+
+#if defined(_WIN32)
+
+bool CFDSolverProcess::launch(const std::string& executable, const std::vector<std::string>& args) {
+    stop(0);
+    std::string cmd = "\"" + executable + "\"";
+    for (const auto& a : args) {
+        cmd += " \"" + a + "\"";
+    }
+    STARTUPINFOA si{};
+    si.cb = sizeof(si);
+    PROCESS_INFORMATION pi{};
+    if (!CreateProcessA(nullptr, &cmd[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si, &pi)) {
+        return false;
+    }
+    CloseHandle(pi.hThread);
+    process_handle_ = pi.hProcess;
+    return true;
+}
+
+bool CFDSolverProcess::isRunning() const {
+    return process_handle_ &&
+           WaitForSingleObject(static_cast<HANDLE>(process_handle_), 0) == WAIT_TIMEOUT;
+}
+
+void CFDSolverProcess::stop(int timeout_ms) {
+    if (!process_handle_) return;
+    HANDLE h = static_cast<HANDLE>(process_handle_);
+    if (WaitForSingleObject(h, static_cast<DWORD>(timeout_ms)) == WAIT_TIMEOUT) {
+        TerminateProcess(h, 1);
+        WaitForSingleObject(h, INFINITE);
+    }
+    CloseHandle(h);
+    process_handle_ = nullptr;
+}
+
+#else
+
+bool CFDSolverProcess::launch(const std::string& executable, const std::vector<std::string>& args) {
+    stop(0);
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(executable.c_str()));
+    for (const auto& a : args) {
+        argv.push_back(const_cast<char*>(a.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid = -1;
+    if (posix_spawnp(&pid, executable.c_str(), nullptr, nullptr, argv.data(), environ) != 0) {
+        return false;
+    }
+    pid_ = pid;
+    return true;
+}
+
+bool CFDSolverProcess::isRunning() const {
+    if (pid_ <= 0) return false;
+    return waitpid(static_cast<pid_t>(pid_), nullptr, WNOHANG) == 0;
+}
+
+void CFDSolverProcess::stop(int timeout_ms) {
+    if (pid_ <= 0) return;
+    const pid_t pid = static_cast<pid_t>(pid_);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (waitpid(pid, nullptr, WNOHANG) == 0) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    pid_ = -1;
+}
+
+#endif
+
+// ============================================================================
+// STAND-IN SOLVER
+// ============================================================================
+
+int mockCFDZoneAt(double z_m) {
+    return z_m > 2.0 ? 0 : (z_m > 1.0 ? 1 : 2);
+}
+
+double mockCFDZoneW(int zone) {
+    return zone == 2 ? 0.1 : 0.5;  // Simple buoyancy estimate
+}
+
+uint64_t runCFDStandInSolver(CFDAsyncChannel& channel, const CFDStandInOptions& options,
+                             const std::atomic<bool>* stop) {
+    const int nx = options.nx, ny = options.ny, nz = options.nz;
+    const size_t plane = static_cast<size_t>(nx) * ny;
+    const size_t n = plane * nz;
+    if (nx < 2 || ny < 2 || nz < 2 || n > channel.maxPoints()) {
+        return 0;
+    }
+    const double dx = options.length_x_m / (nx - 1);
+    const double dy = options.length_y_m / (ny - 1);
+    const double dz = options.height_m / (nz - 1);
+
+    // Same perturbation as CFDCoupler::runMockCFDStep
+    const double omega = 0.5;  // rad/s
+    const double amp_T = 5.0;  // K
+    const double amp_w = 0.1;  // m/s
+
+    auto stopping = [&]() {
+        return channel.shutdownRequested() || (stop && stop->load(std::memory_order_acquire));
+    };
+
+    channel.setSolverReady();
+    uint64_t published = 0;
+    CFDBoundaryMessage msg;
+    while (!stopping()) {
+        if (!channel.popBoundary(msg)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        const auto t0 = std::chrono::steady_clock::now();
+
+        double* fields[static_cast<size_t>(CFDField::Count)];
+        CFDResultHeader* result = nullptr;
+        while (!(result = channel.beginResult(fields))) {
+            if (stopping()) return published;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        for (int k = 0; k < nz; ++k) {
+            const double z = k * dz;
+            const int zone = mockCFDZoneAt(z);
+            const double phase = omega * msg.sim_time_s + 0.5 * z;
+            const double T = msg.zone_T_K[zone] + amp_T * std::sin(phase);
+            const double w = msg.zone_w_m_s[zone] + amp_w * std::cos(phase);
+            for (size_t idx = k * plane; idx < (k + 1) * plane; ++idx) {
+                fields[static_cast<size_t>(CFDField::Temperature)][idx] = T;
+                fields[static_cast<size_t>(CFDField::VelocityU)][idx] = 0.0;
+                fields[static_cast<size_t>(CFDField::VelocityV)][idx] = 0.0;
+                fields[static_cast<size_t>(CFDField::VelocityW)][idx] = w;
+                fields[static_cast<size_t>(CFDField::Density)][idx] = msg.zone_rho_kg_m3[zone];
+                fields[static_cast<size_t>(CFDField::Pressure)][idx] = msg.zone_P_Pa[zone];
+            }
+        }
+
+        if (options.latency_ms > 0.0) {
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(options.latency_ms));
+        }
+
+        result->sequence = msg.sequence;
+        result->sim_time_s = msg.sim_time_s;
+        result->solver_time_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        result->nx = nx;
+        result->ny = ny;
+        result->nz = nz;
+        result->reserved = 0;
+        result->x_min = 0.0;
+        result->y_min = 0.0;
+        result->z_min = 0.0;
+        result->dx = dx;
+        result->dy = dy;
+        result->dz = dz;
+        channel.commitResult();
+        ++published;
+    }
+    return published;
+}
+
+} // namespace vfep
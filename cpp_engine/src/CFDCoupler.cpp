@@ -12,12 +12,18 @@
  */
 
 #include "CFDCoupler.h"
+#include "CFDAsyncChannel.h"
+#include "CFDTimeSeries.h"
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <stdexcept>
 #include <cmath>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <thread>
 
 namespace vfep {
 
@@ -25,6 +31,26 @@ namespace vfep {
 constexpr float DEFAULT_COUPLING_DT = 0.1f;  // 100ms coupling timestep
 constexpr int DEFAULT_REMESH_FREQ = 10;      // Remesh every 10 coupling steps
 
+constexpr size_t NUM_CFD_FIELDS = static_cast<size_t>(CFDField::Count);
+
+// Asynchronous coupling state: channel, optional child solver, and the two
+// newest results kept for temporal extrapolation
+struct CFDCoupler::AsyncState {
+    CFDAsyncConfig config;
+    CFDAsyncChannel channel;
+    CFDSolverProcess process;
+    CFDAsyncStats stats;
+    uint64_t next_sequence = 0;
+    float start_time_s = 0.0f;
+
+    std::array<std::vector<double>, NUM_CFD_FIELDS> prev_fields;
+    std::array<std::vector<double>, NUM_CFD_FIELDS> last_fields;
+    float prev_time_s = 0.0f;
+    float last_time_s = 0.0f;
+    int results_held = 0;  // 0, 1 or 2
+    CFDResultHeader last_geometry{};
+};
+
 // ============================================================================
 // CONSTRUCTION & INITIALIZATION
 // ============================================================================
@@ -33,15 +59,19 @@ CFDCoupler::CFDCoupler()
     : last_sync_time_(0.0f),
       loose_coupling_dt_(DEFAULT_COUPLING_DT),
             remesh_frequency_(DEFAULT_REMESH_FREQ),
-            sync_count_(0) {
+            sync_count_(0),
+            replay_offset_s_(0.0) {
     // Initialize with empty CFD interface
 }
 
 CFDCoupler::~CFDCoupler() {
-    // Cleanup handled automatically
+    // Let an attached solver process exit cleanly
+    stopAsyncCoupling();
 }
 
 void CFDCoupler::reset() {
+    stopAsyncCoupling();
+    stopReplay();
     cfd_interface_.clear();
     last_sync_time_ = 0.0f;
     loose_coupling_dt_ = DEFAULT_COUPLING_DT;
@@ -129,6 +159,16 @@ void CFDCoupler::exportBoundaryConditions(const ThreeZoneModel& zones) {
     lower_pt.w = 0.0;  // No vertical velocity at floor
     boundary_points.push_back(lower_pt);
     
+    // Asynchronous mode: hand the conditions to the external solver; the
+    // local mapping only seeds the grid until the first result arrives
+    if (async_) {
+        publishBoundaryConditions(zones);
+        if (cfd_interface_.gridPointCount() == 0) {
+            mapZoneToCFDDomain(zones);
+        }
+        return;
+    }
+
     // In a real system, we'd write these to file or send to CFD solver
     // For now, store in internal CFD interface, honoring remesh cadence
     if (sync_count_ % remesh_frequency_ == 0 || cfd_interface_.gridPointCount() == 0) {
@@ -140,6 +180,12 @@ void CFDCoupler::exportBoundaryConditions(const ThreeZoneModel& zones) {
 // CFD RESULT IMPORT
 // ============================================================================
 
+void CFDCoupler::importCFDResults(CFDInterface&& cfd) {
+    // Take ownership of the solver's arrays instead of copying them
+    cfd_interface_ = std::move(cfd);
+    mapCFDDomainToZones();
+}
+
 void CFDCoupler::importCFDResults(const CFDInterface& cfd) {
     // Import CFD results into our internal interface
     // In a real implementation, this would:
@@ -186,7 +232,15 @@ void CFDCoupler::synchronize(float sim_time_s) {
     last_sync_time_ = sim_time_s;
     ++sync_count_;
 
-    runMockCFDStep(sim_time_s);
+    if (async_) {
+        synchronizeAsync(sim_time_s);
+    } else if (replay_) {
+        if (replay_->sample(sim_time_s + replay_offset_s_, cfd_interface_)) {
+            mapCFDDomainToZones();
+        }
+    } else {
+        runMockCFDStep(sim_time_s);
+    }
 }
 
 // ============================================================================
@@ -266,55 +320,264 @@ bool CFDCoupler::exportCouplingCSV(const std::string& filename,
     return true;
 }
 
+// ============================================================================
+// ASYNCHRONOUS COUPLING
+// ============================================================================
+
+bool CFDCoupler::startAsyncCoupling(const CFDAsyncConfig& config) {
+    if (config.ring_slots < 2) {
+        throw std::invalid_argument("Async coupling needs at least 2 ring slots");
+    }
+    if (config.max_points < 8) {
+        throw std::invalid_argument("Async coupling max_points must hold at least one cell");
+    }
+    if (config.max_staleness_s < 0.0f || config.max_wait_ms < 0 || config.startup_timeout_ms < 0) {
+        throw std::invalid_argument("Async coupling bounds must be non-negative");
+    }
+    if (replay_) {
+        throw std::logic_error("Stop replay before starting async coupling");
+    }
+
+    stopAsyncCoupling();
+
+    auto state = std::make_unique<AsyncState>();
+    state->config = config;
+    if (state->config.channel_name.empty()) {
+        state->config.channel_name = CFDAsyncChannel::uniqueName("vfep_cfd");
+    }
+    if (!state->channel.create(state->config.channel_name, config.ring_slots, config.max_points)) {
+        return false;
+    }
+
+    if (!config.solver_executable.empty() &&
+        !state->process.launch(config.solver_executable, {"--channel", state->config.channel_name})) {
+        return false;
+    }
+
+    if (config.startup_timeout_ms > 0) {
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds(config.startup_timeout_ms);
+        while (!state->channel.solverReady()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                state->channel.requestShutdown();
+                state->process.stop(100);
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    state->start_time_s = last_sync_time_;
+    async_ = std::move(state);
+    return true;
+}
+
+void CFDCoupler::stopAsyncCoupling() {
+    if (!async_) {
+        return;
+    }
+    async_->channel.requestShutdown();
+    async_->process.stop(1000);
+    async_->channel.close();
+    async_.reset();
+}
+
+const CFDAsyncStats& CFDCoupler::asyncStats() const {
+    static const CFDAsyncStats empty{};
+    return async_ ? async_->stats : empty;
+}
+
+std::string CFDCoupler::asyncChannelName() const {
+    return async_ ? async_->channel.name() : std::string();
+}
+
+void CFDCoupler::publishBoundaryConditions(const ThreeZoneModel& zones) {
+    AsyncState& a = *async_;
+
+    CFDBoundaryMessage msg{};
+    msg.sequence = a.next_sequence;
+    msg.sim_time_s = last_sync_time_;
+    const Zone* zone_ptrs[3] = {&zones.upperZone(), &zones.middleZone(), &zones.lowerZone()};
+    for (int z = 0; z < 3; ++z) {
+        msg.zone_T_K[z] = zone_ptrs[z]->T_K;
+        msg.zone_rho_kg_m3[z] = zone_ptrs[z]->density_kg_m3();
+        msg.zone_P_Pa[z] = zone_ptrs[z]->P_Pa;
+        msg.zone_w_m_s[z] = mockCFDZoneW(z);
+    }
+
+    if (a.channel.pushBoundary(msg)) {
+        ++a.next_sequence;
+        ++a.stats.boundaries_sent;
+    } else {
+        ++a.stats.boundaries_dropped;  // Solver is behind; newer state follows
+    }
+}
+
+bool CFDCoupler::applyPendingResults(float sim_time_s) {
+    AsyncState& a = *async_;
+    bool applied = false;
+
+    const double* fields[NUM_CFD_FIELDS];
+    while (const CFDResultHeader* result = a.channel.peekResult(fields)) {
+        const size_t n = static_cast<size_t>(result->nx) * result->ny * result->nz;
+        if (result->nx < 2 || result->ny < 2 || result->nz < 2 || n > a.channel.maxPoints()) {
+            a.channel.releaseResult();  // Malformed: skip
+            continue;
+        }
+
+        // Newest result becomes "last"; the previous one is kept for extrapolation
+        std::swap(a.prev_fields, a.last_fields);
+        a.prev_time_s = a.last_time_s;
+        for (size_t f = 0; f < NUM_CFD_FIELDS; ++f) {
+            a.last_fields[f].resize(n);
+            std::memcpy(a.last_fields[f].data(), fields[f], n * sizeof(double));
+        }
+        a.last_time_s = static_cast<float>(result->sim_time_s);
+        a.last_geometry = *result;
+        a.results_held = std::min(a.results_held + 1, 2);
+
+        CFDAsyncStats& st = a.stats;
+        ++st.results_applied;
+        st.last_solver_ms = result->solver_time_ms;
+        st.mean_solver_ms += (result->solver_time_ms - st.mean_solver_ms) / static_cast<double>(st.results_applied);
+        st.last_lag_s = sim_time_s - a.last_time_s;
+        st.max_lag_s = std::max(st.max_lag_s, st.last_lag_s);
+
+        a.channel.releaseResult();
+        applied = true;
+    }
+    return applied;
+}
+
+void CFDCoupler::synchronizeAsync(float sim_time_s) {
+    AsyncState& a = *async_;
+    applyPendingResults(sim_time_s);
+
+    // Staleness bound: wait for the solver only while requests are outstanding
+    auto staleness = [&]() {
+        return sim_time_s - (a.results_held > 0 ? a.last_time_s : a.start_time_s);
+    };
+    auto outstanding = [&]() {
+        return a.stats.results_applied < a.stats.boundaries_sent;
+    };
+    if (staleness() > a.config.max_staleness_s && outstanding()) {
+        ++a.stats.blocking_waits;
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto deadline = t0 + std::chrono::milliseconds(a.config.max_wait_ms);
+        while (staleness() > a.config.max_staleness_s && outstanding()) {
+            if (applyPendingResults(sim_time_s)) {
+                continue;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                ++a.stats.stale_syncs;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        a.stats.total_wait_ms +=
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    a.stats.staleness_s = staleness();
+    updateExtrapolatedFields(sim_time_s);
+}
+
+void CFDCoupler::updateExtrapolatedFields(float sim_time_s) {
+    AsyncState& a = *async_;
+    if (a.results_held == 0) {
+        return;  // Keep the locally seeded grid
+    }
+
+    const CFDResultHeader& g = a.last_geometry;
+    const size_t n = a.last_fields[0].size();
+    if (!cfd_interface_.isStructured() || cfd_interface_.gridPointCount() != n ||
+        cfd_interface_.gridNx() != g.nx || cfd_interface_.gridNy() != g.ny ||
+        cfd_interface_.gridNz() != g.nz) {
+        cfd_interface_.resizeStructuredGrid(g.nx, g.ny, g.nz, g.x_min, g.y_min, g.z_min, g.dx, g.dy, g.dz);
+    }
+
+    // Linear extrapolation, limited to one result interval ahead
+    double alpha = 0.0;
+    const bool can_extrapolate = a.config.extrapolate && a.results_held == 2 &&
+                                 a.prev_fields[0].size() == n && a.last_time_s > a.prev_time_s;
+    if (can_extrapolate) {
+        alpha = (sim_time_s - a.last_time_s) / static_cast<double>(a.last_time_s - a.prev_time_s);
+        alpha = std::max(0.0, std::min(1.0, alpha));
+    }
+
+    for (size_t f = 0; f < NUM_CFD_FIELDS; ++f) {
+        double* dst = cfd_interface_.mutableFieldData(static_cast<CFDField>(f));
+        const double* last = a.last_fields[f].data();
+        if (alpha > 0.0) {
+            const double* prev = a.prev_fields[f].data();
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = last[i] + alpha * (last[i] - prev[i]);
+            }
+        } else {
+            std::memcpy(dst, last, n * sizeof(double));
+        }
+    }
+}
+
+// ============================================================================
+// TRANSIENT REPLAY
+// ============================================================================
+
+void CFDCoupler::startReplay(std::shared_ptr<CFDTimeSeries> series, double time_offset_s) {
+    if (!series || series->frameCount() == 0) {
+        throw std::invalid_argument("Replay needs a non-empty CFD time series");
+    }
+    if (async_) {
+        throw std::logic_error("Stop async coupling before starting replay");
+    }
+    replay_ = std::move(series);
+    replay_offset_s_ = time_offset_s;
+}
+
+void CFDCoupler::stopReplay() {
+    replay_.reset();
+    replay_offset_s_ = 0.0;
+}
+
 // ============================================================================
 // PRIVATE METHODS - DOMAIN MAPPING
 // ============================================================================
 
 void CFDCoupler::mapZoneToCFDDomain(const ThreeZoneModel& zones) {
     // Map zone model to CFD domain
-    // Create a simple structured grid with zone-averaged properties
-    
-    std::vector<GridPoint> grid;
-    
+    // Create a simple structured grid with zone-averaged properties,
+    // written straight into the interface's field arrays
+
     // Create 3x3x3 grid (27 points) representing the three zones
     const int nx = 3, ny = 3, nz = 3;
     const double dx = 1.0 / (nx - 1);
     const double dy = 1.0 / (ny - 1);
     const double dz = 3.0 / (nz - 1);  // 3m height
-    
+
+    cfd_interface_.resizeStructuredGrid(nx, ny, nz, 0.0, 0.0, 0.0, dx, dy, dz);
+    double* T = cfd_interface_.mutableFieldData(CFDField::Temperature);
+    double* u = cfd_interface_.mutableFieldData(CFDField::VelocityU);
+    double* v = cfd_interface_.mutableFieldData(CFDField::VelocityV);
+    double* w = cfd_interface_.mutableFieldData(CFDField::VelocityW);
+    double* rho = cfd_interface_.mutableFieldData(CFDField::Density);
+    double* P = cfd_interface_.mutableFieldData(CFDField::Pressure);
+
+    const size_t plane = static_cast<size_t>(nx) * ny;
     for (int k = 0; k < nz; ++k) {
         // Determine which zone this height belongs to
-        double z = k * dz;
-        const Zone* zone_ptr;
-        
-        if (z > 2.0) {
-            zone_ptr = &zones.upperZone();
-        } else if (z > 1.0) {
-            zone_ptr = &zones.middleZone();
-        } else {
-            zone_ptr = &zones.lowerZone();
-        }
-        
-        for (int j = 0; j < ny; ++j) {
-            for (int i = 0; i < nx; ++i) {
-                GridPoint pt;
-                pt.x = i * dx;
-                pt.y = j * dy;
-                pt.z = z;
-                pt.T_K = zone_ptr->T_K;
-                pt.rho_kg_m3 = zone_ptr->density_kg_m3();
-                pt.P_Pa = zone_ptr->P_Pa;
-                pt.u = 0.0;
-                pt.v = 0.0;
-                pt.w = (z > 1.0) ? 0.5 : 0.1;  // Simple buoyancy estimate
-                
-                grid.push_back(pt);
-            }
-        }
+        const double z = k * dz;
+        const int zone = mockCFDZoneAt(z);
+        const Zone* zone_ptr = zone == 0 ? &zones.upperZone()
+                             : zone == 1 ? &zones.middleZone() : &zones.lowerZone();
+
+        const size_t begin = k * plane;
+        std::fill(T + begin, T + begin + plane, zone_ptr->T_K);
+        std::fill(rho + begin, rho + begin + plane, zone_ptr->density_kg_m3());
+        std::fill(P + begin, P + begin + plane, zone_ptr->P_Pa);
+        std::fill(u + begin, u + begin + plane, 0.0);
+        std::fill(v + begin, v + begin + plane, 0.0);
+        std::fill(w + begin, w + begin + plane, mockCFDZoneW(zone));
     }
-    
-    // Store in internal CFD interface (normally would export to file)
-    cfd_interface_.setGridPoints(grid, nx, ny, nz, 0.0, 0.0, 0.0, dx, dy, dz);
 }
 
 void CFDCoupler::runMockCFDStep(float sim_time_s) {
@@ -322,28 +585,36 @@ void CFDCoupler::runMockCFDStep(float sim_time_s) {
         return;
     }
 
-    std::vector<GridPoint> updated = cfd_interface_.gridPoints();
     const double omega = 0.5;  // rad/s
     const double amp_T = 5.0;  // K
     const double amp_w = 0.1;  // m/s
 
-    for (auto& p : updated) {
-        const double phase = omega * sim_time_s + 0.5 * p.z;
-        p.T_K += amp_T * std::sin(phase);
-        p.w += amp_w * std::cos(phase);
-    }
-
-    cfd_interface_.setGridPoints(
-        updated,
-        cfd_interface_.gridNx(),
-        cfd_interface_.gridNy(),
-        cfd_interface_.gridNz(),
-        cfd_interface_.gridXMin(),
-        cfd_interface_.gridYMin(),
-        cfd_interface_.gridZMin(),
-        cfd_interface_.gridDx(),
-        cfd_interface_.gridDy(),
-        cfd_interface_.gridDz());
+    if (!cfd_interface_.isStructured()) {
+        for (auto& p : cfd_interface_.mutableGridPoints()) {
+            const double phase = omega * sim_time_s + 0.5 * p.z;
+            p.T_K += amp_T * std::sin(phase);
+            p.w += amp_w * std::cos(phase);
+        }
+        cfd_interface_.rebuildOctree();
+        return;
+    }
+
+    // Structured grid: update in place, one phase per z-plane
+    double* T = cfd_interface_.mutableFieldData(CFDField::Temperature);
+    double* w = cfd_interface_.mutableFieldData(CFDField::VelocityW);
+    const size_t plane = static_cast<size_t>(cfd_interface_.gridNx()) * cfd_interface_.gridNy();
+    for (int k = 0; k < cfd_interface_.gridNz(); ++k) {
+        const double z = cfd_interface_.gridZMin() + k * cfd_interface_.gridDz();
+        const double phase = omega * sim_time_s + 0.5 * z;
+        const double dT = amp_T * std::sin(phase);
+        const double dw = amp_w * std::cos(phase);
+        double* T_plane = T + k * plane;
+        double* w_plane = w + k * plane;
+        for (size_t idx = 0; idx < plane; ++idx) {
+            T_plane[idx] += dT;
+            w_plane[idx] += dw;
+        }
+    }
 }
 
 void CFDCoupler::mapCFDDomainToZones() {
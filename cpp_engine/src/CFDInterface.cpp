@@ -1,14 +1,182 @@
 #include "CFDInterface.h"
+#include "OctreeField.h"
+#include "ParallelFor.h"
+#include "VTKIO.h"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cstdint>
 #include <cmath>
 #include <iomanip>
+#include <stdexcept>
 
 namespace vfep {
 
+namespace {
+
+constexpr double AMBIENT_T_K = 293.15;
+constexpr size_t MIN_POINTS_PER_THREAD = 1 << 16;
+constexpr size_t MIN_PROBES_PER_THREAD = 1 << 15;
+constexpr size_t PROBE_BLOCK = 64;  // Probes per index/gather/blend pass
+constexpr int DEFAULT_OCTREE_DEPTH = 10;
+constexpr size_t DEFAULT_OCTREE_LEAF_POINTS = 8;
+
+constexpr size_t STATS_BLOCK = 256;  // Points per in-cache statistics block
+
+constexpr size_t fieldIndex(CFDField f) { return static_cast<size_t>(f); }
+
+// Running comparison moments for one set of points. Unlabelled passes
+// reduce blocks of points with a two-pass mean/co-moment while they sit in
+// cache; labelled passes add points one at a time (Welford). Partials are
+// merged with the pairwise update of Chan et al.
+struct ComparisonAccumulator {
+    size_t n = 0;
+    double mean_abs = 0.0;   // Mean |a - b|
+    double mean_sq = 0.0;    // Mean (a - b)^2
+    double max_abs = 0.0;
+    double mean_a = 0.0, mean_b = 0.0;
+    double m2_a = 0.0, m2_b = 0.0, c_ab = 0.0;
+
+    static ComparisonAccumulator fromBlock(const double* a, const double* b, size_t m) {
+        ComparisonAccumulator acc;
+        if (m == 0) return acc;
+        double sum_a = 0.0, sum_b = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            sum_a += a[i];
+            sum_b += b[i];
+        }
+        acc.n = m;
+        acc.mean_a = sum_a / m;
+        acc.mean_b = sum_b / m;
+        double sum_abs = 0.0, sum_sq = 0.0, max_abs = 0.0;
+        double m2_a = 0.0, m2_b = 0.0, c_ab = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            const double err = std::abs(a[i] - b[i]);
+            sum_abs += err;
+            sum_sq += err * err;
+            max_abs = std::max(max_abs, err);
+            const double da = a[i] - acc.mean_a;
+            const double db = b[i] - acc.mean_b;
+            m2_a += da * da;
+            m2_b += db * db;
+            c_ab += da * db;
+        }
+        acc.mean_abs = sum_abs / m;
+        acc.mean_sq = sum_sq / m;
+        acc.max_abs = max_abs;
+        acc.m2_a = m2_a;
+        acc.m2_b = m2_b;
+        acc.c_ab = c_ab;
+        return acc;
+    }
+
+    void add(double a, double b) {
+        ++n;
+        const double inv = 1.0 / static_cast<double>(n);
+        const double err = std::abs(a - b);
+        mean_abs += (err - mean_abs) * inv;
+        mean_sq += (err * err - mean_sq) * inv;
+        max_abs = std::max(max_abs, err);
+        const double da = a - mean_a;
+        const double db = b - mean_b;
+        mean_a += da * inv;
+        mean_b += db * inv;
+        m2_a += da * (a - mean_a);
+        m2_b += db * (b - mean_b);
+        c_ab += da * (b - mean_b);
+    }
+
+    void merge(const ComparisonAccumulator& o) {
+        if (o.n == 0) return;
+        if (n == 0) {
+            *this = o;
+            return;
+        }
+        const double n_a = static_cast<double>(n);
+        const double n_b = static_cast<double>(o.n);
+        const double total = n_a + n_b;
+        const double w = n_b / total;
+        const double da = o.mean_a - mean_a;
+        const double db = o.mean_b - mean_b;
+        m2_a += o.m2_a + da * da * n_a * w;
+        m2_b += o.m2_b + db * db * n_a * w;
+        c_ab += o.c_ab + da * db * n_a * w;
+        mean_a += da * w;
+        mean_b += db * w;
+        mean_abs += (o.mean_abs - mean_abs) * w;
+        mean_sq += (o.mean_sq - mean_sq) * w;
+        max_abs = std::max(max_abs, o.max_abs);
+        n += o.n;
+    }
+
+    ComparisonStats stats() const {
+        ComparisonStats s{};
+        s.num_points = static_cast<int>(n);
+        if (n == 0) return s;
+        s.mean_error = mean_abs;
+        s.max_error = max_abs;
+        s.rmse = std::sqrt(mean_sq);
+        const double denom = std::sqrt(m2_a * m2_b);
+        s.correlation = (denom > 1e-12) ? (c_ab / denom) : 0.0;
+        return s;
+    }
+};
+
+// One parallel pass over n points. get(i, a, b) fills the pair and returns
+// its label; labels >= num_labels are skipped. Each chunk keeps one
+// accumulator per label and adds points to it directly - labels can run to
+// tens of thousands, so there is no per-label staging. A dense pass (one
+// label, nothing skipped) instead goes through one in-cache block; masked
+// passes stay per point so they agree exactly with the same points taken
+// as a region. Chunk results are merged in a fixed order, so results do not
+// depend on thread timing.
+template <typename Get>
+std::vector<ComparisonAccumulator> reduceComparison(size_t n, size_t num_labels, bool dense, const Get& get) {
+    std::vector<std::vector<ComparisonAccumulator>> partial(
+        parallelWorkerCount(n, MIN_POINTS_PER_THREAD),
+        std::vector<ComparisonAccumulator>(num_labels));
+
+    const size_t chunks = parallelForChunks(n, MIN_POINTS_PER_THREAD, [&](size_t chunk, size_t begin, size_t end) {
+        std::vector<ComparisonAccumulator>& acc = partial[chunk];
+        if (!dense || num_labels != 1) {
+            for (size_t i = begin; i < end; ++i) {
+                double a, b;
+                const size_t label = get(i, a, b);
+                if (label < num_labels) acc[label].add(a, b);
+            }
+            return;
+        }
+        double buf_a[STATS_BLOCK], buf_b[STATS_BLOCK];
+        size_t fill = 0;
+        for (size_t i = begin; i < end; ++i) {
+            double a, b;
+            get(i, a, b);
+            buf_a[fill] = a;
+            buf_b[fill] = b;
+            if (++fill == STATS_BLOCK) {
+                acc[0].merge(ComparisonAccumulator::fromBlock(buf_a, buf_b, fill));
+                fill = 0;
+            }
+        }
+        acc[0].merge(ComparisonAccumulator::fromBlock(buf_a, buf_b, fill));
+    });
+
+    std::vector<ComparisonAccumulator> total(num_labels);
+    for (size_t c = 0; c < chunks; ++c) {
+        for (size_t label = 0; label < num_labels; ++label) {
+            total[label].merge(partial[c][label]);
+        }
+    }
+    return total;
+}
+
+} // namespace
+
 CFDInterface::CFDInterface()
-    : nx_(0), ny_(0), nz_(0)
+    : structured_(false)
+    , octree_depth_(DEFAULT_OCTREE_DEPTH)
+    , octree_leaf_points_(DEFAULT_OCTREE_LEAF_POINTS)
+    , nx_(0), ny_(0), nz_(0)
     , dx_(0.0), dy_(0.0), dz_(0.0)
     , x_min_(0.0), y_min_(0.0), z_min_(0.0)
 {}
@@ -56,169 +224,265 @@ bool CFDInterface::exportComparisonCSV(const std::string& csv_file,
 }
 
 double CFDInterface::interpolateTemperature(double x, double y, double z) const {
+    if (!structured_) {
+        return octree_ ? octree_->interpolate(CFDField::Temperature, x, y, z, AMBIENT_T_K)
+                       : AMBIENT_T_K;
+    }
     int i0, j0, k0;
     if (!findCell(x, y, z, i0, j0, k0)) {
-        return 293.15; // Default ambient if outside grid
+        return AMBIENT_T_K; // Default ambient if outside grid
     }
-    
-    // Get 8 corner values
-    auto getT = [this](int i, int j, int k) -> double {
-        int idx = i + j * nx_ + k * nx_ * ny_;
-        if (idx >= 0 && idx < static_cast<int>(grid_.size())) {
-            return grid_[idx].T_K;
-        }
-        return 293.15;
-    };
-    
-    double c000 = getT(i0, j0, k0);
-    double c100 = getT(i0 + 1, j0, k0);
-    double c010 = getT(i0, j0 + 1, k0);
-    double c110 = getT(i0 + 1, j0 + 1, k0);
-    double c001 = getT(i0, j0, k0 + 1);
-    double c101 = getT(i0 + 1, j0, k0 + 1);
-    double c011 = getT(i0, j0 + 1, k0 + 1);
-    double c111 = getT(i0 + 1, j0 + 1, k0 + 1);
-    
+
+    const double* T = fields_[fieldIndex(CFDField::Temperature)].data();
+    const size_t sy = static_cast<size_t>(nx_);
+    const size_t sz = sy * static_cast<size_t>(ny_);
+    const size_t base = i0 + j0 * sy + k0 * sz;
+
     // Fractional position in cell
     double fx = (x - (x_min_ + i0 * dx_)) / dx_;
     double fy = (y - (y_min_ + j0 * dy_)) / dy_;
     double fz = (z - (z_min_ + k0 * dz_)) / dz_;
-    
-    return trilinear(c000, c100, c010, c110, c001, c101, c011, c111, fx, fy, fz);
+
+    return trilinear(T[base], T[base + 1], T[base + sy], T[base + sy + 1],
+                     T[base + sz], T[base + sz + 1], T[base + sz + sy], T[base + sz + sy + 1],
+                     fx, fy, fz);
 }
 
 void CFDInterface::interpolateVelocity(double x, double y, double z,
                                       double& u, double& v, double& w) const {
+    if (!structured_) {
+        double values[OctreeField::NUM_FIELDS];
+        if (octree_ && octree_->interpolate(x, y, z, values)) {
+            u = values[fieldIndex(CFDField::VelocityU)];
+            v = values[fieldIndex(CFDField::VelocityV)];
+            w = values[fieldIndex(CFDField::VelocityW)];
+        } else {
+            u = v = w = 0.0;
+        }
+        return;
+    }
     int i0, j0, k0;
     if (!findCell(x, y, z, i0, j0, k0)) {
         u = v = w = 0.0;
         return;
     }
-    
-    auto getVel = [this](int i, int j, int k, double& u, double& v, double& w) {
-        int idx = i + j * nx_ + k * nx_ * ny_;
-        if (idx >= 0 && idx < static_cast<int>(grid_.size())) {
-            u = grid_[idx].u;
-            v = grid_[idx].v;
-            w = grid_[idx].w;
-        } else {
-            u = v = w = 0.0;
-        }
-    };
-    
-    double u000, v000, w000, u100, v100, w100;
-    double u010, v010, w010, u110, v110, w110;
-    double u001, v001, w001, u101, v101, w101;
-    double u011, v011, w011, u111, v111, w111;
-    
-    getVel(i0, j0, k0, u000, v000, w000);
-    getVel(i0 + 1, j0, k0, u100, v100, w100);
-    getVel(i0, j0 + 1, k0, u010, v010, w010);
-    getVel(i0 + 1, j0 + 1, k0, u110, v110, w110);
-    getVel(i0, j0, k0 + 1, u001, v001, w001);
-    getVel(i0 + 1, j0, k0 + 1, u101, v101, w101);
-    getVel(i0, j0 + 1, k0 + 1, u011, v011, w011);
-    getVel(i0 + 1, j0 + 1, k0 + 1, u111, v111, w111);
-    
+
+    const size_t sy = static_cast<size_t>(nx_);
+    const size_t sz = sy * static_cast<size_t>(ny_);
+    const size_t base = i0 + j0 * sy + k0 * sz;
+
     double fx = (x - (x_min_ + i0 * dx_)) / dx_;
     double fy = (y - (y_min_ + j0 * dy_)) / dy_;
     double fz = (z - (z_min_ + k0 * dz_)) / dz_;
-    
-    u = trilinear(u000, u100, u010, u110, u001, u101, u011, u111, fx, fy, fz);
-    v = trilinear(v000, v100, v010, v110, v001, v101, v011, v111, fx, fy, fz);
-    w = trilinear(w000, w100, w010, w110, w001, w101, w011, w111, fx, fy, fz);
+
+    auto sample = [&](CFDField f) {
+        const double* c = fields_[fieldIndex(f)].data();
+        return trilinear(c[base], c[base + 1], c[base + sy], c[base + sy + 1],
+                         c[base + sz], c[base + sz + 1], c[base + sz + sy], c[base + sz + sy + 1],
+                         fx, fy, fz);
+    };
+
+    u = sample(CFDField::VelocityU);
+    v = sample(CFDField::VelocityV);
+    w = sample(CFDField::VelocityW);
+}
+
+void CFDInterface::interpolateTemperatureBatch(const double* x, const double* y, const double* z,
+                                               size_t count, double* out) const {
+    if (!structured_ && octree_) {
+        const OctreeField& tree = *octree_;
+        parallelFor(count, MIN_PROBES_PER_THREAD, [&](size_t begin, size_t end) {
+            for (size_t q = begin; q < end; ++q) {
+                out[q] = tree.interpolate(CFDField::Temperature, x[q], y[q], z[q], AMBIENT_T_K);
+            }
+        });
+        return;
+    }
+    if (!structured_ || nx_ <= 1 || ny_ <= 1 || nz_ <= 1) {
+        std::fill(out, out + count, AMBIENT_T_K);
+        return;
+    }
+
+    const double* T = fields_[fieldIndex(CFDField::Temperature)].data();
+    const int64_t sy = nx_;
+    const int64_t sz = static_cast<int64_t>(nx_) * ny_;
+    const double lim_x = nx_, lim_y = ny_, lim_z = nz_;
+
+    parallelFor(count, MIN_PROBES_PER_THREAD, [&](size_t begin, size_t end) {
+        int64_t base[PROBE_BLOCK];
+        double fx[PROBE_BLOCK], fy[PROBE_BLOCK], fz[PROBE_BLOCK];
+        double c[8][PROBE_BLOCK];
+        bool inside[PROBE_BLOCK];
+
+        for (size_t b = begin; b < end; b += PROBE_BLOCK) {
+            const size_t m = std::min(PROBE_BLOCK, end - b);
+            const double* bx = x + b;
+            const double* by = y + b;
+            const double* bz = z + b;
+
+            // Pass 1: cell indices and fractions (branch-free, vectorizable).
+            // Same truncation as findCell(); coordinates are clamped first so
+            // far-away probes convert safely.
+            for (size_t q = 0; q < m; ++q) {
+                const double gx = std::min(std::max((bx[q] - x_min_) / dx_, -1.0), lim_x);
+                const double gy = std::min(std::max((by[q] - y_min_) / dy_, -1.0), lim_y);
+                const double gz = std::min(std::max((bz[q] - z_min_) / dz_, -1.0), lim_z);
+                const int i0 = static_cast<int>(gx);
+                const int j0 = static_cast<int>(gy);
+                const int k0 = static_cast<int>(gz);
+                inside[q] = (i0 >= 0) & (i0 < nx_ - 1) & (j0 >= 0) & (j0 < ny_ - 1) &
+                            (k0 >= 0) & (k0 < nz_ - 1);
+                const int ic = std::min(std::max(i0, 0), nx_ - 2);
+                const int jc = std::min(std::max(j0, 0), ny_ - 2);
+                const int kc = std::min(std::max(k0, 0), nz_ - 2);
+                base[q] = ic + jc * sy + kc * sz;
+                fx[q] = std::max(0.0, std::min(1.0, (bx[q] - (x_min_ + ic * dx_)) / dx_));
+                fy[q] = std::max(0.0, std::min(1.0, (by[q] - (y_min_ + jc * dy_)) / dy_));
+                fz[q] = std::max(0.0, std::min(1.0, (bz[q] - (z_min_ + kc * dz_)) / dz_));
+            }
+
+            // Pass 2: gather the 8 corners
+            for (size_t q = 0; q < m; ++q) {
+                const double* cell = T + base[q];
+                c[0][q] = cell[0];
+                c[1][q] = cell[1];
+                c[2][q] = cell[sy];
+                c[3][q] = cell[sy + 1];
+                c[4][q] = cell[sz];
+                c[5][q] = cell[sz + 1];
+                c[6][q] = cell[sz + sy];
+                c[7][q] = cell[sz + sy + 1];
+            }
+
+            // Pass 3: trilinear blend (same operation order as trilinear())
+            for (size_t q = 0; q < m; ++q) {
+                const double c00 = c[0][q] * (1.0 - fx[q]) + c[1][q] * fx[q];
+                const double c01 = c[4][q] * (1.0 - fx[q]) + c[5][q] * fx[q];
+                const double c10 = c[2][q] * (1.0 - fx[q]) + c[3][q] * fx[q];
+                const double c11 = c[6][q] * (1.0 - fx[q]) + c[7][q] * fx[q];
+                const double c0 = c00 * (1.0 - fy[q]) + c10 * fy[q];
+                const double c1 = c01 * (1.0 - fy[q]) + c11 * fy[q];
+                const double value = c0 * (1.0 - fz[q]) + c1 * fz[q];
+                out[b + q] = inside[q] ? value : AMBIENT_T_K;
+            }
+        }
+    });
 }
 
 ComparisonStats CFDInterface::compareTemperature(
     const std::vector<GridPoint>& vfep_points,
     const std::vector<GridPoint>& cfd_points) const {
-    
-    ComparisonStats stats{};
-    stats.num_points = std::min(vfep_points.size(), cfd_points.size());
-    
-    if (stats.num_points == 0) return stats;
-    
-    double sum_error = 0.0;
-    double sum_sq_error = 0.0;
-    double max_error = 0.0;
-    
-    double sum_vfep = 0.0;
-    double sum_cfd = 0.0;
-    
-    for (int i = 0; i < stats.num_points; ++i) {
-        double error = std::abs(vfep_points[i].T_K - cfd_points[i].T_K);
-        sum_error += error;
-        sum_sq_error += error * error;
-        max_error = std::max(max_error, error);
-        
-        sum_vfep += vfep_points[i].T_K;
-        sum_cfd += cfd_points[i].T_K;
-    }
-    
-    stats.mean_error = sum_error / stats.num_points;
-    stats.rmse = std::sqrt(sum_sq_error / stats.num_points);
-    stats.max_error = max_error;
-    
-    // Calculate correlation (simplified)
-    double mean_vfep = sum_vfep / stats.num_points;
-    double mean_cfd = sum_cfd / stats.num_points;
-    
-    double sum_prod = 0.0;
-    double sum_vfep_sq = 0.0;
-    double sum_cfd_sq = 0.0;
-    
-    for (int i = 0; i < stats.num_points; ++i) {
-        double dv = vfep_points[i].T_K - mean_vfep;
-        double dc = cfd_points[i].T_K - mean_cfd;
-        sum_prod += dv * dc;
-        sum_vfep_sq += dv * dv;
-        sum_cfd_sq += dc * dc;
-    }
-    
-    double denom = std::sqrt(sum_vfep_sq * sum_cfd_sq);
-    stats.correlation = (denom > 1e-12) ? (sum_prod / denom) : 0.0;
-    
-    return stats;
+    const size_t n = std::min(vfep_points.size(), cfd_points.size());
+    return reduceComparison(n, 1, true, [&](size_t i, double& a, double& b) {
+        a = vfep_points[i].T_K;
+        b = cfd_points[i].T_K;
+        return size_t(0);
+    })[0].stats();
 }
 
 ComparisonStats CFDInterface::compareVelocity(
     const std::vector<GridPoint>& vfep_points,
     const std::vector<GridPoint>& cfd_points) const {
-    
-    ComparisonStats stats{};
-    stats.num_points = std::min(vfep_points.size(), cfd_points.size());
-    
-    if (stats.num_points == 0) return stats;
-    
-    double sum_error = 0.0;
-    double sum_sq_error = 0.0;
-    double max_error = 0.0;
-    
-    for (int i = 0; i < stats.num_points; ++i) {
-        double vmag_vfep = std::sqrt(
-            vfep_points[i].u * vfep_points[i].u +
-            vfep_points[i].v * vfep_points[i].v +
-            vfep_points[i].w * vfep_points[i].w
-        );
-        
-        double vmag_cfd = std::sqrt(
-            cfd_points[i].u * cfd_points[i].u +
-            cfd_points[i].v * cfd_points[i].v +
-            cfd_points[i].w * cfd_points[i].w
-        );
-        
-        double error = std::abs(vmag_vfep - vmag_cfd);
-        sum_error += error;
-        sum_sq_error += error * error;
-        max_error = std::max(max_error, error);
+    const size_t n = std::min(vfep_points.size(), cfd_points.size());
+    return reduceComparison(n, 1, true, [&](size_t i, double& a, double& b) {
+        const GridPoint& pv = vfep_points[i];
+        const GridPoint& pc = cfd_points[i];
+        a = std::sqrt(pv.u * pv.u + pv.v * pv.v + pv.w * pv.w);
+        b = std::sqrt(pc.u * pc.u + pc.v * pc.v + pc.w * pc.w);
+        return size_t(0);
+    })[0].stats();
+}
+
+ComparisonStats CFDInterface::compareFields(const double* vfep, const double* cfd, size_t count,
+                                            const uint8_t* mask) const {
+    return reduceComparison(count, 1, mask == nullptr, [&](size_t i, double& a, double& b) {
+        a = vfep[i];
+        b = cfd[i];
+        return (mask && !mask[i]) ? size_t(1) : size_t(0);
+    })[0].stats();
+}
+
+ComparisonStats CFDInterface::compareVelocityFields(const double* const vfep_uvw[3],
+                                                    const double* const cfd_uvw[3], size_t count,
+                                                    const uint8_t* mask) const {
+    return reduceComparison(count, 1, mask == nullptr, [&](size_t i, double& a, double& b) {
+        a = std::sqrt(vfep_uvw[0][i] * vfep_uvw[0][i] + vfep_uvw[1][i] * vfep_uvw[1][i] +
+                      vfep_uvw[2][i] * vfep_uvw[2][i]);
+        b = std::sqrt(cfd_uvw[0][i] * cfd_uvw[0][i] + cfd_uvw[1][i] * cfd_uvw[1][i] +
+                      cfd_uvw[2][i] * cfd_uvw[2][i]);
+        return (mask && !mask[i]) ? size_t(1) : size_t(0);
+    })[0].stats();
+}
+
+std::vector<ComparisonStats> CFDInterface::compareFieldsByRegion(const double* vfep, const double* cfd,
+                                                                 size_t count, const uint16_t* labels,
+                                                                 size_t num_regions) const {
+    const auto acc = reduceComparison(count, num_regions, false, [&](size_t i, double& a, double& b) {
+        a = vfep[i];
+        b = cfd[i];
+        return static_cast<size_t>(labels[i]);
+    });
+    std::vector<ComparisonStats> out(num_regions);
+    for (size_t r = 0; r < num_regions; ++r) {
+        out[r] = acc[r].stats();
     }
-    
-    stats.mean_error = sum_error / stats.num_points;
-    stats.rmse = std::sqrt(sum_sq_error / stats.num_points);
-    stats.max_error = max_error;
-    stats.correlation = 0.0; // Not calculated for velocity
-    
-    return stats;
+    return out;
+}
+
+std::vector<ComparisonStats> CFDInterface::compareTemperatureByRegion(
+    const std::vector<GridPoint>& vfep_points,
+    const std::vector<GridPoint>& cfd_points,
+    const std::vector<ComparisonRegion>& regions) const {
+    const size_t n = std::min(vfep_points.size(), cfd_points.size());
+    const size_t num_regions = regions.size();
+    const auto acc = reduceComparison(n, num_regions, false, [&](size_t i, double& a, double& b) {
+        const GridPoint& pc = cfd_points[i];
+        a = vfep_points[i].T_K;
+        b = pc.T_K;
+        size_t r = 0;
+        while (r < num_regions && !regions[r].contains(pc.x, pc.y, pc.z)) {
+            ++r;
+        }
+        return r;
+    });
+    std::vector<ComparisonStats> out(num_regions);
+    for (size_t r = 0; r < num_regions; ++r) {
+        out[r] = acc[r].stats();
+    }
+    return out;
+}
+
+std::vector<uint16_t> CFDInterface::regionLabels(const std::vector<ComparisonRegion>& regions) const {
+    if (regions.size() >= 0xFFFF) {
+        throw std::invalid_argument("Too many comparison regions");
+    }
+    const size_t n = gridPointCount();
+    const uint16_t outside = static_cast<uint16_t>(regions.size());
+    std::vector<uint16_t> labels(n, outside);
+
+    const size_t nx = static_cast<size_t>(std::max(nx_, 1));
+    const size_t nxy = nx * static_cast<size_t>(std::max(ny_, 1));
+    parallelFor(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            double x, y, z;
+            if (structured_) {
+                x = x_min_ + static_cast<double>(idx % nx) * dx_;
+                y = y_min_ + static_cast<double>((idx / nx) % ny_) * dy_;
+                z = z_min_ + static_cast<double>(idx / nxy) * dz_;
+            } else {
+                x = grid_[idx].x;
+                y = grid_[idx].y;
+                z = grid_[idx].z;
+            }
+            for (uint16_t r = 0; r < outside; ++r) {
+                if (regions[r].contains(x, y, z)) {
+                    labels[idx] = r;
+                    break;
+                }
+            }
+        }
+    });
+    return labels;
 }
 
 bool CFDInterface::generateMockCFD(const std::string& output_vtk,
@@ -272,16 +536,131 @@ bool CFDInterface::generateMockCFD(const std::string& output_vtk,
 
 void CFDInterface::clear() {
     grid_.clear();
+    structured_ = false;
+    for (auto& f : fields_) {
+        f.clear();
+    }
+    aos_cache_.points.clear();
+    aos_cache_.valid.store(false, std::memory_order_relaxed);
+    octree_.reset();
     nx_ = ny_ = nz_ = 0;
     dx_ = dy_ = dz_ = 0.0;
     x_min_ = y_min_ = z_min_ = 0.0;
 }
 
+void CFDInterface::allocateFields(size_t n) {
+    grid_.clear();
+    octree_.reset();
+    structured_ = true;
+    for (auto& f : fields_) {
+        f.resize(n);
+    }
+    aos_cache_.points.clear();
+    aos_cache_.valid.store(false, std::memory_order_relaxed);
+}
+
+const std::vector<GridPoint>& CFDInterface::gridPoints() const {
+    if (!structured_) {
+        return grid_;
+    }
+    if (aos_cache_.valid.load(std::memory_order_acquire)) {
+        return aos_cache_.points;
+    }
+    std::lock_guard<std::mutex> lock(aos_cache_.mu);
+    if (!aos_cache_.valid.load(std::memory_order_relaxed)) {
+        const size_t n = fields_[0].size();
+        std::vector<GridPoint>& points = aos_cache_.points;
+        points.resize(n);
+        const size_t nx = static_cast<size_t>(nx_);
+        const size_t nxy = nx * static_cast<size_t>(ny_);
+        parallelFor(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end; ++idx) {
+                GridPoint& p = points[idx];
+                p.x = x_min_ + static_cast<double>(idx % nx) * dx_;
+                p.y = y_min_ + static_cast<double>((idx / nx) % ny_) * dy_;
+                p.z = z_min_ + static_cast<double>(idx / nxy) * dz_;
+                p.T_K = fields_[fieldIndex(CFDField::Temperature)][idx];
+                p.u = fields_[fieldIndex(CFDField::VelocityU)][idx];
+                p.v = fields_[fieldIndex(CFDField::VelocityV)][idx];
+                p.w = fields_[fieldIndex(CFDField::VelocityW)][idx];
+                p.rho_kg_m3 = fields_[fieldIndex(CFDField::Density)][idx];
+                p.P_Pa = fields_[fieldIndex(CFDField::Pressure)][idx];
+            }
+        });
+        aos_cache_.valid.store(true, std::memory_order_release);
+    }
+    return aos_cache_.points;
+}
+
+double* CFDInterface::mutableFieldData(CFDField field) {
+    if (!structured_) {
+        return nullptr;
+    }
+    aos_cache_.valid.store(false, std::memory_order_relaxed);
+    return fields_[fieldIndex(field)].data();
+}
+
+bool CFDInterface::swapFieldBuffer(CFDField field, std::vector<double>& buffer) {
+    std::vector<double>& current = fields_[fieldIndex(field)];
+    if (!structured_ || buffer.size() != current.size()) {
+        return false;
+    }
+    current.swap(buffer);
+    aos_cache_.valid.store(false, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<GridPoint>& CFDInterface::mutableGridPoints() {
+    if (structured_) {
+        throw std::logic_error("Structured grid: use mutableFieldData()");
+    }
+    octree_.reset();
+    return grid_;
+}
+
+void CFDInterface::rebuildOctree() {
+    if (structured_ || grid_.empty()) {
+        octree_.reset();
+        return;
+    }
+    auto tree = std::make_shared<OctreeField>();
+    tree->buildFromPoints(grid_, octree_depth_, octree_leaf_points_);
+    octree_ = std::move(tree);
+}
+
+void CFDInterface::setOctreeResolution(int max_depth, size_t max_points_per_leaf) {
+    if (max_depth < 1 || max_depth > OctreeField::MAX_DEPTH) {
+        throw std::invalid_argument("Octree depth must be in [1, 21]");
+    }
+    if (max_points_per_leaf == 0) {
+        throw std::invalid_argument("Octree leaves must allow at least one point");
+    }
+    octree_depth_ = max_depth;
+    octree_leaf_points_ = max_points_per_leaf;
+}
+
+void CFDInterface::resizeStructuredGrid(int nx, int ny, int nz,
+                                       double x_min, double y_min, double z_min,
+                                       double dx, double dy, double dz) {
+    if (nx < 1 || ny < 1 || nz < 1) {
+        throw std::invalid_argument("Grid dimensions must be positive");
+    }
+    allocateFields(static_cast<size_t>(nx) * ny * nz);
+    nx_ = nx;
+    ny_ = ny;
+    nz_ = nz;
+    x_min_ = x_min;
+    y_min_ = y_min;
+    z_min_ = z_min;
+    dx_ = dx;
+    dy_ = dy;
+    dz_ = dz;
+}
+
 void CFDInterface::setGridPoints(const std::vector<GridPoint>& points,
                                 int nx, int ny, int nz,
                                 double x_min, double y_min, double z_min,
                                 double dx, double dy, double dz) {
-    grid_ = points;
     nx_ = nx;
     ny_ = ny;
     nz_ = nz;
@@ -291,22 +670,210 @@ void CFDInterface::setGridPoints(const std::vector<GridPoint>& points,
     dx_ = dx;
     dy_ = dy;
     dz_ = dz;
+
+    const size_t n = points.size();
+    const bool lattice = n > 0 && nx > 0 && ny > 0 && nz > 0 &&
+                         static_cast<size_t>(nx) * ny * nz == n;
+    if (!lattice) {
+        structured_ = false;
+        for (auto& f : fields_) {
+            f.clear();
+        }
+        aos_cache_.points.clear();
+        aos_cache_.valid.store(false, std::memory_order_relaxed);
+        grid_ = points;
+        rebuildOctree();
+        return;
+    }
+
+    allocateFields(n);
+    parallelFor(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            const GridPoint& p = points[idx];
+            fields_[fieldIndex(CFDField::Temperature)][idx] = p.T_K;
+            fields_[fieldIndex(CFDField::VelocityU)][idx] = p.u;
+            fields_[fieldIndex(CFDField::VelocityV)][idx] = p.v;
+            fields_[fieldIndex(CFDField::VelocityW)][idx] = p.w;
+            fields_[fieldIndex(CFDField::Density)][idx] = p.rho_kg_m3;
+            fields_[fieldIndex(CFDField::Pressure)][idx] = p.P_Pa;
+        }
+    });
 }
+
 bool CFDInterface::parseVTK(const std::string& vtk_file) {
-    std::ifstream ifs(vtk_file);
-    if (!ifs.is_open()) return false;
-    
+    VTKDataset ds;
+    if (!VTKReader::read(vtk_file, ds)) {
+        return false;
+    }
+
     clear();
-    
-    std::string line;
-    // Simplified VTK parser (would need proper implementation for production)
-    // For Phase 8, we'll just create a minimal mock
-    
-    // This is a placeholder - real VTK parsing is more complex
-    grid_.push_back({0.0, 0.0, 0.0, 293.15, 0.0, 0.0, 0.0, 1.2, 101325.0});
-    nx_ = ny_ = nz_ = 1;
-    
-    ifs.close();
+    return loadDataset(ds);
+}
+
+bool CFDInterface::loadDataset(const VTKDataset& ds) {
+    const size_t n = ds.numPoints();
+    if (n == 0) return false;
+
+    const bool has_points = ds.points.valid() && ds.points.num_tuples == n;
+    const bool has_coords = ds.coords[0].valid() && ds.coords[1].valid() && ds.coords[2].valid();
+
+    int dims[3] = {ds.dims[0], ds.dims[1], ds.dims[2]};
+    double origin[3] = {ds.origin[0], ds.origin[1], ds.origin[2]};
+    double spacing[3] = {ds.spacing[0], ds.spacing[1], ds.spacing[2]};
+
+    if (ds.kind == VTKDataset::Kind::RectilinearGrid) {
+        if (!has_coords) return false;
+        for (int a = 0; a < 3; ++a) {
+            const VTKFieldView& c = ds.coords[a];
+            origin[a] = c.get(0);
+            spacing[a] = (c.num_tuples > 1)
+                ? (c.get(c.num_tuples - 1) - origin[a]) / static_cast<double>(c.num_tuples - 1)
+                : 0.0;
+        }
+    } else if (ds.kind == VTKDataset::Kind::StructuredGrid ||
+               ds.kind == VTKDataset::Kind::PointSet) {
+        if (!has_points) return false;
+
+        // Infer i-fastest lattice dimensions from where y and z first change
+        const double x0 = ds.points.get(0, 0);
+        const double y0 = ds.points.get(0, 1);
+        const double z0 = ds.points.get(0, 2);
+        if (ds.kind == VTKDataset::Kind::PointSet) {
+            size_t nx = 1;
+            while (nx < n && ds.points.get(nx, 1) == y0 && ds.points.get(nx, 2) == z0) ++nx;
+            size_t nxy = nx;
+            while (nxy < n && ds.points.get(nxy, 2) == z0) ++nxy;
+            dims[0] = static_cast<int>(nx);
+            dims[1] = static_cast<int>(nxy / nx);
+            dims[2] = static_cast<int>(n / nxy);
+        }
+        origin[0] = x0;
+        origin[1] = y0;
+        origin[2] = z0;
+
+        const size_t corner = n - 1;
+        const double extent[3] = {
+            ds.points.get(corner, 0) - x0,
+            ds.points.get(corner, 1) - y0,
+            ds.points.get(corner, 2) - z0
+        };
+        for (int a = 0; a < 3; ++a) {
+            spacing[a] = (dims[a] > 1) ? extent[a] / (dims[a] - 1) : 0.0;
+        }
+    }
+
+    bool structured = dims[0] > 0 && dims[1] > 0 && dims[2] > 0 &&
+                      static_cast<size_t>(dims[0]) * dims[1] * dims[2] == n;
+
+    const VTKFieldView* T = ds.findPointField({"T", "T_K", "Temperature", "temp"}, 1);
+    const VTKFieldView* vel = ds.findPointField({"U", "Velocity", "vel", "velocity_vector"}, 3);
+    const VTKFieldView* u = vel ? nullptr : ds.findPointField({"U-VELOCITY", "Velocity_X", "Ux", "u"}, 1);
+    const VTKFieldView* v = vel ? nullptr : ds.findPointField({"V-VELOCITY", "Velocity_Y", "Uy", "v"}, 1);
+    const VTKFieldView* w = vel ? nullptr : ds.findPointField({"W-VELOCITY", "Velocity_Z", "Uz", "w"}, 1);
+    const VTKFieldView* rho = ds.findPointField({"rho", "density", "rho_kg_m3"}, 1);
+    const VTKFieldView* P = ds.findPointField({"p", "pressure", "P_Pa"}, 1);
+
+    // Field arrays: decoded straight from the file views
+    allocateFields(n);
+    auto load = [&](CFDField f, const VTKFieldView* view, int component, double fallback) {
+        std::vector<double>& dst = fields_[fieldIndex(f)];
+        if (view) {
+            view->copyComponent(component, dst.data());
+        } else {
+            std::fill(dst.begin(), dst.end(), fallback);
+        }
+    };
+    load(CFDField::Temperature, T, 0, AMBIENT_T_K);
+    load(CFDField::VelocityU, vel ? vel : u, 0, 0.0);
+    load(CFDField::VelocityV, vel ? vel : v, vel ? 1 : 0, 0.0);
+    load(CFDField::VelocityW, vel ? vel : w, vel ? 2 : 0, 0.0);
+    load(CFDField::Density, rho, 0, 1.2);
+    load(CFDField::Pressure, P, 0, 101325.0);
+
+    // Explicit coordinates must lie on the lattice to be dropped
+    const size_t nx = static_cast<size_t>(std::max(dims[0], 1));
+    const size_t nxy = nx * static_cast<size_t>(std::max(dims[1], 1));
+    auto pointAt = [&](size_t idx, double xyz[3]) {
+        if (has_points) {
+            xyz[0] = ds.points.get(idx, 0);
+            xyz[1] = ds.points.get(idx, 1);
+            xyz[2] = ds.points.get(idx, 2);
+        } else {
+            const size_t ijk[3] = {idx % nx, (idx / nx) % (nxy / nx), idx / nxy};
+            for (int a = 0; a < 3; ++a) {
+                xyz[a] = has_coords ? ds.coords[a].get(ijk[a]) : origin[a] + ijk[a] * spacing[a];
+            }
+        }
+    };
+
+    if (structured && (has_points || ds.kind == VTKDataset::Kind::RectilinearGrid)) {
+        const double tol[3] = {1e-4 * std::abs(spacing[0]), 1e-4 * std::abs(spacing[1]),
+                               1e-4 * std::abs(spacing[2])};
+        std::vector<uint8_t> on_lattice(parallelWorkerCount(n, MIN_POINTS_PER_THREAD), 1);
+        parallelForChunks(n, MIN_POINTS_PER_THREAD, [&](size_t chunk, size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end; ++idx) {
+                double p[3];
+                pointAt(idx, p);
+                const double lattice[3] = {
+                    origin[0] + static_cast<double>(idx % nx) * spacing[0],
+                    origin[1] + static_cast<double>((idx / nx) % (nxy / nx)) * spacing[1],
+                    origin[2] + static_cast<double>(idx / nxy) * spacing[2]
+                };
+                if (std::abs(p[0] - lattice[0]) > tol[0] ||
+                    std::abs(p[1] - lattice[1]) > tol[1] ||
+                    std::abs(p[2] - lattice[2]) > tol[2]) {
+                    on_lattice[chunk] = 0;
+                    return;
+                }
+            }
+        });
+        for (uint8_t ok : on_lattice) {
+            structured = structured && ok;
+        }
+    }
+
+    if (structured) {
+        nx_ = dims[0];
+        ny_ = dims[1];
+        nz_ = dims[2];
+        x_min_ = origin[0];
+        y_min_ = origin[1];
+        z_min_ = origin[2];
+        dx_ = spacing[0];
+        dy_ = spacing[1];
+        dz_ = spacing[2];
+        return true;
+    }
+
+    // Scattered points: keep values with explicit coordinates and disable
+    // lattice interpolation
+    std::vector<GridPoint> scattered(n);
+    parallelFor(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            GridPoint& gp = scattered[idx];
+            double p[3];
+            pointAt(idx, p);
+            gp.x = p[0];
+            gp.y = p[1];
+            gp.z = p[2];
+            gp.T_K = fields_[fieldIndex(CFDField::Temperature)][idx];
+            gp.u = fields_[fieldIndex(CFDField::VelocityU)][idx];
+            gp.v = fields_[fieldIndex(CFDField::VelocityV)][idx];
+            gp.w = fields_[fieldIndex(CFDField::VelocityW)][idx];
+            gp.rho_kg_m3 = fields_[fieldIndex(CFDField::Density)][idx];
+            gp.P_Pa = fields_[fieldIndex(CFDField::Pressure)][idx];
+        }
+    });
+    structured_ = false;
+    for (auto& f : fields_) {
+        f.clear();
+    }
+    grid_ = std::move(scattered);
+    rebuildOctree();
+    nx_ = static_cast<int>(n);
+    ny_ = nz_ = 1;
+    dx_ = dy_ = dz_ = 0.0;
+    x_min_ = y_min_ = z_min_ = 0.0;
     return true;
 }
 
@@ -0,0 +1,293 @@
+/**
+ * @file CFDTimeSeries.cpp
+ * @brief Lazily paged VTK frame series with temporal interpolation
+ *
+ * Phase 8: CFD Interface - Transient fields
+ */
+
+#include "CFDTimeSeries.h"
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+namespace vfep {
+
+namespace {
+
+constexpr double AMBIENT_T_K = 293.15;
+constexpr size_t MIN_POINTS_PER_THREAD = 1 << 16;
+constexpr size_t NO_FRAME = std::numeric_limits<size_t>::max();
+
+bool isVTKExtension(std::string ext) {
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext == ".vtk" || ext == ".vti" || ext == ".vtr" || ext == ".vts" || ext == ".vtu";
+}
+
+bool sameValue(double a, double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::max(std::abs(a), std::abs(b)));
+}
+
+bool sameLattice(const CFDInterface& a, const CFDInterface& b) {
+    return a.isStructured() && b.isStructured() &&
+           a.gridNx() == b.gridNx() && a.gridNy() == b.gridNy() && a.gridNz() == b.gridNz() &&
+           sameValue(a.gridXMin(), b.gridXMin()) && sameValue(a.gridYMin(), b.gridYMin()) &&
+           sameValue(a.gridZMin(), b.gridZMin()) && sameValue(a.gridDx(), b.gridDx()) &&
+           sameValue(a.gridDy(), b.gridDy()) && sameValue(a.gridDz(), b.gridDz());
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUCTION & INDEXING
+// ============================================================================
+
+CFDTimeSeries::CFDTimeSeries(size_t max_resident_frames)
+    : max_resident_(max_resident_frames)
+    , resident_(0)
+    , use_clock_(0)
+{
+    if (max_resident_frames < 2) {
+        throw std::invalid_argument("CFDTimeSeries needs at least 2 resident frames");
+    }
+}
+
+bool CFDTimeSeries::parseFrameNumber(const std::string& file_name, double& value) {
+    const std::string stem = std::filesystem::path(file_name).stem().string();
+
+    // Scan back over the last run of digits (with at most one decimal point)
+    size_t end = stem.size();
+    while (end > 0 && !std::isdigit(static_cast<unsigned char>(stem[end - 1]))) {
+        --end;
+    }
+    if (end == 0) {
+        return false;
+    }
+    size_t begin = end;
+    bool seen_point = false;
+    while (begin > 0) {
+        const char c = stem[begin - 1];
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            --begin;
+        } else if (c == '.' && !seen_point && begin > 1 &&
+                   std::isdigit(static_cast<unsigned char>(stem[begin - 2]))) {
+            seen_point = true;
+            --begin;
+        } else {
+            break;
+        }
+    }
+    try {
+        value = std::stod(stem.substr(begin, end - begin));
+    } catch (const std::exception&) {
+        return false;  // Digit run too long to represent
+    }
+    return std::isfinite(value);
+}
+
+bool CFDTimeSeries::openDirectory(const std::string& directory, double time_scale) {
+    if (!std::isfinite(time_scale) || time_scale <= 0.0) {
+        throw std::invalid_argument("Time scale must be positive");
+    }
+
+    std::error_code ec;
+    std::filesystem::directory_iterator it(directory, ec);
+    if (ec) {
+        return false;
+    }
+
+    // Listing order is unspecified: sort so that of several files with the
+    // same frame time (fire_0001.vtk and fire_0001.vti) the first by path wins
+    std::vector<std::pair<double, std::string>> found;
+    for (; it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        if (ec) {
+            return false;
+        }
+        const auto& entry = *it;
+        if (!entry.is_regular_file(ec) || !isVTKExtension(entry.path().extension().string())) {
+            continue;
+        }
+        double number = 0.0;
+        if (!parseFrameNumber(entry.path().filename().string(), number) ||
+            !std::isfinite(number * time_scale)) {
+            continue;
+        }
+        found.emplace_back(number * time_scale, entry.path().string());
+    }
+    std::sort(found.begin(), found.end());
+
+    clear();
+    for (const auto& f : found) {
+        if (!frames_.empty() && frames_.back().time_s == f.first) {
+            continue;
+        }
+        frames_.push_back(Frame{f.second, f.first, nullptr, 0});
+    }
+    return !frames_.empty();
+}
+
+void CFDTimeSeries::addFrame(const std::string& path, double time_s) {
+    if (!std::isfinite(time_s)) {
+        throw std::invalid_argument("Frame time must be finite");
+    }
+    auto pos = std::lower_bound(frames_.begin(), frames_.end(), time_s,
+                                [](const Frame& f, double t) { return f.time_s < t; });
+    if (pos != frames_.end() && pos->time_s == time_s) {
+        throw std::invalid_argument("Duplicate frame time: " + path);
+    }
+    frames_.insert(pos, Frame{path, time_s, nullptr, 0});
+}
+
+void CFDTimeSeries::clear() {
+    frames_.clear();
+    resident_ = 0;
+    use_clock_ = 0;
+    stats_ = CFDTimeSeriesStats{};
+}
+
+double CFDTimeSeries::startTime() const {
+    return frames_.empty() ? 0.0 : frames_.front().time_s;
+}
+
+double CFDTimeSeries::endTime() const {
+    return frames_.empty() ? 0.0 : frames_.back().time_s;
+}
+
+// ============================================================================
+// PAGING
+// ============================================================================
+
+void CFDTimeSeries::setMaxResidentFrames(size_t max_resident_frames) {
+    if (max_resident_frames < 2) {
+        throw std::invalid_argument("CFDTimeSeries needs at least 2 resident frames");
+    }
+    max_resident_ = max_resident_frames;
+    evictExcept(NO_FRAME, NO_FRAME);
+}
+
+void CFDTimeSeries::evictExcept(size_t keep0, size_t keep1) {
+    while (resident_ > max_resident_) {
+        size_t victim = NO_FRAME;
+        for (size_t i = 0; i < frames_.size(); ++i) {
+            if (!frames_[i].data || i == keep0 || i == keep1) continue;
+            if (victim == NO_FRAME || frames_[i].last_use < frames_[victim].last_use) {
+                victim = i;
+            }
+        }
+        if (victim == NO_FRAME) {
+            return;
+        }
+        frames_[victim].data.reset();  // Callers holding the pointer keep it alive
+        --resident_;
+        ++stats_.evictions;
+    }
+}
+
+std::shared_ptr<const CFDInterface> CFDTimeSeries::frame(size_t index) {
+    if (index >= frames_.size()) {
+        throw std::out_of_range("Frame index out of range");
+    }
+    Frame& f = frames_[index];
+    f.last_use = ++use_clock_;
+    if (f.data) {
+        ++stats_.hits;
+        return f.data;
+    }
+
+    auto loaded = std::make_shared<CFDInterface>();
+    if (!loaded->importTemperatureField(f.path)) {
+        ++stats_.load_failures;
+        return nullptr;
+    }
+    f.data = std::move(loaded);
+    ++resident_;
+    ++stats_.page_ins;
+    evictExcept(index, index);
+    return f.data;
+}
+
+// ============================================================================
+// TEMPORAL INTERPOLATION
+// ============================================================================
+
+void CFDTimeSeries::bracket(double t, size_t& i0, size_t& i1, double& alpha) const {
+    alpha = 0.0;
+    if (t <= frames_.front().time_s) {
+        i0 = i1 = 0;
+        return;
+    }
+    if (t >= frames_.back().time_s) {
+        i0 = i1 = frames_.size() - 1;
+        return;
+    }
+    auto it = std::upper_bound(frames_.begin(), frames_.end(), t,
+                               [](double v, const Frame& f) { return v < f.time_s; });
+    i1 = static_cast<size_t>(std::distance(frames_.begin(), it));
+    i0 = i1 - 1;
+    alpha = (t - frames_[i0].time_s) / (frames_[i1].time_s - frames_[i0].time_s);
+}
+
+bool CFDTimeSeries::sample(double t, CFDInterface& out) {
+    if (frames_.empty()) {
+        return false;
+    }
+    size_t i0, i1;
+    double alpha;
+    bracket(t, i0, i1, alpha);
+
+    const auto a = frame(i0);
+    if (!a) return false;
+    const auto b = (i1 == i0 || alpha == 0.0) ? a : frame(i1);
+    if (!b) return false;
+
+    if (!sameLattice(*a, *b)) {
+        out = (alpha < 0.5) ? *a : *b;
+        return true;
+    }
+
+    if (!sameLattice(out, *a)) {
+        out.resizeStructuredGrid(a->gridNx(), a->gridNy(), a->gridNz(),
+                                 a->gridXMin(), a->gridYMin(), a->gridZMin(),
+                                 a->gridDx(), a->gridDy(), a->gridDz());
+    }
+    const size_t n = a->gridPointCount();
+    for (int f = 0; f < static_cast<int>(CFDField::Count); ++f) {
+        const CFDField field = static_cast<CFDField>(f);
+        const double* va = a->fieldData(field);
+        const double* vb = b->fieldData(field);
+        double* dst = out.mutableFieldData(field);
+        parallelFor(n, MIN_POINTS_PER_THREAD, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] = va[i] + alpha * (vb[i] - va[i]);
+            }
+        });
+    }
+    return true;
+}
+
+double CFDTimeSeries::interpolateTemperature(double t, double x, double y, double z) {
+    if (frames_.empty()) {
+        return AMBIENT_T_K;
+    }
+    size_t i0, i1;
+    double alpha;
+    bracket(t, i0, i1, alpha);
+
+    const auto a = frame(i0);
+    if (!a) return AMBIENT_T_K;
+    const double Ta = a->interpolateTemperature(x, y, z);
+    if (i1 == i0 || alpha == 0.0) {
+        return Ta;
+    }
+    const auto b = frame(i1);
+    if (!b) return AMBIENT_T_K;
+    return Ta + alpha * (b->interpolateTemperature(x, y, z) - Ta);
+}
+
+} // namespace vfep
@@ -0,0 +1,123 @@
+/**
+ * @file Crc32.cpp
+ * @brief Carry-less multiply folding for long CRC-32 inputs
+ *
+ * Four 128-bit lanes fold 64 bytes per step, then reduce to 128 bits, to
+ * 64 bits and finally Barrett-reduce to the 32-bit remainder (Gopal et al.,
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ", with the
+ * bit-reflected IEEE constants). Compiled for the pclmul / sse4.1 targets
+ * per function and selected at run time, so the rest of the build keeps its
+ * baseline ISA; other compilers and CPUs use slicing-by-8.
+ */
+
+#include "Crc32.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CHEMSI_CRC32_CLMUL 1
+#include <immintrin.h>
+#endif
+
+namespace vfep {
+
+namespace {
+
+#ifdef CHEMSI_CRC32_CLMUL
+
+#define CHEMSI_CLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+
+// x * (k.hi, k.lo) folded 128 bits forward, plus the next block
+CHEMSI_CLMUL_TARGET inline __m128i fold(__m128i x, __m128i k, __m128i next) {
+    const __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+}
+
+CHEMSI_CLMUL_TARGET inline __m128i load(const std::uint8_t* q) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+}
+
+// len >= 64 and a multiple of 16; `c` is the inverted register
+CHEMSI_CLMUL_TARGET std::uint32_t foldClmul(std::uint32_t c, const std::uint8_t* p, std::size_t len) {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_xor_si128(load(p), _mm_cvtsi32_si128(static_cast<int>(c)));
+    __m128i x2 = load(p + 16);
+    __m128i x3 = load(p + 32);
+    __m128i x4 = load(p + 48);
+    p += 64;
+    len -= 64;
+
+    for (; len >= 64; p += 64, len -= 64) {
+        x1 = fold(x1, k1k2, load(p));
+        x2 = fold(x2, k1k2, load(p + 16));
+        x3 = fold(x3, k1k2, load(p + 32));
+        x4 = fold(x4, k1k2, load(p + 48));
+    }
+
+    // Four lanes -> one, then the 16-byte tail
+    x1 = fold(x1, k3k4, x2);
+    x1 = fold(x1, k3k4, x3);
+    x1 = fold(x1, k3k4, x4);
+    for (; len >= 16; p += 16, len -= 16) {
+        x1 = fold(x1, k3k4, load(p));
+    }
+
+    // 128 -> 64 bits
+    __m128i x2r = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+    x2r = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5k0, 0x00), x2r);
+
+    // Barrett reduction to 32 bits
+    __m128i t = _mm_and_si128(x1, mask32);
+    t = _mm_clmulepi64_si128(t, poly, 0x10);
+    t = _mm_and_si128(t, mask32);
+    t = _mm_clmulepi64_si128(t, poly, 0x00);
+    x1 = _mm_xor_si128(x1, t);
+    return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool detectClmul() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}
+
+#endif
+
+bool useClmul() {
+#ifdef CHEMSI_CRC32_CLMUL
+    static const bool supported = detectClmul();  // Thread-safe one-time init
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+bool crc32Accelerated() {
+    return useClmul();
+}
+
+namespace detail {
+
+std::uint32_t crc32Folded(std::uint32_t c, const std::uint8_t* p, std::size_t len) {
+#ifdef CHEMSI_CRC32_CLMUL
+    if (len >= 64 && useClmul()) {
+        const std::size_t bulk = len & ~std::size_t{15};
+        c = foldClmul(c, p, bulk);
+        p += bulk;
+        len -= bulk;
+    }
+#endif
+    return crc32Slice8(c, p, len);
+}
+
+} // namespace detail
+
+} // namespace vfep
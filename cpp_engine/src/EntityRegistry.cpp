@@ -0,0 +1,298 @@
+#include "EntityRegistry.h"
+
+#include <algorithm>
+
+namespace vfep {
+namespace obj {
+
+// ============================================================================
+// IdTable
+// ============================================================================
+
+std::uint32_t IdTable::intern(const std::string& id) {
+    auto it = index_.find(id);
+    if (it != index_.end()) return it->second;
+    const auto h = static_cast<std::uint32_t>(ids_.size());
+    ids_.push_back(id);
+    index_.emplace(id, h);
+    return h;
+}
+
+std::uint32_t IdTable::find(const std::string& id) const {
+    auto it = index_.find(id);
+    return it == index_.end() ? kNoHandle : it->second;
+}
+
+void IdTable::clear() {
+    index_.clear();
+    ids_.clear();
+}
+
+// ============================================================================
+// Build
+// ============================================================================
+
+void EntityRegistry::build(ObjectStore& s) {
+    *this = EntityRegistry{};
+    store_ = &s;
+
+    for (auto& [id, rt] : s.rack_telemetry) {
+        racks.ids.intern(id);
+        auto it = s.racks.find(id);
+        racks.room_id.push_back(it != s.racks.end() ? it->second.room_id : std::string());
+        racks.store.push_back(&rt);
+    }
+    const std::size_t nr = racks.store.size();
+    racks.on_fire.resize(nr);
+    racks.surface_temp_C.resize(nr);
+    racks.risk_pct.resize(nr);
+    racks.open_incident.assign(nr, kNoHandle);
+    racks.suppressing.resize(nr);
+    racks.agent_flow_kg_s.resize(nr);
+
+    for (auto& [id, at] : s.arm_telemetry) {
+        auto it = s.arms.find(id);
+        if (it == s.arms.end()) continue;
+        const ArmConfig& cfg = it->second;
+        arms.ids.intern(id);
+        arms.parking_s.push_back(cfg.parking_s_0_1);
+        arms.s_min.push_back(cfg.travel_s_min_0_1);
+        arms.s_max.push_back(cfg.travel_s_max_0_1);
+        arms.v_max.push_back(cfg.max_v_s_0_1_per_s);
+        arms.a_max.push_back(cfg.max_a_s_0_1_per_s2);
+        arms.store.push_back(&at);
+    }
+    const std::size_t na = arms.store.size();
+    arms.s.resize(na);
+    arms.v.resize(na);
+    arms.target_s.resize(na);
+    arms.has_target.resize(na);
+    arms.state.resize(na);
+
+    for (auto& [id, nt] : s.nozzle_telemetry) {
+        auto it = s.nozzles.find(id);
+        if (it == s.nozzles.end()) continue;
+        const NozzleConfig& cfg = it->second;
+        nozzles.ids.intern(id);
+        nozzles.pan_min.push_back(cfg.pan_min_deg);
+        nozzles.pan_max.push_back(cfg.pan_max_deg);
+        nozzles.tilt_min.push_back(cfg.tilt_min_deg);
+        nozzles.tilt_max.push_back(cfg.tilt_max_deg);
+        nozzles.store.push_back(&nt);
+    }
+    const std::size_t nn = nozzles.store.size();
+    nozzles.pan.resize(nn);
+    nozzles.tilt.resize(nn);
+    nozzles.target_pan.resize(nn);
+    nozzles.target_tilt.resize(nn);
+    nozzles.has_target.resize(nn);
+
+    // Tanks in store iteration order, so "first tank of the VFEP" matches
+    // a scan of s.tanks
+    std::unordered_map<std::string, std::uint32_t> first_tank;
+    for (auto& [id, cfg] : s.tanks) {
+        const std::uint32_t h = tanks.ids.intern(id);
+        tanks.initial_mass_kg.push_back(cfg.initial_agent_mass_kg);
+        tanks.regulator_setpoint_bar.push_back(cfg.regulator_setpoint_bar);
+        tanks.store.push_back(&s.tank_telemetry[id]);
+        first_tank.emplace(cfg.vfep_id, h);
+    }
+    const std::size_t nt = tanks.store.size();
+    tanks.pressure_bar.resize(nt);
+    tanks.regulator_bar.resize(nt);
+    tanks.remaining_kg.resize(nt);
+    tanks.flow_kg_s.resize(nt);
+    tanks.depleted.resize(nt);
+    tanks.discharging.resize(nt);
+
+    std::unordered_map<std::string, std::uint32_t> first_interlock;
+    for (auto& [id, il] : s.interlocks) {
+        const std::uint32_t h = interlocks.ids.intern(id);
+        interlocks.store.push_back(&il);
+        first_interlock.emplace(il.vfep_id, h);
+    }
+    const std::size_t ni = interlocks.store.size();
+    interlocks.allow_arm.resize(ni);
+    interlocks.allow_suppress.resize(ni);
+    interlocks.updated_ms.resize(ni);
+
+    vfeps.coverage_begin.push_back(0);
+    for (auto& [id, v] : s.vfeps) {
+        vfeps.ids.intern(id);
+        auto t = first_tank.find(id);
+        vfeps.tank.push_back(t != first_tank.end() ? t->second : kNoHandle);
+        auto il = first_interlock.find(id);
+        vfeps.interlock.push_back(il != first_interlock.end() ? il->second : kNoHandle);
+        for (const auto& rid : v.coverage_rack_ids) {
+            const std::uint32_t r = racks.ids.find(rid);
+            if (r != kNoHandle) vfeps.coverage_racks.push_back(r);
+        }
+        vfeps.coverage_begin.push_back(static_cast<std::uint32_t>(vfeps.coverage_racks.size()));
+        vfeps.store.push_back(&v);
+    }
+    const std::size_t nv = vfeps.store.size();
+    vfeps.suppression_active.resize(nv);
+    vfeps.selected_rack.assign(nv, kNoHandle);
+    vfeps.selected_rack_id.resize(nv);
+
+    for (auto& [id, inc] : s.incidents) {
+        incidents.ids.intern(id);
+        incidents.rack.push_back(racks.ids.find(inc.rack_id));
+        incidents.store.push_back(&inc);
+    }
+    const std::size_t nc = incidents.store.size();
+    incidents.state.resize(nc);
+    incidents.started_at_s.resize(nc);
+    incidents.resolved_at_s.resize(nc);
+
+    load();
+}
+
+// ============================================================================
+// Store <-> arrays
+// ============================================================================
+
+void EntityRegistry::load() {
+    for (std::size_t i = 0; i < racks.store.size(); ++i) {
+        const RackTelemetry& rt = *racks.store[i];
+        racks.on_fire[i] = rt.is_on_fire;
+        racks.surface_temp_C[i] = rt.surface_temp_C;
+        racks.risk_pct[i] = rt.risk_to_assets_pct;
+    }
+    for (std::size_t i = 0; i < arms.store.size(); ++i) {
+        const ArmTelemetry& at = *arms.store[i];
+        arms.s[i] = at.s_0_1;
+        arms.v[i] = at.v_s_0_1_per_s;
+        arms.target_s[i] = at.target_s_0_1;
+        arms.has_target[i] = at.has_target;
+        arms.state[i] = at.state;
+    }
+    for (std::size_t i = 0; i < nozzles.store.size(); ++i) {
+        const NozzleTelemetry& nt = *nozzles.store[i];
+        nozzles.pan[i] = nt.pan_deg;
+        nozzles.tilt[i] = nt.tilt_deg;
+        nozzles.target_pan[i] = nt.target_pan_deg;
+        nozzles.target_tilt[i] = nt.target_tilt_deg;
+        nozzles.has_target[i] = nt.has_target;
+    }
+    for (std::size_t i = 0; i < tanks.store.size(); ++i) {
+        const TankTelemetry& tt = *tanks.store[i];
+        tanks.pressure_bar[i] = tt.current_pressure_bar;
+        tanks.regulator_bar[i] = tt.regulator_bar;
+        tanks.remaining_kg[i] = tt.remaining_agent_mass_kg;
+        tanks.flow_kg_s[i] = tt.current_flow_kg_s;
+        tanks.depleted[i] = tt.is_depleted;
+        tanks.discharging[i] = (tt.valve_state == "discharging");
+    }
+    for (std::size_t i = 0; i < interlocks.store.size(); ++i) {
+        const InterlockStatus& il = *interlocks.store[i];
+        interlocks.allow_arm[i] = il.allow_arm;
+        interlocks.allow_suppress[i] = il.allow_suppress;
+        interlocks.updated_ms[i] = il.updated_ms;
+    }
+    for (std::size_t i = 0; i < vfeps.store.size(); ++i) {
+        const VFEPConfig& v = *vfeps.store[i];
+        vfeps.suppression_active[i] = v.suppression_active;
+        // Re-resolve only when the selection changed
+        if (v.selected_rack_id != vfeps.selected_rack_id[i]) {
+            vfeps.selected_rack_id[i] = v.selected_rack_id;
+            vfeps.selected_rack[i] = v.selected_rack_id.empty() ? kNoHandle : racks.ids.find(v.selected_rack_id);
+        }
+    }
+
+    std::fill(racks.open_incident.begin(), racks.open_incident.end(), kNoHandle);
+    for (std::size_t i = 0; i < incidents.rack.size(); ++i) {
+        if (incidents.store[i]) {
+            const Incident& inc = *incidents.store[i];
+            incidents.state[i] = inc.state;
+            incidents.started_at_s[i] = inc.started_at_s;
+            incidents.resolved_at_s[i] = inc.resolved_at_s;
+        }
+        const std::uint32_t r = incidents.rack[i];
+        if (r != kNoHandle && incidents.state[i] != IncidentState::Resolved &&
+            racks.open_incident[r] == kNoHandle) {
+            racks.open_incident[r] = static_cast<std::uint32_t>(i);
+        }
+    }
+}
+
+void EntityRegistry::save() {
+    for (std::size_t i = 0; i < racks.store.size(); ++i) {
+        RackTelemetry& rt = *racks.store[i];
+        rt.is_on_fire = racks.on_fire[i] != 0;
+        rt.surface_temp_C = racks.surface_temp_C[i];
+        rt.risk_to_assets_pct = racks.risk_pct[i];
+    }
+    for (std::size_t i = 0; i < arms.store.size(); ++i) {
+        ArmTelemetry& at = *arms.store[i];
+        at.s_0_1 = arms.s[i];
+        at.v_s_0_1_per_s = arms.v[i];
+        at.target_s_0_1 = arms.target_s[i];
+        at.has_target = arms.has_target[i] != 0;
+        at.state = arms.state[i];
+    }
+    for (std::size_t i = 0; i < nozzles.store.size(); ++i) {
+        NozzleTelemetry& nt = *nozzles.store[i];
+        nt.pan_deg = nozzles.pan[i];
+        nt.tilt_deg = nozzles.tilt[i];
+        nt.target_pan_deg = nozzles.target_pan[i];
+        nt.target_tilt_deg = nozzles.target_tilt[i];
+        nt.has_target = nozzles.has_target[i] != 0;
+    }
+    for (std::size_t i = 0; i < tanks.store.size(); ++i) {
+        TankTelemetry& tt = *tanks.store[i];
+        tt.current_pressure_bar = tanks.pressure_bar[i];
+        tt.regulator_bar = tanks.regulator_bar[i];
+        tt.remaining_agent_mass_kg = tanks.remaining_kg[i];
+        tt.current_flow_kg_s = tanks.flow_kg_s[i];
+        tt.is_depleted = tanks.depleted[i] != 0;
+        if (tanks.discharging[i] && tt.valve_state != "discharging") tt.valve_state = "discharging";
+    }
+    for (std::size_t i = 0; i < interlocks.store.size(); ++i) {
+        InterlockStatus& il = *interlocks.store[i];
+        il.allow_arm = interlocks.allow_arm[i] != 0;
+        il.allow_suppress = interlocks.allow_suppress[i] != 0;
+        il.updated_ms = interlocks.updated_ms[i];
+        if (il.allow_arm && il.allow_suppress) il.reasons.clear();
+    }
+    for (std::size_t i = 0; i < incidents.rack.size(); ++i) {
+        if (!incidents.store[i]) {
+            const std::uint32_t r = incidents.rack[i];
+            Incident inc;
+            inc.incident_id = incidents.ids.id(static_cast<std::uint32_t>(i));
+            inc.room_id = racks.room_id[r];
+            inc.rack_id = racks.ids.id(r);
+            inc.tags = {"auto"};
+            store_->upsert(inc);
+            incidents.store[i] = &store_->incidents[inc.incident_id];
+        }
+        Incident& inc = *incidents.store[i];
+        inc.state = incidents.state[i];
+        inc.started_at_s = incidents.started_at_s[i];
+        inc.resolved_at_s = incidents.resolved_at_s[i];
+    }
+}
+
+std::uint32_t EntityRegistry::openIncident(std::uint32_t rack, double sim_time_s) {
+    const std::string id = "inc-" + racks.ids.id(rack) + "-" + std::to_string((long long)(sim_time_s * 1000.0));
+    const std::uint32_t h = incidents.ids.intern(id);
+    if (h == incidents.rack.size()) {
+        incidents.rack.push_back(rack);
+        incidents.state.push_back(IncidentState::Active);
+        incidents.started_at_s.push_back(sim_time_s);
+        incidents.resolved_at_s.push_back(0.0);
+        incidents.store.push_back(nullptr);
+    } else {
+        // Same ID as an existing incident (re-ignition within the same ms):
+        // reopen it, as upserting the same key would
+        incidents.rack[h] = rack;
+        incidents.state[h] = IncidentState::Active;
+        incidents.started_at_s[h] = sim_time_s;
+        incidents.resolved_at_s[h] = 0.0;
+    }
+    racks.open_incident[rack] = h;
+    return h;
+}
+
+} // namespace obj
+} // namespace vfep
@@ -0,0 +1,130 @@
+#include "FireSimBridge.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace vfep {
+namespace mech {
+
+using vfep::obj::kNoHandle;
+
+FireSimBridge::FireSimBridge(FireBridgeParams p) : p_(p) {}
+
+void FireSimBridge::clear() {
+    for (auto& f : fires_) {
+        if (f.sim) pool_.push_back(std::move(f.sim));
+    }
+    fires_.clear();
+    std::fill(fire_of_rack_.begin(), fire_of_rack_.end(), kNoHandle);
+}
+
+const vfep::Simulation* FireSimBridge::simulationFor(std::uint32_t rack) const {
+    if (rack >= fire_of_rack_.size() || fire_of_rack_[rack] == kNoHandle) return nullptr;
+    return fires_[fire_of_rack_[rack]].sim.get();
+}
+
+// ============================================================================
+// Step
+// ============================================================================
+
+void FireSimBridge::step(vfep::obj::EntityRegistry& reg, double sim_time_s, double dt) {
+    auto& racks = reg.racks;
+    const std::size_t n = racks.on_fire.size();
+    if (fire_of_rack_.size() != n) {
+        // Registry was rebuilt; rack handles changed
+        clear();
+        fire_of_rack_.assign(n, kNoHandle);
+    }
+
+    // Racks that stopped burning outside the bridge (commands) release their
+    // Simulation; racks that started burning get one, in rack order
+    for (auto& f : fires_) {
+        if (!racks.on_fire[f.rack]) f.out = true;
+    }
+    for (std::uint32_t r = 0; r < n; ++r) {
+        if (!racks.on_fire[r] || fire_of_rack_[r] != kNoHandle) continue;
+        Fire f;
+        f.rack = r;
+        if (!pool_.empty()) {
+            f.sim = std::move(pool_.back());
+            pool_.pop_back();
+        }
+        fire_of_rack_[r] = static_cast<std::uint32_t>(fires_.size());
+        fires_.push_back(std::move(f));
+    }
+    if (fires_.empty()) return;
+
+    const int substeps = std::max(1, static_cast<int>(std::ceil(dt / std::max(1e-6, p_.max_substep_s))));
+    const double h = dt / substeps;
+    WorkerPool& pool = p_.pool ? *p_.pool : WorkerPool::shared();
+    pool.parallelFor(fires_.size(), p_.min_fires_per_thread, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Fire& f = fires_[i];
+            if (f.out) continue;
+            // Constructed here rather than in the serial pass: it is the
+            // expensive part of a new fire
+            if (!f.sim) {
+                f.sim = std::make_unique<vfep::Simulation>();
+                f.sim->enableTelemetryHistory(false);
+            }
+            if (!f.started) {
+                f.sim->resetToDataCenterRackScenario();
+                f.sim->commandIgniteOrIncreasePyrolysis();
+                f.started = true;
+            }
+
+            const bool suppress = racks.suppressing[f.rack] != 0;
+            if (suppress != f.suppressing) {
+                if (suppress) f.sim->commandStartSuppression();
+                else f.sim->commandStopSuppression();
+                f.suppressing = suppress;
+            }
+            f.suppressed = f.suppressed || suppress;
+
+            for (int k = 0; k < substeps; ++k) f.sim->step(h);
+            f.obs = f.sim->observe();
+            // A fresh ignition starts below the threshold; only a fire that
+            // grew past it and was knocked back down counts as out
+            f.developed = f.developed || f.obs.HRR_W >= p_.extinguished_HRR_W;
+            f.out = f.suppressed && ((f.developed && f.obs.HRR_W < p_.extinguished_HRR_W) || f.sim->isConcluded());
+        }
+    });
+
+    // Write back and retire extinguished fires (serial: incidents are shared)
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < fires_.size(); ++i) {
+        Fire& f = fires_[i];
+        const std::uint32_t r = f.rack;
+        if (f.started && racks.on_fire[r]) {
+            racks.surface_temp_C[r] = f.obs.T_K - 273.15;
+            racks.risk_pct[r] = std::clamp(100.0 * f.obs.HRR_W / std::max(1.0, p_.full_risk_HRR_W), 0.0, 100.0);
+            racks.agent_flow_kg_s[r] = f.obs.agent_mdot_kgps;
+            if (f.out) {
+                racks.on_fire[r] = 0;
+                racks.agent_flow_kg_s[r] = 0.0;
+                const std::uint32_t inc = racks.open_incident[r];
+                if (inc != kNoHandle) {
+                    reg.incidents.state[inc] = vfep::obj::IncidentState::Resolved;
+                    reg.incidents.resolved_at_s[inc] = sim_time_s;
+                    racks.open_incident[r] = kNoHandle;
+                }
+            }
+        } else if (!racks.on_fire[r]) {
+            racks.agent_flow_kg_s[r] = 0.0;
+        }
+
+        if (f.out) {
+            if (f.sim) pool_.push_back(std::move(f.sim));
+            fire_of_rack_[r] = kNoHandle;
+            continue;
+        }
+        if (kept != i) fires_[kept] = std::move(f);
+        fire_of_rack_[r] = static_cast<std::uint32_t>(kept);
+        ++kept;
+    }
+    fires_.resize(kept);
+}
+
+} // namespace mech
+} // namespace vfep
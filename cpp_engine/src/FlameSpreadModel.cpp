@@ -9,12 +9,16 @@
  * - Surface-to-surface flame spread
  * - Heat release rate calculation from burning surfaces
  * - Material property handling (HRRPUA, ignition temperature)
+ * - Event-driven ignition: each non-burning surface carries a predicted
+ *   ignition time in a min-heap; work per step scales with the surfaces whose
+ *   incident flux changed, not with the whole inventory
  */
 
 #include "FlameSpreadModel.h"
 #include <algorithm>
 #include <stdexcept>
 #include <cmath>
+#include <limits>
 
 namespace vfep {
 
@@ -26,6 +30,31 @@ constexpr float SPREAD_DISTANCE = 0.5f;       // Flame spreads to surfaces withi
 constexpr float MIN_SPREAD_DISTANCE = 0.05f;  // Avoid singularity at very short distances
 constexpr float HEAT_FLUX_TO_TEMP_COEFF = 0.015f; // Empirical temp rise per (W/m²·s)
 constexpr float MIN_FUEL_LOAD_KG = 1e-5f;
+constexpr float NEAR_FLAME_IGNITION_FRACTION = 0.8f; // Threshold fraction next to a flame
+constexpr float FLUX_REPUBLISH_FUEL_FRACTION = 0.01f; // Re-send source flux after 1% fuel decay
+constexpr float IGNITION_TEMP_TOLERANCE_K = 1e-3f;
+constexpr float PI_F = 3.14159f;
+
+namespace {
+
+int64_t gridKey(int ix, int iy, int iz) {
+    // 21 bits per axis covers +/-1e6 cells (+/-500 km at 0.5 m cells)
+    constexpr int64_t MASK = (int64_t(1) << 21) - 1;
+    return ((int64_t(ix) & MASK) << 42) | ((int64_t(iy) & MASK) << 21) | (int64_t(iz) & MASK);
+}
+
+int gridCell(float coord_m) {
+    return static_cast<int>(std::floor(coord_m / SPREAD_DISTANCE));
+}
+
+float fuelFactor(const FlammableSurface& surface) {
+    if (surface.fuel_load_kg <= MIN_FUEL_LOAD_KG || surface.initial_fuel_load_kg <= 0.0f) {
+        return 0.0f;
+    }
+    return std::min(1.0f, surface.fuel_load_kg / surface.initial_fuel_load_kg);
+}
+
+} // namespace
 
 // ============================================================================
 // CONSTRUCTION & INITIALIZATION
@@ -41,6 +70,17 @@ FlameSpreadModel::~FlameSpreadModel() {
 
 void FlameSpreadModel::reset() {
     surfaces_.clear();
+    neighbors_.clear();
+    incident_flux_W_m2_.clear();
+    burning_neighbors_.clear();
+    temp_ref_time_s_.clear();
+    published_power_W_.clear();
+    generation_.clear();
+    burning_slot_.clear();
+    burning_ids_.clear();
+    ignition_queue_ = {};
+    spatial_grid_.clear();
+    time_s_ = 0.0;
 }
 
 // ============================================================================
@@ -83,7 +123,18 @@ int FlameSpreadModel::addSurface(const FlammableSurface& surface) {
     }
 
     surfaces_.push_back(normalized);
-    return static_cast<int>(surfaces_.size() - 1);
+    neighbors_.emplace_back();
+    incident_flux_W_m2_.push_back(0.0f);
+    burning_neighbors_.push_back(0);
+    temp_ref_time_s_.push_back(time_s_);
+    published_power_W_.push_back(0.0f);
+    generation_.push_back(0);
+    burning_slot_.push_back(-1);
+
+    const int id = static_cast<int>(surfaces_.size() - 1);
+    linkNeighbors(id);
+    predictIgnition(id);
+    return id;
 }
 
 void FlameSpreadModel::setSurfaceTemperature(int surface_id, float temp_K) {
@@ -95,9 +146,11 @@ void FlameSpreadModel::setSurfaceTemperature(int surface_id, float temp_K) {
     }
     
     surfaces_[surface_id].temperature_K = temp_K;
+    temp_ref_time_s_[surface_id] = time_s_;
     
     // Check if heating causes ignition
-    checkIgnitionCriteria(0.0f);  // Immediate check
+    predictIgnition(surface_id);
+    processIgnitionQueue();  // Immediate check
 }
 
 // ============================================================================
@@ -109,24 +162,32 @@ void FlameSpreadModel::updateFlameSpread(float dt) {
         throw std::invalid_argument("Timestep must be positive");
     }
     
-    // Step 1: Update burn time for all burning surfaces
-    for (auto& surface : surfaces_) {
-        if (surface.is_burning) {
-            surface.burn_time_s += dt;
-            if (surface.mass_loss_rate_kg_s > 0.0f) {
-                surface.fuel_load_kg = std::max(0.0f, surface.fuel_load_kg - surface.mass_loss_rate_kg_s * dt);
-                if (surface.fuel_load_kg <= MIN_FUEL_LOAD_KG) {
-                    surface.is_burning = false;
-                }
+    time_s_ += dt;
+
+    // Step 1: Update burn time and fuel for burning surfaces only. Burnout and
+    // significant fuel decay change the flux seen by neighbors.
+    const std::vector<int> burning = burning_ids_;
+    for (int id : burning) {
+        FlammableSurface& surface = surfaces_[id];
+        surface.burn_time_s += dt;
+        if (surface.mass_loss_rate_kg_s > 0.0f) {
+            surface.fuel_load_kg = std::max(0.0f, surface.fuel_load_kg - surface.mass_loss_rate_kg_s * dt);
+            if (surface.fuel_load_kg <= MIN_FUEL_LOAD_KG) {
+                setBurning(id, false);
+                continue;
             }
         }
+
+        const float full_power = surface.hrrpua_W_m2 * surface.area_m2;
+        const float power = sourcePower(id);
+        if (full_power > 0.0f &&
+            published_power_W_[id] - power > FLUX_REPUBLISH_FUEL_FRACTION * full_power) {
+            publishSourcePower(id, power);
+        }
     }
     
-    // Step 2: Check for new ignitions based on temperature
-    checkIgnitionCriteria(dt);
-    
-    // Step 3: Propagate flame to nearby surfaces
-    propagateFlame(dt);
+    // Step 2: Ignite surfaces whose predicted ignition time has arrived
+    processIgnitionQueue();
 }
 
 void FlameSpreadModel::igniteAtLocation(int surface_id) {
@@ -137,7 +198,7 @@ void FlameSpreadModel::igniteAtLocation(int surface_id) {
     FlammableSurface& surface = surfaces_[surface_id];
     
     if (!surface.is_burning) {
-        surface.is_burning = true;
+        setBurning(surface_id, true);
         surface.burn_time_s = 0.0f;
     }
 }
@@ -147,8 +208,7 @@ void FlameSpreadModel::extinguish(int surface_id) {
         throw std::out_of_range("Invalid surface ID");
     }
     
-    FlammableSurface& surface = surfaces_[surface_id];
-    surface.is_burning = false;
+    setBurning(surface_id, false);
     // Note: We keep burn_time_s to track cumulative burn duration
 }
 
@@ -159,14 +219,8 @@ void FlameSpreadModel::extinguish(int surface_id) {
 float FlameSpreadModel::getTotalHeatReleaseRate() const {
     float total_hrr = 0.0f;
     
-    for (const auto& surface : surfaces_) {
-        if (surface.is_burning) {
-            float fuel_factor = 0.0f;
-            if (surface.fuel_load_kg > MIN_FUEL_LOAD_KG && surface.initial_fuel_load_kg > 0.0f) {
-                fuel_factor = std::min(1.0f, surface.fuel_load_kg / surface.initial_fuel_load_kg);
-            }
-            total_hrr += surface.hrrpua_W_m2 * surface.area_m2 * fuel_factor;
-        }
+    for (int id : burning_ids_) {
+        total_hrr += sourcePower(id);
     }
     
     return total_hrr;
@@ -177,14 +231,10 @@ float FlameSpreadModel::getHeatReleaseRateFromSurface(int surface_id) const {
         throw std::out_of_range("Invalid surface ID");
     }
     
-    const FlammableSurface& surface = surfaces_[surface_id];
-    
-    if (!surface.is_burning || surface.fuel_load_kg <= MIN_FUEL_LOAD_KG || surface.initial_fuel_load_kg <= 0.0f) {
+    if (!surfaces_[surface_id].is_burning) {
         return 0.0f;
     }
-    
-    float fuel_factor = std::min(1.0f, surface.fuel_load_kg / surface.initial_fuel_load_kg);
-    return surface.hrrpua_W_m2 * surface.area_m2 * fuel_factor;
+    return sourcePower(surface_id);
 }
 
 float FlameSpreadModel::getSurfaceHeatFluxWm2(int surface_id) const {
@@ -193,12 +243,10 @@ float FlameSpreadModel::getSurfaceHeatFluxWm2(int surface_id) const {
     }
 
     const FlammableSurface& surface = surfaces_[surface_id];
-    if (!surface.is_burning || surface.fuel_load_kg <= MIN_FUEL_LOAD_KG || surface.initial_fuel_load_kg <= 0.0f) {
+    if (!surface.is_burning) {
         return 0.0f;
     }
-
-    float fuel_factor = std::min(1.0f, surface.fuel_load_kg / surface.initial_fuel_load_kg);
-    return surface.hrrpua_W_m2 * fuel_factor;
+    return surface.hrrpua_W_m2 * fuelFactor(surface);
 }
 
 // ============================================================================
@@ -215,129 +263,225 @@ bool FlameSpreadModel::isSurfaceBurning(int surface_id) const {
 
 int FlameSpreadModel::getNumBurningSurfaces() const {
     int count = 0;
-    for (const auto& surface : surfaces_) {
-        if (surface.is_burning && surface.fuel_load_kg > MIN_FUEL_LOAD_KG) {
+    for (int id : burning_ids_) {
+        if (surfaces_[id].fuel_load_kg > MIN_FUEL_LOAD_KG) {
             ++count;
         }
     }
     return count;
 }
 
+float FlameSpreadModel::getSurfaceTemperature(int surface_id) const {
+    if (surface_id < 0 || surface_id >= static_cast<int>(surfaces_.size())) {
+        throw std::out_of_range("Invalid surface ID");
+    }
+
+    const FlammableSurface& surface = surfaces_[surface_id];
+    if (surface.is_burning) {
+        return surface.temperature_K;
+    }
+    const double elapsed = time_s_ - temp_ref_time_s_[surface_id];
+    return surface.temperature_K + heatingRate(surface_id) * static_cast<float>(elapsed);
+}
+
 // ============================================================================
-// PRIVATE METHODS - IGNITION & SPREAD LOGIC
+// IGNITION PREDICTION
 // ============================================================================
 
-void FlameSpreadModel::checkIgnitionCriteria(float dt) {
-    // Check each surface for ignition conditions
-    for (size_t i = 0; i < surfaces_.size(); ++i) {
-        if (!surfaces_[i].is_burning && canIgnite(static_cast<int>(i))) {
-            surfaces_[i].is_burning = true;
-            surfaces_[i].burn_time_s = 0.0f;
-        }
+float FlameSpreadModel::getTimeToIgnition(int surface_id) const {
+    if (surface_id < 0 || surface_id >= static_cast<int>(surfaces_.size())) {
+        throw std::out_of_range("Invalid surface ID");
+    }
+
+    const FlammableSurface& surface = surfaces_[surface_id];
+    if (surface.is_burning || surface.fuel_load_kg <= MIN_FUEL_LOAD_KG) {
+        return std::numeric_limits<float>::infinity();
     }
+
+    const float deficit_K = ignitionThreshold(surface_id) - getSurfaceTemperature(surface_id);
+    if (deficit_K <= 0.0f) {
+        return 0.0f;
+    }
+    const float rate = heatingRate(surface_id);
+    if (rate <= 0.0f) {
+        return std::numeric_limits<float>::infinity();
+    }
+    return deficit_K / rate;
 }
 
-bool FlameSpreadModel::canIgnite(int surface_id) const {
+float FlameSpreadModel::getIncidentHeatFluxWm2(int surface_id) const {
     if (surface_id < 0 || surface_id >= static_cast<int>(surfaces_.size())) {
-        return false;
+        throw std::out_of_range("Invalid surface ID");
     }
-    
+    return std::max(0.0f, incident_flux_W_m2_[surface_id]);
+}
+
+// ============================================================================
+// PRIVATE METHODS - NEIGHBORHOOD & SOURCE BOOKKEEPING
+// ============================================================================
+
+void FlameSpreadModel::linkNeighbors(int surface_id) {
+    // Surfaces never move after being added, so neighbor lists are built once
+    // from a uniform grid with cell size equal to the spread distance.
     const FlammableSurface& surface = surfaces_[surface_id];
-    
-    // Already burning
-    if (surface.is_burning) {
-        return false;
+    const int cx = gridCell(surface.x_m);
+    const int cy = gridCell(surface.y_m);
+    const int cz = gridCell(surface.z_m);
+
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                auto it = spatial_grid_.find(gridKey(cx + dx, cy + dy, cz + dz));
+                if (it == spatial_grid_.end()) {
+                    continue;
+                }
+                for (int other_id : it->second) {
+                    const FlammableSurface& other = surfaces_[other_id];
+                    float ddx = surface.x_m - other.x_m;
+                    float ddy = surface.y_m - other.y_m;
+                    float ddz = surface.z_m - other.z_m;
+                    float distance = std::sqrt(ddx*ddx + ddy*ddy + ddz*ddz);
+                    if (distance >= SPREAD_DISTANCE) {
+                        continue;
+                    }
+                    distance = std::max(distance, MIN_SPREAD_DISTANCE);
+                    // q_rad ∝ 1/r² for point source
+                    const float coeff = 1.0f / (4.0f * PI_F * distance * distance);
+                    neighbors_[surface_id].push_back({other_id, coeff});
+                    neighbors_[other_id].push_back({surface_id, coeff});
+
+                    // A newly added surface immediately sees existing flames
+                    if (other.is_burning) {
+                        incident_flux_W_m2_[surface_id] += published_power_W_[other_id] * coeff;
+                        burning_neighbors_[surface_id] += 1;
+                    }
+                }
+            }
+        }
     }
-    
-    // Check if temperature exceeds ignition threshold
-    if (surface.temperature_K >= surface.ignition_temp_K) {
-        return true;
+
+    spatial_grid_[gridKey(cx, cy, cz)].push_back(surface_id);
+}
+
+float FlameSpreadModel::sourcePower(int surface_id) const {
+    const FlammableSurface& surface = surfaces_[surface_id];
+    return surface.hrrpua_W_m2 * surface.area_m2 * fuelFactor(surface);
+}
+
+void FlameSpreadModel::setBurning(int surface_id, bool burning) {
+    FlammableSurface& surface = surfaces_[surface_id];
+    if (surface.is_burning == burning) {
+        return;
     }
-    
-    // Check if nearby burning surfaces provide enough radiant heat
-    // (Simplified: if any nearby surface is burning, temperature will rise)
-    for (size_t i = 0; i < surfaces_.size(); ++i) {
-        if (i == static_cast<size_t>(surface_id)) {
-            continue;
+
+    if (burning) {
+        materializeTemperature(surface_id);
+        surface.is_burning = true;
+        ++generation_[surface_id];  // Drop any pending prediction
+        burning_slot_[surface_id] = static_cast<int>(burning_ids_.size());
+        burning_ids_.push_back(surface_id);
+    } else {
+        surface.is_burning = false;
+        temp_ref_time_s_[surface_id] = time_s_;
+        const int slot = burning_slot_[surface_id];
+        const int last = burning_ids_.back();
+        burning_ids_[slot] = last;
+        burning_slot_[last] = slot;
+        burning_ids_.pop_back();
+        burning_slot_[surface_id] = -1;
+    }
+
+    const int delta_count = burning ? 1 : -1;
+    for (const Neighbor& n : neighbors_[surface_id]) {
+        burning_neighbors_[n.id] += delta_count;
+    }
+    publishSourcePower(surface_id, burning ? sourcePower(surface_id) : 0.0f);
+
+    if (!burning) {
+        predictIgnition(surface_id);
+    }
+}
+
+void FlameSpreadModel::publishSourcePower(int surface_id, float power_W) {
+    const float delta_W = power_W - published_power_W_[surface_id];
+    published_power_W_[surface_id] = power_W;
+
+    for (const Neighbor& n : neighbors_[surface_id]) {
+        if (!surfaces_[n.id].is_burning) {
+            materializeTemperature(n.id);  // Close out heating at the old rate
         }
-        
-        const FlammableSurface& other = surfaces_[i];
-        if (!other.is_burning) {
-            continue;
+        incident_flux_W_m2_[n.id] += delta_W * n.view_coeff;
+        if (burning_neighbors_[n.id] == 0) {
+            incident_flux_W_m2_[n.id] = 0.0f;  // Drop accumulated round-off
         }
-        
-        // Calculate distance between surfaces
-        float dx = surface.x_m - other.x_m;
-        float dy = surface.y_m - other.y_m;
-        float dz = surface.z_m - other.z_m;
-        float distance = std::sqrt(dx*dx + dy*dy + dz*dz);
-        
-        // If burning surface is nearby, assume radiative heating
-        if (distance < SPREAD_DISTANCE) {
-            // Simplified: if very close and surface is warm, can ignite
-            if (surface.temperature_K > surface.ignition_temp_K * 0.8f) {
-                return true;
-            }
+        if (!surfaces_[n.id].is_burning) {
+            predictIgnition(n.id);
         }
     }
-    
-    return false;
 }
 
-void FlameSpreadModel::propagateFlame(float dt) {
-    // Find all currently burning surfaces
-    std::vector<int> burning_ids;
-    for (size_t i = 0; i < surfaces_.size(); ++i) {
-        if (surfaces_[i].is_burning) {
-            burning_ids.push_back(static_cast<int>(i));
+// ============================================================================
+// PRIVATE METHODS - IGNITION PREDICTION & EVENT QUEUE
+// ============================================================================
+
+float FlameSpreadModel::heatingRate(int surface_id) const {
+    // Lumped thermal response: dT/dt = q'' · HEAT_FLUX_TO_TEMP_COEFF
+    return std::max(0.0f, incident_flux_W_m2_[surface_id]) * HEAT_FLUX_TO_TEMP_COEFF;
+}
+
+float FlameSpreadModel::ignitionThreshold(int surface_id) const {
+    // A surface adjacent to a flame ignites once it is reasonably warm
+    const float threshold = surfaces_[surface_id].ignition_temp_K;
+    return burning_neighbors_[surface_id] > 0 ? threshold * NEAR_FLAME_IGNITION_FRACTION : threshold;
+}
+
+void FlameSpreadModel::materializeTemperature(int surface_id) {
+    const double elapsed = time_s_ - temp_ref_time_s_[surface_id];
+    if (elapsed > 0.0) {
+        surfaces_[surface_id].temperature_K += heatingRate(surface_id) * static_cast<float>(elapsed);
+    }
+    temp_ref_time_s_[surface_id] = time_s_;
+}
+
+void FlameSpreadModel::predictIgnition(int surface_id) {
+    ++generation_[surface_id];
+
+    const FlammableSurface& surface = surfaces_[surface_id];
+    if (surface.is_burning || surface.fuel_load_kg <= MIN_FUEL_LOAD_KG) {
+        return;  // Burning or burnt out: nothing to predict
+    }
+
+    const float deficit_K = ignitionThreshold(surface_id) - getSurfaceTemperature(surface_id);
+    double ignition_time_s = time_s_;
+    if (deficit_K > 0.0f) {
+        const float rate = heatingRate(surface_id);
+        if (rate <= 0.0f) {
+            return;  // Not heating: stays out of the queue until flux changes
         }
+        ignition_time_s += static_cast<double>(deficit_K / rate);
     }
-    
-    // Check each burning surface for potential spread to neighbors
-    for (int burning_id : burning_ids) {
-        const FlammableSurface& burning_surface = surfaces_[burning_id];
-        
-        // Check all other surfaces
-        for (size_t target_id = 0; target_id < surfaces_.size(); ++target_id) {
-            if (static_cast<int>(target_id) == burning_id) {
-                continue;
-            }
-            
-            FlammableSurface& target = surfaces_[target_id];
-            if (target.is_burning) {
-                continue;  // Already burning
-            }
-            
-            // Calculate distance
-            float dx = target.x_m - burning_surface.x_m;
-            float dy = target.y_m - burning_surface.y_m;
-            float dz = target.z_m - burning_surface.z_m;
-            float distance = std::sqrt(dx*dx + dy*dy + dz*dz);
-            distance = std::max(distance, MIN_SPREAD_DISTANCE);
-            
-            // Flame spread criterion: nearby surfaces heat up from radiation
-            if (distance < SPREAD_DISTANCE) {
-                float fuel_factor = 0.0f;
-                if (burning_surface.fuel_load_kg > MIN_FUEL_LOAD_KG && burning_surface.initial_fuel_load_kg > 0.0f) {
-                    fuel_factor = std::min(1.0f, burning_surface.fuel_load_kg / burning_surface.initial_fuel_load_kg);
-                }
 
-                // Estimate radiative heating
-                // q_rad ∝ 1/r² for point source
-                float heat_flux = burning_surface.hrrpua_W_m2 * 
-                                 burning_surface.area_m2 * fuel_factor / 
-                                 (4.0f * 3.14159f * distance * distance);
-                
-                // Simplified: raise temperature based on heat flux and timestep
-                float temp_rise = heat_flux * HEAT_FLUX_TO_TEMP_COEFF * dt;
-                target.temperature_K += temp_rise;
-                
-                // Check if this heating causes ignition
-                if (target.temperature_K >= target.ignition_temp_K) {
-                    target.is_burning = true;
-                    target.burn_time_s = 0.0f;
-                }
-            }
+    ignition_queue_.push({ignition_time_s, surface_id, generation_[surface_id]});
+}
+
+void FlameSpreadModel::processIgnitionQueue() {
+    // Pop only the events that are due. Igniting a surface re-predicts its
+    // neighbors, so cascades within the same step resolve here as well.
+    while (!ignition_queue_.empty() && ignition_queue_.top().time_s <= time_s_) {
+        const IgnitionEvent ev = ignition_queue_.top();
+        ignition_queue_.pop();
+
+        if (ev.generation != generation_[ev.surface_id] || surfaces_[ev.surface_id].is_burning) {
+            continue;  // Stale entry
+        }
+
+        materializeTemperature(ev.surface_id);
+        const FlammableSurface& surface = surfaces_[ev.surface_id];
+        if (surface.temperature_K + IGNITION_TEMP_TOLERANCE_K >= ignitionThreshold(ev.surface_id)) {
+            setBurning(ev.surface_id, true);
+            surfaces_[ev.surface_id].burn_time_s = 0.0f;
+        } else {
+            predictIgnition(ev.surface_id);
         }
     }
 }
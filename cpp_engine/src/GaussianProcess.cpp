@@ -0,0 +1,212 @@
+#include "GaussianProcess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace vfep {
+
+namespace {
+
+// L z = b (L lower, row-major n x n)
+void forwardSolve(const std::vector<double>& L, size_t n, const double* b, double* z) {
+    for (size_t i = 0; i < n; ++i) {
+        double s = b[i];
+        const double* Li = &L[i * n];
+        for (size_t k = 0; k < i; ++k) s -= Li[k] * z[k];
+        z[i] = s / Li[i];
+    }
+}
+
+// L^T x = z
+void backSolve(const std::vector<double>& L, size_t n, const double* z, double* x) {
+    for (size_t i = n; i-- > 0;) {
+        double s = z[i];
+        for (size_t k = i + 1; k < n; ++k) s -= L[k * n + i] * x[k];
+        x[i] = s / L[i * n + i];
+    }
+}
+
+constexpr double kMinLength = 0.1;  // Shorter is not identifiable from tens of points
+constexpr double kMaxLength = 10.0;
+constexpr int kGridPoints = 16;
+constexpr int kSweeps = 3;
+constexpr double kMinNugget = 1e-8;
+constexpr double kMaxNugget = 1.0;  // Noise as large as the signal: anything rougher is not worth modelling
+
+} // namespace
+
+double GaussianProcess::correlation(const double* a, const double* b) const {
+    double d2 = 0.0;
+    for (size_t k = 0; k < dim_; ++k) {
+        const double d = (a[k] - b[k]) / length_[k];
+        d2 += d * d;
+    }
+    return std::exp(-0.5 * d2);
+}
+
+bool GaussianProcess::factor() {
+    const size_t n = y_.size();
+    chol_.assign(n * n, 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            double s = (i == j) ? 1.0 + nugget_ : correlation(&x_[i * dim_], &x_[j * dim_]);
+            for (size_t k = 0; k < j; ++k) s -= chol_[i * n + k] * chol_[j * n + k];
+            if (i == j) {
+                if (!(s > 0.0)) return false;
+                chol_[i * n + i] = std::sqrt(s);
+            } else {
+                chol_[i * n + j] = s / chol_[j * n + j];
+            }
+        }
+    }
+
+    // GLS mean, then alpha = R^-1 (y - mean) and the profiled signal variance
+    std::vector<double> tmp(n), ones(n, 1.0);
+    rinv_one_.resize(n);
+    forwardSolve(chol_, n, ones.data(), tmp.data());
+    backSolve(chol_, n, tmp.data(), rinv_one_.data());
+    std::vector<double> rinv_y(n);
+    forwardSolve(chol_, n, y_.data(), tmp.data());
+    backSolve(chol_, n, tmp.data(), rinv_y.data());
+    one_rinv_one_ = 0.0;
+    double one_rinv_y = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        one_rinv_one_ += rinv_one_[i];
+        one_rinv_y += rinv_y[i];
+    }
+    mean_ = one_rinv_one_ > 0.0 ? one_rinv_y / one_rinv_one_ : 0.0;
+    alpha_.resize(n);
+    sigma2_ = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        alpha_[i] = rinv_y[i] - mean_ * rinv_one_[i];
+        sigma2_ += (y_[i] - mean_) * alpha_[i];
+    }
+    sigma2_ = std::max(sigma2_ / static_cast<double>(n), 0.0);
+    return true;
+}
+
+double GaussianProcess::concentratedNegLogLikelihood() {
+    if (!factor()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const size_t n = y_.size();
+    double log_det = 0.0;
+    for (size_t i = 0; i < n; ++i) log_det += std::log(chol_[i * n + i]);
+    return 0.5 * static_cast<double>(n) * std::log(std::max(sigma2_, 1e-300)) + log_det;
+}
+
+void GaussianProcess::condition() {
+    while (!factor()) {
+        if (nugget_ >= kMaxNugget) {
+            throw std::runtime_error("GaussianProcess: correlation matrix is not positive definite");
+        }
+        nugget_ *= 10.0;
+    }
+}
+
+void GaussianProcess::fit(const std::vector<double>& x, size_t dim, const std::vector<double>& y) {
+    if (dim == 0 || y.empty() || x.size() != y.size() * dim) {
+        throw std::invalid_argument("GaussianProcess::fit: need n x dim inputs for n > 0 outputs");
+    }
+    for (double v : x) {
+        if (!std::isfinite(v)) throw std::invalid_argument("GaussianProcess::fit: non-finite input");
+    }
+    for (double v : y) {
+        if (!std::isfinite(v)) throw std::invalid_argument("GaussianProcess::fit: non-finite output");
+    }
+    dim_ = dim;
+    x_ = x;
+    y_ = y;
+    length_.assign(dim, 0.5);
+    nugget_ = kMinNugget;
+
+    // Coordinate search: the nugget by decades, then each length scale on a log
+    // grid. The nugget goes first so noise is not fitted by shrinking lengths
+    std::vector<double> grid(kGridPoints);
+    for (int g = 0; g < kGridPoints; ++g) {
+        grid[g] = kMinLength * std::pow(kMaxLength / kMinLength, double(g) / double(kGridPoints - 1));
+    }
+    double best = concentratedNegLogLikelihood();
+    for (int sweep = 0; sweep < kSweeps; ++sweep) {
+        bool improved = false;
+        for (size_t k = 0; k <= dim; ++k) {
+            const bool nugget = k == 0;
+            double& param = nugget ? nugget_ : length_[k - 1];
+            double best_value = param;
+            auto tryValue = [&](double value) {
+                param = value;
+                const double nll = concentratedNegLogLikelihood();
+                if (nll < best - 1e-9) {
+                    best = nll;
+                    best_value = value;
+                    improved = true;
+                }
+            };
+            if (nugget) {
+                for (double nug = kMinNugget; nug <= kMaxNugget * 1.0001; nug *= 10.0) tryValue(nug);
+            } else {
+                for (double len : grid) tryValue(len);
+            }
+            param = best_value;
+        }
+        if (!improved) break;
+    }
+    condition();
+}
+
+void GaussianProcess::addPoint(const double* x, double y) {
+    if (dim_ == 0) {
+        throw std::logic_error("GaussianProcess::addPoint: fit() first");
+    }
+    x_.insert(x_.end(), x, x + dim_);
+    y_.push_back(y);
+    condition();
+}
+
+void GaussianProcess::predict(const double* x, double& mean, double& variance) const {
+    const size_t n = y_.size();
+    if (n == 0) {
+        throw std::logic_error("GaussianProcess::predict: fit() first");
+    }
+    thread_local std::vector<double> r, v;
+    r.resize(n);
+    v.resize(n);
+    double mu = mean_;
+    double one_rinv_r = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = correlation(x, &x_[i * dim_]);
+        mu += r[i] * alpha_[i];
+        one_rinv_r += r[i] * rinv_one_[i];
+    }
+    forwardSolve(chol_, n, r.data(), v.data());
+    double vv = 0.0;
+    for (size_t i = 0; i < n; ++i) vv += v[i] * v[i];
+    const double u = 1.0 - one_rinv_r;
+    mean = mu;
+    variance = sigma2_ * std::max(0.0, 1.0 - vv + u * u / one_rinv_one_);
+}
+
+double GaussianProcess::leaveOneOutRmse() const {
+    const size_t n = y_.size();
+    if (n < 2) {
+        return 0.0;
+    }
+    // diag(R^-1) = column norms of L^-1
+    std::vector<double> diag(n, 0.0), e(n), col(n);
+    for (size_t j = 0; j < n; ++j) {
+        std::fill(e.begin(), e.end(), 0.0);
+        e[j] = 1.0;
+        forwardSolve(chol_, n, e.data(), col.data());
+        for (size_t i = j; i < n; ++i) diag[j] += col[i] * col[i];
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double r = alpha_[i] / diag[i];
+        sum += r * r;
+    }
+    return std::sqrt(sum / static_cast<double>(n));
+}
+
+} // namespace vfep
@@ -4,18 +4,24 @@
 
 #include <grpcpp/grpcpp.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <cctype>
 #include <string_view>
 
+#include "TelemetryPublisher.h"
+#include "WorldHost.h"
 #include "vfep_sim_service_v1.grpc.pb.h"
 
 namespace vfep {
@@ -23,10 +29,17 @@ namespace grpcsim {
 
 using chemsi::vfep::v1::VFEPUnitySimServiceV1;
 using chemsi::vfep::v1::EmptyV1;
+using chemsi::vfep::v1::WorldRequestV1;
+using chemsi::vfep::v1::CreateWorldV1;
+using chemsi::vfep::v1::WorldInfoV1;
+using chemsi::vfep::v1::WorldListV1;
 using chemsi::vfep::v1::WorldSnapshotV1;
 using chemsi::vfep::v1::TelemetryFrameV1;
+using chemsi::vfep::v1::TelemetryDeltaV1;
 using chemsi::vfep::v1::CommandV1;
 using chemsi::vfep::v1::CommandAckV1;
+using chemsi::vfep::v1::ClockControlV1;
+using chemsi::vfep::v1::ClockStateV1;
 
 static chemsi::vfep::v1::VFEPStatusV1 mapStatus(vfep::obj::VFEPStatus s) {
     using V = chemsi::vfep::v1::VFEPStatusV1;
@@ -53,6 +66,27 @@ static chemsi::vfep::v1::ArmStateV1 mapArmState(vfep::obj::ArmDeploymentState s)
     }
 }
 
+static chemsi::vfep::v1::ClockModeV1 mapClockMode(vfep::host::ClockMode m) {
+    using V = chemsi::vfep::v1::ClockModeV1;
+    switch (m) {
+    case vfep::host::ClockMode::RealTime: return V::CLOCK_MODE_REAL_TIME;
+    case vfep::host::ClockMode::Scaled: return V::CLOCK_MODE_SCALED;
+    case vfep::host::ClockMode::MaxThroughput: return V::CLOCK_MODE_MAX_THROUGHPUT;
+    case vfep::host::ClockMode::Lockstep: return V::CLOCK_MODE_LOCKSTEP;
+    default: return V::CLOCK_MODE_REAL_TIME;
+    }
+}
+
+static vfep::host::ClockMode mapClockMode(chemsi::vfep::v1::ClockModeV1 m) {
+    using V = chemsi::vfep::v1::ClockModeV1;
+    switch (m) {
+    case V::CLOCK_MODE_SCALED: return vfep::host::ClockMode::Scaled;
+    case V::CLOCK_MODE_MAX_THROUGHPUT: return vfep::host::ClockMode::MaxThroughput;
+    case V::CLOCK_MODE_LOCKSTEP: return vfep::host::ClockMode::Lockstep;
+    default: return vfep::host::ClockMode::RealTime;
+    }
+}
+
 static chemsi::vfep::v1::IncidentStateV1 mapIncidentState(vfep::obj::IncidentState s) {
     using V = chemsi::vfep::v1::IncidentStateV1;
     switch (s) {
@@ -255,16 +289,420 @@ double get_z_mm(const Rack& rack) {
 
 } // namespace detail
 
-class ServiceImpl final : public VFEPUnitySimServiceV1::Service {
+// ---- Snapshot -> proto conversion ----
+// Full frames identify entities by string ID; deltas by integer handle.
+
+static void fillRack(chemsi::vfep::v1::RackTelemetryV1* r, const vfep::obj::RackTelemetry& rt) {
+    r->set_is_on_fire(rt.is_on_fire);
+    r->set_surface_temp_c(rt.surface_temp_C);
+    r->set_risk_to_assets_pct(rt.risk_to_assets_pct);
+}
+
+static void fillTank(chemsi::vfep::v1::TankTelemetryV1* t, const vfep::obj::TankTelemetry& tt) {
+    t->set_current_pressure_bar(tt.current_pressure_bar);
+    t->set_regulator_bar(tt.regulator_bar);
+    t->set_remaining_agent_mass_kg(tt.remaining_agent_mass_kg);
+    t->set_current_flow_kg_s(tt.current_flow_kg_s);
+    t->set_is_depleted(tt.is_depleted);
+    t->set_valve_state(tt.valve_state);
+}
+
+static void fillArm(chemsi::vfep::v1::ArmTelemetryV1* a, const vfep::obj::ArmTelemetry& at) {
+    a->set_state(mapArmState(at.state));
+    a->set_s_0_1(at.s_0_1);
+    a->set_v_s_0_1_per_s(at.v_s_0_1_per_s);
+    a->set_target_s_0_1(at.target_s_0_1);
+    a->set_has_target(at.has_target);
+    a->set_interlock_active(at.interlock_active);
+    a->set_fault_code(at.fault_code);
+}
+
+static void fillNozzle(chemsi::vfep::v1::NozzleTelemetryV1* n, const vfep::obj::NozzleTelemetry& nt) {
+    n->set_clogged(nt.clogged);
+    n->set_pan_deg(nt.pan_deg);
+    n->set_tilt_deg(nt.tilt_deg);
+    n->set_target_pan_deg(nt.target_pan_deg);
+    n->set_target_tilt_deg(nt.target_tilt_deg);
+    n->set_has_target(nt.has_target);
+}
+
+static void fillInterlock(chemsi::vfep::v1::InterlockStatusV1* i, const vfep::obj::InterlockStatus& il) {
+    i->set_vfep_id(il.vfep_id);
+    i->set_allow_arm(il.allow_arm);
+    i->set_allow_suppress(il.allow_suppress);
+    for (const auto& reason : il.reasons) i->add_reasons(reason);
+    i->set_updated_ms(il.updated_ms);
+}
+
+static void fillIncident(chemsi::vfep::v1::IncidentV1* i, const vfep::obj::Incident& inc) {
+    i->set_room_id(inc.room_id);
+    i->set_rack_id(inc.rack_id);
+    i->set_state(mapIncidentState(inc.state));
+    i->set_started_at_s(inc.started_at_s);
+    i->set_resolved_at_s(inc.resolved_at_s);
+    for (const auto& tag : inc.tags) i->add_tags(tag);
+}
+
+static void fillAlert(chemsi::vfep::v1::AlertV1* a, const vfep::obj::Alert& al) {
+    a->set_room_id(al.room_id);
+    a->set_rack_id(al.rack_id);
+    a->set_severity(mapAlertSeverity(al.severity));
+    a->set_code(al.code);
+    a->set_message(al.message);
+    a->set_created_ms(al.created_ms);
+    a->set_acknowledged(al.acknowledged);
+}
+
+static void fillVFEP(chemsi::vfep::v1::VFEPOrchestrationV1* v, const vfep::telemetry::VFEPOrchestration& o) {
+    v->set_status(mapStatus(o.status));
+    v->set_selected_rack_id(o.selected_rack_id);
+    v->set_selected_hotspot_u(o.selected_hotspot_u);
+    v->set_suppression_active(o.suppression_active);
+}
+
+// Append entities of one kind; `indices` selects a subset (nullptr = all)
+template <class T, class AddFn, class FillFn, class SetIdFn>
+static void appendEntities(const vfep::telemetry::TelemetrySnapshot& snap,
+                           const std::vector<vfep::telemetry::Handled<T>>& items,
+                           const std::vector<std::uint32_t>* indices, bool by_handle,
+                           AddFn add, FillFn fill, SetIdFn set_id) {
+    const std::size_t count = indices ? indices->size() : items.size();
+    for (std::size_t k = 0; k < count; ++k) {
+        const auto& item = items[indices ? (*indices)[k] : k];
+        auto* m = add();
+        if (by_handle) {
+            m->set_handle(item.handle);
+        } else {
+            set_id(m, snap.id(item.handle));
+        }
+        fill(m, item.value);
+    }
+}
+
+template <class Out>
+static void appendAll(Out& out, const vfep::telemetry::TelemetrySnapshot& snap,
+                      const vfep::telemetry::TelemetryDelta* delta) {
+    using namespace chemsi::vfep::v1;
+    using vfep::telemetry::EntityKind;
+    const bool by_handle = delta != nullptr;
+    auto sel = [&](EntityKind k) { return delta ? &delta->changed[static_cast<std::size_t>(k)] : nullptr; };
+
+    appendEntities(snap, snap.racks, sel(EntityKind::Rack), by_handle, [&]() { return out.add_racks(); }, fillRack,
+                   [](RackTelemetryV1* m, const std::string& id) { m->set_rack_id(id); });
+    appendEntities(snap, snap.tanks, sel(EntityKind::Tank), by_handle, [&]() { return out.add_tanks(); }, fillTank,
+                   [](TankTelemetryV1* m, const std::string& id) { m->set_tank_id(id); });
+    appendEntities(snap, snap.arms, sel(EntityKind::Arm), by_handle, [&]() { return out.add_arms(); }, fillArm,
+                   [](ArmTelemetryV1* m, const std::string& id) { m->set_arm_id(id); });
+    appendEntities(snap, snap.nozzles, sel(EntityKind::Nozzle), by_handle, [&]() { return out.add_nozzles(); }, fillNozzle,
+                   [](NozzleTelemetryV1* m, const std::string& id) { m->set_nozzle_id(id); });
+    appendEntities(snap, snap.interlocks, sel(EntityKind::Interlock), by_handle, [&]() { return out.add_interlocks(); },
+                   fillInterlock, [](InterlockStatusV1* m, const std::string& id) { m->set_interlock_id(id); });
+    appendEntities(snap, snap.incidents, sel(EntityKind::Incident), by_handle, [&]() { return out.add_incidents(); },
+                   fillIncident, [](IncidentV1* m, const std::string& id) { m->set_incident_id(id); });
+    appendEntities(snap, snap.alerts, sel(EntityKind::Alert), by_handle, [&]() { return out.add_alerts(); }, fillAlert,
+                   [](AlertV1* m, const std::string& id) { m->set_alert_id(id); });
+    appendEntities(snap, snap.vfeps, sel(EntityKind::VFEP), by_handle, [&]() { return out.add_vfeps(); }, fillVFEP,
+                   [](VFEPOrchestrationV1* m, const std::string& id) { m->set_vfep_id(id); });
+}
+
+// Proto messages shared by all streams. Each published tick is converted
+// once, by the first stream that needs it; consecutive-tick deltas are
+// cached the same way (streams that fell behind diff on their own).
+class TelemetryProtoCache {
 public:
-    ServiceImpl(vfep::obj::ObjectStore& store, std::mutex& mu, std::atomic<bool>& stop_flag, double& sim_time_s)
-        : store_(store), mu_(mu), stop_flag_(stop_flag), sim_time_s_(sim_time_s) {}
+    explicit TelemetryProtoCache(std::string world_id) : world_id_(std::move(world_id)) {}
 
-    grpc::Status GetWorldSnapshot(grpc::ServerContext*, const EmptyV1*, WorldSnapshotV1* out) override {
+    std::shared_ptr<const TelemetryFrameV1> frameFor(const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& snap) {
         std::lock_guard<std::mutex> lk(mu_);
+        if (!frame_ || frame_tick_ != snap->tick) {
+            auto frame = std::make_shared<TelemetryFrameV1>();
+            frame->set_schema_version("1.0");
+            frame->set_world_id(world_id_);
+            frame->set_sim_time_s(snap->sim_time_s);
+            appendAll(*frame, *snap, nullptr);
+            frame_ = std::move(frame);
+            frame_tick_ = snap->tick;
+        }
+        return frame_;
+    }
+
+    std::shared_ptr<const TelemetryDeltaV1> deltaFor(const vfep::telemetry::TelemetrySnapshot* base,
+                                                     const vfep::telemetry::TelemetrySnapshot& cur) {
+        const std::uint64_t base_tick = base ? base->tick : 0;
+        const bool cacheable = base && base_tick + 1 == cur.tick;
+        if (cacheable) {
+            std::lock_guard<std::mutex> lk(mu_);
+            if (delta_ && delta_tick_ == cur.tick && delta_base_tick_ == base_tick) return delta_;
+        }
+
+        auto msg = std::make_shared<TelemetryDeltaV1>();
+        const auto delta = vfep::telemetry::computeDelta(base, cur);
+        msg->set_schema_version("1.0");
+        msg->set_world_id(world_id_);
+        msg->set_tick(cur.tick);
+        msg->set_base_tick(delta.base_tick);
+        msg->set_sim_time_s(cur.sim_time_s);
+        for (std::uint32_t h = delta.first_new_handle; h < delta.end_new_handle; ++h) {
+            auto* e = msg->add_new_handles();
+            e->set_handle(h);
+            e->set_id(cur.id(h));
+        }
+        appendAll(*msg, cur, &delta);
+        for (std::uint32_t h : delta.removed_handles) msg->add_removed_handles(h);
+
+        if (cacheable) {
+            std::lock_guard<std::mutex> lk(mu_);
+            delta_ = msg;
+            delta_tick_ = cur.tick;
+            delta_base_tick_ = base_tick;
+        }
+        return msg;
+    }
+
+private:
+    const std::string world_id_;
+    std::mutex mu_;
+    std::shared_ptr<const TelemetryFrameV1> frame_;
+    std::uint64_t frame_tick_ = 0;
+    std::shared_ptr<const TelemetryDeltaV1> delta_;
+    std::uint64_t delta_tick_ = 0;
+    std::uint64_t delta_base_tick_ = 0;
+};
+
+struct CommandOutcome {
+    bool ok = false;
+    std::string message;
+};
+
+// Worker stepping the world only
+static CommandOutcome applyCommand(vfep::obj::ObjectStore& store, const CommandV1* cmd) {
+    const std::uint64_t ts = cmd->client_timestamp_ms();
+
+    auto ok = [](const std::string& msg) { return CommandOutcome{true, msg}; };
+    auto bad = [](const std::string& msg) { return CommandOutcome{false, msg}; };
+
+    if (cmd->has_set_armed()) {
+        const auto& c = cmd->set_armed();
+        auto it = store.vfeps.find(c.vfep_id());
+        if (it == store.vfeps.end()) return bad("Unknown vfep_id");
+        it->second.status = c.armed() ? vfep::obj::VFEPStatus::Armed : vfep::obj::VFEPStatus::Normal;
+        return ok("set_armed applied");
+    }
+    if (cmd->has_select_target()) {
+        const auto& c = cmd->select_target();
+        auto it = store.vfeps.find(c.vfep_id());
+        if (it == store.vfeps.end()) return bad("Unknown vfep_id");
+        it->second.selected_rack_id = c.rack_id();
+        it->second.selected_hotspot_u = c.hotspot_u();
+        return ok("select_target applied");
+    }
+    if (cmd->has_start_suppression()) {
+        const auto& c = cmd->start_suppression();
+        auto it = store.vfeps.find(c.vfep_id());
+        if (it == store.vfeps.end()) return bad("Unknown vfep_id");
+        it->second.suppression_active = true;
+        return ok("start_suppression applied");
+    }
+    if (cmd->has_stop_suppression()) {
+        const auto& c = cmd->stop_suppression();
+        auto it = store.vfeps.find(c.vfep_id());
+        if (it == store.vfeps.end()) return bad("Unknown vfep_id");
+        it->second.suppression_active = false;
+        return ok("stop_suppression applied");
+    }
+    if (cmd->has_manual_aim()) {
+        const auto& c = cmd->manual_aim();
+        auto it = store.nozzle_telemetry.find(c.nozzle_id());
+        if (it == store.nozzle_telemetry.end()) return bad("Unknown nozzle_id");
+        it->second.target_pan_deg = c.pan_deg();
+        it->second.target_tilt_deg = c.tilt_deg();
+        it->second.has_target = true;
+        it->second.last_command_ms = ts;
+        it->second.last_command_source = "grpc";
+        return ok("manual_aim applied");
+    }
+    if (cmd->has_move_arm()) {
+        const auto& c = cmd->move_arm();
+        auto it = store.arm_telemetry.find(c.arm_id());
+        if (it == store.arm_telemetry.end()) return bad("Unknown arm_id");
+        it->second.target_s_0_1 = c.target_s_0_1();
+        it->second.has_target = true;
+        it->second.last_command_ms = ts;
+        it->second.last_command_source = "grpc";
+        return ok("move_arm applied");
+    }
+    if (cmd->has_ignite_rack()) {
+        const auto& c = cmd->ignite_rack();
+        auto it = store.rack_telemetry.find(c.rack_id());
+        if (it == store.rack_telemetry.end()) return bad("Unknown rack_id");
+        auto& rt = it->second;
+        if (!rt.is_on_fire) {
+            // Starting point for the built-in model; a fire_sim world
+            // overwrites it with the rack's Simulation on the next tick
+            rt.is_on_fire = true;
+            rt.surface_temp_C = std::max(rt.surface_temp_C, 400.0);
+            rt.risk_to_assets_pct = std::max(rt.risk_to_assets_pct, 80.0);
+        }
+        return ok("ignite_rack applied");
+    }
+    if (cmd->has_reset()) {
+        const auto& c = cmd->reset();
+        auto it = store.vfeps.find(c.vfep_id());
+        if (it == store.vfeps.end()) return bad("Unknown vfep_id");
+        it->second.selected_rack_id.clear();
+        it->second.selected_hotspot_u = 0;
+        it->second.suppression_active = false;
+        // reset tanks
+        for (auto& [tid, cfg] : store.tanks) {
+            if (cfg.vfep_id != c.vfep_id()) continue;
+            auto& tt = store.tank_telemetry[tid];
+            tt.remaining_agent_mass_kg = cfg.initial_agent_mass_kg;
+            tt.current_pressure_bar = cfg.regulator_setpoint_bar;
+            tt.regulator_bar = cfg.regulator_setpoint_bar;
+            tt.current_flow_kg_s = 0.0;
+            tt.is_depleted = false;
+            tt.valve_state = "online";
+        }
+        return ok("reset applied");
+    }
+
+    return bad("No command set");
+}
+
+// One subscriber stream. Ticks arrive from the worker that stepped the
+// world and go out through a StreamGate (one write in flight,
+// drop-to-latest, rate cap), so a slow client holds no thread and never
+// delays the other streams. Delta streams diff against the last snapshot
+// actually written. A completed write acks its tick to the host, which is
+// what releases a lockstep world: that world never publishes past a frame
+// some stream has not taken, so no stream skips a tick.
+template <class Msg>
+class TelemetryStreamReactor final : public grpc::ServerWriteReactor<Msg> {
+public:
+    TelemetryStreamReactor(vfep::host::WorldHost& host, std::shared_ptr<vfep::host::World> world,
+                           std::shared_ptr<TelemetryProtoCache> cache, double max_stream_hz)
+        : host_(host), world_(std::move(world)), cache_(std::move(cache)), gate_(max_stream_hz) {
+        // Subscribing also starts an idle world ticking
+        sub_id_ = host.subscribe(world_, [this](const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& snap) {
+            onSnapshot(snap);
+        });
+        // Either the fan-out saw close() after we subscribed (and will send
+        // nullptr), or it happened before and closed() says so
+        const auto& publisher = world_->publisher();
+        onSnapshot(publisher.closed() ? nullptr : publisher.latest());
+    }
+
+    void OnWriteDone(bool ok) override {
+        std::unique_lock<std::mutex> lk(mu_);
+        if (ok && sent_) host_.ack(world_, sub_id_, sent_->tick);
+        auto next = gate_.writeDone(std::chrono::steady_clock::now());
+        if (!ok || finishing_) {
+            finishLocked(lk);
+            return;
+        }
+        if (next) writeLocked(lk, std::move(next));
+    }
+
+    void OnCancel() override {
+        std::unique_lock<std::mutex> lk(mu_);
+        requestFinishLocked(lk);
+    }
+
+    void OnDone() override {
+        host_.unsubscribe(world_, sub_id_);
+        delete this;
+    }
+
+private:
+    void onSnapshot(const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& snap) {
+        std::unique_lock<std::mutex> lk(mu_);
+        if (finishing_) return;
+        if (!snap) {
+            // Publisher closed (world destroyed or server stopping)
+            requestFinishLocked(lk);
+            return;
+        }
+        if (auto now_snap = gate_.offer(snap, std::chrono::steady_clock::now())) {
+            writeLocked(lk, std::move(now_snap));
+        }
+    }
+
+    // The gRPC calls run after unlocking: a reaction may run inline and,
+    // for Finish(), delete this reactor.
+    void writeLocked(std::unique_lock<std::mutex>& lk, std::shared_ptr<const vfep::telemetry::TelemetrySnapshot> snap) {
+        if constexpr (std::is_same<Msg, TelemetryDeltaV1>::value) {
+            msg_ = cache_->deltaFor(sent_.get(), *snap);
+        } else {
+            msg_ = cache_->frameFor(snap);
+        }
+        sent_ = std::move(snap);
+        const Msg* msg = msg_.get();
+        lk.unlock();
+        this->StartWrite(msg);
+    }
+
+    void requestFinishLocked(std::unique_lock<std::mutex>& lk) {
+        finishing_ = true;
+        if (!gate_.writing()) finishLocked(lk);
+    }
+
+    void finishLocked(std::unique_lock<std::mutex>& lk) {
+        finishing_ = true;
+        if (finished_) return;
+        finished_ = true;
+        lk.unlock();
+        this->Finish(grpc::Status::OK);
+    }
+
+    vfep::host::WorldHost& host_;
+    std::shared_ptr<vfep::host::World> world_;  // Keeps the fan-out alive until OnDone
+    std::shared_ptr<TelemetryProtoCache> cache_;
+    std::uint64_t sub_id_ = 0;
+
+    std::mutex mu_;
+    vfep::telemetry::StreamGate gate_;
+    std::shared_ptr<const Msg> msg_;                               // Kept alive until the write completes
+    std::shared_ptr<const vfep::telemetry::TelemetrySnapshot> sent_;  // Delta base
+    bool finishing_ = false;
+    bool finished_ = false;
+};
+
+// Stream that ends immediately with an error (e.g. unknown world)
+template <class Msg>
+class FailedStreamReactor final : public grpc::ServerWriteReactor<Msg> {
+public:
+    explicit FailedStreamReactor(const grpc::Status& status) { this->Finish(status); }
+    void OnDone() override { delete this; }
+};
+
+static const char* const kDefaultWorldId = "default";
+
+// Callback-API service: no RPC occupies a thread while it waits for a tick
+// or for a worker to apply a command.
+class ServiceImpl final : public VFEPUnitySimServiceV1::CallbackService {
+public:
+    ServiceImpl(vfep::host::WorldHost& host, std::atomic<bool>& stop_flag, double default_tick_hz, double max_stream_hz)
+        : host_(host), stop_flag_(stop_flag), default_tick_hz_(default_tick_hz), max_stream_hz_(max_stream_hz) {}
+
+    grpc::ServerUnaryReactor* GetWorldSnapshot(grpc::CallbackServerContext* ctx, const WorldRequestV1* req,
+                                               WorldSnapshotV1* out) override {
+        auto* reactor = ctx->DefaultReactor();
+        const auto world = resolve(req->world_id());
+        if (!world) {
+            reactor->Finish(unknownWorld(req->world_id()));
+            return reactor;
+        }
+
+        // Static layout from the creation copy; VFEP status from the latest tick
+        const vfep::obj::ObjectStore& store = *world->layout();
+        std::unordered_map<std::string, vfep::obj::VFEPStatus> live_status;
+        if (const auto snap = world->publisher().latest()) {
+            for (const auto& v : snap->vfeps) live_status.emplace(snap->id(v.handle), v.value.status);
+        }
         out->set_schema_version("1.0");
+        out->set_world_id(world->id());
 
-        for (const auto& [id, room] : store_.rooms) {
+        for (const auto& [id, room] : store.rooms) {
             auto* r = out->add_rooms();
             r->set_room_id(room.room_id);
             r->set_name(room.name);
@@ -272,7 +710,7 @@ public:
             r->set_security_level(room.security_level);
         }
 
-        for (const auto& [id, rack] : store_.racks) {
+        for (const auto& [id, rack] : store.racks) {
             auto* r = out->add_racks();
             r->set_rack_id(rack.rack_id);
             r->set_room_id(rack.room_id);
@@ -289,17 +727,18 @@ public:
             p->set_z_mm(detail::get_z_mm(rack));
         }
 
-        for (const auto& [id, vfep] : store_.vfeps) {
+        for (const auto& [id, vfep] : store.vfeps) {
             auto* v = out->add_vfeps();
             v->set_vfep_id(vfep.vfep_id);
             v->set_room_id(vfep.room_id);
-            v->set_status(mapStatus(vfep.status));
+            const auto live = live_status.find(id);
+            v->set_status(mapStatus(live != live_status.end() ? live->second : vfep.status));
             v->set_mounting_type(vfep.mounting_type);
             v->set_firmware_version(vfep.firmware_version);
             for (const auto& rid : vfep.coverage_rack_ids) v->add_coverage_rack_ids(rid);
         }
 
-        for (const auto& [id, rail] : store_.rails) {
+        for (const auto& [id, rail] : store.rails) {
             auto* r = out->add_rails();
             r->set_rail_id(rail.rail_id);
             r->set_vfep_id(rail.vfep_id);
@@ -313,7 +752,7 @@ public:
             for (const auto& rid : rail.related_rack_ids) r->add_related_rack_ids(rid);
         }
 
-        for (const auto& [id, arm] : store_.arms) {
+        for (const auto& [id, arm] : store.arms) {
             auto* a = out->add_arms();
             a->set_arm_id(arm.arm_id);
             a->set_vfep_id(arm.vfep_id);
@@ -325,7 +764,7 @@ public:
             a->set_max_a_s_0_1_per_s2(arm.max_a_s_0_1_per_s2);
         }
 
-        for (const auto& [id, noz] : store_.nozzles) {
+        for (const auto& [id, noz] : store.nozzles) {
             auto* n = out->add_nozzles();
             n->set_nozzle_id(noz.nozzle_id);
             n->set_arm_id(noz.arm_id);
@@ -336,7 +775,7 @@ public:
             n->set_flow_rate_kg_s(noz.flow_rate_kg_s);
         }
 
-        for (const auto& [id, tank] : store_.tanks) {
+        for (const auto& [id, tank] : store.tanks) {
             auto* t = out->add_tanks();
             t->set_tank_id(tank.tank_id);
             t->set_vfep_id(tank.vfep_id);
@@ -346,226 +785,205 @@ public:
             t->set_regulator_setpoint_bar(tank.regulator_setpoint_bar);
         }
 
-        return grpc::Status::OK;
-    }
-
-    grpc::Status StreamTelemetry(grpc::ServerContext* ctx, const EmptyV1*, grpc::ServerWriter<TelemetryFrameV1>* writer) override {
-        while (!ctx->IsCancelled() && !stop_flag_.load()) {
-            TelemetryFrameV1 frame;
-            {
-                std::lock_guard<std::mutex> lk(mu_);
-                frame.set_schema_version("1.0");
-                frame.set_sim_time_s(sim_time_s_);
-
-                for (const auto& [rack_id, rt] : store_.rack_telemetry) {
-                    auto* r = frame.add_racks();
-                    r->set_rack_id(rack_id);
-                    r->set_is_on_fire(rt.is_on_fire);
-                    r->set_surface_temp_c(rt.surface_temp_C);
-                    r->set_risk_to_assets_pct(rt.risk_to_assets_pct);
-                }
-                for (const auto& [tank_id, tt] : store_.tank_telemetry) {
-                    auto* t = frame.add_tanks();
-                    t->set_tank_id(tank_id);
-                    t->set_current_pressure_bar(tt.current_pressure_bar);
-                    t->set_regulator_bar(tt.regulator_bar);
-                    t->set_remaining_agent_mass_kg(tt.remaining_agent_mass_kg);
-                    t->set_current_flow_kg_s(tt.current_flow_kg_s);
-                    t->set_is_depleted(tt.is_depleted);
-                    t->set_valve_state(tt.valve_state);
-                }
-                for (const auto& [arm_id, at] : store_.arm_telemetry) {
-                    auto* a = frame.add_arms();
-                    a->set_arm_id(arm_id);
-                    a->set_state(mapArmState(at.state));
-                    a->set_s_0_1(at.s_0_1);
-                    a->set_v_s_0_1_per_s(at.v_s_0_1_per_s);
-                    a->set_target_s_0_1(at.target_s_0_1);
-                    a->set_has_target(at.has_target);
-                    a->set_interlock_active(at.interlock_active);
-                    a->set_fault_code(at.fault_code);
-                }
-                for (const auto& [noz_id, nt] : store_.nozzle_telemetry) {
-                    auto* n = frame.add_nozzles();
-                    n->set_nozzle_id(noz_id);
-                    n->set_clogged(nt.clogged);
-                    n->set_pan_deg(nt.pan_deg);
-                    n->set_tilt_deg(nt.tilt_deg);
-                    n->set_target_pan_deg(nt.target_pan_deg);
-                    n->set_target_tilt_deg(nt.target_tilt_deg);
-                    n->set_has_target(nt.has_target);
-                }
-                for (const auto& [iid, il] : store_.interlocks) {
-                    auto* i = frame.add_interlocks();
-                    i->set_interlock_id(iid);
-                    i->set_vfep_id(il.vfep_id);
-                    i->set_allow_arm(il.allow_arm);
-                    i->set_allow_suppress(il.allow_suppress);
-                    for (const auto& reason : il.reasons) i->add_reasons(reason);
-                    i->set_updated_ms(il.updated_ms);
-                }
-                for (const auto& [inc_id, inc] : store_.incidents) {
-                    auto* i = frame.add_incidents();
-                    i->set_incident_id(inc_id);
-                    i->set_room_id(inc.room_id);
-                    i->set_rack_id(inc.rack_id);
-                    i->set_state(mapIncidentState(inc.state));
-                    i->set_started_at_s(inc.started_at_s);
-                    i->set_resolved_at_s(inc.resolved_at_s);
-                    for (const auto& tag : inc.tags) i->add_tags(tag);
-                }
-                for (const auto& [al_id, al] : store_.alerts) {
-                    auto* a = frame.add_alerts();
-                    a->set_alert_id(al_id);
-                    a->set_room_id(al.room_id);
-                    a->set_rack_id(al.rack_id);
-                    a->set_severity(mapAlertSeverity(al.severity));
-                    a->set_code(al.code);
-                    a->set_message(al.message);
-                    a->set_created_ms(al.created_ms);
-                    a->set_acknowledged(al.acknowledged);
-                }
-                for (const auto& [vfep_id, vfep] : store_.vfeps) {
-                    auto* v = frame.add_vfeps();
-                    v->set_vfep_id(vfep_id);
-                    v->set_status(mapStatus(vfep.status));
-                    v->set_selected_rack_id(vfep.selected_rack_id);
-                    v->set_selected_hotspot_u(vfep.selected_hotspot_u);
-                    v->set_suppression_active(vfep.suppression_active);
-                }
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
+    }
+
+    grpc::ServerWriteReactor<TelemetryFrameV1>* StreamTelemetry(grpc::CallbackServerContext*, const WorldRequestV1* req) override {
+        // One frame per published tick; the frame is shared by all streams of the world
+        const auto world = resolve(req->world_id());
+        if (!world) return new FailedStreamReactor<TelemetryFrameV1>(unknownWorld(req->world_id()));
+        return new TelemetryStreamReactor<TelemetryFrameV1>(host_, world, cacheFor(*world), max_stream_hz_);
+    }
+
+    grpc::ServerWriteReactor<TelemetryDeltaV1>* StreamTelemetryDelta(grpc::CallbackServerContext*, const WorldRequestV1* req) override {
+        // Keyframe first, then changes relative to the last snapshot sent
+        const auto world = resolve(req->world_id());
+        if (!world) return new FailedStreamReactor<TelemetryDeltaV1>(unknownWorld(req->world_id()));
+        return new TelemetryStreamReactor<TelemetryDeltaV1>(host_, world, cacheFor(*world), max_stream_hz_);
+    }
+
+    grpc::ServerUnaryReactor* SendCommand(grpc::CallbackServerContext* ctx, const CommandV1* cmd, CommandAckV1* ack) override {
+        auto* reactor = ctx->DefaultReactor();
+        if (stop_flag_.load()) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::UNAVAILABLE, "Server stopping"));
+            return reactor;
+        }
+        const auto world = resolve(cmd->world_id());
+        if (!world) {
+            reactor->Finish(unknownWorld(cmd->world_id()));
+            return reactor;
+        }
+        // Applied by the worker that steps the world next, which then
+        // completes the call
+        auto pending = std::make_unique<vfep::host::WorldCommand>();
+        pending->run = [reactor, ack, cmd = *cmd](vfep::obj::ObjectStore* store) {
+            if (!store) {
+                ack->set_ok(false);
+                ack->set_message("World destroyed");
+                reactor->Finish(grpc::Status(grpc::StatusCode::ABORTED, "World destroyed"));
+                return;
             }
+            const CommandOutcome outcome = applyCommand(*store, &cmd);
+            ack->set_ok(outcome.ok);
+            ack->set_message(outcome.message);
+            reactor->Finish(outcome.ok ? grpc::Status::OK
+                                       : grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, outcome.message));
+        };
+        host_.enqueue(world, std::move(pending));
+        return reactor;
+    }
 
-            if (!writer->Write(frame)) break;
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    grpc::ServerUnaryReactor* CreateWorld(grpc::CallbackServerContext* ctx, const CreateWorldV1* req, WorldInfoV1* out) override {
+        auto* reactor = ctx->DefaultReactor();
+        if (!req->world_id().empty() && host_.find(req->world_id())) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::ALREADY_EXISTS, "World already exists: " + req->world_id()));
+            return reactor;
         }
-        return grpc::Status::OK;
+        vfep::host::WorldConfig cfg;
+        cfg.world_id = req->world_id();
+        cfg.tick_hz = req->tick_hz() > 0.0 ? req->tick_hz() : default_tick_hz_;
+        cfg.synthetic_racks = req->synthetic_racks();
+        cfg.fire_sim = req->fire_sim();
+        std::string error;
+        const auto world = host_.create(cfg, &error);
+        if (!world) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, error));
+            return reactor;
+        }
+        fillInfo(out, *world);
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
     }
 
-    grpc::Status SendCommand(grpc::ServerContext*, const CommandV1* cmd, CommandAckV1* ack) override {
-        std::lock_guard<std::mutex> lk(mu_);
-        const std::uint64_t ts = cmd->client_timestamp_ms();
+    grpc::ServerUnaryReactor* DestroyWorld(grpc::CallbackServerContext* ctx, const WorldRequestV1* req, WorldInfoV1* out) override {
+        auto* reactor = ctx->DefaultReactor();
+        const std::string id = req->world_id().empty() ? kDefaultWorldId : req->world_id();
+        if (id == kDefaultWorldId) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "The default world cannot be destroyed"));
+            return reactor;
+        }
+        const auto world = host_.find(id);
+        if (!world || !host_.destroy(id)) {
+            reactor->Finish(unknownWorld(id));
+            return reactor;
+        }
+        {
+            std::lock_guard<std::mutex> lk(caches_mu_);
+            caches_.erase(world->serial());
+        }
+        fillInfo(out, *world);
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
+    }
 
-        auto ok = [&](const std::string& msg) {
-            ack->set_ok(true);
-            ack->set_message(msg);
-            return grpc::Status::OK;
-        };
-        auto bad = [&](const std::string& msg) {
-            ack->set_ok(false);
-            ack->set_message(msg);
-            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, msg);
-        };
+    grpc::ServerUnaryReactor* ListWorlds(grpc::CallbackServerContext* ctx, const EmptyV1*, WorldListV1* out) override {
+        for (const auto& world : host_.list()) fillInfo(out->add_worlds(), *world);
+        auto* reactor = ctx->DefaultReactor();
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
+    }
+
+    grpc::ServerUnaryReactor* ClockControl(grpc::CallbackServerContext* ctx, const ClockControlV1* req, ClockStateV1* out) override {
+        auto* reactor = ctx->DefaultReactor();
+        const auto world = resolve(req->world_id());
+        if (!world) {
+            reactor->Finish(unknownWorld(req->world_id()));
+            return reactor;
+        }
 
-        if (cmd->has_set_armed()) {
-            const auto& c = cmd->set_armed();
-            auto it = store_.vfeps.find(c.vfep_id());
-            if (it == store_.vfeps.end()) return bad("Unknown vfep_id");
-            it->second.status = c.armed() ? vfep::obj::VFEPStatus::Armed : vfep::obj::VFEPStatus::Normal;
-            return ok("set_armed applied");
-        }
-        if (cmd->has_select_target()) {
-            const auto& c = cmd->select_target();
-            auto it = store_.vfeps.find(c.vfep_id());
-            if (it == store_.vfeps.end()) return bad("Unknown vfep_id");
-            it->second.selected_rack_id = c.rack_id();
-            it->second.selected_hotspot_u = c.hotspot_u();
-            return ok("select_target applied");
-        }
-        if (cmd->has_start_suppression()) {
-            const auto& c = cmd->start_suppression();
-            auto it = store_.vfeps.find(c.vfep_id());
-            if (it == store_.vfeps.end()) return bad("Unknown vfep_id");
-            it->second.suppression_active = true;
-            return ok("start_suppression applied");
-        }
-        if (cmd->has_stop_suppression()) {
-            const auto& c = cmd->stop_suppression();
-            auto it = store_.vfeps.find(c.vfep_id());
-            if (it == store_.vfeps.end()) return bad("Unknown vfep_id");
-            it->second.suppression_active = false;
-            return ok("stop_suppression applied");
-        }
-        if (cmd->has_manual_aim()) {
-            const auto& c = cmd->manual_aim();
-            auto it = store_.nozzle_telemetry.find(c.nozzle_id());
-            if (it == store_.nozzle_telemetry.end()) return bad("Unknown nozzle_id");
-            it->second.target_pan_deg = c.pan_deg();
-            it->second.target_tilt_deg = c.tilt_deg();
-            it->second.has_target = true;
-            it->second.last_command_ms = ts;
-            it->second.last_command_source = "grpc";
-            return ok("manual_aim applied");
-        }
-        if (cmd->has_move_arm()) {
-            const auto& c = cmd->move_arm();
-            auto it = store_.arm_telemetry.find(c.arm_id());
-            if (it == store_.arm_telemetry.end()) return bad("Unknown arm_id");
-            it->second.target_s_0_1 = c.target_s_0_1();
-            it->second.has_target = true;
-            it->second.last_command_ms = ts;
-            it->second.last_command_source = "grpc";
-            return ok("move_arm applied");
-        }
-        if (cmd->has_reset()) {
-            const auto& c = cmd->reset();
-            auto it = store_.vfeps.find(c.vfep_id());
-            if (it == store_.vfeps.end()) return bad("Unknown vfep_id");
-            it->second.selected_rack_id.clear();
-            it->second.selected_hotspot_u = 0;
-            it->second.suppression_active = false;
-            // reset tanks
-            for (auto& [tid, cfg] : store_.tanks) {
-                if (cfg.vfep_id != c.vfep_id()) continue;
-                auto& tt = store_.tank_telemetry[tid];
-                tt.remaining_agent_mass_kg = cfg.initial_agent_mass_kg;
-                tt.current_pressure_bar = cfg.regulator_setpoint_bar;
-                tt.regulator_bar = cfg.regulator_setpoint_bar;
-                tt.current_flow_kg_s = 0.0;
-                tt.is_depleted = false;
-                tt.valve_state = "online";
+        std::string error;
+        bool ok = true;
+        if (req->mode() != chemsi::vfep::v1::CLOCK_MODE_UNCHANGED) {
+            ok = host_.setClockMode(world, mapClockMode(req->mode()), req->speed(), &error);
+        }
+        if (ok) {
+            switch (req->action_case()) {
+                case ClockControlV1::kPaused:
+                    host_.setPaused(world, req->paused());
+                    break;
+                case ClockControlV1::kStepTicks:
+                    host_.stepTicks(world, req->step_ticks());
+                    break;
+                case ClockControlV1::kSeekToS:
+                    ok = host_.seek(world, req->seek_to_s(), &error);
+                    break;
+                default:
+                    break;
             }
-            return ok("reset applied");
+        }
+        if (!ok) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error));
+            return reactor;
         }
 
-        return bad("No command set");
+        const vfep::host::ClockState c = host_.clock(*world);
+        const auto snap = world->publisher().latest();
+        out->set_world_id(world->id());
+        out->set_mode(mapClockMode(c.mode));
+        out->set_speed(c.speed);
+        out->set_paused(c.paused);
+        out->set_pending_steps(c.pending_steps);
+        out->set_seeking(c.seek_to_s >= 0.0);
+        out->set_seek_to_s(c.seek_to_s >= 0.0 ? c.seek_to_s : 0.0);
+        out->set_sim_time_s(snap ? snap->sim_time_s : 0.0);
+        out->set_ticks(world->ticks());
+        reactor->Finish(grpc::Status::OK);
+        return reactor;
     }
 
 private:
-    vfep::obj::ObjectStore& store_;
-    std::mutex& mu_;
+    std::shared_ptr<vfep::host::World> resolve(const std::string& world_id) const {
+        return host_.find(world_id.empty() ? kDefaultWorldId : world_id);
+    }
+
+    static grpc::Status unknownWorld(const std::string& world_id) {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Unknown world_id: " + (world_id.empty() ? kDefaultWorldId : world_id));
+    }
+
+    // Proto caches are per world instance (keyed by serial, so a re-created
+    // world with the same ID never sees the old world's frames)
+    std::shared_ptr<TelemetryProtoCache> cacheFor(const vfep::host::World& world) {
+        std::lock_guard<std::mutex> lk(caches_mu_);
+        auto& cache = caches_[world.serial()];
+        if (!cache) cache = std::make_shared<TelemetryProtoCache>(world.id());
+        return cache;
+    }
+
+    void fillInfo(WorldInfoV1* out, vfep::host::World& world) const {
+        out->set_world_id(world.id());
+        out->set_tick_hz(world.tickHz());
+        out->set_ticks(world.ticks());
+        out->set_subscribers(static_cast<std::uint32_t>(world.fanout().subscriberCount()));
+        out->set_ticking(host_.ticking(world));
+        out->set_fire_sim(world.fireSim());
+        out->set_active_fires(static_cast<std::uint32_t>(world.activeFires()));
+    }
+
+    vfep::host::WorldHost& host_;
     std::atomic<bool>& stop_flag_;
-    double& sim_time_s_;
+    const double default_tick_hz_;
+    const double max_stream_hz_;
+    std::mutex caches_mu_;
+    std::unordered_map<std::uint64_t, std::shared_ptr<TelemetryProtoCache>> caches_;
 };
 
 struct GrpcSimServer::Impl {
-    vfep::obj::ObjectStore store;
-    vfep::mech::MechanicsParams params;
-    std::mutex mu;
-    std::atomic<bool> stop_flag{false};
-    double sim_time_s = 0.0;
+    // Worlds (stores, clocks, telemetry) live in the host; its workers own
+    // each store while stepping it, RPC handlers only see published snapshots
+    std::unique_ptr<vfep::host::WorldHost> host;
+    std::size_t workers = 0;
+    std::size_t max_worlds = 256;
+    double max_tick_hz = 100.0;
+    bool default_fire_sim = false;
+
+    std::atomic<bool> stop_flag{false};  // RPCs: refuse new commands
+    double max_stream_hz = 0.0;
 
     std::unique_ptr<grpc::Server> server;
-    std::thread sim_thread;
-
-    void simLoop(int tick_hz) {
-        const double dt = (tick_hz > 0) ? (1.0 / static_cast<double>(tick_hz)) : 0.05;
-        auto next = std::chrono::steady_clock::now();
-        while (!stop_flag.load()) {
-            next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-                std::chrono::duration<double>(dt));
-            {
-                std::lock_guard<std::mutex> lk(mu);
-                vfep::mech::tick(store, sim_time_s, dt, params);
-                sim_time_s += dt;
-            }
-            std::this_thread::sleep_until(next);
-        }
-    }
 };
 
-GrpcSimServer::GrpcSimServer() : impl_(new Impl()) {
-    impl_->store = vfep::obj::makeDefault4x4ObjectStore();
-}
+GrpcSimServer::GrpcSimServer() : impl_(new Impl()) {}
 
 GrpcSimServer::~GrpcSimServer() {
     Stop();
@@ -573,8 +991,19 @@ GrpcSimServer::~GrpcSimServer() {
 
 bool GrpcSimServer::Run(const std::string& bind_addr, int port, int tick_hz) {
     const std::string addr = bind_addr + ":" + std::to_string(port);
-
-    ServiceImpl service(impl_->store, impl_->mu, impl_->stop_flag, impl_->sim_time_s);
+    const double default_hz = (tick_hz > 0) ? static_cast<double>(tick_hz) : 20.0;
+
+    impl_->host = std::make_unique<vfep::host::WorldHost>(impl_->workers, std::max(default_hz, impl_->max_tick_hz),
+                                                          impl_->max_worlds);
+    vfep::host::WorldConfig cfg;
+    cfg.world_id = kDefaultWorldId;
+    cfg.tick_hz = default_hz;
+    cfg.fire_sim = impl_->default_fire_sim;
+    if (!impl_->host->create(cfg)) {
+        std::cerr << "ERROR: Could not create the default world\n";
+        return false;
+    }
+    ServiceImpl service(*impl_->host, impl_->stop_flag, default_hz, impl_->max_stream_hz);
 
     grpc::ServerBuilder builder;
     builder.AddListeningPort(addr, grpc::InsecureServerCredentials());
@@ -582,12 +1011,14 @@ bool GrpcSimServer::Run(const std::string& bind_addr, int port, int tick_hz) {
     impl_->server = builder.BuildAndStart();
     if (!impl_->server) {
         std::cerr << "ERROR: Could not start gRPC server on " << addr << "\n";
+        impl_->host->stop();
         return false;
     }
 
-    std::cout << "[gRPC] VFEPUnitySimServiceV1 listening on " << addr << " tick_hz=" << tick_hz << "\n";
+    std::cout << "[gRPC] VFEPUnitySimServiceV1 listening on " << addr << " tick_hz=" << default_hz
+              << " max_stream_hz=" << impl_->max_stream_hz << " max_worlds=" << impl_->max_worlds
+              << " fire_sim=" << (impl_->default_fire_sim ? "on" : "off") << "\n";
     impl_->stop_flag.store(false);
-    impl_->sim_thread = std::thread([this, tick_hz]() { impl_->simLoop(tick_hz); });
 
     impl_->server->Wait(); // blocks
     return true;
@@ -596,11 +1027,57 @@ bool GrpcSimServer::Run(const std::string& bind_addr, int port, int tick_hz) {
 void GrpcSimServer::Stop() {
     if (!impl_) return;
     if (impl_->stop_flag.exchange(true)) return;
+    // Streams finish on close; workers keep applying commands until the
+    // server is down so queued ones still complete
+    if (impl_->host) impl_->host->closeTelemetry();
     if (impl_->server) {
-        impl_->server->Shutdown();
+        impl_->server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(2));
         impl_->server.reset();
     }
-    if (impl_->sim_thread.joinable()) impl_->sim_thread.join();
+    if (!impl_->host) return;
+    const auto st = loopStats();
+    impl_->host->stop();
+
+    std::cout << "[gRPC] worlds=" << st.worlds << " ticks=" << st.ticks << " overruns=" << st.overruns
+              << " tick_jitter_p99_us=" << st.tick_jitter_p99_us
+              << " commands=" << st.commands << " command_latency_p99_us=" << st.command_latency_p99_us << "\n";
+}
+
+GrpcSimServer::LoopStats GrpcSimServer::loopStats() const {
+    LoopStats st;
+    if (!impl_->host) return st;
+    const auto& host = *impl_->host;
+    auto us = [](std::uint64_t ns) { return static_cast<double>(ns) * 1e-3; };
+    st.ticks = host.ticks();
+    st.overruns = host.overruns();
+    st.tick_jitter_p50_us = us(host.tickJitter().percentile(0.50));
+    st.tick_jitter_p99_us = us(host.tickJitter().percentile(0.99));
+    st.tick_jitter_max_us = us(host.tickJitter().max());
+    st.commands = host.commandLatency().count();
+    st.command_latency_p50_us = us(host.commandLatency().percentile(0.50));
+    st.command_latency_p99_us = us(host.commandLatency().percentile(0.99));
+    st.command_latency_max_us = us(host.commandLatency().max());
+    for (const auto& world : host.list()) st.subscribers += world->fanout().subscriberCount();
+    st.worlds = host.worldCount();
+    st.ticking_worlds = host.tickingCount();
+    return st;
+}
+
+void GrpcSimServer::setMaxStreamHz(double hz) {
+    impl_->max_stream_hz = (hz > 0.0) ? hz : 0.0;
+}
+
+void GrpcSimServer::setWorkerThreads(std::size_t n) {
+    impl_->workers = n;
+}
+
+void GrpcSimServer::setWorldLimits(std::size_t max_worlds, double max_tick_hz) {
+    impl_->max_worlds = std::max<std::size_t>(1, max_worlds);
+    if (max_tick_hz > 0.0) impl_->max_tick_hz = max_tick_hz;
+}
+
+void GrpcSimServer::setDefaultFireSim(bool enabled) {
+    impl_->default_fire_sim = enabled;
 }
 
 } // namespace grpcsim
@@ -623,6 +1100,11 @@ bool GrpcSimServer::Run(const std::string&, int, int) {
     return false;
 }
 void GrpcSimServer::Stop() {}
+GrpcSimServer::LoopStats GrpcSimServer::loopStats() const { return {}; }
+void GrpcSimServer::setMaxStreamHz(double) {}
+void GrpcSimServer::setWorkerThreads(std::size_t) {}
+void GrpcSimServer::setWorldLimits(std::size_t, double) {}
+void GrpcSimServer::setDefaultFireSim(bool) {}
 
 } // namespace grpcsim
 } // namespace vfep
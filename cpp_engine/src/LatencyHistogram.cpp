@@ -0,0 +1,84 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Lock-free log-linear histogram for timing percentiles
+ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vfep {
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < SUB_BUCKETS) {
+        return static_cast<size_t>(value);
+    }
+    unsigned msb = 63;
+    while (!(value >> msb)) --msb;
+    const unsigned group = msb - SUB_BUCKET_BITS + 1;
+    const uint64_t sub = (value >> (msb - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+    return group * SUB_BUCKETS + static_cast<size_t>(sub);
+}
+
+uint64_t LatencyHistogram::bucketLow(size_t index) {
+    const size_t group = index / SUB_BUCKETS;
+    const uint64_t sub = index % SUB_BUCKETS;
+    if (group == 0) {
+        return sub;
+    }
+    return (SUB_BUCKETS + sub) << (group - 1);
+}
+
+uint64_t LatencyHistogram::bucketHigh(size_t index) {
+    const size_t group = index / SUB_BUCKETS;
+    if (group == 0) {
+        return bucketLow(index);
+    }
+    return bucketLow(index) + ((uint64_t(1) << (group - 1)) - 1);
+}
+
+void LatencyHistogram::record(uint64_t value_ns) {
+    buckets_[bucketIndex(value_ns)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value_ns, std::memory_order_relaxed);
+    uint64_t prev = max_.load(std::memory_order_relaxed);
+    while (value_ns > prev && !max_.compare_exchange_weak(prev, value_ns, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset() {
+    for (auto& b : buckets_) b.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const {
+    const uint64_t n = count();
+    return n ? static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(n) : 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    // Count from the buckets themselves so a concurrent record() cannot
+    // push the rank past the last populated bucket
+    uint64_t total = 0;
+    for (const auto& b : buckets_) total += b.load(std::memory_order_relaxed);
+    if (total == 0) {
+        return 0;
+    }
+    q = std::min(1.0, std::max(0.0, q));
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            const uint64_t lo = bucketLow(i);
+            const uint64_t mid = lo + (bucketHigh(i) - lo) / 2;
+            return std::min(mid, max());
+        }
+    }
+    return max();
+}
+
+} // namespace vfep
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 namespace vfep {
 namespace mech {
@@ -14,189 +16,217 @@ std::uint64_t now_ms() {
 
 static inline double clampd(double v, double lo, double hi) { return std::max(lo, std::min(hi, v)); }
 
-static void update_interlocks(vfep::obj::ObjectStore& s) {
+// The tick runs on a WorldHost worker; a persistent pool keeps it from
+// starting threads on every tick of every world
+static WorkerPool& poolFor(const MechanicsParams& p) { return p.pool ? *p.pool : WorkerPool::shared(); }
+
+static void update_interlocks(vfep::obj::InterlockComponents& il) {
     // Minimal: allow by default unless explicit conditions exist later.
     // If a future build introduces door/ups/auth zones, populate reasons here.
-    for (auto& [id, il] : s.interlocks) {
-        il.allow_arm = true;
-        il.allow_suppress = true;
-        il.reasons.clear();
-        il.updated_ms = now_ms();
-    }
+    const std::uint64_t ms = now_ms();
+    std::fill(il.allow_arm.begin(), il.allow_arm.end(), std::uint8_t(1));
+    std::fill(il.allow_suppress.begin(), il.allow_suppress.end(), std::uint8_t(1));
+    std::fill(il.updated_ms.begin(), il.updated_ms.end(), ms);
 }
 
-static bool interlocks_allow_suppress(const vfep::obj::ObjectStore& s, const std::string& vfep_id) {
-    for (const auto& [id, il] : s.interlocks) {
-        if (il.vfep_id == vfep_id) return il.allow_suppress;
-    }
-    return true;
-}
+static void tick_arms(vfep::obj::ArmComponents& a, double dt, const MechanicsParams& p) {
+    // Arms are independent: each worker owns a contiguous slice of every array
+    poolFor(p).parallelFor(a.s.size(), p.min_entities_per_thread, [&a, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!a.has_target[i]) {
+                // return to parking if no explicit target
+                a.target_s[i] = a.parking_s[i];
+            }
 
-static void tick_arms(vfep::obj::ObjectStore& s, double dt) {
-    for (auto& [arm_id, at] : s.arm_telemetry) {
-        const auto it_cfg = s.arms.find(arm_id);
-        if (it_cfg == s.arms.end()) continue;
-        const auto& cfg = it_cfg->second;
+            const double lo = a.s_min[i], hi = a.s_max[i];
+            const double target = clampd(a.target_s[i], lo, hi);
+            const double pos = clampd(a.s[i], lo, hi);
+            const double err = target - pos;
+            const double dir = (err >= 0.0) ? 1.0 : -1.0;
 
-        if (!at.has_target) {
-            // return to parking if no explicit target
-            at.target_s_0_1 = cfg.parking_s_0_1;
-        }
+            const double vmax = std::max(0.0, a.v_max[i]);
+            const double amax = std::max(0.0, a.a_max[i]);
 
-        const double target = clampd(at.target_s_0_1, cfg.travel_s_min_0_1, cfg.travel_s_max_0_1);
-        const double pos = clampd(at.s_0_1, cfg.travel_s_min_0_1, cfg.travel_s_max_0_1);
-        const double err = target - pos;
-        const double dir = (err >= 0.0) ? 1.0 : -1.0;
+            // simple trapezoid (very approximate): accelerate toward target then brake near it
+            double v = a.v[i];
+            const double dist = std::abs(err);
+            const double brake_dist = (amax > 1e-9) ? (v*v) / (2.0*amax) : 0.0;
+            const bool should_brake = dist <= brake_dist + 1e-6;
 
-        const double vmax = std::max(0.0, cfg.max_v_s_0_1_per_s);
-        const double amax = std::max(0.0, cfg.max_a_s_0_1_per_s2);
+            const double a_cmd = should_brake ? (-dir * amax) : (dir * amax);
+            v += a_cmd * dt;
+            v = clampd(v, -vmax, vmax);
 
-        // simple trapezoid (very approximate): accelerate toward target then brake near it
-        double v = at.v_s_0_1_per_s;
-        const double dist = std::abs(err);
-        const double brake_dist = (amax > 1e-9) ? (v*v) / (2.0*amax) : 0.0;
-        const bool should_brake = dist <= brake_dist + 1e-6;
+            double new_pos = pos + v * dt;
 
-        const double a_cmd = should_brake ? (-dir * amax) : (dir * amax);
-        v += a_cmd * dt;
-        v = clampd(v, -vmax, vmax);
+            // snap if crossing target
+            if ((dir > 0.0 && new_pos >= target) || (dir < 0.0 && new_pos <= target)) {
+                new_pos = target;
+                v = 0.0;
+            }
 
-        double new_pos = pos + v * dt;
+            a.s[i] = clampd(new_pos, lo, hi);
+            a.v[i] = v;
 
-        // snap if crossing target
-        if ((dir > 0.0 && new_pos >= target) || (dir < 0.0 && new_pos <= target)) {
-            new_pos = target;
-            v = 0.0;
+            // coarse state
+            if (std::abs(target - a.s[i]) < 1e-6) {
+                if (a.state[i] == vfep::obj::ArmDeploymentState::Moving) a.state[i] = vfep::obj::ArmDeploymentState::Aiming;
+            } else {
+                a.state[i] = vfep::obj::ArmDeploymentState::Moving;
+            }
         }
+    });
+}
 
-        at.s_0_1 = clampd(new_pos, cfg.travel_s_min_0_1, cfg.travel_s_max_0_1);
-        at.v_s_0_1_per_s = v;
-
-        // coarse state
-        if (std::abs(target - at.s_0_1) < 1e-6) {
-            if (at.state == vfep::obj::ArmDeploymentState::Moving) at.state = vfep::obj::ArmDeploymentState::Aiming;
-        } else {
-            at.state = vfep::obj::ArmDeploymentState::Moving;
+static void tick_nozzles(vfep::obj::NozzleComponents& nz, double dt, const MechanicsParams& p) {
+    const double max_step = std::max(0.0, p.nozzle_slew_deg_per_s) * dt;
+    auto stepToward = [max_step](double cur, double tgt) -> double {
+        const double e = tgt - cur;
+        if (std::abs(e) <= max_step) return tgt;
+        return cur + (e > 0.0 ? max_step : -max_step);
+    };
+
+    poolFor(p).parallelFor(nz.pan.size(), p.min_entities_per_thread, [&nz, &stepToward](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const double pan_tgt = clampd(nz.target_pan[i], nz.pan_min[i], nz.pan_max[i]);
+            const double tilt_tgt = clampd(nz.target_tilt[i], nz.tilt_min[i], nz.tilt_max[i]);
+            nz.pan[i] = stepToward(nz.pan[i], pan_tgt);
+            nz.tilt[i] = stepToward(nz.tilt[i], tilt_tgt);
+            nz.has_target[i] = 1;
         }
-    }
+    });
 }
 
-static void tick_nozzles(vfep::obj::ObjectStore& s, double dt, const MechanicsParams& p) {
-    for (auto& [noz_id, nt] : s.nozzle_telemetry) {
-        const auto it_cfg = s.nozzles.find(noz_id);
-        if (it_cfg == s.nozzles.end()) continue;
-        const auto& cfg = it_cfg->second;
+static void tick_suppression(vfep::obj::EntityRegistry& r, double sim_time_s, double dt, const MechanicsParams& p) {
+    using vfep::obj::kNoHandle;
+    auto& racks = r.racks;
+    auto& tanks = r.tanks;
+    auto& vf = r.vfeps;
+
+    // For MVP, each VFEP discharges its first tank onto the selected rack (or first burning covered rack).
+    //
+    // Two phases so the VFEP loop can run in parallel: every VFEP resolves its
+    // target against the rack state at the start of the phase and updates its
+    // own tank (tanks belong to one VFEP), recording the rack it hit. The hits
+    // are then joined by rack handle and applied once per rack, in VFEP order,
+    // so the result does not depend on the thread count.
+    const std::size_t nv = vf.suppression_active.size();
+    std::vector<std::uint32_t> hit(nv, kNoHandle);
+    std::fill(racks.suppressing.begin(), racks.suppressing.end(), std::uint8_t(0));
+    poolFor(p).parallelFor(nv, p.min_entities_per_thread, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t v = begin; v < end; ++v) {
+            if (!vf.suppression_active[v]) continue;
+            const std::uint32_t il = vf.interlock[v];
+            if (il != kNoHandle && !r.interlocks.allow_suppress[il]) continue;
+
+            const std::uint32_t t = vf.tank[v];
+            if (t == kNoHandle) continue;
+
+            // pick rack: selected if valid else find a burning rack
+            std::uint32_t rack = vf.selected_rack[v];
+            if (rack == kNoHandle) {
+                for (std::uint32_t k = vf.coverage_begin[v]; k < vf.coverage_begin[v + 1]; ++k) {
+                    if (racks.on_fire[vf.coverage_racks[k]]) { rack = vf.coverage_racks[k]; break; }
+                }
+            }
+            if (rack == kNoHandle) continue;
+
+            // flow model (simple), or whatever the external fire model delivered
+            const double flow = p.external_rack_fire ? racks.agent_flow_kg_s[rack] : p.agent_flow_kg_s;
+            if (tanks.depleted[t] || tanks.remaining_kg[t] <= 0.0) {
+                tanks.depleted[t] = 1;
+                tanks.flow_kg_s[t] = 0.0;
+                continue;
+            }
 
-        const double pan_tgt = clampd(nt.target_pan_deg, cfg.pan_min_deg, cfg.pan_max_deg);
-        const double tilt_tgt = clampd(nt.target_tilt_deg, cfg.tilt_min_deg, cfg.tilt_max_deg);
+            const double used = flow * dt;
+            tanks.remaining_kg[t] = std::max(0.0, tanks.remaining_kg[t] - used);
+            tanks.flow_kg_s[t] = flow;
+            tanks.depleted[t] = (tanks.remaining_kg[t] <= 1e-6);
+            tanks.regulator_bar[t] = tanks.regulator_setpoint_bar[t];
+            // approximate pressure decay with remaining fraction
+            const double m0 = tanks.initial_mass_kg[t];
+            const double frac = (m0 > 1e-6) ? (tanks.remaining_kg[t] / m0) : 0.0;
+            tanks.pressure_bar[t] = tanks.regulator_setpoint_bar[t] * clampd(frac, 0.0, 1.0);
+            tanks.discharging[t] = 1;
+            hit[v] = rack;
+        }
+    });
 
-        const double max_step = std::max(0.0, p.nozzle_slew_deg_per_s) * dt;
+    // Join: (rack, vfep) pairs sorted by rack; each run is one rack's discharges
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> hits;
+    for (std::uint32_t v = 0; v < nv; ++v) {
+        if (hit[v] != kNoHandle) hits.emplace_back(hit[v], v);
+    }
+    if (hits.empty()) return;
+    std::sort(hits.begin(), hits.end());
+    std::vector<std::uint32_t> run_begin;
+    for (std::uint32_t k = 0; k < hits.size(); ++k) {
+        if (k == 0 || hits[k].first != hits[k - 1].first) run_begin.push_back(k);
+    }
+    run_begin.push_back(static_cast<std::uint32_t>(hits.size()));
 
-        auto stepToward = [&](double cur, double tgt) -> double {
-            const double e = tgt - cur;
-            if (std::abs(e) <= max_step) return tgt;
-            return cur + (e > 0.0 ? max_step : -max_step);
-        };
+    const std::size_t runs = run_begin.size() - 1;
+    poolFor(p).parallelFor(runs, p.min_entities_per_thread, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t j = begin; j < end; ++j) {
+            const std::uint32_t rack = hits[run_begin[j]].first;
 
-        nt.pan_deg = stepToward(nt.pan_deg, pan_tgt);
-        nt.tilt_deg = stepToward(nt.tilt_deg, tilt_tgt);
-        nt.has_target = true;
-    }
-}
+            racks.suppressing[rack] = 1;
 
-static void tick_suppression(vfep::obj::ObjectStore& s, double sim_time_s, double dt, const MechanicsParams& p) {
-    // For MVP, assume single VFEP with single tank and affects selected rack (or hottest rack if none).
-    for (const auto& [vfep_id, vfep] : s.vfeps) {
-        bool active = vfep.suppression_active;
-        if (!active) continue;
-        if (!interlocks_allow_suppress(s, vfep_id)) continue;
-
-        // pick tank: first tank belonging to vfep
-        vfep::obj::TankTelemetry* tt = nullptr;
-        vfep::obj::TankConfig const* tc = nullptr;
-        for (auto& [tid, cfg] : s.tanks) {
-            if (cfg.vfep_id == vfep_id) {
-                tc = &cfg;
-                tt = &s.tank_telemetry[tid];
-                break;
+            // cool rack, once per discharging VFEP
+            for (std::uint32_t k = run_begin[j]; !p.external_rack_fire && k < run_begin[j + 1]; ++k) {
+                racks.surface_temp_C[rack] = std::max(20.0, racks.surface_temp_C[rack] - p.cooling_degC_per_s * dt);
+                racks.risk_pct[rack] = std::max(0.0, racks.risk_pct[rack] - p.risk_reduction_pct_per_s * dt);
+                if (racks.surface_temp_C[rack] <= 40.0) racks.on_fire[rack] = 0;
             }
-        }
-        if (!tt || !tc) continue;
-
-        // pick rack: selected if valid else find a burning rack
-        std::string rack_id = vfep.selected_rack_id;
-        if (rack_id.empty() || s.rack_telemetry.find(rack_id) == s.rack_telemetry.end()) {
-            for (const auto& rid : vfep.coverage_rack_ids) {
-                auto it = s.rack_telemetry.find(rid);
-                if (it != s.rack_telemetry.end() && it->second.is_on_fire) { rack_id = rid; break; }
-            }
-        }
-        if (rack_id.empty()) continue;
 
-        auto& rtel = s.rack_telemetry[rack_id];
-
-        // flow model (simple)
-        const double flow = 0.5; // kg/s baseline MVP
-        if (tt->is_depleted || tt->remaining_agent_mass_kg <= 0.0) {
-            tt->is_depleted = true;
-            tt->current_flow_kg_s = 0.0;
-            continue;
+            // Update the rack's open incident
+            const std::uint32_t inc = racks.open_incident[rack];
+            if (inc != kNoHandle) {
+                if (racks.on_fire[rack]) {
+                    r.incidents.state[inc] = vfep::obj::IncidentState::Suppressing;
+                } else {
+                    r.incidents.state[inc] = vfep::obj::IncidentState::Resolved;
+                    r.incidents.resolved_at_s[inc] = sim_time_s;
+                    racks.open_incident[rack] = kNoHandle;
+                }
+            }
         }
+    });
+}
 
-        const double used = flow * dt;
-        tt->remaining_agent_mass_kg = std::max(0.0, tt->remaining_agent_mass_kg - used);
-        tt->current_flow_kg_s = flow;
-        tt->is_depleted = (tt->remaining_agent_mass_kg <= 1e-6);
-        tt->regulator_bar = tc->regulator_setpoint_bar;
-        // approximate pressure decay with remaining fraction
-        const double frac = (tc->initial_agent_mass_kg > 1e-6) ? (tt->remaining_agent_mass_kg / tc->initial_agent_mass_kg) : 0.0;
-        tt->current_pressure_bar = tc->regulator_setpoint_bar * clampd(frac, 0.0, 1.0);
-        tt->valve_state = "discharging";
-
-        // cool rack
-        rtel.surface_temp_C = std::max(20.0, rtel.surface_temp_C - p.cooling_degC_per_s * dt);
-        rtel.risk_to_assets_pct = std::max(0.0, rtel.risk_to_assets_pct - p.risk_reduction_pct_per_s * dt);
-        if (rtel.surface_temp_C <= 40.0) rtel.is_on_fire = false;
-
-        // Update incident state if present
-        for (auto& [inc_id, inc] : s.incidents) {
-            if (inc.rack_id == rack_id && inc.state != vfep::obj::IncidentState::Resolved) {
-                inc.state = rtel.is_on_fire ? vfep::obj::IncidentState::Suppressing : vfep::obj::IncidentState::Resolved;
-                if (inc.state == vfep::obj::IncidentState::Resolved) inc.resolved_at_s = sim_time_s;
+static void tick_incidents(vfep::obj::EntityRegistry& r, double sim_time_s, const MechanicsParams& p) {
+    // create incidents for burning racks if absent. The scan runs in parallel;
+    // opening appends to the incident arrays, so it stays serial (and in rack order).
+    const std::size_t n = r.racks.on_fire.size();
+    WorkerPool& pool = poolFor(p);
+    std::vector<std::vector<std::uint32_t>> found(pool.chunkCount(n, p.min_entities_per_thread));
+    const std::size_t chunks = pool.parallelForChunks(n, p.min_entities_per_thread,
+        [&r, &found](std::size_t chunk, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                if (r.racks.on_fire[i] && r.racks.open_incident[i] == vfep::obj::kNoHandle) {
+                    found[chunk].push_back(static_cast<std::uint32_t>(i));
+                }
             }
-        }
+        });
+    for (std::size_t c = 0; c < chunks; ++c) {
+        for (const std::uint32_t i : found[c]) r.openIncident(i, sim_time_s);
     }
 }
 
-static void tick_incidents(vfep::obj::ObjectStore& s, double sim_time_s) {
-    // create incidents for burning racks if absent
-    for (const auto& [rack_id, rt] : s.rack_telemetry) {
-        if (!rt.is_on_fire) continue;
-        bool found = false;
-        for (const auto& [inc_id, inc] : s.incidents) {
-            if (inc.rack_id == rack_id && inc.state != vfep::obj::IncidentState::Resolved) { found = true; break; }
-        }
-        if (!found) {
-            vfep::obj::Incident inc;
-            inc.incident_id = "inc-" + rack_id + "-" + std::to_string((long long)(sim_time_s*1000.0));
-            // best-effort room lookup
-            auto itRack = s.racks.find(rack_id);
-            inc.room_id = (itRack != s.racks.end()) ? itRack->second.room_id : "";
-            inc.rack_id = rack_id;
-            inc.state = vfep::obj::IncidentState::Active;
-            inc.started_at_s = sim_time_s;
-            inc.tags = {"auto"};
-            s.upsert(inc);
-        }
-    }
+void tick(vfep::obj::EntityRegistry& reg, double sim_time_s, double dt, const MechanicsParams& p) {
+    update_interlocks(reg.interlocks);
+    tick_incidents(reg, sim_time_s, p);
+    tick_arms(reg.arms, dt, p);
+    tick_nozzles(reg.nozzles, dt, p);
+    tick_suppression(reg, sim_time_s, dt, p);
 }
 
 void tick(vfep::obj::ObjectStore& store, double sim_time_s, double dt, const MechanicsParams& p) {
-    update_interlocks(store);
-    tick_incidents(store, sim_time_s);
-    tick_arms(store, dt);
-    tick_nozzles(store, dt, p);
-    tick_suppression(store, sim_time_s, dt, p);
+    vfep::obj::EntityRegistry reg;
+    reg.build(store);
+    tick(reg, sim_time_s, dt, p);
+    reg.save();
 }
 
 } // namespace mech
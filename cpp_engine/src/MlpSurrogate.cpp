@@ -0,0 +1,533 @@
+/**
+ * @file MlpSurrogate.cpp
+ * @brief SurrogateModel JSON loader and blocked float32 MLP kernels
+ */
+
+#include "MlpSurrogate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CHEMSI_MLP_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace vfep {
+
+namespace {
+
+// ============================================================
+// Minimal JSON reader (objects, arrays, numbers, strings, literals)
+// ============================================================
+
+struct JsonValue {
+    enum class Kind { Null, Bool, Number, String, Array, Object } kind = Kind::Null;
+    double number = 0.0;
+    bool boolean = false;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::map<std::string, JsonValue> object;
+
+    const JsonValue* get(const std::string& key) const {
+        if (kind != Kind::Object) return nullptr;
+        const auto it = object.find(key);
+        return it == object.end() || it->second.kind == Kind::Null ? nullptr : &it->second;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : s_(text) {}
+
+    bool parse(JsonValue& out, std::string& error) {
+        if (!value(out, 0)) {
+            error = "JSON parse error at offset " + std::to_string(pos_) + ": " + error_;
+            return false;
+        }
+        skipSpace();
+        if (pos_ != s_.size()) {
+            error = "trailing characters after JSON value at offset " + std::to_string(pos_);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    const std::string& s_;
+    size_t pos_ = 0;
+    std::string error_;
+
+    bool fail(const char* what) {
+        error_ = what;
+        return false;
+    }
+
+    void skipSpace() {
+        while (pos_ < s_.size() && (s_[pos_] == ' ' || s_[pos_] == '\n' || s_[pos_] == '\r' || s_[pos_] == '\t')) {
+            ++pos_;
+        }
+    }
+
+    bool literal(const char* word) {
+        const size_t n = std::strlen(word);
+        if (s_.compare(pos_, n, word) != 0) return false;
+        pos_ += n;
+        return true;
+    }
+
+    bool value(JsonValue& v, int depth) {
+        if (depth > 64) return fail("nesting too deep");
+        skipSpace();
+        if (pos_ >= s_.size()) return fail("unexpected end of input");
+        const char c = s_[pos_];
+        if (c == '{') return object(v, depth);
+        if (c == '[') return array(v, depth);
+        if (c == '"') {
+            v.kind = JsonValue::Kind::String;
+            return string(v.string);
+        }
+        if (literal("null")) { v.kind = JsonValue::Kind::Null; return true; }
+        if (literal("true")) { v.kind = JsonValue::Kind::Bool; v.boolean = true; return true; }
+        if (literal("false")) { v.kind = JsonValue::Kind::Bool; v.boolean = false; return true; }
+        // Python's json writes NaN / Infinity for non-finite floats
+        if (literal("NaN")) { v.kind = JsonValue::Kind::Number; v.number = std::nan(""); return true; }
+        if (literal("Infinity")) { v.kind = JsonValue::Kind::Number; v.number = HUGE_VAL; return true; }
+        if (literal("-Infinity")) { v.kind = JsonValue::Kind::Number; v.number = -HUGE_VAL; return true; }
+        return number(v);
+    }
+
+    bool number(JsonValue& v) {
+        const char* begin = s_.c_str() + pos_;
+        char* end = nullptr;
+        v.number = std::strtod(begin, &end);
+        if (end == begin) return fail("expected a value");
+        pos_ += static_cast<size_t>(end - begin);
+        v.kind = JsonValue::Kind::Number;
+        return true;
+    }
+
+    bool string(std::string& out) {
+        ++pos_;  // opening quote
+        out.clear();
+        while (pos_ < s_.size() && s_[pos_] != '"') {
+            char c = s_[pos_++];
+            if (c == '\\') {
+                if (pos_ >= s_.size()) break;
+                c = s_[pos_++];
+                switch (c) {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'u':
+                    // Names are ASCII; keep \uXXXX escapes as '?'
+                    pos_ = std::min(s_.size(), pos_ + 4);
+                    c = '?';
+                    break;
+                default: break;  // \" \\ \/
+                }
+            }
+            out.push_back(c);
+        }
+        if (pos_ >= s_.size()) return fail("unterminated string");
+        ++pos_;
+        return true;
+    }
+
+    bool array(JsonValue& v, int depth) {
+        ++pos_;
+        v.kind = JsonValue::Kind::Array;
+        skipSpace();
+        if (pos_ < s_.size() && s_[pos_] == ']') { ++pos_; return true; }
+        for (;;) {
+            v.array.emplace_back();
+            if (!value(v.array.back(), depth + 1)) return false;
+            skipSpace();
+            if (pos_ < s_.size() && s_[pos_] == ',') { ++pos_; continue; }
+            if (pos_ < s_.size() && s_[pos_] == ']') { ++pos_; return true; }
+            return fail("expected ',' or ']'");
+        }
+    }
+
+    bool object(JsonValue& v, int depth) {
+        ++pos_;
+        v.kind = JsonValue::Kind::Object;
+        skipSpace();
+        if (pos_ < s_.size() && s_[pos_] == '}') { ++pos_; return true; }
+        for (;;) {
+            skipSpace();
+            if (pos_ >= s_.size() || s_[pos_] != '"') return fail("expected a key");
+            std::string key;
+            if (!string(key)) return false;
+            skipSpace();
+            if (pos_ >= s_.size() || s_[pos_] != ':') return fail("expected ':'");
+            ++pos_;
+            if (!value(v.object[key], depth + 1)) return false;
+            skipSpace();
+            if (pos_ < s_.size() && s_[pos_] == ',') { ++pos_; continue; }
+            if (pos_ < s_.size() && s_[pos_] == '}') { ++pos_; return true; }
+            return fail("expected ',' or '}'");
+        }
+    }
+};
+
+bool toVector(const JsonValue* v, std::vector<double>& out) {
+    if (!v || v->kind != JsonValue::Kind::Array) return false;
+    out.clear();
+    for (const auto& e : v->array) {
+        if (e.kind != JsonValue::Kind::Number) return false;
+        out.push_back(e.number);
+    }
+    return true;
+}
+
+bool toMatrix(const JsonValue& v, std::vector<std::vector<double>>& out) {
+    if (v.kind != JsonValue::Kind::Array) return false;
+    out.clear();
+    for (const auto& row : v.array) {
+        out.emplace_back();
+        if (!toVector(&row, out.back())) return false;
+    }
+    return true;
+}
+
+std::vector<std::string> toNames(const JsonValue* v) {
+    std::vector<std::string> names;
+    if (v && v->kind == JsonValue::Kind::Array) {
+        for (const auto& e : v->array) {
+            names.push_back(e.kind == JsonValue::Kind::String ? e.string : std::string());
+        }
+    }
+    return names;
+}
+
+bool setError(std::string* error, const std::string& what) {
+    if (error) *error = what;
+    return false;
+}
+
+// ============================================================
+// Kernels: one block of kSurrogateLanes samples, neuron-major
+// ============================================================
+
+float activate(float z, MlpSurrogate::Activation a) {
+    switch (a) {
+    case MlpSurrogate::Activation::Relu: return z > 0.0f ? z : 0.0f;
+    case MlpSurrogate::Activation::Tanh: return std::tanh(z);
+    default: return z;
+    }
+}
+
+// y[j][l] = b[j] + sum_i w[j][i] * x[i][l]. kNeuronsPerPass output neurons
+// are accumulated together: their FMA chains are independent, so the
+// block is throughput- rather than latency-bound.
+constexpr size_t kNeuronsPerPass = 4;
+
+void layerPortable(const float* w, const float* b, size_t in, size_t out, const float* x, float* y,
+                   MlpSurrogate::Activation a, bool hidden) {
+    for (size_t j0 = 0; j0 < out; j0 += kNeuronsPerPass) {
+        const size_t n = std::min(kNeuronsPerPass, out - j0);
+        float acc[kNeuronsPerPass][kSurrogateLanes];
+        for (size_t k = 0; k < n; ++k)
+            for (size_t l = 0; l < kSurrogateLanes; ++l) acc[k][l] = b[j0 + k];
+        for (size_t i = 0; i < in; ++i) {
+            const float* xi = x + i * kSurrogateLanes;
+            for (size_t k = 0; k < n; ++k) {
+                const float wi = w[(j0 + k) * in + i];
+                for (size_t l = 0; l < kSurrogateLanes; ++l) acc[k][l] += wi * xi[l];
+            }
+        }
+        for (size_t k = 0; k < n; ++k) {
+            float* yj = y + (j0 + k) * kSurrogateLanes;
+            for (size_t l = 0; l < kSurrogateLanes; ++l) yj[l] = hidden ? activate(acc[k][l], a) : acc[k][l];
+        }
+    }
+}
+
+#ifdef CHEMSI_MLP_AVX2
+static_assert(kSurrogateLanes == 8, "the AVX2 kernel holds one block in a ymm register");
+
+#define CHEMSI_MLP_TARGET __attribute__((target("avx2,fma")))
+
+CHEMSI_MLP_TARGET inline void storeNeuron(float* yj, __m256 acc, MlpSurrogate::Activation a, bool hidden) {
+    if (hidden && a == MlpSurrogate::Activation::Relu) {
+        acc = _mm256_max_ps(acc, _mm256_setzero_ps());
+    }
+    _mm256_store_ps(yj, acc);
+    if (hidden && a == MlpSurrogate::Activation::Tanh) {
+        for (size_t l = 0; l < kSurrogateLanes; ++l) yj[l] = std::tanh(yj[l]);
+    }
+}
+
+CHEMSI_MLP_TARGET void layerAvx2(const float* w, const float* b, size_t in, size_t out, const float* x, float* y,
+                                 MlpSurrogate::Activation a, bool hidden) {
+    size_t j = 0;
+    for (; j + kNeuronsPerPass <= out; j += kNeuronsPerPass) {
+        __m256 acc0 = _mm256_set1_ps(b[j]);
+        __m256 acc1 = _mm256_set1_ps(b[j + 1]);
+        __m256 acc2 = _mm256_set1_ps(b[j + 2]);
+        __m256 acc3 = _mm256_set1_ps(b[j + 3]);
+        const float* w0 = w + j * in;
+        for (size_t i = 0; i < in; ++i) {
+            const __m256 xi = _mm256_load_ps(x + i * kSurrogateLanes);
+            acc0 = _mm256_fmadd_ps(_mm256_set1_ps(w0[i]), xi, acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_set1_ps(w0[in + i]), xi, acc1);
+            acc2 = _mm256_fmadd_ps(_mm256_set1_ps(w0[2 * in + i]), xi, acc2);
+            acc3 = _mm256_fmadd_ps(_mm256_set1_ps(w0[3 * in + i]), xi, acc3);
+        }
+        storeNeuron(y + j * kSurrogateLanes, acc0, a, hidden);
+        storeNeuron(y + (j + 1) * kSurrogateLanes, acc1, a, hidden);
+        storeNeuron(y + (j + 2) * kSurrogateLanes, acc2, a, hidden);
+        storeNeuron(y + (j + 3) * kSurrogateLanes, acc3, a, hidden);
+    }
+    for (; j < out; ++j) {
+        __m256 acc = _mm256_set1_ps(b[j]);
+        const float* wj = w + j * in;
+        for (size_t i = 0; i < in; ++i) {
+            acc = _mm256_fmadd_ps(_mm256_set1_ps(wj[i]), _mm256_load_ps(x + i * kSurrogateLanes), acc);
+        }
+        storeNeuron(y + j * kSurrogateLanes, acc, a, hidden);
+    }
+}
+#endif
+
+using LayerKernel = void (*)(const float*, const float*, size_t, size_t, const float*, float*,
+                             MlpSurrogate::Activation, bool);
+
+LayerKernel selectKernel() {
+#ifdef CHEMSI_MLP_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return layerAvx2;
+    }
+#endif
+    return layerPortable;
+}
+
+const LayerKernel kLayerKernel = selectKernel();
+
+} // namespace
+
+bool surrogateAccelerated() {
+    return kLayerKernel != layerPortable;
+}
+
+// ============================================================
+// Loading
+// ============================================================
+
+bool MlpSurrogate::loadFile(const std::string& path, std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return setError(error, "cannot open " + path);
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return loadJson(text.str(), error);
+}
+
+bool MlpSurrogate::loadJson(const std::string& text, std::string* error) {
+    JsonValue root;
+    std::string parse_error;
+    if (!JsonParser(text).parse(root, parse_error)) {
+        return setError(error, parse_error);
+    }
+    if (root.kind != JsonValue::Kind::Object) {
+        return setError(error, "surrogate JSON must be an object");
+    }
+    if (const JsonValue* trained = root.get("trained")) {
+        if (trained->kind == JsonValue::Kind::Bool && !trained->boolean) {
+            return setError(error, "model was saved untrained");
+        }
+    }
+
+    // SurrogateModel.load() defaults to relu; any other name is the identity
+    Activation activation = Activation::Relu;
+    if (const JsonValue* act = root.get("activation")) {
+        if (act->kind != JsonValue::Kind::String) {
+            return setError(error, "activation must be a string");
+        }
+        activation = Activation::Identity;
+        if (act->string == "relu") activation = Activation::Relu;
+        else if (act->string == "tanh") activation = Activation::Tanh;
+    }
+
+    std::vector<double> in_mean, in_std, out_mean, out_std;
+    if (!toVector(root.get("input_mean"), in_mean) || !toVector(root.get("input_std"), in_std)
+        || !toVector(root.get("output_mean"), out_mean) || !toVector(root.get("output_std"), out_std)) {
+        return setError(error, "missing input/output normalization");
+    }
+    if (in_mean.empty() || in_std.size() != in_mean.size() || out_mean.empty() || out_std.size() != out_mean.size()) {
+        return setError(error, "normalization vectors have inconsistent sizes");
+    }
+
+    const JsonValue* weights = root.get("weights");
+    const JsonValue* biases = root.get("biases");
+    if (!weights || !biases || weights->kind != JsonValue::Kind::Array || biases->kind != JsonValue::Kind::Array
+        || weights->array.empty() || weights->array.size() != biases->array.size()) {
+        return setError(error, "weights/biases missing or of different lengths");
+    }
+
+    std::vector<Layer> layers;
+    size_t width = in_mean.size();
+    size_t max_width = width;
+    for (size_t k = 0; k < weights->array.size(); ++k) {
+        std::vector<std::vector<double>> w;
+        std::vector<double> b;
+        if (!toMatrix(weights->array[k], w) || !toVector(&biases->array[k], b)) {
+            return setError(error, "layer " + std::to_string(k) + ": weights or bias is not numeric");
+        }
+        if (w.size() != width || b.empty()) {
+            return setError(error, "layer " + std::to_string(k) + ": expected " + std::to_string(width) + " input rows");
+        }
+        Layer layer;
+        layer.in = width;
+        layer.out = b.size();
+        layer.w.resize(layer.in * layer.out);
+        for (size_t i = 0; i < layer.in; ++i) {
+            if (w[i].size() != layer.out) {
+                return setError(error, "layer " + std::to_string(k) + ": ragged weight matrix");
+            }
+            for (size_t j = 0; j < layer.out; ++j) {
+                layer.w[j * layer.in + i] = static_cast<float>(w[i][j]);  // Transpose to out x in
+            }
+        }
+        layer.b.assign(b.begin(), b.end());
+        width = layer.out;
+        max_width = std::max(max_width, width);
+        layers.push_back(std::move(layer));
+    }
+    if (width != out_mean.size()) {
+        return setError(error, "last layer has " + std::to_string(width) + " outputs, normalization " +
+                                   std::to_string(out_mean.size()));
+    }
+
+    const size_t n_in = in_mean.size();
+    std::vector<double> lo(n_in), hi(n_in), in_min, in_max;
+    const bool have_range = toVector(root.get("input_min"), in_min) && toVector(root.get("input_max"), in_max)
+                            && in_min.size() == n_in && in_max.size() == n_in;
+    for (size_t i = 0; i < n_in; ++i) {
+        if (!(std::isfinite(in_std[i]) && in_std[i] > 0.0)) {
+            in_std[i] = 1.0;  // SurrogateModel.train() does the same for constant inputs
+        }
+        lo[i] = have_range ? in_min[i] : in_mean[i] - envelopeSigmas() * in_std[i];
+        hi[i] = have_range ? in_max[i] : in_mean[i] + envelopeSigmas() * in_std[i];
+    }
+
+    layers_ = std::move(layers);
+    activation_ = activation;
+    max_width_ = max_width;
+    input_mean_ = in_mean;
+    input_inv_std_.resize(n_in);
+    for (size_t i = 0; i < n_in; ++i) input_inv_std_[i] = 1.0 / in_std[i];
+    output_mean_ = out_mean;
+    output_std_ = out_std;
+    trained_lo_ = lo;
+    trained_hi_ = hi;
+    env_lo_ = lo;
+    env_hi_ = hi;
+    input_names_ = toNames(root.get("input_names"));
+    output_names_ = toNames(root.get("output_names"));
+    input_names_.resize(n_in);
+    output_names_.resize(out_mean.size());
+    return true;
+}
+
+size_t MlpSurrogate::outputIndex(const std::string& name) const {
+    const auto it = std::find(output_names_.begin(), output_names_.end(), name);
+    return static_cast<size_t>(it - output_names_.begin());
+}
+
+void MlpSurrogate::setEnvelopeMargin(double fraction_of_span) {
+    for (size_t i = 0; i < trained_lo_.size(); ++i) {
+        const double pad = fraction_of_span * (trained_hi_[i] - trained_lo_[i]);
+        env_lo_[i] = trained_lo_[i] - pad;
+        env_hi_[i] = trained_hi_[i] + pad;
+    }
+}
+
+bool MlpSurrogate::inEnvelope(const double* inputs) const {
+    for (size_t i = 0; i < env_lo_.size(); ++i) {
+        if (!(inputs[i] >= env_lo_[i] && inputs[i] <= env_hi_[i])) {
+            return false;  // NaN is outside too
+        }
+    }
+    return true;
+}
+
+// ============================================================
+// Inference
+// ============================================================
+
+void MlpSurrogate::predictBatch(const double* inputs, size_t rows, double* outputs) const {
+    if (!loaded()) {
+        throw std::logic_error("MlpSurrogate::predictBatch: no model loaded");
+    }
+    const size_t n_in = inputCount();
+    const size_t n_out = outputCount();
+
+    // Two ping-pong activation blocks, 32-byte aligned for the ymm loads
+    constexpr size_t kAlign = 32 / sizeof(float);
+    const size_t block = (max_width_ * kSurrogateLanes + kAlign - 1) / kAlign * kAlign;
+    thread_local std::vector<float> scratch;
+    if (scratch.size() < 2 * block + kAlign) scratch.resize(2 * block + kAlign);
+    float* base = scratch.data();
+    const size_t misalign = (reinterpret_cast<std::uintptr_t>(base) / sizeof(float)) % kAlign;
+    base += misalign ? kAlign - misalign : 0;
+    float* a = base;
+    float* b = base + block;
+
+    for (size_t r0 = 0; r0 < rows; r0 += kSurrogateLanes) {
+        const size_t lanes = std::min(kSurrogateLanes, rows - r0);
+        for (size_t l = 0; l < kSurrogateLanes; ++l) {
+            const double* row = inputs + (r0 + std::min(l, lanes - 1)) * n_in;  // Pad a short block with its last row
+            for (size_t i = 0; i < n_in; ++i) {
+                a[i * kSurrogateLanes + l] = static_cast<float>((row[i] - input_mean_[i]) * input_inv_std_[i]);
+            }
+        }
+        float* x = a;
+        float* y = b;
+        for (size_t k = 0; k < layers_.size(); ++k) {
+            const Layer& L = layers_[k];
+            kLayerKernel(L.w.data(), L.b.data(), L.in, L.out, x, y, activation_, k + 1 < layers_.size());
+            std::swap(x, y);
+        }
+        for (size_t l = 0; l < lanes; ++l) {
+            double* row = outputs + (r0 + l) * n_out;
+            for (size_t j = 0; j < n_out; ++j) {
+                row[j] = static_cast<double>(x[j * kSurrogateLanes + l]) * output_std_[j] + output_mean_[j];
+            }
+        }
+    }
+}
+
+size_t MlpSurrogate::predictOrRun(const double* inputs, size_t rows, double* outputs, const FullSimulation& full_sim,
+                                  uint8_t* used_surrogate) const {
+    const size_t n_in = inputCount();
+    const size_t n_out = outputCount();
+    predictBatch(inputs, rows, outputs);
+    size_t fallbacks = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        const bool inside = inEnvelope(inputs + r * n_in);
+        if (!inside) {
+            if (!full_sim) {
+                throw std::invalid_argument("MlpSurrogate::predictOrRun: input outside the envelope and no fallback");
+            }
+            full_sim(inputs + r * n_in, outputs + r * n_out);
+            ++fallbacks;
+        }
+        if (used_surrogate) used_surrogate[r] = inside ? 1 : 0;
+    }
+    return fallbacks;
+}
+
+} // namespace vfep
@@ -1,6 +1,8 @@
 #include "ObjectModel.h"
 
 #include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace vfep {
 namespace obj {
@@ -620,5 +622,132 @@ s.upsert(plan);
     return s;
 }
 
+ObjectStore makeSyntheticObjectStore(std::size_t rack_count, std::size_t racks_per_vfep) {
+    if (racks_per_vfep == 0) {
+        throw std::invalid_argument("makeSyntheticObjectStore: racks_per_vfep must be > 0");
+    }
+    ObjectStore s;
+
+    DataCenterRoomConfig room;
+    room.room_id = "room-synth";
+    room.name = "synthetic";
+    room.location = "synthetic";
+    room.security_level = "High";
+    room.floor_number = 1;
+    room.number_of_racks = static_cast<int>(rack_count);
+    room.rack_configurations = {"standard_600x1200_42U"};
+    room.rack_heights_supported_u = {42};
+    s.upsert(room);
+
+    // Square-ish grid with the default 4x4 pitch
+    const std::size_t cols = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(std::sqrt(double(rack_count)))));
+    std::vector<std::string> rack_ids;
+    rack_ids.reserve(rack_count);
+    for (std::size_t i = 0; i < rack_count; ++i) {
+        const std::size_t row = i / cols;
+        const std::size_t col = i % cols;
+        RackConfig r;
+        r.room_id = room.room_id;
+        r.row = "R" + std::to_string(row);
+        r.col_index = static_cast<int>(col + 1);
+        r.label = r.row + "-" + std::to_string(r.col_index);
+        r.rack_id = "rack-" + std::to_string(i);
+        r.centroid_x_mm = 2000.0 + 900.0 * double(col);
+        r.centroid_y_mm = 2000.0 + 2400.0 * double(row);
+        r.rotation_deg = (row % 2) ? 180.0 : 0.0;
+        r.width_mm = 600.0;
+        r.depth_mm = 1200.0;
+        r.height_u = 42;
+        r.aisle_designation = "unspecified";
+        s.upsert(r);
+
+        RackTelemetry rtel;
+        rtel.is_on_fire = false;
+        rtel.surface_temp_C = 30.0;
+        rtel.risk_to_assets_pct = 0.0;
+        s.rack_telemetry[r.rack_id] = rtel;
+        rack_ids.push_back(r.rack_id);
+    }
+
+    // One VFEP per block of racks, each with its own tank, interlock and two arms/nozzles
+    const std::size_t n_vfep = (rack_count + racks_per_vfep - 1) / racks_per_vfep;
+    for (std::size_t v = 0; v < n_vfep; ++v) {
+        const std::string tag = std::to_string(v);
+
+        VFEPConfig vfep;
+        vfep.vfep_id = "vfep-" + tag;
+        vfep.room_id = room.room_id;
+        vfep.mounting_type = "overhead_rail";
+        vfep.status = VFEPStatus::Armed;
+        vfep.firmware_version = "sim";
+        const std::size_t begin = v * racks_per_vfep;
+        const std::size_t end = std::min(rack_count, begin + racks_per_vfep);
+        vfep.coverage_rack_ids.assign(rack_ids.begin() + begin, rack_ids.begin() + end);
+        s.upsert(vfep);
+
+        RailConfig rail;
+        rail.rail_id = "rail-" + tag;
+        rail.vfep_id = vfep.vfep_id;
+        rail.label = "overhead-rail";
+        rail.mount_height_mm = 5600.0;
+        rail.related_rack_ids = vfep.coverage_rack_ids;
+        s.upsert(rail);
+
+        TankConfig tank;
+        tank.tank_id = "tank-" + tag;
+        tank.vfep_id = vfep.vfep_id;
+        tank.rail_id = rail.rail_id;
+        tank.gas_type = "Nitrogen";
+        tank.capacity_L = 50.0;
+        tank.initial_agent_mass_kg = 25.0;
+        tank.regulator_setpoint_bar = 245.0;
+        tank.pressure_thresholds = {0.0, 300.0, 245.0, 50.0, 280.0};
+        s.upsert(tank);
+        TankTelemetry tt;
+        tt.current_pressure_bar = 245.0;
+        tt.regulator_bar = tank.regulator_setpoint_bar;
+        tt.remaining_agent_mass_kg = tank.initial_agent_mass_kg;
+        tt.current_flow_kg_s = 0.0;
+        tt.is_depleted = false;
+        tt.valve_state = "online";
+        s.tank_telemetry[tank.tank_id] = tt;
+
+        for (int i = 1; i <= 2; ++i) {
+            ArmConfig arm;
+            arm.arm_id = "arm-" + tag + "-" + std::to_string(i);
+            arm.vfep_id = vfep.vfep_id;
+            arm.rail_id = rail.rail_id;
+            arm.parking_s_0_1 = (i == 1) ? 0.25 : 0.75;
+            arm.travel_s_min_0_1 = 0.0;
+            arm.travel_s_max_0_1 = 1.0;
+            s.upsert(arm);
+
+            ArmTelemetry at;
+            at.state = ArmDeploymentState::Stowed;
+            at.s_0_1 = arm.parking_s_0_1;
+            at.target_s_0_1 = at.s_0_1;
+            s.arm_telemetry[arm.arm_id] = at;
+
+            NozzleConfig noz;
+            noz.nozzle_id = "nozzle-" + tag + "-" + std::to_string(i);
+            noz.arm_id = arm.arm_id;
+            noz.flow_rate_kg_s = 14.9;
+            noz.spray_pattern = "cone";
+            s.upsert(noz);
+            s.nozzle_telemetry[noz.nozzle_id] = NozzleTelemetry{};
+        }
+
+        InterlockStatus il;
+        il.interlock_id = "interlock-" + vfep.vfep_id;
+        il.vfep_id = vfep.vfep_id;
+        il.allow_arm = true;
+        il.allow_suppress = true;
+        il.updated_ms = 0;
+        s.upsert(il);
+    }
+
+    return s;
+}
+
 } // namespace obj
 } // namespace vfep
@@ -0,0 +1,217 @@
+/**
+ * @file ObservationLog.cpp
+ * @brief Writer thread and row formatting for the asynchronous run log
+ */
+
+#include "ObservationLog.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace vfep {
+
+namespace {
+
+constexpr char kBinaryMagic[8] = {'V', 'F', 'E', 'P', 'L', 'O', 'G', '1'};
+constexpr size_t kBinaryNameBytes = 32;
+constexpr size_t kColumns = 12;
+
+constexpr size_t kBufferBytes = size_t{1} << 20;
+constexpr auto kIdleFlush = std::chrono::milliseconds(250);  // Bounds what a crash loses
+// Widest CSV row: 12 x (sign + 309 integer digits + '.' + 6 decimals + separator)
+constexpr size_t kMaxRowChars = kColumns * 320;
+
+void rowValues(const ObservationLogWriter::Row& row, double out[kColumns]) {
+    const Observation& o = row.obs;
+    out[0] = row.t_s;
+    out[1] = o.T_K;
+    out[2] = o.HRR_W / 1000.0;
+    out[3] = o.O2_volpct;
+    out[4] = o.CO2_volpct;
+    out[5] = o.H2O_volpct;
+    out[6] = o.fuel_kg;
+    out[7] = o.inhibitor_kgm3;
+    out[8] = o.inert_kgm3;
+    out[9] = o.ACH;
+    out[10] = o.agent_mdot_kgps;
+    out[11] = o.reward;
+}
+
+} // namespace
+
+bool parseObservationLogFormat(const std::string& name, ObservationLogFormat& out) {
+    if (name == "csv") out = ObservationLogFormat::Csv;
+    else if (name == "bin") out = ObservationLogFormat::Binary;
+    else if (name == "parquet-lite") out = ObservationLogFormat::ParquetLite;
+    else return false;
+    return true;
+}
+
+const char* observationLogExtension(ObservationLogFormat format) {
+    switch (format) {
+        case ObservationLogFormat::Csv: return ".csv";
+        case ObservationLogFormat::Binary: return ".bin";
+        case ObservationLogFormat::ParquetLite: return ".vfrec";
+    }
+    return ".csv";
+}
+
+const std::vector<std::string>& ObservationLogWriter::columnNames() {
+    static const std::vector<std::string> names = {
+        "time_s", "T_K", "HRR_kW", "O2_volpct", "CO2_volpct", "H2O_volpct",
+        "fuel_kg", "inhib_kgm3", "inert_kgm3", "ACH", "agent_mdot_kgps", "reward",
+    };
+    return names;
+}
+
+size_t ObservationLogWriter::dataOffset() {
+    return sizeof(kBinaryMagic) + 4 + 4 + kColumns * kBinaryNameBytes;
+}
+
+// ============================================================================
+// Producer side
+// ============================================================================
+
+ObservationLogWriter::ObservationLogWriter(size_t ring_capacity) : ring_(ring_capacity) {}
+
+ObservationLogWriter::~ObservationLogWriter() {
+    close();
+}
+
+bool ObservationLogWriter::open(const std::string& path, ObservationLogFormat format) {
+    if (isOpen()) return false;
+    format_ = format;
+    failed_ = false;
+    rows_pushed_ = 0;
+    stalls_ = 0;
+    rows_written_ = 0;
+    used_ = 0;
+
+    if (format == ObservationLogFormat::ParquetLite) {
+        if (!recorder_.open(path, RecordingSchema::Observation)) return false;
+    } else {
+        out_.open(path, std::ios::binary | std::ios::trunc);
+        if (!out_) return false;
+        buf_.resize(kBufferBytes);
+
+        if (format == ObservationLogFormat::Csv) {
+            for (size_t c = 0; c < kColumns; ++c) {
+                const std::string& name = columnNames()[c];
+                std::memcpy(buf_.data() + used_, name.data(), name.size());
+                used_ += name.size();
+                buf_[used_++] = c + 1 < kColumns ? ',' : '\n';
+            }
+        } else {
+            std::memcpy(buf_.data(), kBinaryMagic, sizeof(kBinaryMagic));
+            const uint32_t header[2] = {static_cast<uint32_t>(kColumns), 0u};
+            std::memcpy(buf_.data() + sizeof(kBinaryMagic), header, sizeof(header));
+            used_ = sizeof(kBinaryMagic) + sizeof(header);
+            for (const auto& name : columnNames()) {
+                std::memset(buf_.data() + used_, 0, kBinaryNameBytes);
+                std::memcpy(buf_.data() + used_, name.data(), std::min(name.size(), kBinaryNameBytes - 1));
+                used_ += kBinaryNameBytes;
+            }
+        }
+    }
+
+    closing_ = false;
+    thread_ = std::thread([this] { writerLoop(); });
+    return true;
+}
+
+void ObservationLogWriter::push(double t_s, const Observation& obs) {
+    if (!isOpen()) return;
+    Row row;
+    row.t_s = t_s;
+    row.obs = obs;
+    if (!ring_.tryPush(row)) {
+        ++stalls_;
+        while (!ring_.tryPush(row)) std::this_thread::yield();
+    }
+    ++rows_pushed_;
+}
+
+bool ObservationLogWriter::close() {
+    if (!thread_.joinable()) return !failed_;
+    closing_.store(true, std::memory_order_release);
+    thread_.join();
+    return !failed_;
+}
+
+// ============================================================================
+// Writer thread
+// ============================================================================
+
+void ObservationLogWriter::writerLoop() {
+    auto last_flush = std::chrono::steady_clock::now();
+    for (;;) {
+        if (const Row* row = ring_.front()) {
+            writeRow(*row);
+            ring_.pop();
+            rows_written_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        // Producer's last push happens-before closing_, so an empty ring
+        // after seeing closing_ is really empty
+        if (closing_.load(std::memory_order_acquire)) {
+            if (ring_.front()) continue;
+            break;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_flush >= kIdleFlush) {
+            flushBuffer();
+            last_flush = now;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (format_ == ObservationLogFormat::ParquetLite) {
+        if (!recorder_.close()) failed_ = true;
+        return;
+    }
+    flushBuffer();
+    out_.flush();
+    if (!out_) failed_ = true;
+    out_.close();
+    buf_.clear();
+    buf_.shrink_to_fit();
+}
+
+void ObservationLogWriter::writeRow(const Row& row) {
+    if (format_ == ObservationLogFormat::ParquetLite) {
+        recorder_.append(row.t_s, row.obs);
+        return;
+    }
+
+    double values[kColumns];
+    rowValues(row, values);
+
+    if (format_ == ObservationLogFormat::Binary) {
+        if (buf_.size() - used_ < sizeof(values)) flushBuffer();
+        std::memcpy(buf_.data() + used_, values, sizeof(values));
+        used_ += sizeof(values);
+        return;
+    }
+
+    if (buf_.size() - used_ < kMaxRowChars) flushBuffer();
+    char* p = buf_.data() + used_;
+    char* const end = buf_.data() + buf_.size();
+    for (size_t c = 0; c < kColumns; ++c) {
+        // Same text as std::fixed << std::setprecision(6)
+        p = std::to_chars(p, end, values[c], std::chars_format::fixed, 6).ptr;
+        *p++ = c + 1 < kColumns ? ',' : '\n';
+    }
+    used_ = static_cast<size_t>(p - buf_.data());
+}
+
+void ObservationLogWriter::flushBuffer() {
+    if (used_ == 0 || format_ == ObservationLogFormat::ParquetLite) return;
+    out_.write(buf_.data(), static_cast<std::streamsize>(used_));
+    if (!out_) failed_ = true;
+    used_ = 0;
+}
+
+} // namespace vfep
@@ -0,0 +1,380 @@
+/**
+ * @file ObservationShm.cpp
+ * @brief Shared ring mapping, seqlock publish and validated reads
+ */
+
+#include "ObservationShm.h"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <stdexcept>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace vfep {
+
+namespace {
+
+constexpr char kMagic[8] = {'V', 'F', 'E', 'P', 'O', 'B', 'S', '1'};
+constexpr uint32_t kTypeF64 = 1;
+
+struct Slot {
+    std::atomic<uint64_t> seq;
+    ObservationFrameV1 frame;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "seqlock needs a lock-free 64-bit atomic");
+static_assert(offsetof(Slot, frame) == sizeof(uint64_t), "slot is seq then frame");
+static_assert(sizeof(ObservationShmHeader) <= 128, "descriptors start at byte 128");
+
+constexpr uint32_t kDescriptorOffset = 128;
+
+uint64_t fnv1a64(uint64_t h, const void* data, size_t len) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+void addField(std::vector<ObservationShmField>& out, const std::string& name, size_t offset) {
+    ObservationShmField f{};
+    std::strncpy(f.name, name.c_str(), sizeof(f.name) - 1);
+    f.offset = static_cast<uint32_t>(offsetof(Slot, frame) + offset);
+    f.type = kTypeF64;
+    out.push_back(f);
+}
+
+// ============================================================================
+// Platform mapping (the writer's is read-write, readers' read-only; both shared)
+// ============================================================================
+
+#if defined(_WIN32)
+
+bool mapShared(const std::string& path, bool writable, size_t create_bytes, void*& addr, size_t& bytes,
+               void*& file_handle, void*& mapping_handle) {
+    HANDLE file = CreateFileA(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              writable ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (writable) {
+        size.QuadPart = static_cast<LONGLONG>(create_bytes);
+    } else if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                        static_cast<DWORD>(size.QuadPart >> 32),
+                                        static_cast<DWORD>(size.QuadPart & 0xFFFFFFFFu), nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    addr = view;
+    bytes = static_cast<size_t>(size.QuadPart);
+    file_handle = file;
+    mapping_handle = mapping;
+    return true;
+}
+
+void unmapShared(void*& addr, size_t& bytes, void*& file_handle, void*& mapping_handle) {
+    if (addr) UnmapViewOfFile(addr);
+    if (mapping_handle) CloseHandle(static_cast<HANDLE>(mapping_handle));
+    if (file_handle) CloseHandle(static_cast<HANDLE>(file_handle));
+    addr = nullptr;
+    bytes = 0;
+    file_handle = nullptr;
+    mapping_handle = nullptr;
+}
+
+uint64_t processId() { return GetCurrentProcessId(); }
+
+#else
+
+bool mapShared(const std::string& path, bool writable, size_t create_bytes, void*& addr, size_t& bytes) {
+    const int fd = writable ? ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    size_t size = create_bytes;
+    if (writable) {
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return false;
+        }
+    } else {
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<size_t>(st.st_size);
+    }
+    if (size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* p = ::mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping keeps its own reference to the file
+    if (p == MAP_FAILED) return false;
+    addr = p;
+    bytes = size;
+    return true;
+}
+
+void unmapShared(void*& addr, size_t& bytes) {
+    if (addr) ::munmap(addr, bytes);
+    addr = nullptr;
+    bytes = 0;
+}
+
+uint64_t processId() { return static_cast<uint64_t>(::getpid()); }
+
+#endif
+
+} // namespace
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+void toObservationFrame(double t_s, const Observation& obs, ObservationFrameV1& out) {
+    out.t_s = t_s;
+#define CHEMSI_FRAME_SCALAR(name) out.name = static_cast<double>(obs.name);
+#define CHEMSI_FRAME_SECTOR(name) \
+    for (int i = 0; i < Observation::kNumSuppressionSectors; ++i) out.name[i] = obs.name[i];
+    CHEMSI_OBSERVATION_FRAME_V1_FIELDS(CHEMSI_FRAME_SCALAR)
+    CHEMSI_OBSERVATION_FRAME_V1_SECTOR_FIELDS(CHEMSI_FRAME_SECTOR)
+#undef CHEMSI_FRAME_SCALAR
+#undef CHEMSI_FRAME_SECTOR
+}
+
+const std::vector<ObservationShmField>& observationShmFields() {
+    static const std::vector<ObservationShmField> fields = [] {
+        std::vector<ObservationShmField> f;
+        addField(f, "t_s", offsetof(ObservationFrameV1, t_s));
+#define CHEMSI_FRAME_SCALAR(name) addField(f, #name, offsetof(ObservationFrameV1, name));
+#define CHEMSI_FRAME_SECTOR(name)                                                                \
+        for (int i = 0; i < Observation::kNumSuppressionSectors; ++i) {                         \
+            addField(f, #name "_" + std::to_string(i), offsetof(ObservationFrameV1, name) + i * sizeof(double)); \
+        }
+        CHEMSI_OBSERVATION_FRAME_V1_FIELDS(CHEMSI_FRAME_SCALAR)
+        CHEMSI_OBSERVATION_FRAME_V1_SECTOR_FIELDS(CHEMSI_FRAME_SECTOR)
+#undef CHEMSI_FRAME_SCALAR
+#undef CHEMSI_FRAME_SECTOR
+        return f;
+    }();
+    return fields;
+}
+
+uint64_t observationShmLayoutHash() {
+    static const uint64_t hash = [] {
+        uint64_t h = 14695981039346656037ull;
+        const uint32_t head[2] = {kObservationShmVersion, static_cast<uint32_t>(sizeof(Slot))};
+        h = fnv1a64(h, head, sizeof(head));
+        for (const auto& f : observationShmFields()) {
+            h = fnv1a64(h, f.name, std::strlen(f.name));
+            h = fnv1a64(h, &f.offset, sizeof(f.offset));
+            h = fnv1a64(h, &f.type, sizeof(f.type));
+        }
+        return h;
+    }();
+    return hash;
+}
+
+static_assert(kDescriptorOffset + 128 * sizeof(ObservationShmField) <= kObservationShmHeaderBytes,
+              "header page holds the descriptors");
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+ObservationShmWriter::~ObservationShmWriter() {
+    close();
+}
+
+bool ObservationShmWriter::open(const std::string& path, size_t capacity) {
+    if (capacity == 0) throw std::invalid_argument("ObservationShmWriter: capacity must be > 0");
+    if (isOpen()) return false;
+    size_t n = 1;
+    while (n < capacity) n <<= 1;
+
+    const auto& fields = observationShmFields();
+    if (kDescriptorOffset + fields.size() * sizeof(ObservationShmField) > kObservationShmHeaderBytes) return false;
+    const size_t bytes = kObservationShmHeaderBytes + n * sizeof(Slot);
+#if defined(_WIN32)
+    if (!mapShared(path, true, bytes, map_, map_bytes_, file_handle_, mapping_handle_)) return false;
+#else
+    if (!mapShared(path, true, bytes, map_, map_bytes_)) return false;
+#endif
+
+    // The file starts zeroed; the magic is written last so a reader that
+    // sees it also sees a complete header
+    auto* base = static_cast<uint8_t*>(map_);
+    header_ = new (base) ObservationShmHeader{};
+    header_->version = kObservationShmVersion;
+    header_->header_bytes = static_cast<uint32_t>(kObservationShmHeaderBytes);
+    header_->slot_bytes = static_cast<uint32_t>(sizeof(Slot));
+    header_->capacity = static_cast<uint32_t>(n);
+    header_->field_count = static_cast<uint32_t>(fields.size());
+    header_->descriptor_offset = kDescriptorOffset;
+    header_->layout_hash = observationShmLayoutHash();
+    header_->writer_pid = processId();
+    std::memcpy(base + kDescriptorOffset, fields.data(), fields.size() * sizeof(ObservationShmField));
+
+    slots_ = base + kObservationShmHeaderBytes;
+    for (size_t i = 0; i < n; ++i) new (slots_ + i * sizeof(Slot)) Slot{};
+    capacity_ = n;
+    next_ = 0;
+
+    header_->writer_open.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header_->magic, kMagic, sizeof(kMagic));
+    return true;
+}
+
+void ObservationShmWriter::publish(double t_s, const Observation& obs) {
+    if (!header_) return;
+    const uint64_t n = next_;
+    Slot& slot = *reinterpret_cast<Slot*>(slots_ + (n & (capacity_ - 1)) * sizeof(Slot));
+    slot.seq.store(2 * n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);  // Odd seq visible before the new bytes
+    toObservationFrame(t_s, obs, slot.frame);
+    slot.seq.store(2 * n + 2, std::memory_order_release);
+    header_->published.store(n + 1, std::memory_order_release);
+    next_ = n + 1;
+}
+
+void ObservationShmWriter::close() {
+    if (!header_) return;
+    header_->writer_open.store(0, std::memory_order_release);
+    header_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+#if defined(_WIN32)
+    FlushViewOfFile(map_, 0);
+    unmapShared(map_, map_bytes_, file_handle_, mapping_handle_);
+#else
+    unmapShared(map_, map_bytes_);
+#endif
+}
+
+std::string ObservationShmWriter::defaultPath() {
+#if defined(__linux__)
+    return "/dev/shm/vfep_observations";
+#else
+    std::error_code ec;
+    const auto dir = std::filesystem::temp_directory_path(ec);
+    return ((ec ? std::filesystem::path(".") : dir) / "vfep_observations.shm").string();
+#endif
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+ObservationShmReader::~ObservationShmReader() {
+    close();
+}
+
+bool ObservationShmReader::open(const std::string& path) {
+    close();
+#if defined(_WIN32)
+    if (!mapShared(path, false, 0, map_, map_bytes_, file_handle_, mapping_handle_)) return false;
+#else
+    if (!mapShared(path, false, 0, map_, map_bytes_)) return false;
+#endif
+
+    const auto* h = static_cast<const ObservationShmHeader*>(map_);
+    bool ok = map_bytes_ >= kObservationShmHeaderBytes && std::memcmp(h->magic, kMagic, sizeof(kMagic)) == 0;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    ok = ok && h->version == kObservationShmVersion && h->layout_hash == observationShmLayoutHash()
+        && h->slot_bytes == sizeof(Slot) && h->capacity != 0 && (h->capacity & (h->capacity - 1)) == 0
+        && map_bytes_ >= h->header_bytes + static_cast<size_t>(h->capacity) * h->slot_bytes;
+    if (!ok) {
+        close();
+        return false;
+    }
+    header_ = h;
+    slots_ = static_cast<const uint8_t*>(map_) + h->header_bytes;
+    capacity_ = h->capacity;
+    return true;
+}
+
+void ObservationShmReader::close() {
+    header_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+#if defined(_WIN32)
+    unmapShared(map_, map_bytes_, file_handle_, mapping_handle_);
+#else
+    unmapShared(map_, map_bytes_);
+#endif
+}
+
+uint64_t ObservationShmReader::published() const {
+    return header_ ? header_->published.load(std::memory_order_acquire) : 0;
+}
+
+bool ObservationShmReader::writerOpen() const {
+    return header_ && header_->writer_open.load(std::memory_order_acquire) != 0;
+}
+
+bool ObservationShmReader::read(uint64_t n, ObservationFrameV1& out) const {
+    if (!header_) return false;
+    const Slot& slot = *reinterpret_cast<const Slot*>(slots_ + (n & (capacity_ - 1)) * sizeof(Slot));
+    const uint64_t before = slot.seq.load(std::memory_order_acquire);
+    if (before != 2 * n + 2) return false;
+    std::memcpy(&out, &slot.frame, sizeof(out));
+    std::atomic_thread_fence(std::memory_order_acquire);  // Copy completes before the re-check
+    return slot.seq.load(std::memory_order_relaxed) == before;
+}
+
+size_t ObservationShmReader::poll(uint64_t& cursor, std::vector<ObservationFrameV1>& out, uint64_t* dropped) const {
+    uint64_t lost = 0;
+    const uint64_t newest = published();
+    if (cursor > newest) cursor = 0;  // A new writer restarted the ring
+    if (newest - cursor > capacity_) {
+        lost = newest - capacity_ - cursor;
+        cursor = newest - capacity_;
+    }
+    size_t added = 0;
+    ObservationFrameV1 frame;
+    for (; cursor < newest; ++cursor) {
+        if (read(cursor, frame)) {
+            out.push_back(frame);
+            ++added;
+        } else {
+            ++lost;  // Overwritten while we were copying
+        }
+    }
+    if (dropped) *dropped = lost;
+    return added;
+}
+
+} // namespace vfep
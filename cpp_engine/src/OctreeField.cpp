@@ -0,0 +1,321 @@
+/**
+ * @file OctreeField.cpp
+ * @brief Sparse octree (AMR) field container
+ *
+ * Phase 8: CFD Interface - Multi-resolution fields
+ */
+
+#include "OctreeField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace vfep {
+
+namespace {
+
+constexpr size_t MAX_IDW_SAMPLES = 64;  // Points used for an empty leaf's corners
+
+uint64_t spreadBits(uint32_t v) {
+    uint64_t x = v & 0x1FFFFFull;
+    x = (x | (x << 32)) & 0x1F00000000FFFFull;
+    x = (x | (x << 16)) & 0x1F0000FF0000FFull;
+    x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+}
+
+uint32_t cellCoord(double p, double lo, double size, uint32_t cells) {
+    const double t = (p - lo) / size * static_cast<double>(cells);
+    if (!(t > 0.0)) return 0;
+    const uint32_t c = static_cast<uint32_t>(t);
+    return std::min(c, cells - 1);
+}
+
+} // namespace
+
+uint64_t OctreeField::mortonEncode(uint32_t x, uint32_t y, uint32_t z) {
+    return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+}
+
+// ============================================================================
+// CONSTRUCTION
+// ============================================================================
+
+void OctreeField::clear() {
+    keys_.clear();
+    levels_.clear();
+    for (auto& c : corners_) {
+        c.clear();
+    }
+    depth_ = 0;
+    for (int a = 0; a < 3; ++a) {
+        lo_[a] = 0.0;
+        size_[a] = 0.0;
+    }
+}
+
+void OctreeField::setDomain(const double lo[3], const double hi[3], int max_depth) {
+    if (max_depth < 0 || max_depth > MAX_DEPTH) {
+        throw std::invalid_argument("Octree depth must be in [0, 21]");
+    }
+    for (int a = 0; a < 3; ++a) {
+        if (!(hi[a] > lo[a])) {
+            throw std::invalid_argument("Octree domain must have positive extent");
+        }
+    }
+    clear();
+    depth_ = max_depth;
+    for (int a = 0; a < 3; ++a) {
+        lo_[a] = lo[a];
+        size_[a] = hi[a] - lo[a];
+    }
+}
+
+void OctreeField::cellBounds(int level, uint32_t ix, uint32_t iy, uint32_t iz,
+                             double lo[3], double hi[3]) const {
+    const double cells = static_cast<double>(1u << level);
+    const uint32_t idx[3] = {ix, iy, iz};
+    for (int a = 0; a < 3; ++a) {
+        const double cs = size_[a] / cells;
+        lo[a] = lo_[a] + idx[a] * cs;
+        hi[a] = lo[a] + cs;
+    }
+}
+
+void OctreeField::addLeaf(int level, uint32_t ix, uint32_t iy, uint32_t iz, const double* corner_values) {
+    const int shift = depth_ - level;
+    keys_.push_back(mortonEncode(ix << shift, iy << shift, iz << shift));
+    levels_.push_back(static_cast<uint8_t>(level));
+    for (size_t f = 0; f < NUM_FIELDS; ++f) {
+        for (int c = 0; c < 8; ++c) {
+            corners_[f].push_back(corner_values[c * NUM_FIELDS + f]);
+        }
+    }
+}
+
+void OctreeField::build(const double lo[3], const double hi[3], int max_depth,
+                        const RefinePredicate& refine, const Sampler& sample) {
+    setDomain(lo, hi, max_depth);
+
+    double corner_values[8 * NUM_FIELDS];
+    // Children are visited in Morton order, so leaves come out sorted by key
+    std::function<void(int, uint32_t, uint32_t, uint32_t)> visit =
+        [&](int level, uint32_t ix, uint32_t iy, uint32_t iz) {
+            double clo[3], chi[3];
+            cellBounds(level, ix, iy, iz, clo, chi);
+            if (level < depth_ && refine(clo, chi, level)) {
+                for (uint32_t c = 0; c < 8; ++c) {
+                    visit(level + 1, 2 * ix + (c & 1), 2 * iy + ((c >> 1) & 1), 2 * iz + ((c >> 2) & 1));
+                }
+                return;
+            }
+            for (int c = 0; c < 8; ++c) {
+                sample((c & 1) ? chi[0] : clo[0],
+                       (c & 2) ? chi[1] : clo[1],
+                       (c & 4) ? chi[2] : clo[2],
+                       corner_values + c * NUM_FIELDS);
+            }
+            addLeaf(level, ix, iy, iz, corner_values);
+        };
+    visit(0, 0, 0, 0);
+}
+
+void OctreeField::buildFromPoints(const std::vector<GridPoint>& points, int max_depth,
+                                  size_t max_points_per_leaf) {
+    if (points.empty()) {
+        throw std::invalid_argument("Octree resampling needs at least one point");
+    }
+    max_points_per_leaf = std::max<size_t>(1, max_points_per_leaf);
+
+    // Bounding box, with degenerate axes widened so every cell has volume
+    double lo[3] = {points[0].x, points[0].y, points[0].z};
+    double hi[3] = {lo[0], lo[1], lo[2]};
+    for (const auto& p : points) {
+        const double xyz[3] = {p.x, p.y, p.z};
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = std::min(lo[a], xyz[a]);
+            hi[a] = std::max(hi[a], xyz[a]);
+        }
+    }
+    const double max_extent = std::max({hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2]});
+    for (int a = 0; a < 3; ++a) {
+        if (hi[a] - lo[a] <= 1e-9 * max_extent || hi[a] == lo[a]) {
+            const double half = (max_extent > 0.0) ? 1e-6 * max_extent : 1e-6;
+            lo[a] -= half;
+            hi[a] += half;
+        }
+    }
+    setDomain(lo, hi, max_depth);
+
+    std::vector<uint32_t> order(points.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    std::vector<uint32_t> scratch(points.size());
+    std::vector<uint8_t> child_of(points.size());
+
+    auto idwCorners = [&](const double clo[3], const double chi[3],
+                          size_t begin, size_t end, double* corner_values) {
+        const size_t count = end - begin;
+        const size_t stride = std::max<size_t>(1, count / MAX_IDW_SAMPLES);
+        for (int c = 0; c < 8; ++c) {
+            const double cx = (c & 1) ? chi[0] : clo[0];
+            const double cy = (c & 2) ? chi[1] : clo[1];
+            const double cz = (c & 4) ? chi[2] : clo[2];
+            double sum_w = 0.0;
+            double acc[NUM_FIELDS] = {};
+            bool exact = false;
+            for (size_t s = begin; s < end && !exact; s += stride) {
+                const GridPoint& p = points[order[s]];
+                const double d2 = (p.x - cx) * (p.x - cx) + (p.y - cy) * (p.y - cy) + (p.z - cz) * (p.z - cz);
+                const double vals[NUM_FIELDS] = {p.T_K, p.u, p.v, p.w, p.rho_kg_m3, p.P_Pa};
+                if (d2 < 1e-24) {
+                    std::copy(vals, vals + NUM_FIELDS, acc);
+                    sum_w = 1.0;
+                    exact = true;
+                    break;
+                }
+                const double w = 1.0 / d2;
+                sum_w += w;
+                for (size_t f = 0; f < NUM_FIELDS; ++f) {
+                    acc[f] += w * vals[f];
+                }
+            }
+            for (size_t f = 0; f < NUM_FIELDS; ++f) {
+                corner_values[c * NUM_FIELDS + f] = acc[f] / sum_w;
+            }
+        }
+    };
+
+    double corner_values[8 * NUM_FIELDS];
+    std::function<void(int, uint32_t, uint32_t, uint32_t, size_t, size_t, size_t, size_t)> visit =
+        [&](int level, uint32_t ix, uint32_t iy, uint32_t iz,
+            size_t begin, size_t end, size_t parent_begin, size_t parent_end) {
+            double clo[3], chi[3];
+            cellBounds(level, ix, iy, iz, clo, chi);
+            const size_t count = end - begin;
+
+            if (count <= max_points_per_leaf || level >= depth_) {
+                if (count > 0) {
+                    idwCorners(clo, chi, begin, end, corner_values);
+                } else {
+                    idwCorners(clo, chi, parent_begin, parent_end, corner_values);
+                }
+                addLeaf(level, ix, iy, iz, corner_values);
+                return;
+            }
+
+            // Counting sort of this cell's points into its 8 children
+            const uint32_t cells = 1u << (level + 1);
+            size_t counts[9] = {};
+            for (size_t s = begin; s < end; ++s) {
+                const GridPoint& p = points[order[s]];
+                const uint32_t cx = std::min(std::max(cellCoord(p.x, lo_[0], size_[0], cells), 2 * ix), 2 * ix + 1);
+                const uint32_t cy = std::min(std::max(cellCoord(p.y, lo_[1], size_[1], cells), 2 * iy), 2 * iy + 1);
+                const uint32_t cz = std::min(std::max(cellCoord(p.z, lo_[2], size_[2], cells), 2 * iz), 2 * iz + 1);
+                const uint8_t child = static_cast<uint8_t>((cx & 1) | ((cy & 1) << 1) | ((cz & 1) << 2));
+                child_of[s] = child;
+                ++counts[child + 1];
+            }
+            for (int c = 0; c < 8; ++c) {
+                counts[c + 1] += counts[c];
+            }
+            size_t cursor[8];
+            for (int c = 0; c < 8; ++c) {
+                cursor[c] = begin + counts[c];
+            }
+            for (size_t s = begin; s < end; ++s) {
+                scratch[cursor[child_of[s]]++] = order[s];
+            }
+            std::copy(scratch.begin() + begin, scratch.begin() + end, order.begin() + begin);
+
+            for (uint32_t c = 0; c < 8; ++c) {
+                visit(level + 1, 2 * ix + (c & 1), 2 * iy + ((c >> 1) & 1), 2 * iz + ((c >> 2) & 1),
+                      begin + counts[c], begin + counts[c + 1], begin, end);
+            }
+        };
+    visit(0, 0, 0, 0, 0, order.size(), 0, order.size());
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+long long OctreeField::findLeaf(double x, double y, double z) const {
+    if (keys_.empty()) return -1;
+    const double p[3] = {x, y, z};
+    for (int a = 0; a < 3; ++a) {
+        if (!(p[a] >= lo_[a] && p[a] <= lo_[a] + size_[a])) {
+            return -1;
+        }
+    }
+
+    const uint32_t cells = 1u << depth_;
+    const uint64_t code = mortonEncode(cellCoord(x, lo_[0], size_[0], cells),
+                                       cellCoord(y, lo_[1], size_[1], cells),
+                                       cellCoord(z, lo_[2], size_[2], cells));
+    auto it = std::upper_bound(keys_.begin(), keys_.end(), code);
+    if (it == keys_.begin()) return -1;
+    const size_t leaf = static_cast<size_t>(std::distance(keys_.begin(), it)) - 1;
+    const uint64_t span = 1ull << (3 * (depth_ - levels_[leaf]));
+    return (code - keys_[leaf] < span) ? static_cast<long long>(leaf) : -1;
+}
+
+void OctreeField::leafBounds(size_t leaf, double lo[3], double hi[3]) const {
+    // De-interleave the min-corner code, then scale to the leaf's level
+    uint32_t idx[3] = {0, 0, 0};
+    const uint64_t key = keys_[leaf];
+    for (int b = 0; b < depth_; ++b) {
+        for (int a = 0; a < 3; ++a) {
+            idx[a] |= static_cast<uint32_t>((key >> (3 * b + a)) & 1u) << b;
+        }
+    }
+    const int level = levels_[leaf];
+    const int shift = depth_ - level;
+    cellBounds(level, idx[0] >> shift, idx[1] >> shift, idx[2] >> shift, lo, hi);
+}
+
+bool OctreeField::interpolate(double x, double y, double z, double* values) const {
+    const long long leaf = findLeaf(x, y, z);
+    if (leaf < 0) return false;
+
+    double lo[3], hi[3];
+    leafBounds(static_cast<size_t>(leaf), lo, hi);
+    const double fx = std::max(0.0, std::min(1.0, (x - lo[0]) / (hi[0] - lo[0])));
+    const double fy = std::max(0.0, std::min(1.0, (y - lo[1]) / (hi[1] - lo[1])));
+    const double fz = std::max(0.0, std::min(1.0, (z - lo[2]) / (hi[2] - lo[2])));
+
+    const size_t base = static_cast<size_t>(leaf) * 8;
+    for (size_t f = 0; f < NUM_FIELDS; ++f) {
+        const double* c = corners_[f].data() + base;
+        const double c00 = c[0] * (1.0 - fx) + c[1] * fx;
+        const double c10 = c[2] * (1.0 - fx) + c[3] * fx;
+        const double c01 = c[4] * (1.0 - fx) + c[5] * fx;
+        const double c11 = c[6] * (1.0 - fx) + c[7] * fx;
+        const double c0 = c00 * (1.0 - fy) + c10 * fy;
+        const double c1 = c01 * (1.0 - fy) + c11 * fy;
+        values[f] = c0 * (1.0 - fz) + c1 * fz;
+    }
+    return true;
+}
+
+double OctreeField::interpolate(CFDField field, double x, double y, double z, double fallback) const {
+    double values[NUM_FIELDS];
+    if (!interpolate(x, y, z, values)) {
+        return fallback;
+    }
+    return values[static_cast<size_t>(field)];
+}
+
+size_t OctreeField::memoryBytes() const {
+    size_t bytes = keys_.capacity() * sizeof(uint64_t) + levels_.capacity() * sizeof(uint8_t);
+    for (const auto& c : corners_) {
+        bytes += c.capacity() * sizeof(double);
+    }
+    return bytes;
+}
+
+} // namespace vfep
@@ -0,0 +1,208 @@
+#include "ScenarioBatch.h"
+
+#include "TelemetryHistory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vfep {
+
+static_assert(sizeof(ScenarioParams) == kScenarioParamCount * sizeof(double), "ScenarioParams must be all doubles");
+static_assert(sizeof(ScenarioMetrics) == kScenarioMetricCount * sizeof(double), "ScenarioMetrics must be all doubles");
+
+namespace {
+
+const char* const kParamNames[] = {
+    "dt_s", "t_end_s", "ignite_at_s", "suppress_at_s", "ach_1_per_h",
+    "pyrolysis_max_kgps", "heat_release_J_per_mol", "volume_m3", "area_m2", "h_W_m2K",
+};
+const char* const kMetricNames[] = {
+    "peak_T_K", "peak_HRR_W", "t_peak_HRR_s", "final_T_K",
+    "final_HRR_W", "min_O2_volpct", "final_fuel_kg", "steps",
+};
+static_assert(sizeof(kParamNames) / sizeof(kParamNames[0]) == kScenarioParamCount, "param names");
+static_assert(sizeof(kMetricNames) / sizeof(kMetricNames[0]) == kScenarioMetricCount, "metric names");
+
+} // namespace
+
+const char* scenarioParamName(size_t column) {
+    return column < kScenarioParamCount ? kParamNames[column] : nullptr;
+}
+
+const char* scenarioMetricName(size_t column) {
+    return column < kScenarioMetricCount ? kMetricNames[column] : nullptr;
+}
+
+ScenarioParams scenarioParamsFromRow(const double* row, size_t cols) {
+    if (cols > kScenarioParamCount) {
+        throw std::invalid_argument("ScenarioBatch: " + std::to_string(cols) + " parameter columns, at most " +
+                                    std::to_string(kScenarioParamCount));
+    }
+    ScenarioParams p{};
+    double* dst = reinterpret_cast<double*>(&p);
+    std::copy(row, row + cols, dst);
+    if (!(std::isfinite(p.dt_s) && p.dt_s > 0.0) || !(std::isfinite(p.t_end_s) && p.t_end_s > 0.0)) {
+        throw std::invalid_argument("ScenarioBatch: dt_s and t_end_s must be positive and finite");
+    }
+    return p;
+}
+
+// ============================================================
+// Single scenario (same drive as MonteCarloUQ::runScenario)
+// ============================================================
+
+void configureScenario(Simulation& sim, const ScenarioParams& p) {
+    sim.resetToDataCenterRackScenario();
+    if (p.ach_1_per_h > 0.0) {
+        sim.setVentilationACH(p.ach_1_per_h);
+    }
+    sim.setPyrolysisMax(p.pyrolysis_max_kgps);
+    if (p.heat_release_J_per_mol > 0.0) {
+        sim.setCombustionHeatRelease(p.heat_release_J_per_mol);
+    }
+    sim.setReactorGeometry(p.volume_m3, p.area_m2, p.h_W_m2K);
+    sim.setLiIonEnabled(false);
+}
+
+ScenarioMetrics runScenario(const ScenarioParams& p, TelemetrySampleV1* telemetry, size_t telemetry_cap,
+                            size_t* telemetry_rows) {
+    const bool want_telemetry = telemetry != nullptr && telemetry_cap > 0;
+
+    Simulation sim;
+    sim.enableTelemetryHistory(want_telemetry);
+    configureScenario(sim, p);
+
+    ScenarioMetrics m{};
+    const Observation o0 = sim.observe();
+    m.min_O2_volpct = o0.O2_volpct;
+
+    double t = 0.0;
+    bool ignited = false;
+    bool suppressed = false;
+    Observation o = o0;
+    while (t + p.dt_s <= p.t_end_s + 1e-12) {
+        const double t_prev = t;
+        const double t_next = t + p.dt_s;
+
+        if (!ignited && (t_prev < p.ignite_at_s && t_next >= p.ignite_at_s)) {
+            sim.commandIgniteOrIncreasePyrolysis();
+            sim.setPyrolysisRate(p.pyrolysis_max_kgps);
+            ignited = true;
+        }
+        if (p.suppress_at_s >= 0.0 && !suppressed && (t_prev < p.suppress_at_s && t_next >= p.suppress_at_s)) {
+            sim.commandStartSuppression();
+            sim.setAgentDeliveryRate(1.0);
+            sim.setKnockdown(0.55);
+            suppressed = true;
+        }
+
+        sim.step(p.dt_s);
+        t = t_next;
+        m.steps += 1.0;
+
+        o = sim.observe();
+        if (o.T_K > m.peak_T_K) {
+            m.peak_T_K = o.T_K;
+        }
+        if (o.HRR_W > m.peak_HRR_W) {
+            m.peak_HRR_W = o.HRR_W;
+            m.t_peak_HRR_s = t;
+        }
+        m.min_O2_volpct = std::min(m.min_O2_volpct, o.O2_volpct);
+    }
+    m.final_T_K = o.T_K;
+    m.final_HRR_W = o.HRR_W;
+    m.final_fuel_kg = o.fuel_kg;
+
+    size_t rows = 0;
+    if (want_telemetry) {
+        if (const TelemetryHistory* h = sim.telemetryHistory()) {
+            rows = h->copyFullRate(0, telemetry_cap, telemetry);
+        }
+    }
+    if (telemetry_rows) {
+        *telemetry_rows = rows;
+    }
+    return m;
+}
+
+// ============================================================
+// Batch
+// ============================================================
+
+void runScenarioBatch(const double* params, size_t rows, size_t param_cols, double* metrics, float* telemetry,
+                      size_t telemetry_cap, int32_t* telemetry_rows, size_t threads) {
+    if (rows == 0) {
+        return;
+    }
+    if (!params || !metrics) {
+        throw std::invalid_argument("ScenarioBatch: null parameter or metric matrix");
+    }
+
+    // Validate every row before starting any work
+    std::vector<ScenarioParams> scenarios;
+    scenarios.reserve(rows);
+    for (size_t r = 0; r < rows; ++r) {
+        scenarios.push_back(scenarioParamsFromRow(params + r * param_cols, param_cols));
+    }
+
+    const size_t cap = telemetry ? telemetry_cap : 0;
+    constexpr size_t kSampleFloats = sizeof(TelemetrySampleV1) / sizeof(float);
+    auto runRow = [&](size_t r) {
+        TelemetrySampleV1* tel = cap ? reinterpret_cast<TelemetrySampleV1*>(telemetry + r * cap * kSampleFloats)
+                                     : nullptr;
+        size_t written = 0;
+        const ScenarioMetrics m = runScenario(scenarios[r], tel, cap, &written);
+        std::copy_n(reinterpret_cast<const double*>(&m), kScenarioMetricCount, metrics + r * kScenarioMetricCount);
+        if (telemetry_rows) {
+            telemetry_rows[r] = static_cast<int32_t>(written);
+        }
+    };
+
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, rows);
+    if (threads == 1) {
+        for (size_t r = 0; r < rows; ++r) {
+            runRow(r);
+        }
+        return;
+    }
+
+    // Rows are handed out one at a time: run lengths vary with t_end_s / dt_s
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+    auto worker = [&]() {
+        for (size_t r; !failed.load(std::memory_order_relaxed) && (r = next.fetch_add(1)) < rows;) {
+            try {
+                runRow(r);
+            } catch (...) {
+                if (!failed.exchange(true)) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (size_t w = 1; w < threads; ++w) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& th : pool) {
+        th.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace vfep
@@ -52,6 +52,7 @@ SensitivityAnalyzer::ScenarioGeometry SensitivityAnalyzer::scaleGeometryForVolum
 
 SensitivityAnalyzer::SampleResult SensitivityAnalyzer::runScenario(const ScenarioConfig& scenario) const {
     vfep::Simulation sim;
+    sim.enableTelemetryHistory(false);  // Only end-of-run metrics are read
     sim.resetToDataCenterRackScenario();
 
     if (scenario.ach_1_per_h > 0.0) {
@@ -6,6 +6,8 @@
 #include "Simulation.h"
 #include "Aerodynamics.h"
 #include "Constants.h"
+#include "Crc32.h"
+#include "TelemetryHistory.h"
 
 #include <algorithm>
 #include <cmath>
@@ -88,34 +90,6 @@ static inline std::uint32_t fnv1a32_add_f64(std::uint32_t h, double v) {
     return fnv1a32_update(h, &bits, sizeof(bits));
 }
 
-static inline std::uint32_t crc32_update(std::uint32_t crc, const void* data, std::size_t len) {
-    static bool table_init = false;
-    static std::uint32_t table[256];
-    if (!table_init) {
-        for (std::uint32_t i = 0; i < 256; ++i) {
-            std::uint32_t c = i;
-            for (int k = 0; k < 8; ++k) {
-                c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
-            }
-            table[i] = c;
-        }
-        table_init = true;
-    }
-    const std::uint8_t* p = reinterpret_cast<const std::uint8_t*>(data);
-    std::uint32_t c = crc ^ 0xFFFFFFFFu;
-    for (std::size_t i = 0; i < len; ++i) {
-        c = table[(c ^ p[i]) & 0xFFu] ^ (c >> 8);
-    }
-    return c ^ 0xFFFFFFFFu;
-}
-
-static inline std::uint32_t crc32_add_f32(std::uint32_t crc, float v) {
-    std::uint32_t bits = 0;
-    static_assert(sizeof(bits) == sizeof(v), "unexpected float size");
-    std::memcpy(&bits, &v, sizeof(v));
-    return crc32_update(crc, &bits, sizeof(bits));
-}
-
 static inline double utilizationU(double exposure_kg, double k_util_1_per_kg) {
     if (!std::isfinite(exposure_kg) || exposure_kg <= 0.0) return 0.0;
     if (!std::isfinite(k_util_1_per_kg) || k_util_1_per_kg <= 0.0) return 0.0;
@@ -394,6 +368,8 @@ setAgent(AgentType::CleanAgent);
     resetToDataCenterRackScenario();
 }
 
+Simulation::~Simulation() = default;
+
 void Simulation::resetToDataCenterRackScenario() {
     concluded_ = false;
     ignited_   = false;
@@ -466,8 +442,7 @@ void Simulation::resetToDataCenterRackScenario() {
     run_signatures_ = {};
     expected_signatures_ = {};
     latest_events_bits_ = 0;
-    telemetry_head_ = 0;
-    telemetry_count_ = 0;
+    if (telemetry_history_) telemetry_history_->clear();
     telemetry_next_t_s_ = 0.0;
     prev_occluded_any_ = false;
     prev_kd_ge_0p5_ = false;
@@ -559,11 +534,8 @@ void Simulation::enableCalibrationMode(bool enabled) {
     run_signatures_ = {};
     expected_signatures_ = {};
     latest_events_bits_ = 0;
-    telemetry_head_ = 0;
-    telemetry_count_ = 0;
+    clearTelemetry();
     telemetry_next_t_s_ = 0.0;
-    telemetry_v2_head_ = 0;
-    telemetry_v2_count_ = 0;
     last_profile_ = {};
 
     if (calibration_mode_) {
@@ -617,11 +589,8 @@ void Simulation::enableVerificationMode(bool enabled) {
     run_signatures_ = {};
     expected_signatures_ = {};
     latest_events_bits_ = 0;
-    telemetry_head_ = 0;
-    telemetry_count_ = 0;
+    clearTelemetry();
     telemetry_next_t_s_ = 0.0;
-    telemetry_v2_head_ = 0;
-    telemetry_v2_count_ = 0;
     last_profile_ = {};
     prev_occluded_any_ = false;
     prev_kd_ge_0p5_ = false;
@@ -634,19 +603,39 @@ void Simulation::enableVerificationMode(bool enabled) {
 
 void Simulation::enableTelemetryV2(bool enabled) {
     telemetry_v2_enabled_ = enabled;
-    telemetry_v2_head_ = 0;
-    telemetry_v2_count_ = 0;
+    if (!enabled) telemetry_v2_history_.reset();
+    else if (telemetry_v2_history_) telemetry_v2_history_->clear();
 }
 
-int Simulation::getTelemetrySamplesV2(TelemetrySampleV2* out_ptr, int cap) const {
-    if (!out_ptr || cap <= 0) return 0;
-    const int n = std::min<int>(telemetry_v2_count_, cap);
-    int idx = (telemetry_v2_head_ - telemetry_v2_count_);
-    while (idx < 0) idx += kTelemetryV2Capacity_;
-    for (int i = 0; i < n; ++i) {
-        out_ptr[i] = telemetry_v2_rb_[(idx + i) % kTelemetryV2Capacity_];
+void Simulation::enableTelemetryHistory(bool enabled) {
+    telemetry_history_enabled_ = enabled;
+    if (!enabled) {
+        telemetry_history_.reset();
+        telemetry_v2_history_.reset();
     }
-    return n;
+}
+
+void Simulation::clearTelemetry() {
+    if (telemetry_history_) telemetry_history_->clear();
+    if (telemetry_v2_history_) telemetry_v2_history_->clear();
+}
+
+namespace {
+
+// Last kTelemetryWindow full-rate samples, oldest first (the old ring semantics)
+template <typename Sample>
+int copyTelemetryWindow(const TelemetryHistory* history, Sample* out_ptr, int cap) {
+    if (!out_ptr || cap <= 0 || !history) return 0;
+    const size_t rows = history->fullRateRows();
+    const size_t window = std::min<size_t>(rows, Simulation::kTelemetryWindow);
+    const size_t n = std::min<size_t>(window, static_cast<size_t>(cap));
+    return static_cast<int>(history->copyFullRate(rows - window, n, out_ptr));
+}
+
+} // namespace
+
+int Simulation::getTelemetrySamplesV2(TelemetrySampleV2* out_ptr, int cap) const {
+    return copyTelemetryWindow(telemetry_v2_history_.get(), out_ptr, cap);
 }
 
 void Simulation::setControlInputs(const ControlInputsV1& in) {
@@ -685,15 +674,7 @@ std::uint32_t Simulation::getLatestEvents() {
 }
 
 int Simulation::getTelemetrySamples(TelemetrySampleV1* out_ptr, int cap) const {
-    if (!out_ptr || cap <= 0) return 0;
-    const int n = std::min<int>(telemetry_count_, cap);
-    // Oldest sample index = head - count (mod capacity)
-    int idx = (telemetry_head_ - telemetry_count_);
-    while (idx < 0) idx += kTelemetryCapacity_;
-    for (int i = 0; i < n; ++i) {
-        out_ptr[i] = telemetry_rb_[(idx + i) % kTelemetryCapacity_];
-    }
-    return n;
+    return copyTelemetryWindow(telemetry_history_.get(), out_ptr, cap);
 }
 
 static inline std::uint32_t fnv_hash_text_u32(const char* s) {
@@ -895,8 +876,7 @@ bool Simulation::runVerificationTest(VerificationTestId id) {
     telemetry_next_t_s_ = 0.0;
     run_signatures_ = {};
     latest_events_bits_ = 0;
-    telemetry_head_ = 0;
-    telemetry_count_ = 0;
+    if (telemetry_history_) telemetry_history_->clear();
 
     // Parameter hash over effective parameters (explicit list, fixed order)
     {
@@ -1143,6 +1123,14 @@ void Simulation::commandStartSuppression() {
     supp_.setConfig(sc);
 }
 
+void Simulation::commandStopSuppression() {
+    auto sc = supp_.config();
+    sc.enabled = false;
+    supp_.setConfig(sc);
+    // A disabled Suppression no longer writes the delivered rate back
+    agent_mdot_kgps_ = 0.0;
+}
+
 void Simulation::step(double dt) {
     if (concluded_ && !verification_mode_) return;
 
@@ -1630,12 +1618,6 @@ if (!std::isfinite(combustionHRR_W) || combustionHRR_W < 0.0) combustionHRR_W =
     // Phase 3B.1: deterministic telemetry sampling (schema v1)
     // --------------------
     {
-        auto fnv_add_f32 = [&](std::uint32_t h, float v) {
-            std::uint32_t bits = 0;
-            std::memcpy(&bits, &v, sizeof(v));
-            return fnv1a32_update(h, &bits, sizeof(bits));
-        };
-
         auto push_sample = [&](double sample_t_s) {
             TelemetrySampleV1 s{};
             s.t_s = static_cast<float>(sample_t_s);
@@ -1655,9 +1637,12 @@ if (!std::isfinite(combustionHRR_W) || combustionHRR_W < 0.0) combustionHRR_W =
             s.KD_actual_0_1 = static_cast<float>(clamp01(knockdown_0_1_));
             s.HRR_kW = static_cast<float>(std::max(0.0, effective_HRR_W_) * 0.001);
 
-            telemetry_rb_[telemetry_head_] = s;
-            telemetry_head_ = (telemetry_head_ + 1) % kTelemetryCapacity_;
-            if (telemetry_count_ < kTelemetryCapacity_) telemetry_count_++;
+            if (telemetry_history_enabled_) {
+                if (!telemetry_history_) {
+                    telemetry_history_ = std::make_unique<TelemetryHistory>(RecordingSchema::TelemetryV1);
+                }
+                telemetry_history_->push(s);
+            }
 
             std::uint32_t events = 0u;
             const bool occluded_any =
@@ -1729,39 +1714,39 @@ if (!std::isfinite(combustionHRR_W) || combustionHRR_W < 0.0) combustionHRR_W =
                 s2.shield_min_0_1 = static_cast<float>(sh_min);
                 s2.blocked_sector_count_u32 = blocked;
 
-                telemetry_v2_rb_[telemetry_v2_head_] = s2;
-                telemetry_v2_head_ = (telemetry_v2_head_ + 1) % kTelemetryV2Capacity_;
-                if (telemetry_v2_count_ < kTelemetryV2Capacity_) telemetry_v2_count_++;
+                if (telemetry_history_enabled_) {
+                    if (!telemetry_v2_history_) {
+                        telemetry_v2_history_ = std::make_unique<TelemetryHistory>(RecordingSchema::TelemetryV2);
+                    }
+                    telemetry_v2_history_->push(s2);
+                }
             }
 
             if (verification_mode_ || calibration_mode_) {
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.t_s);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.raw_mdot_kgps);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.net_mdot_kgps);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.exposure_kg);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.effective_exposure_kg);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.KD_target_0_1);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.KD_actual_0_1);
-                run_signatures_.telemetry_crc_u32 = crc32_add_f32(run_signatures_.telemetry_crc_u32, s.HRR_kW);
-
-                std::uint32_t h = run_signatures_.state_digest_u32;
-                if (h == 0) h = fnv1a32_begin();
-                h = fnv_add_f32(h, s.t_s);
-                h = fnv_add_f32(h, s.exposure_kg);
-                h = fnv_add_f32(h, s.effective_exposure_kg);
-                h = fnv_add_f32(h, s.KD_target_0_1);
-                h = fnv_add_f32(h, s.KD_actual_0_1);
-                h = fnv_add_f32(h, s.HRR_kW);
+                // One CRC / FNV call per sample over packed bytes; both are
+                // streaming, so this equals the old per-field updates
+                run_signatures_.telemetry_crc_u32 = crc32_update(run_signatures_.telemetry_crc_u32, &s, sizeof(s));
+
+                std::array<float, 6 + 7 * 4> snap{};
+                snap[0] = s.t_s;
+                snap[1] = s.exposure_kg;
+                snap[2] = s.effective_exposure_kg;
+                snap[3] = s.KD_target_0_1;
+                snap[4] = s.KD_actual_0_1;
+                snap[5] = s.HRR_kW;
                 for (int i = 0; i < 4; ++i) {
-                    h = fnv_add_f32(h, static_cast<float>(clamp01(sector_occlusion_0_1_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(clamp01(sector_line_attack_0_1_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(clamp01(sector_shield_0_1_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(std::max(0.0, sector_exposure_kg_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(std::max(0.0, sector_effective_exposure_kg_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(clamp01(sector_knockdown_target_0_1_[i])));
-                    h = fnv_add_f32(h, static_cast<float>(clamp01(sector_knockdown_0_1_[i])));
+                    float* f = snap.data() + 6 + 7 * i;
+                    f[0] = static_cast<float>(clamp01(sector_occlusion_0_1_[i]));
+                    f[1] = static_cast<float>(clamp01(sector_line_attack_0_1_[i]));
+                    f[2] = static_cast<float>(clamp01(sector_shield_0_1_[i]));
+                    f[3] = static_cast<float>(std::max(0.0, sector_exposure_kg_[i]));
+                    f[4] = static_cast<float>(std::max(0.0, sector_effective_exposure_kg_[i]));
+                    f[5] = static_cast<float>(clamp01(sector_knockdown_target_0_1_[i]));
+                    f[6] = static_cast<float>(clamp01(sector_knockdown_0_1_[i]));
                 }
-                run_signatures_.state_digest_u32 = h;
+                std::uint32_t h = run_signatures_.state_digest_u32;
+                if (h == 0) h = fnv1a32_begin();
+                run_signatures_.state_digest_u32 = fnv1a32_update(h, snap.data(), sizeof(snap));
             }
         };
 
@@ -0,0 +1,403 @@
+/**
+ * @file SurfaceMesh.cpp
+ * @brief Implementation of STL import and patch coarsening
+ * 
+ * Phase 9: Track E - Geometry Import
+ * 
+ * Binary STL files are memory-mapped and split into contiguous triangle
+ * ranges parsed on worker threads (each 50-byte record is independent).
+ * ASCII files are parsed in place from the mapping with std::from_chars.
+ */
+
+#include "SurfaceMesh.h"
+#include "MappedFile.h"
+#include "ParallelFor.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace vfep {
+
+constexpr size_t STL_HEADER_BYTES = 80;
+constexpr size_t STL_RECORD_BYTES = 50;            // 12 floats + uint16 attribute
+constexpr size_t MIN_TRIANGLES_PER_THREAD = 65536;
+constexpr float MIN_TRIANGLE_AREA_M2 = 1e-12f;
+
+namespace {
+
+float readFloatLE(const unsigned char* p) {
+    // STL is little-endian; records are not 4-byte aligned
+    float v;
+    std::memcpy(&v, p, sizeof(float));
+    return v;
+}
+
+MeshVec3 sub(const MeshVec3& a, const MeshVec3& b) {
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+MeshVec3 cross(const MeshVec3& a, const MeshVec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+float length(const MeshVec3& v) {
+    return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+
+// Dominant axis direction 0..5 (+x,-x,+y,-y,+z,-z)
+int dominantDirection(const MeshVec3& n) {
+    const float ax = std::abs(n.x), ay = std::abs(n.y), az = std::abs(n.z);
+    if (ax >= ay && ax >= az) return n.x >= 0.0f ? 0 : 1;
+    if (ay >= az) return n.y >= 0.0f ? 2 : 3;
+    return n.z >= 0.0f ? 4 : 5;
+}
+
+uint64_t patchKey(int ix, int iy, int iz, int dir) {
+    constexpr uint64_t MASK = (uint64_t(1) << 20) - 1;
+    return ((uint64_t(ix) & MASK) << 43) | ((uint64_t(iy) & MASK) << 23) |
+           ((uint64_t(iz) & MASK) << 3) | uint64_t(dir);
+}
+
+const char* skipSpace(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) ++p;
+    return p;
+}
+
+bool startsWith(const char* p, const char* end, const char* word) {
+    const size_t n = std::strlen(word);
+    return static_cast<size_t>(end - p) >= n && std::memcmp(p, word, n) == 0;
+}
+
+const char* parseFloats(const char* p, const char* end, float* out, int count, bool& ok) {
+    for (int i = 0; i < count; ++i) {
+        p = skipSpace(p, end);
+        // from_chars rejects a leading '+', which some exporters emit
+        if (p < end && *p == '+') ++p;
+        auto res = std::from_chars(p, end, out[i]);
+        if (res.ec != std::errc()) {
+            ok = false;
+            return p;
+        }
+        p = res.ptr;
+    }
+    ok = true;
+    return p;
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUCTION & INITIALIZATION
+// ============================================================================
+
+SurfaceMesh::SurfaceMesh() {
+    reset();
+}
+
+SurfaceMesh::~SurfaceMesh() {
+    // Vector cleanup handled automatically
+}
+
+void SurfaceMesh::reset() {
+    triangles_.clear();
+    bounds_min_ = {0.0f, 0.0f, 0.0f};
+    bounds_max_ = {0.0f, 0.0f, 0.0f};
+    binary_source_ = false;
+}
+
+// ============================================================================
+// LOADING
+// ============================================================================
+
+bool SurfaceMesh::loadSTL(const std::string& path, float unit_scale) {
+    if (unit_scale <= 0.0f) {
+        throw std::invalid_argument("Unit scale must be positive");
+    }
+    
+    reset();
+    
+    MappedFile file;
+    if (!file.open(path) || file.size() == 0) {
+        return false;
+    }
+    
+    const unsigned char* data = file.data();
+    const size_t size = file.size();
+    
+    // Binary files may also begin with "solid", so trust the record count
+    // whenever it matches the file size exactly. Otherwise prefer an ASCII
+    // body, and fall back to binary when the records fit in the file:
+    // exporters pad the tail or write a short count, as the old visualizer
+    // loader tolerated.
+    uint32_t num_triangles = 0;
+    if (size >= STL_HEADER_BYTES + 4) {
+        std::memcpy(&num_triangles, data + STL_HEADER_BYTES, sizeof(uint32_t));
+    }
+    const size_t binary_bytes = STL_HEADER_BYTES + 4 + static_cast<size_t>(num_triangles) * STL_RECORD_BYTES;
+    if (num_triangles > 0 && size == binary_bytes) {
+        binary_source_ = true;
+        return parseBinary(data, size, unit_scale);
+    }
+    
+    if (parseASCII(reinterpret_cast<const char*>(data), size, unit_scale)) {
+        return true;
+    }
+    if (num_triangles > 0 && size >= binary_bytes) {
+        reset();
+        binary_source_ = true;
+        return parseBinary(data, size, unit_scale);
+    }
+    reset();
+    return false;
+}
+
+bool SurfaceMesh::parseBinary(const unsigned char* data, size_t size, float unit_scale) {
+    uint32_t num_triangles = 0;
+    std::memcpy(&num_triangles, data + STL_HEADER_BYTES, sizeof(uint32_t));
+    const unsigned char* records = data + STL_HEADER_BYTES + 4;
+    if (size < STL_HEADER_BYTES + 4 + static_cast<size_t>(num_triangles) * STL_RECORD_BYTES) {
+        return false;
+    }
+    
+    triangles_.resize(num_triangles);
+    
+    auto parseRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const unsigned char* r = records + i * STL_RECORD_BYTES;
+            MeshTriangle& tri = triangles_[i];
+            tri.normal = {readFloatLE(r), readFloatLE(r + 4), readFloatLE(r + 8)};
+            tri.v0 = {readFloatLE(r + 12) * unit_scale, readFloatLE(r + 16) * unit_scale, readFloatLE(r + 20) * unit_scale};
+            tri.v1 = {readFloatLE(r + 24) * unit_scale, readFloatLE(r + 28) * unit_scale, readFloatLE(r + 32) * unit_scale};
+            tri.v2 = {readFloatLE(r + 36) * unit_scale, readFloatLE(r + 40) * unit_scale, readFloatLE(r + 44) * unit_scale};
+        }
+    };
+    
+    parallelFor(num_triangles, MIN_TRIANGLES_PER_THREAD, parseRange);
+    
+    computeBounds();
+    return !triangles_.empty();
+}
+
+bool SurfaceMesh::parseASCII(const char* data, size_t size, float unit_scale) {
+    const char* p = data;
+    const char* end = data + size;
+    
+    p = skipSpace(p, end);
+    if (!startsWith(p, end, "solid")) {
+        return false;
+    }
+    
+    MeshTriangle tri{};
+    int vertex_count = 0;
+    while (p < end) {
+        p = skipSpace(p, end);
+        if (p >= end) break;
+        
+        bool ok = true;
+        if (startsWith(p, end, "facet")) {
+            p += 5;
+            p = skipSpace(p, end);
+            if (startsWith(p, end, "normal")) {
+                float n[3];
+                p = parseFloats(p + 6, end, n, 3, ok);
+                if (ok) tri.normal = {n[0], n[1], n[2]};
+            }
+            vertex_count = 0;
+        } else if (startsWith(p, end, "vertex")) {
+            float v[3];
+            p = parseFloats(p + 6, end, v, 3, ok);
+            if (ok) {
+                MeshVec3 vert = {v[0] * unit_scale, v[1] * unit_scale, v[2] * unit_scale};
+                if (vertex_count == 0) tri.v0 = vert;
+                else if (vertex_count == 1) tri.v1 = vert;
+                else if (vertex_count == 2) tri.v2 = vert;
+                ++vertex_count;
+            }
+        } else if (startsWith(p, end, "endfacet")) {
+            if (vertex_count >= 3) {
+                triangles_.push_back(tri);
+            }
+            vertex_count = 0;
+        }
+        
+        // Advance to the next line
+        while (p < end && *p != '\n') ++p;
+    }
+    
+    computeBounds();
+    return !triangles_.empty();
+}
+
+void SurfaceMesh::computeBounds() {
+    if (triangles_.empty()) {
+        bounds_min_ = bounds_max_ = {0.0f, 0.0f, 0.0f};
+        return;
+    }
+    
+    MeshVec3 lo = triangles_[0].v0;
+    MeshVec3 hi = triangles_[0].v0;
+    for (const auto& tri : triangles_) {
+        for (const MeshVec3* v : {&tri.v0, &tri.v1, &tri.v2}) {
+            lo.x = std::min(lo.x, v->x);
+            lo.y = std::min(lo.y, v->y);
+            lo.z = std::min(lo.z, v->z);
+            hi.x = std::max(hi.x, v->x);
+            hi.y = std::max(hi.y, v->y);
+            hi.z = std::max(hi.z, v->z);
+        }
+    }
+    bounds_min_ = lo;
+    bounds_max_ = hi;
+}
+
+// ============================================================================
+// GEOMETRY QUERIES
+// ============================================================================
+
+float SurfaceMesh::getTotalArea() const {
+    double total = 0.0;
+    for (const auto& tri : triangles_) {
+        total += 0.5 * length(cross(sub(tri.v1, tri.v0), sub(tri.v2, tri.v0)));
+    }
+    return static_cast<float>(total);
+}
+
+// ============================================================================
+// COARSENING
+// ============================================================================
+
+std::vector<SurfacePatch> SurfaceMesh::coarsenToPatches(float target_patch_area_m2) const {
+    if (target_patch_area_m2 <= 0.0f) {
+        throw std::invalid_argument("Target patch area must be positive");
+    }
+    
+    const float cell_m = std::sqrt(target_patch_area_m2);
+    
+    // Accumulate in double: large meshes sum millions of small areas
+    struct Accum {
+        double area = 0.0;
+        double cx = 0.0, cy = 0.0, cz = 0.0;
+        double nx = 0.0, ny = 0.0, nz = 0.0;
+        int count = 0;
+    };
+    std::vector<Accum> accum;
+    std::unordered_map<uint64_t, int> index;
+    index.reserve(triangles_.size() / 4 + 16);
+    
+    for (const auto& tri : triangles_) {
+        const MeshVec3 n2 = cross(sub(tri.v1, tri.v0), sub(tri.v2, tri.v0));
+        const float twice_area = length(n2);
+        const float area = 0.5f * twice_area;
+        if (area < MIN_TRIANGLE_AREA_M2) {
+            continue;  // Degenerate sliver
+        }
+        
+        const MeshVec3 c = {(tri.v0.x + tri.v1.x + tri.v2.x) / 3.0f,
+                            (tri.v0.y + tri.v1.y + tri.v2.y) / 3.0f,
+                            (tri.v0.z + tri.v1.z + tri.v2.z) / 3.0f};
+        const int ix = static_cast<int>(std::floor((c.x - bounds_min_.x) / cell_m));
+        const int iy = static_cast<int>(std::floor((c.y - bounds_min_.y) / cell_m));
+        const int iz = static_cast<int>(std::floor((c.z - bounds_min_.z) / cell_m));
+        const uint64_t key = patchKey(ix, iy, iz, dominantDirection(n2));
+        
+        auto it = index.find(key);
+        int slot;
+        if (it == index.end()) {
+            slot = static_cast<int>(accum.size());
+            index.emplace(key, slot);
+            accum.emplace_back();
+        } else {
+            slot = it->second;
+        }
+        
+        Accum& a = accum[slot];
+        a.area += area;
+        a.cx += static_cast<double>(c.x) * area;
+        a.cy += static_cast<double>(c.y) * area;
+        a.cz += static_cast<double>(c.z) * area;
+        // |n2| = 2A, so summing n2 is already area-weighted
+        a.nx += n2.x;
+        a.ny += n2.y;
+        a.nz += n2.z;
+        a.count += 1;
+    }
+    
+    std::vector<SurfacePatch> patches;
+    patches.reserve(accum.size());
+    for (const Accum& a : accum) {
+        SurfacePatch patch;
+        patch.area_m2 = static_cast<float>(a.area);
+        patch.centroid = {static_cast<float>(a.cx / a.area),
+                          static_cast<float>(a.cy / a.area),
+                          static_cast<float>(a.cz / a.area)};
+        const double nlen = std::sqrt(a.nx * a.nx + a.ny * a.ny + a.nz * a.nz);
+        if (nlen > 0.0) {
+            patch.normal = {static_cast<float>(a.nx / nlen),
+                            static_cast<float>(a.ny / nlen),
+                            static_cast<float>(a.nz / nlen)};
+        } else {
+            patch.normal = {0.0f, 0.0f, 1.0f};
+        }
+        patch.triangle_count = a.count;
+        patches.push_back(patch);
+    }
+    return patches;
+}
+
+// ============================================================================
+// MODEL POPULATION
+// ============================================================================
+
+int SurfaceMesh::populateModels(const std::vector<SurfacePatch>& patches,
+                                const FlammableSurface& material,
+                                const Surface& radiative,
+                                FlameSpreadModel* flame_model,
+                                RadiationModel* radiation_model) {
+    if (flame_model && radiation_model &&
+        flame_model->getNumSurfaces() != radiation_model->getNumSurfaces()) {
+        throw std::invalid_argument("Flame and radiation models must have matching surface counts");
+    }
+    
+    int first_id = -1;
+    if (flame_model) {
+        first_id = flame_model->getNumSurfaces();
+    } else if (radiation_model) {
+        first_id = radiation_model->getNumSurfaces();
+    }
+    
+    for (const SurfacePatch& patch : patches) {
+        int flame_id = -1;
+        int rad_id = -1;
+        
+        if (flame_model) {
+            FlammableSurface s = material;
+            s.x_m = patch.centroid.x;
+            s.y_m = patch.centroid.y;
+            s.z_m = patch.centroid.z;
+            // Fuel scales with area; material values are per square metre
+            s.area_m2 = patch.area_m2;
+            s.fuel_load_kg = material.fuel_load_kg * patch.area_m2;
+            s.initial_fuel_load_kg = material.initial_fuel_load_kg * patch.area_m2;
+            s.mass_loss_rate_kg_s = material.mass_loss_rate_kg_s * patch.area_m2;
+            flame_id = flame_model->addSurface(s);
+        }
+        if (radiation_model) {
+            Surface s = radiative;
+            s.area_m2 = patch.area_m2;
+            rad_id = radiation_model->addSurface(s);
+        }
+        
+        if (flame_model && radiation_model && flame_id != rad_id) {
+            throw std::logic_error("Surface ID mismatch between flame and radiation models");
+        }
+    }
+    
+    return first_id;
+}
+
+} // namespace vfep
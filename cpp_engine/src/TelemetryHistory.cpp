@@ -0,0 +1,270 @@
+/**
+ * @file TelemetryHistory.cpp
+ * @brief Hot ring, tier chunking and min/max/mean decimation
+ */
+
+#include "TelemetryHistory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace vfep {
+
+namespace {
+
+uint32_t floatBits(float f) {
+    uint32_t b;
+    std::memcpy(&b, &f, sizeof(b));
+    return b;
+}
+
+float bitsFloat(uint32_t b) {
+    float f;
+    std::memcpy(&f, &b, sizeof(f));
+    return f;
+}
+
+} // namespace
+
+TelemetryHistory::TelemetryHistory(RecordingSchema schema, TelemetryHistoryConfig cfg)
+    : schema_(schema), cfg_(cfg) {
+    if (schema != RecordingSchema::TelemetryV1 && schema != RecordingSchema::TelemetryV2) {
+        throw std::invalid_argument("TelemetryHistory: schema must be TelemetryV1 or TelemetryV2");
+    }
+    if (cfg.hot_rows == 0 || cfg.chunk_rows == 0 || cfg.full_rate_chunks == 0 || cfg.decimated_chunks == 0) {
+        throw std::invalid_argument("TelemetryHistory: ring, chunk and budget sizes must be > 0");
+    }
+    for (const auto& c : recordingColumns(schema)) is_u32_.push_back(c.type == RecordingColumnType::U32);
+    words_ = is_u32_.size();
+
+    tiers_[0].words = words_;
+    tiers_[0].budget = cfg.full_rate_chunks;
+    tiers_[1].words = 3 * words_;
+    tiers_[1].budget = cfg.decimated_chunks;
+    tiers_[2].words = 3 * words_;
+    tiers_[2].budget = 0;
+}
+
+void TelemetryHistory::clear() {
+    hot_head_ = 0;
+    hot_count_ = 0;
+    total_rows_ = 0;
+    for (auto& t : tiers_) {
+        t.open.clear();
+        t.open.shrink_to_fit();
+        t.open_rows = 0;
+        t.chunks.clear();
+        t.packed_rows = 0;
+    }
+    acc1_ = {};
+    acc2_ = {};
+}
+
+size_t TelemetryHistory::fullRateRows() const {
+    return tiers_[0].packed_rows + tiers_[0].open_rows + hot_count_;
+}
+
+void TelemetryHistory::checkRowBytes(size_t bytes) const {
+    if (bytes != words_ * sizeof(uint32_t)) {
+        throw std::invalid_argument("TelemetryHistory: sample type does not match the schema");
+    }
+}
+
+// ============================================================================
+// Push / spill
+// ============================================================================
+
+void TelemetryHistory::pushRow(const void* row, size_t bytes) {
+    checkRowBytes(bytes);
+    if (hot_.empty()) hot_.resize(cfg_.hot_rows * words_);
+
+    uint32_t* slot = hot_.data() + hot_head_ * words_;
+    if (hot_count_ == cfg_.hot_rows) {
+        evict(slot);  // Oldest sample leaves the ring
+    } else {
+        ++hot_count_;
+    }
+    std::memcpy(slot, row, bytes);
+    hot_head_ = (hot_head_ + 1) % cfg_.hot_rows;
+    ++total_rows_;
+}
+
+float TelemetryHistory::valueOf(uint32_t word, size_t column) const {
+    return is_u32_[column] ? static_cast<float>(word) : bitsFloat(word);
+}
+
+void TelemetryHistory::evict(const uint32_t* row) {
+    append(tiers_[0], row);
+
+    values_.resize(3 * words_);
+    float* v = values_.data();
+    for (size_t c = 0; c < words_; ++c) v[c] = valueOf(row[c], c);
+    accumulate(acc1_, v, v, v, 1);
+    if (acc1_.rows < kDecimation) return;
+
+    emit(acc1_, scratch_);
+    append(tiers_[1], scratch_.data());
+
+    // The summary just written feeds the 100x tier
+    for (size_t i = 0; i < 3 * words_; ++i) v[i] = bitsFloat(scratch_[i]);
+    accumulate(acc2_, v, v + words_, v + 2 * words_, static_cast<uint32_t>(kDecimation));
+    if (acc2_.rows < kDecimation * kDecimation) return;
+
+    emit(acc2_, scratch_);
+    append(tiers_[2], scratch_.data());
+}
+
+void TelemetryHistory::accumulate(Accumulator& acc, const float* min, const float* max, const float* mean,
+                                  uint32_t rows) {
+    if (acc.rows == 0) {
+        acc.min.assign(min, min + words_);
+        acc.max.assign(max, max + words_);
+        acc.sum.assign(words_, 0.0);
+    } else {
+        for (size_t c = 0; c < words_; ++c) {
+            acc.min[c] = std::min(acc.min[c], min[c]);
+            acc.max[c] = std::max(acc.max[c], max[c]);
+        }
+    }
+    for (size_t c = 0; c < words_; ++c) acc.sum[c] += static_cast<double>(mean[c]) * rows;
+    acc.rows += rows;
+}
+
+void TelemetryHistory::emit(Accumulator& acc, std::vector<uint32_t>& row) {
+    row.resize(3 * words_);
+    for (size_t c = 0; c < words_; ++c) {
+        row[c] = floatBits(acc.min[c]);
+        row[words_ + c] = floatBits(acc.max[c]);
+        row[2 * words_ + c] = floatBits(static_cast<float>(acc.sum[c] / acc.rows));
+    }
+    acc.rows = 0;
+}
+
+void TelemetryHistory::append(Tier& tier, const uint32_t* row) {
+    // Grows on demand: the decimated tiers fill 10x / 100x slower than tier 0
+    tier.open.insert(tier.open.end(), row, row + tier.words);
+    if (++tier.open_rows == cfg_.chunk_rows) pack(tier);
+}
+
+void TelemetryHistory::pack(Tier& tier) {
+    Packed p;
+    p.rows = static_cast<uint32_t>(tier.open_rows);
+    std::vector<uint64_t> column(tier.open_rows);
+    for (size_t c = 0; c < tier.words; ++c) {
+        for (size_t r = 0; r < tier.open_rows; ++r) column[r] = tier.open[r * tier.words + c];
+        encodeRecordingColumn(column.data(), tier.open_rows, sizeof(uint32_t), p.bytes);
+    }
+    p.bytes.shrink_to_fit();
+
+    tier.packed_rows += p.rows;
+    tier.chunks.push_back(std::move(p));
+    tier.open.clear();
+    tier.open_rows = 0;
+    if (tier.budget != 0 && tier.chunks.size() > tier.budget) {
+        tier.packed_rows -= tier.chunks.front().rows;
+        tier.chunks.pop_front();
+    }
+}
+
+bool TelemetryHistory::unpack(const Tier& tier, const Packed& chunk, std::vector<uint32_t>& rows) const {
+    rows.resize(static_cast<size_t>(chunk.rows) * tier.words);
+    std::vector<uint64_t> column(chunk.rows);
+    size_t pos = 0;
+    for (size_t c = 0; c < tier.words; ++c) {
+        if (!decodeRecordingColumn(chunk.bytes.data(), chunk.bytes.size(), pos, chunk.rows, sizeof(uint32_t),
+                                   column.data())) {
+            return false;
+        }
+        for (size_t r = 0; r < chunk.rows; ++r) rows[r * tier.words + c] = static_cast<uint32_t>(column[r]);
+    }
+    return pos == chunk.bytes.size();
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+size_t TelemetryHistory::copyRows(size_t first, size_t count, void* out) const {
+    const size_t full = fullRateRows();
+    if (first >= full) return 0;
+    count = std::min(count, full - first);
+    const size_t row_bytes = words_ * sizeof(uint32_t);
+    auto* dst = static_cast<uint8_t*>(out);
+
+    size_t index = first;  // Next row to copy
+    const size_t end = first + count;
+    size_t base = 0;       // Index of the first row of the current segment
+    auto take = [&](const uint32_t* rows, size_t n) {
+        if (index < end && index < base + n) {
+            const size_t k = std::min(end, base + n) - index;
+            std::memcpy(dst, rows + (index - base) * words_, k * row_bytes);
+            dst += k * row_bytes;
+            index += k;
+        }
+        base += n;
+    };
+
+    const Tier& t0 = tiers_[0];
+    std::vector<uint32_t> rows;
+    for (const auto& chunk : t0.chunks) {
+        if (index < base + chunk.rows && index < end) {
+            // A chunk that fails to decode ends the copy: the rows after it
+            // would land at the wrong index
+            if (!unpack(t0, chunk, rows)) return index - first;
+            take(rows.data(), chunk.rows);
+        } else {
+            base += chunk.rows;
+        }
+    }
+    take(t0.open.data(), t0.open_rows);
+
+    const size_t oldest = (hot_head_ + cfg_.hot_rows - hot_count_) % cfg_.hot_rows;
+    for (size_t i = 0; i < hot_count_; ++i) {
+        take(hot_.data() + ((oldest + i) % cfg_.hot_rows) * words_, 1);
+    }
+    return index - first;
+}
+
+bool TelemetryHistory::summaries(int tier, std::vector<TelemetrySummary>& out) const {
+    if (tier != 1 && tier != 2) return false;
+    const Tier& t = tiers_[tier];
+    const uint32_t rows_per = static_cast<uint32_t>(tier == 1 ? kDecimation : kDecimation * kDecimation);
+
+    auto add = [&](const uint32_t* rows, size_t n) {
+        for (size_t r = 0; r < n; ++r) {
+            const uint32_t* row = rows + r * t.words;
+            TelemetrySummary s;
+            s.rows = rows_per;
+            s.min.resize(words_);
+            s.max.resize(words_);
+            s.mean.resize(words_);
+            for (size_t c = 0; c < words_; ++c) {
+                s.min[c] = bitsFloat(row[c]);
+                s.max[c] = bitsFloat(row[words_ + c]);
+                s.mean[c] = bitsFloat(row[2 * words_ + c]);
+            }
+            out.push_back(std::move(s));
+        }
+    };
+
+    std::vector<uint32_t> rows;
+    for (const auto& chunk : t.chunks) {
+        if (!unpack(t, chunk, rows)) return false;
+        add(rows.data(), chunk.rows);
+    }
+    add(t.open.data(), t.open_rows);
+    return true;
+}
+
+size_t TelemetryHistory::memoryBytes() const {
+    size_t bytes = hot_.capacity() * sizeof(uint32_t) + scratch_.capacity() * sizeof(uint32_t) +
+                   values_.capacity() * sizeof(float);
+    for (const auto& t : tiers_) {
+        bytes += t.open.capacity() * sizeof(uint32_t);
+        for (const auto& c : t.chunks) bytes += c.bytes.capacity() + sizeof(Packed);
+    }
+    return bytes;
+}
+
+} // namespace vfep
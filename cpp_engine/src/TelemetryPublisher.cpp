@@ -0,0 +1,373 @@
+#include "TelemetryPublisher.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace vfep {
+namespace telemetry {
+
+namespace {
+
+// Field comparisons cover what the V1 telemetry messages carry; traceability
+// fields (last_command_*) are not streamed and do not make an entity dirty.
+bool same(const obj::RackTelemetry& a, const obj::RackTelemetry& b) {
+    return a.is_on_fire == b.is_on_fire && a.surface_temp_C == b.surface_temp_C &&
+           a.risk_to_assets_pct == b.risk_to_assets_pct;
+}
+
+bool same(const obj::TankTelemetry& a, const obj::TankTelemetry& b) {
+    return a.current_pressure_bar == b.current_pressure_bar && a.regulator_bar == b.regulator_bar &&
+           a.remaining_agent_mass_kg == b.remaining_agent_mass_kg &&
+           a.current_flow_kg_s == b.current_flow_kg_s && a.is_depleted == b.is_depleted &&
+           a.valve_state == b.valve_state;
+}
+
+bool same(const obj::ArmTelemetry& a, const obj::ArmTelemetry& b) {
+    return a.state == b.state && a.s_0_1 == b.s_0_1 && a.v_s_0_1_per_s == b.v_s_0_1_per_s &&
+           a.target_s_0_1 == b.target_s_0_1 && a.has_target == b.has_target &&
+           a.interlock_active == b.interlock_active && a.fault_code == b.fault_code;
+}
+
+bool same(const obj::NozzleTelemetry& a, const obj::NozzleTelemetry& b) {
+    return a.clogged == b.clogged && a.pan_deg == b.pan_deg && a.tilt_deg == b.tilt_deg &&
+           a.target_pan_deg == b.target_pan_deg && a.target_tilt_deg == b.target_tilt_deg &&
+           a.has_target == b.has_target;
+}
+
+bool same(const obj::InterlockStatus& a, const obj::InterlockStatus& b) {
+    return a.vfep_id == b.vfep_id && a.allow_arm == b.allow_arm && a.allow_suppress == b.allow_suppress &&
+           a.reasons == b.reasons && a.updated_ms == b.updated_ms;
+}
+
+bool same(const obj::Incident& a, const obj::Incident& b) {
+    return a.room_id == b.room_id && a.rack_id == b.rack_id && a.state == b.state &&
+           a.started_at_s == b.started_at_s && a.resolved_at_s == b.resolved_at_s && a.tags == b.tags;
+}
+
+bool same(const obj::Alert& a, const obj::Alert& b) {
+    return a.room_id == b.room_id && a.rack_id == b.rack_id && a.severity == b.severity &&
+           a.code == b.code && a.message == b.message && a.created_ms == b.created_ms &&
+           a.acknowledged == b.acknowledged;
+}
+
+bool same(const VFEPOrchestration& a, const VFEPOrchestration& b) {
+    return a.status == b.status && a.selected_rack_id == b.selected_rack_id &&
+           a.selected_hotspot_u == b.selected_hotspot_u && a.suppression_active == b.suppression_active;
+}
+
+// Merge-walk two handle-sorted arrays
+template <class T>
+void diffKind(const std::vector<Handled<T>>* base, const std::vector<Handled<T>>& cur,
+              std::vector<std::uint32_t>& changed, std::vector<std::uint32_t>& removed) {
+    if (!base) {
+        changed.resize(cur.size());
+        for (std::uint32_t i = 0; i < cur.size(); ++i) changed[i] = i;
+        return;
+    }
+    std::size_t b = 0;
+    for (std::uint32_t i = 0; i < cur.size(); ++i) {
+        const std::uint32_t h = cur[i].handle;
+        while (b < base->size() && (*base)[b].handle < h) {
+            removed.push_back((*base)[b].handle);
+            ++b;
+        }
+        if (b < base->size() && (*base)[b].handle == h) {
+            if (!same((*base)[b].value, cur[i].value)) changed.push_back(i);
+            ++b;
+        } else {
+            changed.push_back(i);
+        }
+    }
+    for (; b < base->size(); ++b) {
+        removed.push_back((*base)[b].handle);
+    }
+}
+
+template <class T, class Map>
+void collect(TelemetryPublisher& pub, const Map& map, std::vector<Handled<T>>& out) {
+    out.reserve(map.size());
+    for (const auto& [id, value] : map) {
+        out.push_back(Handled<T>{pub.handleFor(id), value});
+    }
+    std::sort(out.begin(), out.end(),
+              [](const Handled<T>& a, const Handled<T>& b) { return a.handle < b.handle; });
+}
+
+} // namespace
+
+// ============================================================================
+// Snapshots & deltas
+// ============================================================================
+
+std::size_t TelemetrySnapshot::entityCount(EntityKind kind) const {
+    switch (kind) {
+    case EntityKind::Rack: return racks.size();
+    case EntityKind::Tank: return tanks.size();
+    case EntityKind::Arm: return arms.size();
+    case EntityKind::Nozzle: return nozzles.size();
+    case EntityKind::Interlock: return interlocks.size();
+    case EntityKind::Incident: return incidents.size();
+    case EntityKind::Alert: return alerts.size();
+    case EntityKind::VFEP: return vfeps.size();
+    default: return 0;
+    }
+}
+
+std::size_t TelemetryDelta::changedCount() const {
+    std::size_t n = 0;
+    for (const auto& c : changed) n += c.size();
+    return n;
+}
+
+TelemetryDelta computeDelta(const TelemetrySnapshot* base, const TelemetrySnapshot& cur) {
+    TelemetryDelta d;
+    d.tick = cur.tick;
+    d.base_tick = base ? base->tick : 0;
+    d.first_new_handle = base ? base->handleCount() : 0;
+    d.end_new_handle = cur.handleCount();
+
+    auto idx = [](EntityKind k) { return static_cast<std::size_t>(k); };
+    diffKind(base ? &base->racks : nullptr, cur.racks, d.changed[idx(EntityKind::Rack)], d.removed_handles);
+    diffKind(base ? &base->tanks : nullptr, cur.tanks, d.changed[idx(EntityKind::Tank)], d.removed_handles);
+    diffKind(base ? &base->arms : nullptr, cur.arms, d.changed[idx(EntityKind::Arm)], d.removed_handles);
+    diffKind(base ? &base->nozzles : nullptr, cur.nozzles, d.changed[idx(EntityKind::Nozzle)], d.removed_handles);
+    diffKind(base ? &base->interlocks : nullptr, cur.interlocks, d.changed[idx(EntityKind::Interlock)], d.removed_handles);
+    diffKind(base ? &base->incidents : nullptr, cur.incidents, d.changed[idx(EntityKind::Incident)], d.removed_handles);
+    diffKind(base ? &base->alerts : nullptr, cur.alerts, d.changed[idx(EntityKind::Alert)], d.removed_handles);
+    diffKind(base ? &base->vfeps : nullptr, cur.vfeps, d.changed[idx(EntityKind::VFEP)], d.removed_handles);
+    return d;
+}
+
+// ============================================================================
+// Publication
+// ============================================================================
+
+TelemetryPublisher::TelemetryPublisher()
+    : ids_(std::make_shared<std::vector<std::string>>()) {}
+
+std::uint32_t TelemetryPublisher::handleFor(const std::string& id) {
+    auto it = handles_.find(id);
+    if (it != handles_.end()) return it->second;
+
+    if (ids_shared_) {
+        // Published snapshots keep the old table; extend a private copy
+        ids_ = std::make_shared<std::vector<std::string>>(*ids_);
+        ids_shared_ = false;
+    }
+    const auto h = static_cast<std::uint32_t>(ids_->size());
+    ids_->push_back(id);
+    handles_.emplace(id, h);
+    return h;
+}
+
+std::shared_ptr<const TelemetrySnapshot> TelemetryPublisher::publish(const obj::ObjectStore& store, double sim_time_s) {
+    auto snap = std::make_shared<TelemetrySnapshot>();
+    snap->tick = ++tick_;
+    snap->sim_time_s = sim_time_s;
+
+    collect(*this, store.rack_telemetry, snap->racks);
+    collect(*this, store.tank_telemetry, snap->tanks);
+    collect(*this, store.arm_telemetry, snap->arms);
+    collect(*this, store.nozzle_telemetry, snap->nozzles);
+    collect(*this, store.interlocks, snap->interlocks);
+    collect(*this, store.incidents, snap->incidents);
+    collect(*this, store.alerts, snap->alerts);
+
+    snap->vfeps.reserve(store.vfeps.size());
+    for (const auto& [id, v] : store.vfeps) {
+        snap->vfeps.push_back({handleFor(id), VFEPOrchestration{v.status, v.selected_rack_id,
+                                                                v.selected_hotspot_u, v.suppression_active}});
+    }
+    std::sort(snap->vfeps.begin(), snap->vfeps.end(),
+              [](const auto& a, const auto& b) { return a.handle < b.handle; });
+
+    snap->ids = ids_;
+    ids_shared_ = true;
+
+    std::shared_ptr<const TelemetrySnapshot> published = std::move(snap);
+    std::atomic_store_explicit(&latest_, published, std::memory_order_release);
+    {
+        // Empty critical section orders the store before any waiter's
+        // predicate check, so no wakeup is lost
+        std::lock_guard<std::mutex> lk(mu_);
+    }
+    cv_.notify_all();
+    return published;
+}
+
+std::shared_ptr<const TelemetrySnapshot> TelemetryPublisher::latest() const {
+    return std::atomic_load_explicit(&latest_, std::memory_order_acquire);
+}
+
+std::shared_ptr<const TelemetrySnapshot> TelemetryPublisher::waitForNewer(std::uint64_t after_tick, int timeout_ms) const {
+    std::unique_lock<std::mutex> lk(mu_);
+    cv_.wait_for(lk, std::chrono::milliseconds(std::max(0, timeout_ms)), [&]() {
+        const auto snap = latest();
+        return closed_ || (snap && snap->tick > after_tick);
+    });
+    return latest();
+}
+
+void TelemetryPublisher::close() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        closed_ = true;
+    }
+    cv_.notify_all();
+}
+
+bool TelemetryPublisher::closed() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return closed_;
+}
+
+// ============================================================================
+// Per-stream backpressure
+// ============================================================================
+
+StreamGate::StreamGate(double max_hz) {
+    if (max_hz > 0.0) {
+        min_interval_ = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / max_hz));
+    }
+}
+
+std::shared_ptr<const TelemetrySnapshot> StreamGate::release(Clock::time_point now) {
+    if (in_flight_ || !held_ || (sent_ > 0 && now - last_write_ < min_interval_)) {
+        return nullptr;
+    }
+    in_flight_ = true;
+    last_write_ = now;
+    ++sent_;
+    return std::move(held_);
+}
+
+std::shared_ptr<const TelemetrySnapshot> StreamGate::offer(std::shared_ptr<const TelemetrySnapshot> snap,
+                                                          Clock::time_point now) {
+    if (!snap || snap->tick <= last_tick_) return nullptr;  // Duplicate or stale
+    last_tick_ = snap->tick;
+    if (held_) ++dropped_;
+    held_ = std::move(snap);
+    return release(now);
+}
+
+std::shared_ptr<const TelemetrySnapshot> StreamGate::writeDone(Clock::time_point now) {
+    in_flight_ = false;
+    return release(now);
+}
+
+// ============================================================================
+// Fan-out
+// ============================================================================
+
+TelemetryFanout::TelemetryFanout(const TelemetryPublisher& publisher, bool own_thread)
+    : publisher_(publisher)
+    , last_tick_(publisher.latest() ? publisher.latest()->tick : 0) {
+    if (own_thread) {
+        thread_ = std::thread([this]() { run(); });
+    }
+}
+
+TelemetryFanout::~TelemetryFanout() {
+    stopping_.store(true);
+    stop();
+}
+
+std::uint64_t TelemetryFanout::subscribe(Callback cb) {
+    auto entry = std::make_shared<Entry>();
+    entry->fn = std::move(cb);
+    const auto latest = publisher_.latest();
+    entry->acked.store(latest ? latest->tick : 0);
+    std::lock_guard<std::mutex> lk(subs_mu_);
+    const std::uint64_t id = next_id_++;
+    subs_.emplace(id, std::move(entry));
+    return id;
+}
+
+void TelemetryFanout::unsubscribe(std::uint64_t id) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lk(subs_mu_);
+        auto it = subs_.find(id);
+        if (it == subs_.end()) return;
+        entry = std::move(it->second);
+        subs_.erase(it);
+    }
+    entry->active.store(false);
+    if (std::this_thread::get_id() != dispatching_.load()) {
+        // Wait out a dispatch that may already be inside the callback
+        std::lock_guard<std::mutex> lk(dispatch_mu_);
+    }
+}
+
+std::size_t TelemetryFanout::subscriberCount() const {
+    std::lock_guard<std::mutex> lk(subs_mu_);
+    return subs_.size();
+}
+
+void TelemetryFanout::ack(std::uint64_t id, std::uint64_t tick) {
+    std::lock_guard<std::mutex> lk(subs_mu_);
+    auto it = subs_.find(id);
+    if (it == subs_.end()) return;
+    std::atomic<std::uint64_t>& acked = it->second->acked;
+    if (tick > acked.load()) acked.store(tick);
+}
+
+bool TelemetryFanout::allAcked(std::uint64_t tick) const {
+    std::lock_guard<std::mutex> lk(subs_mu_);
+    for (const auto& [id, entry] : subs_) {
+        if (entry->acked.load() < tick) return false;
+    }
+    return true;
+}
+
+void TelemetryFanout::stop() {
+    if (thread_.joinable() && std::this_thread::get_id() != thread_.get_id()) {
+        thread_.join();
+    }
+}
+
+void TelemetryFanout::deliver() {
+    std::lock_guard<std::mutex> dispatch_lk(dispatch_mu_);
+    if (close_sent_) return;
+    if (publisher_.closed()) {
+        close_sent_ = true;
+        dispatch(nullptr);
+        return;
+    }
+    auto snap = publisher_.latest();
+    if (!snap || snap->tick <= last_tick_) return;
+    last_tick_ = snap->tick;
+    dispatch(snap);
+}
+
+void TelemetryFanout::dispatch(const std::shared_ptr<const TelemetrySnapshot>& snap) {
+    std::vector<std::shared_ptr<Entry>> targets;
+    {
+        std::lock_guard<std::mutex> lk(subs_mu_);
+        targets.reserve(subs_.size());
+        for (const auto& [id, entry] : subs_) targets.push_back(entry);
+    }
+    dispatching_.store(std::this_thread::get_id());
+    for (const auto& entry : targets) {
+        if (entry->active.load()) entry->fn(snap);
+    }
+    dispatching_.store(std::thread::id());
+}
+
+void TelemetryFanout::run() {
+    // Short waits so the destructor is not held up by an idle publisher
+    constexpr int kPollMs = 100;
+    while (!stopping_.load()) {
+        std::uint64_t after;
+        {
+            std::lock_guard<std::mutex> lk(dispatch_mu_);
+            if (close_sent_) return;
+            after = last_tick_;
+        }
+        publisher_.waitForNewer(after, kPollMs);
+        deliver();
+    }
+}
+
+} // namespace telemetry
+} // namespace vfep
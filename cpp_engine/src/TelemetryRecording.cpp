@@ -0,0 +1,765 @@
+/**
+ * @file TelemetryRecording.cpp
+ * @brief Binary telemetry recording: columnar chunk codecs, flush thread, mmap reader
+ */
+
+#include "TelemetryRecording.h"
+#include "Crc32.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+namespace vfep {
+
+namespace {
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+constexpr char kFileMagic[8] = {'V', 'F', 'E', 'P', 'R', 'E', 'C', '1'};
+constexpr char kTrailerMagic[8] = {'V', 'F', 'E', 'P', 'R', 'E', 'C', 'E'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrderMark = 0x01020304u;
+constexpr uint32_t kChunkMagic = 0x4B434656u;   // "VFCK"
+constexpr uint32_t kFooterMagic = 0x54464656u;  // "VFFT"
+
+// magic, rows, t_first, t_last, payload bytes, CRC
+constexpr size_t kChunkHeaderBytes = 4 + 4 + 8 + 8 + 4 + 4;
+constexpr size_t kChunkCrcBegin = 4;   // CRC covers rows .. payload bytes
+constexpr size_t kChunkCrcEnd = 28;    // and the payload
+constexpr size_t kFooterEntryBytes = 8 + 4 + 8 + 8;
+constexpr size_t kTrailerBytes = 8 + 8;
+
+enum Codec : uint8_t {
+    kRaw = 0,
+    kDelta = 1,       // zigzag varint of v - prev
+    kXor = 2,         // varint of v ^ prev
+    kXorSwapped = 3,  // varint of bswap(v ^ prev)
+};
+
+// ============================================================================
+// Schemas
+// ============================================================================
+
+struct ObservationField {
+    const char* name;
+    double Observation::* field;
+};
+
+const ObservationField kObservationFields[] = {
+    {"T_K", &Observation::T_K},
+    {"HRR_W", &Observation::HRR_W},
+    {"O2_volpct", &Observation::O2_volpct},
+    {"CO2_volpct", &Observation::CO2_volpct},
+    {"H2O_volpct", &Observation::H2O_volpct},
+    {"fuel_kg", &Observation::fuel_kg},
+    {"inhibitor_kgm3", &Observation::inhibitor_kgm3},
+    {"inert_kgm3", &Observation::inert_kgm3},
+    {"ACH", &Observation::ACH},
+    {"agent_mdot_kgps", &Observation::agent_mdot_kgps},
+    {"vfep_rpm", &Observation::vfep_rpm},
+    {"hit_efficiency_0_1", &Observation::hit_efficiency_0_1},
+    {"delivered_mdot_kgps", &Observation::delivered_mdot_kgps},
+    {"net_delivered_mdot_kgps", &Observation::net_delivered_mdot_kgps},
+    {"exposure_kg", &Observation::exposure_kg},
+    {"knockdown_0_1", &Observation::knockdown_0_1},
+    {"raw_HRR_W", &Observation::raw_HRR_W},
+    {"effective_HRR_W", &Observation::effective_HRR_W},
+    {"effective_exposure_kg", &Observation::effective_exposure_kg},
+    {"reward", &Observation::reward},
+};
+constexpr size_t kObservationFieldCount = sizeof(kObservationFields) / sizeof(kObservationFields[0]);
+
+struct SampleField {
+    const char* name;
+    RecordingColumnType type;
+    size_t offset;
+};
+
+#define CHEMSI_V2_FIELD(name, type) {#name, RecordingColumnType::type, offsetof(TelemetrySampleV2, name)}
+const SampleField kSampleV2Fields[] = {
+    CHEMSI_V2_FIELD(t_s, F32),
+    CHEMSI_V2_FIELD(raw_mdot_kgps, F32),
+    CHEMSI_V2_FIELD(net_mdot_kgps, F32),
+    CHEMSI_V2_FIELD(exposure_kg, F32),
+    CHEMSI_V2_FIELD(effective_exposure_kg, F32),
+    CHEMSI_V2_FIELD(KD_target_0_1, F32),
+    CHEMSI_V2_FIELD(KD_actual_0_1, F32),
+    CHEMSI_V2_FIELD(HRR_kW, F32),
+    CHEMSI_V2_FIELD(events_u32, U32),
+    CHEMSI_V2_FIELD(occ_avg_0_1, F32),
+    CHEMSI_V2_FIELD(occ_min_0_1, F32),
+    CHEMSI_V2_FIELD(loa_avg_0_1, F32),
+    CHEMSI_V2_FIELD(loa_min_0_1, F32),
+    CHEMSI_V2_FIELD(shield_avg_0_1, F32),
+    CHEMSI_V2_FIELD(shield_min_0_1, F32),
+    CHEMSI_V2_FIELD(blocked_sector_count_u32, U32),
+};
+#undef CHEMSI_V2_FIELD
+constexpr size_t kSampleV2FieldCount = sizeof(kSampleV2Fields) / sizeof(kSampleV2Fields[0]);
+
+#define CHEMSI_V1_FIELD(name) {#name, RecordingColumnType::F32, offsetof(TelemetrySampleV1, name)}
+const SampleField kSampleV1Fields[] = {
+    CHEMSI_V1_FIELD(t_s),
+    CHEMSI_V1_FIELD(raw_mdot_kgps),
+    CHEMSI_V1_FIELD(net_mdot_kgps),
+    CHEMSI_V1_FIELD(exposure_kg),
+    CHEMSI_V1_FIELD(effective_exposure_kg),
+    CHEMSI_V1_FIELD(KD_target_0_1),
+    CHEMSI_V1_FIELD(KD_actual_0_1),
+    CHEMSI_V1_FIELD(HRR_kW),
+};
+#undef CHEMSI_V1_FIELD
+
+// ============================================================================
+// Value bits and codecs
+// ============================================================================
+
+size_t widthOf(RecordingColumnType type) {
+    return type == RecordingColumnType::F64 ? 8 : 4;
+}
+
+uint64_t bitsOf(double v) {
+    uint64_t b;
+    std::memcpy(&b, &v, sizeof(b));
+    return b;
+}
+
+double valueOf(uint64_t bits, RecordingColumnType type) {
+    switch (type) {
+        case RecordingColumnType::F64: {
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            return d;
+        }
+        case RecordingColumnType::F32: {
+            const uint32_t b = static_cast<uint32_t>(bits);
+            float f;
+            std::memcpy(&f, &b, sizeof(f));
+            return f;
+        }
+        case RecordingColumnType::U32:
+            return static_cast<double>(static_cast<uint32_t>(bits));
+    }
+    return 0.0;
+}
+
+uint64_t byteSwap(uint64_t x, size_t width) {
+#if defined(__GNUC__) || defined(__clang__)
+    return width == 8 ? __builtin_bswap64(x) : __builtin_bswap32(static_cast<uint32_t>(x));
+#else
+    uint64_t r = 0;
+    for (size_t i = 0; i < width; ++i) {
+        r = (r << 8) | (x & 0xFFu);
+        x >>= 8;
+    }
+    return r;
+#endif
+}
+
+uint64_t forward(Codec codec, uint64_t v, uint64_t prev, size_t width) {
+    switch (codec) {
+        case kDelta: {
+            int64_t d = static_cast<int64_t>(v - prev);
+            if (width == 4) d = static_cast<int32_t>(static_cast<uint32_t>(d));
+            return (static_cast<uint64_t>(d) << 1) ^ static_cast<uint64_t>(d >> 63);
+        }
+        case kXor: return v ^ prev;
+        case kXorSwapped: return byteSwap(v ^ prev, width);
+        case kRaw: break;
+    }
+    return v;
+}
+
+uint64_t inverse(Codec codec, uint64_t u, uint64_t prev, size_t width) {
+    const uint64_t mask = width == 8 ? ~uint64_t{0} : 0xFFFFFFFFull;
+    switch (codec) {
+        case kDelta: {
+            const uint64_t d = (u >> 1) ^ (~(u & 1u) + 1u);
+            return (prev + d) & mask;
+        }
+        case kXor: return (u ^ prev) & mask;
+        case kXorSwapped: return (byteSwap(u, width) ^ prev) & mask;
+        case kRaw: break;
+    }
+    return u & mask;
+}
+
+size_t varintBytes(uint64_t u) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(64 - __builtin_clzll(u | 1u) + 6) / 7;
+#else
+    size_t n = 1;
+    while (u >= 0x80u) {
+        u >>= 7;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+uint8_t* putVarint(uint8_t* out, uint64_t u) {
+    while (u >= 0x80u) {
+        *out++ = static_cast<uint8_t>(u | 0x80u);
+        u >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(u);
+    return out;
+}
+
+template <typename T>
+void put(std::vector<uint8_t>& buf, T v) {
+    const size_t at = buf.size();
+    buf.resize(at + sizeof(T));
+    std::memcpy(buf.data() + at, &v, sizeof(T));
+}
+
+template <typename T>
+void patch(std::vector<uint8_t>& buf, size_t at, T v) {
+    std::memcpy(buf.data() + at, &v, sizeof(T));
+}
+
+// Bounds-checked cursor over mapped bytes
+struct Cursor {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    bool ok = true;
+
+    template <typename T>
+    T get() {
+        T v{};
+        if (!ok || size - pos < sizeof(T)) {
+            ok = false;
+            return v;
+        }
+        std::memcpy(&v, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return v;
+    }
+
+    uint64_t varint() {
+        uint64_t u = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= size) break;
+            const uint8_t b = data[pos++];
+            u |= static_cast<uint64_t>(b & 0x7Fu) << shift;
+            if ((b & 0x80u) == 0) return u;
+        }
+        ok = false;
+        return 0;
+    }
+};
+
+bool knownType(uint8_t t) {
+    return t >= static_cast<uint8_t>(RecordingColumnType::F32) && t <= static_cast<uint8_t>(RecordingColumnType::U32);
+}
+
+bool sameColumns(const std::vector<RecordingColumn>& a, const std::vector<RecordingColumn>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].type != b[i].type) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+const std::vector<RecordingColumn>& recordingColumns(RecordingSchema schema) {
+    static const std::vector<RecordingColumn> observation = [] {
+        std::vector<RecordingColumn> cols{{"t_s", RecordingColumnType::F64}};
+        for (const auto& f : kObservationFields) cols.push_back({f.name, RecordingColumnType::F64});
+        return cols;
+    }();
+    static const std::vector<RecordingColumn> sample_v2 = [] {
+        std::vector<RecordingColumn> cols;
+        for (const auto& f : kSampleV2Fields) cols.push_back({f.name, f.type});
+        return cols;
+    }();
+    static const std::vector<RecordingColumn> sample_v1 = [] {
+        std::vector<RecordingColumn> cols;
+        for (const auto& f : kSampleV1Fields) cols.push_back({f.name, f.type});
+        return cols;
+    }();
+    if (schema == RecordingSchema::TelemetryV2) return sample_v2;
+    if (schema == RecordingSchema::TelemetryV1) return sample_v1;
+    if (schema == RecordingSchema::Observation) return observation;
+    throw std::invalid_argument("recordingColumns: unknown schema");
+}
+
+// ============================================================================
+// Column codec
+// ============================================================================
+
+void encodeRecordingColumn(const uint64_t* v, size_t rows, size_t width, std::vector<uint8_t>& buf) {
+    // Pick the smallest codec for this column of this chunk
+    size_t bytes[4] = {rows * width, 0, 0, 0};
+    uint64_t prev = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        const uint64_t x = v[r] ^ prev;
+        bytes[kDelta] += varintBytes(forward(kDelta, v[r], prev, width));
+        bytes[kXor] += varintBytes(x);
+        bytes[kXorSwapped] += varintBytes(byteSwap(x, width));
+        prev = v[r];
+    }
+    const Codec codec = static_cast<Codec>(std::min_element(bytes, bytes + 4) - bytes);
+
+    buf.push_back(codec);
+    put<uint32_t>(buf, static_cast<uint32_t>(bytes[codec]));
+    const size_t at = buf.size();
+    buf.resize(at + bytes[codec]);
+    uint8_t* out = buf.data() + at;
+    if (codec == kRaw) {
+        for (size_t r = 0; r < rows; ++r, out += width) {
+            std::memcpy(out, &v[r], width);  // Low bytes (little-endian)
+        }
+    } else {
+        prev = 0;
+        for (size_t r = 0; r < rows; ++r) {
+            out = putVarint(out, forward(codec, v[r], prev, width));
+            prev = v[r];
+        }
+    }
+}
+
+bool decodeRecordingColumn(const uint8_t* data, size_t size, size_t& pos, size_t rows, size_t width, uint64_t* out) {
+    Cursor body{data, size, pos};
+    const uint8_t codec = body.get<uint8_t>();
+    const uint32_t len = body.get<uint32_t>();
+    if (!body.ok || codec > kXorSwapped || body.size - body.pos < len) return false;
+    Cursor col{data, body.pos + len, body.pos};
+    uint64_t prev = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        uint64_t u = 0;
+        if (codec == kRaw) {
+            if (col.size - col.pos < width) return false;
+            std::memcpy(&u, col.data + col.pos, width);
+            col.pos += width;
+        } else {
+            u = col.varint();
+        }
+        prev = inverse(static_cast<Codec>(codec), u, prev, width);
+        out[r] = prev;
+    }
+    if (!col.ok || col.pos != col.size) return false;
+    pos = col.size;
+    return true;
+}
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+struct TelemetryRecorder::Chunk {
+    size_t rows = 0;
+    std::vector<uint64_t> bits;  // Column c at [c * rows_per_chunk, ...)
+};
+
+TelemetryRecorder::TelemetryRecorder(size_t rows_per_chunk, size_t max_pending_chunks)
+    : rows_per_chunk_(rows_per_chunk), max_pending_(max_pending_chunks) {
+    if (rows_per_chunk == 0 || rows_per_chunk > 0xFFFFFFFFu) {
+        throw std::invalid_argument("TelemetryRecorder: rows_per_chunk must be in [1, 2^32)");
+    }
+    if (max_pending_chunks == 0) {
+        throw std::invalid_argument("TelemetryRecorder: max_pending_chunks must be > 0");
+    }
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    close();
+}
+
+bool TelemetryRecorder::open(const std::string& path, RecordingSchema schema) {
+    if (isOpen() || schema == RecordingSchema::TelemetryV1) return false;
+    columns_ = recordingColumns(schema);
+    schema_ = schema;
+
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_) return false;
+
+    std::vector<uint8_t> header(kFileMagic, kFileMagic + sizeof(kFileMagic));
+    put<uint32_t>(header, kVersion);
+    put<uint32_t>(header, kByteOrderMark);
+    put<uint32_t>(header, static_cast<uint32_t>(schema));
+    put<uint32_t>(header, static_cast<uint32_t>(rows_per_chunk_));
+    put<uint32_t>(header, static_cast<uint32_t>(columns_.size()));
+    for (const auto& c : columns_) {
+        header.push_back(static_cast<uint8_t>(c.type));
+        header.push_back(static_cast<uint8_t>(c.name.size()));
+        header.insert(header.end(), c.name.begin(), c.name.end());
+    }
+    put<uint32_t>(header, crc32_update(0, header.data(), header.size()));
+
+    failed_ = false;
+    offset_ = 0;
+    index_.clear();
+    chunks_written_ = 0;
+    bytes_written_ = 0;
+    rows_appended_ = 0;
+    writeBytes(header.data(), header.size());
+    if (failed_) {
+        out_.close();
+        return false;
+    }
+
+    cur_ = std::make_unique<Chunk>();
+    cur_->bits.resize(rows_per_chunk_ * columns_.size());
+    closing_ = false;
+    thread_ = std::thread([this] { flushLoop(); });
+    return true;
+}
+
+void TelemetryRecorder::append(double t_s, const Observation& obs) {
+    if (!cur_) return;
+    if (schema_ != RecordingSchema::Observation) {
+        throw std::invalid_argument("TelemetryRecorder: Observation row in a sample recording");
+    }
+    uint64_t* row = cur_->bits.data() + cur_->rows;
+    row[0] = bitsOf(t_s);
+    for (size_t i = 0; i < kObservationFieldCount; ++i) {
+        row[(i + 1) * rows_per_chunk_] = bitsOf(obs.*kObservationFields[i].field);
+    }
+    ++rows_appended_;
+    if (++cur_->rows == rows_per_chunk_) handOff();
+}
+
+void TelemetryRecorder::append(const TelemetrySampleV2& sample) {
+    if (!cur_) return;
+    if (schema_ != RecordingSchema::TelemetryV2) {
+        throw std::invalid_argument("TelemetryRecorder: TelemetrySampleV2 row in an Observation recording");
+    }
+    uint64_t* row = cur_->bits.data() + cur_->rows;
+    const auto* src = reinterpret_cast<const unsigned char*>(&sample);
+    for (size_t i = 0; i < kSampleV2FieldCount; ++i) {
+        uint32_t b;  // f32 and u32 fields alike
+        std::memcpy(&b, src + kSampleV2Fields[i].offset, sizeof(b));
+        row[i * rows_per_chunk_] = b;
+    }
+    ++rows_appended_;
+    if (++cur_->rows == rows_per_chunk_) handOff();
+}
+
+void TelemetryRecorder::handOff() {
+    std::unique_ptr<Chunk> next;
+    {
+        std::unique_lock<std::mutex> lock(mu_);
+        space_cv_.wait(lock, [&] { return queue_.size() < max_pending_; });
+        queue_.push_back(std::move(cur_));
+        if (!free_.empty()) {
+            next = std::move(free_.back());
+            free_.pop_back();
+        }
+    }
+    work_cv_.notify_one();
+    if (!next) {
+        next = std::make_unique<Chunk>();
+        next->bits.resize(rows_per_chunk_ * columns_.size());
+    }
+    next->rows = 0;
+    cur_ = std::move(next);
+}
+
+bool TelemetryRecorder::close() {
+    if (!thread_.joinable()) return !failed_;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (cur_ && cur_->rows > 0) queue_.push_back(std::move(cur_));
+        closing_ = true;
+    }
+    work_cv_.notify_one();
+    thread_.join();
+
+    cur_.reset();
+    free_.clear();
+    return !failed_;
+}
+
+void TelemetryRecorder::flushLoop() {
+    std::vector<uint8_t> buf;
+    for (;;) {
+        std::unique_ptr<Chunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            work_cv_.wait(lock, [&] { return closing_ || !queue_.empty(); });
+            if (queue_.empty()) break;
+            chunk = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        space_cv_.notify_one();
+
+        writeChunk(*chunk, buf);
+
+        std::lock_guard<std::mutex> lock(mu_);
+        free_.push_back(std::move(chunk));
+    }
+
+    writeFooter();
+    out_.flush();
+    if (!out_) failed_ = true;
+    out_.close();
+}
+
+void TelemetryRecorder::writeChunk(const Chunk& chunk, std::vector<uint8_t>& buf) {
+    const size_t rows = chunk.rows;
+    buf.assign(kChunkHeaderBytes, 0);
+
+    for (size_t c = 0; c < columns_.size(); ++c) {
+        const uint64_t* v = chunk.bits.data() + c * rows_per_chunk_;
+        encodeRecordingColumn(v, rows, widthOf(columns_[c].type), buf);
+    }
+
+    const RecordingColumnType time_type = columns_[0].type;
+    const double t_first = valueOf(chunk.bits[0], time_type);
+    const double t_last = valueOf(chunk.bits[rows - 1], time_type);
+    const size_t payload = buf.size() - kChunkHeaderBytes;
+    patch<uint32_t>(buf, 0, kChunkMagic);
+    patch<uint32_t>(buf, 4, static_cast<uint32_t>(rows));
+    patch<double>(buf, 8, t_first);
+    patch<double>(buf, 16, t_last);
+    patch<uint32_t>(buf, 24, static_cast<uint32_t>(payload));
+    uint32_t crc = crc32_update(0, buf.data() + kChunkCrcBegin, kChunkCrcEnd - kChunkCrcBegin);
+    crc = crc32_update(crc, buf.data() + kChunkHeaderBytes, payload);
+    patch<uint32_t>(buf, 28, crc);
+
+    index_.push_back({offset_, static_cast<uint32_t>(rows), t_first, t_last});
+    writeBytes(buf.data(), buf.size());
+    chunks_written_.fetch_add(1);
+}
+
+void TelemetryRecorder::writeFooter() {
+    std::vector<uint8_t> buf;
+    const uint64_t footer_offset = offset_;
+    put<uint32_t>(buf, kFooterMagic);
+    put<uint32_t>(buf, static_cast<uint32_t>(index_.size()));
+    const size_t entries_begin = buf.size();
+    for (const auto& e : index_) {
+        put<uint64_t>(buf, e.offset);
+        put<uint32_t>(buf, e.rows);
+        put<double>(buf, e.t_first);
+        put<double>(buf, e.t_last);
+    }
+    put<uint32_t>(buf, crc32_update(0, buf.data() + entries_begin, buf.size() - entries_begin));
+    put<uint64_t>(buf, footer_offset);
+    buf.insert(buf.end(), kTrailerMagic, kTrailerMagic + sizeof(kTrailerMagic));
+    writeBytes(buf.data(), buf.size());
+}
+
+void TelemetryRecorder::writeBytes(const void* data, size_t n) {
+    out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(n));
+    if (!out_) failed_ = true;
+    offset_ += n;
+    bytes_written_.fetch_add(n);
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+void TelemetryRecordingReader::close() {
+    file_.close();
+    columns_.clear();
+    chunks_.clear();
+    rows_ = 0;
+    recovered_ = false;
+}
+
+bool TelemetryRecordingReader::open(const std::string& path) {
+    close();
+    if (!file_.open(path)) return false;
+
+    Cursor in{file_.data(), file_.size(), 0};
+    if (in.size < sizeof(kFileMagic) || std::memcmp(in.data, kFileMagic, sizeof(kFileMagic)) != 0) {
+        close();
+        return false;
+    }
+    in.pos = sizeof(kFileMagic);
+    const uint32_t version = in.get<uint32_t>();
+    const uint32_t bom = in.get<uint32_t>();
+    const uint32_t schema = in.get<uint32_t>();
+    in.get<uint32_t>();  // rows_per_chunk (informational)
+    const uint32_t ncols = in.get<uint32_t>();
+    bool ok = in.ok && version == kVersion && bom == kByteOrderMark && ncols > 0
+        && schema >= static_cast<uint32_t>(RecordingSchema::Observation)
+        && schema <= static_cast<uint32_t>(RecordingSchema::TelemetryV1);
+    for (uint32_t c = 0; ok && c < ncols; ++c) {
+        const uint8_t type = in.get<uint8_t>();
+        const uint8_t len = in.get<uint8_t>();
+        if (!in.ok || !knownType(type) || in.size - in.pos < len) {
+            ok = false;
+            break;
+        }
+        columns_.push_back({std::string(reinterpret_cast<const char*>(in.data + in.pos), len),
+                            static_cast<RecordingColumnType>(type)});
+        in.pos += len;
+    }
+    const size_t header_bytes = in.pos;
+    const uint32_t crc = in.get<uint32_t>();
+    if (!ok || !in.ok || crc != crc32_update(0, in.data, header_bytes)) {
+        close();
+        return false;
+    }
+    schema_ = static_cast<RecordingSchema>(schema);
+
+    if (!parseFooter(in.pos)) {
+        recovered_ = true;
+        scanChunks(in.pos);
+    }
+    for (const auto& c : chunks_) rows_ += c.rows;
+    return true;
+}
+
+bool TelemetryRecordingReader::parseFooter(size_t data_begin) {
+    const size_t size = file_.size();
+    if (size < data_begin + 8 + 4 + kTrailerBytes) return false;
+    const size_t trailer = size - kTrailerBytes;
+    if (std::memcmp(file_.data() + trailer + 8, kTrailerMagic, sizeof(kTrailerMagic)) != 0) return false;
+
+    Cursor in{file_.data(), size, trailer};
+    const uint64_t footer = in.get<uint64_t>();
+    if (footer < data_begin || footer > trailer - 12) return false;
+    in.pos = static_cast<size_t>(footer);
+    const uint32_t magic = in.get<uint32_t>();
+    const uint32_t count = in.get<uint32_t>();
+    const size_t entries_begin = in.pos;
+    if (magic != kFooterMagic || (trailer - 4 - entries_begin) != static_cast<size_t>(count) * kFooterEntryBytes) {
+        return false;
+    }
+    Cursor crc_in{file_.data(), size, trailer - 4};
+    if (crc_in.get<uint32_t>() != crc32_update(0, file_.data() + entries_begin, trailer - 4 - entries_begin)) {
+        return false;
+    }
+
+    std::vector<RecordingChunkInfo> chunks(count);
+    for (auto& c : chunks) {
+        c.offset = in.get<uint64_t>();
+        c.rows = in.get<uint32_t>();
+        c.t_first = in.get<double>();
+        c.t_last = in.get<double>();
+        if (c.offset < data_begin || c.offset + kChunkHeaderBytes > footer) return false;
+    }
+    chunks_ = std::move(chunks);
+    return true;
+}
+
+void TelemetryRecordingReader::scanChunks(size_t data_begin) {
+    const size_t size = file_.size();
+    size_t pos = data_begin;
+    while (size - pos >= kChunkHeaderBytes) {
+        Cursor in{file_.data(), size, pos};
+        const uint32_t magic = in.get<uint32_t>();
+        RecordingChunkInfo c;
+        c.offset = pos;
+        c.rows = in.get<uint32_t>();
+        c.t_first = in.get<double>();
+        c.t_last = in.get<double>();
+        const uint32_t payload = in.get<uint32_t>();
+        const uint32_t crc = in.get<uint32_t>();
+        if (magic != kChunkMagic || c.rows == 0 || size - in.pos < payload) break;
+        uint32_t actual = crc32_update(0, file_.data() + pos + kChunkCrcBegin, kChunkCrcEnd - kChunkCrcBegin);
+        actual = crc32_update(actual, file_.data() + in.pos, payload);
+        if (actual != crc) break;  // Torn write: keep what came before
+        chunks_.push_back(c);
+        pos = in.pos + payload;
+    }
+}
+
+double TelemetryRecordingReader::startTime() const {
+    return chunks_.empty() ? 0.0 : chunks_.front().t_first;
+}
+
+double TelemetryRecordingReader::endTime() const {
+    return chunks_.empty() ? 0.0 : chunks_.back().t_last;
+}
+
+size_t TelemetryRecordingReader::findChunk(double t_s) const {
+    const auto it = std::lower_bound(chunks_.begin(), chunks_.end(), t_s,
+                                     [](const RecordingChunkInfo& c, double t) { return c.t_last < t; });
+    return static_cast<size_t>(it - chunks_.begin());
+}
+
+bool TelemetryRecordingReader::readChunk(size_t i, RecordingChunkData& out) const {
+    if (i >= chunks_.size()) return false;
+    const RecordingChunkInfo& info = chunks_[i];
+    Cursor in{file_.data(), file_.size(), static_cast<size_t>(info.offset)};
+    const uint32_t magic = in.get<uint32_t>();
+    const uint32_t rows = in.get<uint32_t>();
+    in.pos += 16;  // t_first, t_last (from the index)
+    const uint32_t payload = in.get<uint32_t>();
+    const uint32_t crc = in.get<uint32_t>();
+    if (!in.ok || magic != kChunkMagic || rows != info.rows || in.size - in.pos < payload) return false;
+    uint32_t actual = crc32_update(0, file_.data() + info.offset + kChunkCrcBegin, kChunkCrcEnd - kChunkCrcBegin);
+    actual = crc32_update(actual, file_.data() + in.pos, payload);
+    if (actual != crc) return false;
+
+    out.rows = rows;
+    out.values.resize(columns_.size() * rows);
+    std::vector<uint64_t> bits(rows);
+    const size_t end = in.pos + payload;
+    size_t pos = in.pos;
+    for (size_t c = 0; c < columns_.size(); ++c) {
+        const RecordingColumnType type = columns_[c].type;
+        if (!decodeRecordingColumn(file_.data(), end, pos, rows, widthOf(type), bits.data())) return false;
+        double* dst = out.values.data() + c * rows;
+        for (size_t r = 0; r < rows; ++r) dst[r] = valueOf(bits[r], type);
+    }
+    return pos == end;
+}
+
+namespace {
+
+template <typename Row, typename Fill>
+bool readRows(const TelemetryRecordingReader& reader, double t0_s, double t1_s, std::vector<Row>& out, Fill fill) {
+    RecordingChunkData data;
+    for (size_t i = reader.findChunk(t0_s); i < reader.chunkCount() && reader.chunkInfo(i).t_first <= t1_s; ++i) {
+        if (!reader.readChunk(i, data)) return false;
+        const double* t = data.column(0);
+        for (size_t r = 0; r < data.rows; ++r) {
+            if (t[r] < t0_s || t[r] > t1_s) continue;
+            out.emplace_back();
+            fill(data, r, out.back());
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool TelemetryRecordingReader::readObservations(double t0_s, double t1_s,
+                                                std::vector<RecordedObservation>& out) const {
+    if (!isOpen() || schema_ != RecordingSchema::Observation
+        || !sameColumns(columns_, recordingColumns(RecordingSchema::Observation))) {
+        return false;
+    }
+    return readRows(*this, t0_s, t1_s, out, [](const RecordingChunkData& d, size_t r, RecordedObservation& o) {
+        o.t_s = d.column(0)[r];
+        for (size_t i = 0; i < kObservationFieldCount; ++i) {
+            o.obs.*kObservationFields[i].field = d.column(i + 1)[r];
+        }
+    });
+}
+
+bool TelemetryRecordingReader::readSamplesV2(double t0_s, double t1_s,
+                                             std::vector<TelemetrySampleV2>& out) const {
+    if (!isOpen() || schema_ != RecordingSchema::TelemetryV2
+        || !sameColumns(columns_, recordingColumns(RecordingSchema::TelemetryV2))) {
+        return false;
+    }
+    return readRows(*this, t0_s, t1_s, out, [](const RecordingChunkData& d, size_t r, TelemetrySampleV2& s) {
+        auto* dst = reinterpret_cast<unsigned char*>(&s);
+        for (size_t i = 0; i < kSampleV2FieldCount; ++i) {
+            const double v = d.column(i)[r];
+            if (kSampleV2Fields[i].type == RecordingColumnType::U32) {
+                const uint32_t u = static_cast<uint32_t>(v);
+                std::memcpy(dst + kSampleV2Fields[i].offset, &u, sizeof(u));
+            } else {
+                const float f = static_cast<float>(v);
+                std::memcpy(dst + kSampleV2Fields[i].offset, &f, sizeof(f));
+            }
+        }
+    });
+}
+
+} // namespace vfep
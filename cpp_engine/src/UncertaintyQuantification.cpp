@@ -1,8 +1,10 @@
 #include "UncertaintyQuantification.h"
 
-#include "Simulation.h"
+#include "GaussianProcess.h"
+#include "ScenarioBatch.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <numeric>
 #include <random>
@@ -32,6 +34,21 @@ int clampSamples(int samples) {
     return samples < 1 ? 1 : samples;
 }
 
+vfep::ScenarioParams toScenarioParams(const vfep::MonteCarloUQ::ScenarioConfig& scenario) {
+    vfep::ScenarioParams p;
+    p.dt_s = scenario.dt_s;
+    p.t_end_s = scenario.t_end_s;
+    p.ignite_at_s = scenario.ignite_at_s;
+    p.suppress_at_s = scenario.enable_suppression ? scenario.suppress_at_s : -1.0;
+    p.ach_1_per_h = scenario.ach_1_per_h;
+    p.pyrolysis_max_kgps = scenario.pyrolysis_max_kgps;
+    p.heat_release_J_per_mol = scenario.heat_release_J_per_mol;
+    p.volume_m3 = scenario.geometry.volume_m3;
+    p.area_m2 = scenario.geometry.area_m2;
+    p.h_W_m2K = scenario.geometry.h_W_m2K;
+    return p;
+}
+
 vfep::MonteCarloUQ::ScenarioGeometry scaleGeometryForVolume(
     const vfep::MonteCarloUQ::ScenarioGeometry& base,
     double volume_m3) {
@@ -58,57 +75,18 @@ void MonteCarloUQ::setRanges(const UQRanges& ranges) {
 }
 
 MonteCarloUQ::SampleMetrics MonteCarloUQ::runScenario(const ScenarioConfig& scenario) const {
-    vfep::Simulation sim;
-    sim.resetToDataCenterRackScenario();
-
-    if (scenario.ach_1_per_h > 0.0) {
-        sim.setVentilationACH(scenario.ach_1_per_h);
-    }
-    sim.setPyrolysisMax(scenario.pyrolysis_max_kgps);
-    if (scenario.heat_release_J_per_mol > 0.0) {
-        sim.setCombustionHeatRelease(scenario.heat_release_J_per_mol);
-    }
-    sim.setReactorGeometry(scenario.geometry.volume_m3,
-                           scenario.geometry.area_m2,
-                           scenario.geometry.h_W_m2K);
-    sim.setLiIonEnabled(false);
-
-    SampleMetrics m{};
-    double t = 0.0;
-    bool ignited = false;
-    bool suppressed = false;
-
-    while (t + scenario.dt_s <= scenario.t_end_s + 1e-12) {
-        const double t_prev = t;
-        const double t_next = t + scenario.dt_s;
-
-        if (!ignited && (t_prev < scenario.ignite_at_s && t_next >= scenario.ignite_at_s)) {
-            sim.commandIgniteOrIncreasePyrolysis();
-            sim.setPyrolysisRate(scenario.pyrolysis_max_kgps);
-            ignited = true;
-        }
-        if (scenario.enable_suppression && !suppressed &&
-            (t_prev < scenario.suppress_at_s && t_next >= scenario.suppress_at_s)) {
-            sim.commandStartSuppression();
-            sim.setAgentDeliveryRate(1.0);
-            sim.setKnockdown(0.55);
-            suppressed = true;
-        }
-
-        sim.step(scenario.dt_s);
-        t = t_next;
-
-        const auto o = sim.observe();
-        if (o.T_K > m.peak_T_K) {
-            m.peak_T_K = o.T_K;
-        }
-        if (o.HRR_W > m.peak_HRR_W) {
-            m.peak_HRR_W = o.HRR_W;
-            m.t_peak_HRR_s = t;
-        }
-    }
+    const auto m = vfep::runScenario(toScenarioParams(scenario));
+    return SampleMetrics{m.peak_T_K, m.peak_HRR_W, m.t_peak_HRR_s};
+}
 
-    return m;
+MonteCarloUQ::ScenarioConfig MonteCarloUQ::scenarioAt(const ScenarioConfig& base, const double* u) const {
+    auto lerp = [](const ParameterRange& r, double t) { return r.min + (r.max - r.min) * t; };
+    ScenarioConfig varied = base;
+    varied.heat_release_J_per_mol = lerp(ranges_.heat_release_J_per_mol, u[0]);
+    varied.geometry.h_W_m2K = lerp(ranges_.h_W_m2K, u[1]);
+    varied.geometry = scaleGeometryForVolume(varied.geometry, lerp(ranges_.volume_m3, u[2]));
+    varied.pyrolysis_max_kgps = lerp(ranges_.pyrolysis_max_kgps, u[3]);
+    return varied;
 }
 
 MonteCarloUQ::UQResult MonteCarloUQ::summarize(const std::vector<double>& values) const {
@@ -197,4 +175,168 @@ MonteCarloUQ::UQSummary MonteCarloUQ::runMonteCarlo(int num_samples) const {
     return runMonteCarlo(scenario_, num_samples);
 }
 
+MonteCarloUQ::AdaptiveUQSummary MonteCarloUQ::runAdaptiveMonteCarlo(const ScenarioConfig& scenario,
+                                                                    const AdaptiveOptions& options) const {
+    constexpr size_t kDim = 4;      // heat release, h, volume, pyrolysis
+    constexpr size_t kMetrics = 3;  // peak T, peak HRR, time to peak HRR
+    const int initial = std::max(2, options.initial_samples);
+    const int budget = std::max(initial, options.max_simulations);
+    const int batch = std::max(1, options.batch_size);
+    const size_t pop = static_cast<size_t>(clampSamples(options.population));
+    const bool threshold = options.flashover_T_K > 0.0;
+    std::mt19937 rng(options.seed);
+
+    // Population (where statistics are taken) and initial design, both LHS in the unit cube
+    auto lhsUnit = [&rng](size_t n) {
+        std::vector<double> pts(n * kDim);
+        for (size_t k = 0; k < kDim; ++k) {
+            const auto col = latinHypercubeSamples(0.0, 1.0, static_cast<int>(n), rng);
+            for (size_t i = 0; i < n; ++i) pts[i * kDim + k] = col[i];
+        }
+        return pts;
+    };
+    const std::vector<double> population = lhsUnit(pop);
+    std::vector<double> X = lhsUnit(static_cast<size_t>(initial));
+    std::array<std::vector<double>, kMetrics> Y;
+
+    auto simulate = [&](const std::vector<double>& pts) {
+        const size_t rows = pts.size() / kDim;
+        std::vector<double> params;
+        params.reserve(rows * kScenarioParamCount);
+        for (size_t i = 0; i < rows; ++i) {
+            const ScenarioParams p = toScenarioParams(scenarioAt(scenario, &pts[i * kDim]));
+            const double* d = reinterpret_cast<const double*>(&p);
+            params.insert(params.end(), d, d + kScenarioParamCount);
+        }
+        std::vector<double> metrics(rows * kScenarioMetricCount);
+        runScenarioBatch(params.data(), rows, kScenarioParamCount, metrics.data(), nullptr, 0, nullptr,
+                         static_cast<size_t>(std::max(0, options.threads)));
+        // Peak HRR and its timing are positive and right-skewed: model their logs
+        for (size_t i = 0; i < rows; ++i) {
+            const ScenarioMetrics& m = reinterpret_cast<const ScenarioMetrics*>(metrics.data())[i];
+            Y[0].push_back(m.peak_T_K);
+            Y[1].push_back(std::log(std::max(m.peak_HRR_W, 1e-9)));
+            Y[2].push_back(std::log(std::max(m.t_peak_HRR_s, 1e-9)));
+        }
+    };
+    simulate(X);
+
+    AdaptiveUQSummary result{};
+    std::array<GaussianProcess, kMetrics> gp;
+    std::array<std::vector<double>, kMetrics> mu, sd;
+    for (auto& v : mu) v.resize(pop);
+    for (auto& v : sd) v.resize(pop);
+
+    // Predictions of `models` over the population; returns the worst metric's
+    // population-mean std / spread
+    auto evaluate = [&](const std::array<GaussianProcess, kMetrics>& models) {
+        double worst = 0.0;
+        for (size_t k = 0; k < kMetrics; ++k) {
+            const double spread = std::sqrt(models[k].signalVariance());
+            double sum = 0.0;
+            for (size_t i = 0; i < pop; ++i) {
+                double var = 0.0;
+                models[k].predict(&population[i * kDim], mu[k][i], var);
+                sd[k][i] = std::sqrt(var);
+                sum += sd[k][i];
+            }
+            if (spread > 0.0) worst = std::max(worst, sum / static_cast<double>(pop) / spread);
+        }
+        return worst;
+    };
+    // AK-MCS learning function: |mean - threshold| / std; < 2 means the sign is uncertain
+    auto exceedanceU = [&](size_t i) {
+        return std::fabs(mu[0][i] - options.flashover_T_K) / std::max(sd[0][i], 1e-12);
+    };
+    auto uncertainCount = [&] {
+        size_t n = 0;
+        for (size_t i = 0; i < pop && threshold; ++i) n += exceedanceU(i) < 2.0 ? 1 : 0;
+        return n;
+    };
+
+    for (;;) {
+        for (size_t k = 0; k < kMetrics; ++k) gp[k].fit(X, kDim, Y[k]);
+        ++result.rounds;
+        result.mean_relative_std = evaluate(gp);
+        const int done = static_cast<int>(Y[0].size());
+        if (done >= budget || (result.mean_relative_std < options.std_tolerance && uncertainCount() == 0)) {
+            break;
+        }
+
+        // Choose the batch greedily; each pick is added to copies of the
+        // surrogates at its predicted value ("kriging believer"), which
+        // removes its variance so the next pick goes elsewhere
+        const int picks = std::min(batch, budget - done);
+        auto believer = gp;
+        std::vector<double> next;
+        std::vector<char> taken(pop, 0);
+        for (int b = 0; b < picks; ++b) {
+            if (b > 0) evaluate(believer);
+            size_t best = pop;
+            if (threshold && (b % 2 == 0)) {
+                double best_u = 2.0;
+                for (size_t i = 0; i < pop; ++i) {
+                    const double u = exceedanceU(i);
+                    if (!taken[i] && u < best_u) {
+                        best_u = u;
+                        best = i;
+                    }
+                }
+            }
+            if (best == pop) {
+                double best_rel = -1.0;
+                for (size_t i = 0; i < pop; ++i) {
+                    if (taken[i]) continue;
+                    double rel = 0.0;
+                    for (size_t k = 0; k < kMetrics; ++k) {
+                        const double spread = std::sqrt(believer[k].signalVariance());
+                        if (spread > 0.0) rel = std::max(rel, sd[k][i] / spread);
+                    }
+                    if (rel > best_rel) {
+                        best_rel = rel;
+                        best = i;
+                    }
+                }
+            }
+            taken[best] = 1;
+            const double* u = &population[best * kDim];
+            next.insert(next.end(), u, u + kDim);
+            for (size_t k = 0; k < kMetrics; ++k) believer[k].addPoint(u, mu[k][best]);
+        }
+        simulate(next);
+        X.insert(X.end(), next.begin(), next.end());
+    }
+
+    // The surrogate mean alone understates the spread of a metric it had to
+    // smooth, so each population value gets a draw of the fitted noise back
+    result.simulations = static_cast<int>(Y[0].size());
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::array<std::vector<double>, kMetrics> values;
+    for (size_t k = 0; k < kMetrics; ++k) {
+        const double noise_sd = std::sqrt(gp[k].noiseVariance());
+        values[k].resize(pop);
+        for (size_t i = 0; i < pop; ++i) {
+            const double v = mu[k][i] + noise_sd * noise(rng);
+            values[k][i] = k == 0 ? v : std::exp(v);
+        }
+    }
+    result.summary.peak_T_K = summarize(values[0]);
+    result.summary.peak_HRR_W = summarize(values[1]);
+    result.summary.t_peak_HRR_s = summarize(values[2]);
+    if (threshold) {
+        size_t over = 0;
+        for (size_t i = 0; i < pop; ++i) over += mu[0][i] > options.flashover_T_K ? 1 : 0;
+        result.flashover_probability = static_cast<double>(over) / static_cast<double>(pop);
+        result.flashover_uncertain_fraction = static_cast<double>(uncertainCount()) / static_cast<double>(pop);
+    }
+    result.loo_rmse_peak_T_K = gp[0].leaveOneOutRmse();
+    result.loo_rmse_log_peak_HRR = gp[1].leaveOneOutRmse();
+    result.loo_rmse_log_t_peak_HRR = gp[2].leaveOneOutRmse();
+    return result;
+}
+
+MonteCarloUQ::AdaptiveUQSummary MonteCarloUQ::runAdaptiveMonteCarlo(const AdaptiveOptions& options) const {
+    return runAdaptiveMonteCarlo(scenario_, options);
+}
+
 } // namespace vfep
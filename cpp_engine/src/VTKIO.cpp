@@ -0,0 +1,1099 @@
+/**
+ * @file VTKIO.cpp
+ * @brief Memory-mapped VTK readers (legacy ASCII/BINARY, XML) and writers
+ *
+ * Phase 8: CFD Interface - Field I/O
+ */
+
+#include "VTKIO.h"
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace vfep {
+
+namespace {
+
+constexpr size_t ASCII_TOKENS_PER_BLOCK = 1 << 16;   // Tokens parsed per worker block
+constexpr size_t MIN_ELEMENTS_PER_THREAD = 1 << 18;
+
+bool hostIsLittleEndian() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+template <typename T>
+T loadElement(const uint8_t* p, bool swap) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, p, sizeof(T));
+    if (swap) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    T v;
+    std::memcpy(&v, bytes, sizeof(T));
+    return v;
+}
+
+template <typename T, typename Out>
+void decodeComponent(const VTKFieldView& view, int component, Out* out) {
+    const size_t stride = sizeof(T) * static_cast<size_t>(view.num_components);
+    const uint8_t* base = view.data + sizeof(T) * static_cast<size_t>(component);
+    parallelFor(view.num_tuples, MIN_ELEMENTS_PER_THREAD, [&](size_t begin, size_t end) {
+        if (!view.swap_bytes) {
+            for (size_t i = begin; i < end; ++i) {
+                T v;
+                std::memcpy(&v, base + i * stride, sizeof(T));
+                out[i] = static_cast<Out>(v);
+            }
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = static_cast<Out>(loadElement<T>(base + i * stride, true));
+            }
+        }
+    });
+}
+
+template <typename Out>
+void decodeComponentAny(const VTKFieldView& view, int component, Out* out) {
+    switch (view.type) {
+        case VTKScalarType::Int8:    decodeComponent<int8_t>(view, component, out); break;
+        case VTKScalarType::UInt8:   decodeComponent<uint8_t>(view, component, out); break;
+        case VTKScalarType::Int16:   decodeComponent<int16_t>(view, component, out); break;
+        case VTKScalarType::UInt16:  decodeComponent<uint16_t>(view, component, out); break;
+        case VTKScalarType::Int32:   decodeComponent<int32_t>(view, component, out); break;
+        case VTKScalarType::UInt32:  decodeComponent<uint32_t>(view, component, out); break;
+        case VTKScalarType::Int64:   decodeComponent<int64_t>(view, component, out); break;
+        case VTKScalarType::UInt64:  decodeComponent<uint64_t>(view, component, out); break;
+        case VTKScalarType::Float32: decodeComponent<float>(view, component, out); break;
+        case VTKScalarType::Float64: decodeComponent<double>(view, component, out); break;
+        default: break;
+    }
+}
+
+bool iequals(const std::string& a, const char* b) {
+    const size_t n = std::strlen(b);
+    if (a.size() != n) return false;
+    for (size_t i = 0; i < n; ++i) {
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+const char* skipSpace(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) ++p;
+    return p;
+}
+
+VTKScalarType legacyType(const std::string& name) {
+    if (name == "char") return VTKScalarType::Int8;
+    if (name == "unsigned_char") return VTKScalarType::UInt8;
+    if (name == "short") return VTKScalarType::Int16;
+    if (name == "unsigned_short") return VTKScalarType::UInt16;
+    if (name == "int" || name == "vtkIdType") return VTKScalarType::Int32;
+    if (name == "unsigned_int") return VTKScalarType::UInt32;
+    if (name == "long" || name == "vtktypeint64") return VTKScalarType::Int64;
+    if (name == "unsigned_long" || name == "vtktypeuint64") return VTKScalarType::UInt64;
+    if (name == "float") return VTKScalarType::Float32;
+    if (name == "double") return VTKScalarType::Float64;
+    return VTKScalarType::Unknown;
+}
+
+VTKScalarType xmlType(const std::string& name) {
+    if (name == "Int8") return VTKScalarType::Int8;
+    if (name == "UInt8") return VTKScalarType::UInt8;
+    if (name == "Int16") return VTKScalarType::Int16;
+    if (name == "UInt16") return VTKScalarType::UInt16;
+    if (name == "Int32") return VTKScalarType::Int32;
+    if (name == "UInt32") return VTKScalarType::UInt32;
+    if (name == "Int64") return VTKScalarType::Int64;
+    if (name == "UInt64") return VTKScalarType::UInt64;
+    if (name == "Float32") return VTKScalarType::Float32;
+    if (name == "Float64") return VTKScalarType::Float64;
+    return VTKScalarType::Unknown;
+}
+
+bool fail(std::string* error, const std::string& msg) {
+    if (error) *error = msg;
+    return false;
+}
+
+// count * components * element size, false if it does not fit in size_t
+bool arrayBytes(size_t count, size_t components, VTKScalarType type, size_t& bytes) {
+    const size_t element = vtkScalarSize(type);
+    if (components != 0 && count > std::numeric_limits<size_t>::max() / components) return false;
+    const size_t values = count * components;
+    if (element != 0 && values > std::numeric_limits<size_t>::max() / element) return false;
+    bytes = values * element;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Legacy format
+// ----------------------------------------------------------------------------
+
+class LegacyParser {
+public:
+    LegacyParser(const char* begin, const char* end, VTKDataset& ds, std::string* error)
+        : p_(begin), end_(end), ds_(ds), error_(error) {}
+
+    bool parse();
+
+private:
+    const char* p_;
+    const char* end_;
+    VTKDataset& ds_;
+    std::string* error_;
+    bool binary_ = false;
+    int version_major_ = 3;
+
+    enum class Section { Geometry, Points, Cells };
+    Section section_ = Section::Geometry;
+    size_t section_count_ = 0;
+
+    bool nextToken(std::string& tok) {
+        p_ = skipSpace(p_, end_);
+        if (p_ >= end_) return false;
+        const char* s = p_;
+        while (p_ < end_ && !isSpace(*p_)) ++p_;
+        tok.assign(s, p_);
+        return true;
+    }
+
+    bool nextSize(size_t& v) {
+        std::string tok;
+        if (!nextToken(tok)) return false;
+        auto res = std::from_chars(tok.data(), tok.data() + tok.size(), v);
+        return res.ec == std::errc() && res.ptr == tok.data() + tok.size();
+    }
+
+    bool nextDouble(double& v) {
+        std::string tok;
+        if (!nextToken(tok)) return false;
+        auto res = std::from_chars(tok.data(), tok.data() + tok.size(), v);
+        return res.ec == std::errc();
+    }
+
+    std::string readLine() {
+        const char* s = p_;
+        while (p_ < end_ && *p_ != '\n') ++p_;
+        std::string line(s, p_);
+        if (p_ < end_) ++p_;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        return line;
+    }
+
+    // METADATA blocks run until the next empty line
+    void skipMetadata() {
+        readLine();
+        while (p_ < end_) {
+            std::string line = readLine();
+            if (line.find_first_not_of(" \t\r") == std::string::npos) break;
+        }
+    }
+
+    // Binary payloads start right after the header line's newline
+    void finishHeaderLine() {
+        while (p_ < end_ && *p_ != '\n') ++p_;
+        if (p_ < end_) ++p_;
+    }
+
+    bool readArray(size_t count, VTKScalarType type, int components, VTKFieldView* out,
+                   bool header_pending = true);
+    bool readAttribute(const std::string& keyword);
+    bool readFieldBlock();
+    bool readCellBlock(size_t n, size_t size);
+};
+
+bool LegacyParser::readArray(size_t count, VTKScalarType type, int components, VTKFieldView* out,
+                             bool header_pending) {
+    if (type == VTKScalarType::Unknown) {
+        return fail(error_, "unsupported VTK data type");
+    }
+    size_t bytes = 0;
+    if (!arrayBytes(count, static_cast<size_t>(components), VTKScalarType::Float64, bytes)) {
+        return fail(error_, "array size overflows");
+    }
+    const size_t num_values = count * static_cast<size_t>(components);
+
+    if (binary_) {
+        if (header_pending) {
+            finishHeaderLine();
+        }
+        bytes = num_values * vtkScalarSize(type);
+        if (static_cast<size_t>(end_ - p_) < bytes) {
+            return fail(error_, "binary array extends past end of file");
+        }
+        if (out) {
+            out->data = reinterpret_cast<const uint8_t*>(p_);
+            out->num_tuples = count;
+            out->num_components = components;
+            out->type = type;
+            out->swap_bytes = hostIsLittleEndian();  // Legacy binary is big-endian
+        }
+        p_ += bytes;
+        return true;
+    }
+
+    if (!out) {
+        // Skip without converting (connectivity, cell types, ...)
+        for (size_t i = 0; i < num_values; ++i) {
+            p_ = skipSpace(p_, end_);
+            if (p_ >= end_) return fail(error_, "ASCII array truncated");
+            while (p_ < end_ && !isSpace(*p_)) ++p_;
+        }
+        return true;
+    }
+
+    const VTKScalarType stored = (type == VTKScalarType::Float32) ? VTKScalarType::Float32
+                                                                  : VTKScalarType::Float64;
+    ds_.owned.emplace_back(num_values * vtkScalarSize(stored));
+    uint8_t* buffer = ds_.owned.back().data();
+    const char* next = VTKReader::parseAsciiNumbers(p_, end_, num_values, stored, buffer);
+    if (!next) {
+        return fail(error_, "failed to parse ASCII array");
+    }
+    p_ = next;
+    out->data = buffer;
+    out->num_tuples = count;
+    out->num_components = components;
+    out->type = stored;
+    out->swap_bytes = false;
+    return true;
+}
+
+bool LegacyParser::readAttribute(const std::string& keyword) {
+    std::map<std::string, VTKFieldView>& target =
+        (section_ == Section::Cells) ? ds_.cell_data : ds_.point_data;
+
+    std::string name, type_name;
+    if (!nextToken(name) || !nextToken(type_name)) {
+        return fail(error_, "truncated " + keyword + " header");
+    }
+
+    int components = 1;
+    if (keyword == "SCALARS") {
+        // SCALARS name type [numComp]
+        std::istringstream rest(readLine());
+        int n = 0;
+        if (rest >> n && n > 0) {
+            components = n;
+        }
+        // Optional LOOKUP_TABLE line; binary data begins right after it
+        const char* probe = binary_ ? p_ : skipSpace(p_, end_);
+        if (static_cast<size_t>(end_ - probe) >= 12 && std::memcmp(probe, "LOOKUP_TABLE", 12) == 0) {
+            p_ = probe;
+            readLine();
+        }
+        VTKFieldView view;
+        if (!readArray(section_count_, legacyType(type_name), components, &view, false)) {
+            return false;
+        }
+        target[name] = view;
+        return true;
+    }
+
+    if (keyword == "VECTORS" || keyword == "NORMALS") {
+        components = 3;
+    } else if (keyword == "TENSORS") {
+        components = 9;
+    } else if (keyword == "TEXTURE_COORDINATES") {
+        // TEXTURE_COORDINATES name dim type
+        components = std::atoi(type_name.c_str());
+        if (!nextToken(type_name) || components <= 0) {
+            return fail(error_, "malformed TEXTURE_COORDINATES header");
+        }
+    }
+
+    VTKFieldView view;
+    if (!readArray(section_count_, legacyType(type_name), components, &view)) {
+        return false;
+    }
+    target[name] = view;
+    return true;
+}
+
+bool LegacyParser::readFieldBlock() {
+    std::map<std::string, VTKFieldView>& target =
+        (section_ == Section::Cells) ? ds_.cell_data : ds_.point_data;
+
+    std::string field_name;
+    size_t num_arrays = 0;
+    if (!nextToken(field_name) || !nextSize(num_arrays)) {
+        return fail(error_, "malformed FIELD header");
+    }
+
+    size_t parsed = 0;
+    while (parsed < num_arrays) {
+        std::string name, type_name;
+        size_t components = 0, tuples = 0;
+        if (!nextToken(name)) return fail(error_, "truncated FIELD block");
+        if (name == "METADATA") {
+            skipMetadata();
+            continue;
+        }
+        ++parsed;
+        if (!nextSize(components) || !nextSize(tuples) || !nextToken(type_name)) {
+            return fail(error_, "malformed FIELD array header");
+        }
+        VTKFieldView view;
+        if (!readArray(tuples, legacyType(type_name), static_cast<int>(components), &view)) {
+            return false;
+        }
+        target[name] = view;
+    }
+    return true;
+}
+
+bool LegacyParser::readCellBlock(size_t n, size_t size) {
+    if (version_major_ >= 5) {
+        // 5.x: OFFSETS <type> (n values) + CONNECTIVITY <type> (size values)
+        std::string kw, type_name;
+        if (!nextToken(kw) || kw != "OFFSETS" || !nextToken(type_name)) {
+            return fail(error_, "expected OFFSETS in VTK 5 cell block");
+        }
+        if (!readArray(n, legacyType(type_name), 1, nullptr)) return false;
+        if (!nextToken(kw) || kw != "CONNECTIVITY" || !nextToken(type_name)) {
+            return fail(error_, "expected CONNECTIVITY in VTK 5 cell block");
+        }
+        return readArray(size, legacyType(type_name), 1, nullptr);
+    }
+    return readArray(size, VTKScalarType::Int32, 1, nullptr);
+}
+
+bool LegacyParser::parse() {
+    // Header: version line, title line, ASCII|BINARY
+    std::string version = readLine();
+    if (version.rfind("# vtk DataFile Version", 0) != 0) {
+        return fail(error_, "not a legacy VTK file");
+    }
+    {
+        const size_t pos = version.find_last_of(' ');
+        version_major_ = std::atoi(version.c_str() + pos + 1);
+    }
+    readLine();  // Title
+    std::string format;
+    if (!nextToken(format)) return fail(error_, "missing ASCII/BINARY line");
+    if (format == "BINARY") {
+        binary_ = true;
+    } else if (format != "ASCII") {
+        return fail(error_, "unknown legacy format " + format);
+    }
+    ds_.binary_source = binary_;
+
+    std::string kw;
+    while (nextToken(kw)) {
+        if (kw == "DATASET") {
+            std::string kind;
+            nextToken(kind);
+            if (kind == "STRUCTURED_POINTS") ds_.kind = VTKDataset::Kind::ImageData;
+            else if (kind == "RECTILINEAR_GRID") ds_.kind = VTKDataset::Kind::RectilinearGrid;
+            else if (kind == "STRUCTURED_GRID") ds_.kind = VTKDataset::Kind::StructuredGrid;
+            else if (kind == "UNSTRUCTURED_GRID" || kind == "POLYDATA") ds_.kind = VTKDataset::Kind::PointSet;
+            else return fail(error_, "unsupported DATASET " + kind);
+        } else if (kw == "DIMENSIONS") {
+            size_t d[3];
+            if (!nextSize(d[0]) || !nextSize(d[1]) || !nextSize(d[2])) return fail(error_, "bad DIMENSIONS");
+            for (int i = 0; i < 3; ++i) ds_.dims[i] = static_cast<int>(d[i]);
+        } else if (kw == "ORIGIN") {
+            if (!nextDouble(ds_.origin[0]) || !nextDouble(ds_.origin[1]) || !nextDouble(ds_.origin[2])) {
+                return fail(error_, "bad ORIGIN");
+            }
+        } else if (kw == "SPACING" || kw == "ASPECT_RATIO") {
+            if (!nextDouble(ds_.spacing[0]) || !nextDouble(ds_.spacing[1]) || !nextDouble(ds_.spacing[2])) {
+                return fail(error_, "bad SPACING");
+            }
+        } else if (kw == "POINTS") {
+            size_t n;
+            std::string type_name;
+            if (!nextSize(n) || !nextToken(type_name)) return fail(error_, "bad POINTS header");
+            if (!readArray(n, legacyType(type_name), 3, &ds_.points)) return false;
+        } else if (kw == "X_COORDINATES" || kw == "Y_COORDINATES" || kw == "Z_COORDINATES") {
+            size_t n;
+            std::string type_name;
+            if (!nextSize(n) || !nextToken(type_name)) return fail(error_, "bad " + kw + " header");
+            const int axis = kw[0] - 'X';
+            if (!readArray(n, legacyType(type_name), 1, &ds_.coords[axis])) return false;
+        } else if (kw == "CELLS" || kw == "VERTICES" || kw == "LINES" ||
+                   kw == "POLYGONS" || kw == "TRIANGLE_STRIPS") {
+            size_t n, size;
+            if (!nextSize(n) || !nextSize(size)) return fail(error_, "bad " + kw + " header");
+            if (!readCellBlock(n, size)) return false;
+        } else if (kw == "CELL_TYPES") {
+            size_t n;
+            if (!nextSize(n)) return fail(error_, "bad CELL_TYPES header");
+            if (!readArray(n, VTKScalarType::Int32, 1, nullptr)) return false;
+        } else if (kw == "POINT_DATA") {
+            if (!nextSize(section_count_)) return fail(error_, "bad POINT_DATA header");
+            section_ = Section::Points;
+        } else if (kw == "CELL_DATA") {
+            if (!nextSize(section_count_)) return fail(error_, "bad CELL_DATA header");
+            section_ = Section::Cells;
+        } else if (kw == "SCALARS" || kw == "VECTORS" || kw == "NORMALS" ||
+                   kw == "TENSORS" || kw == "TEXTURE_COORDINATES") {
+            if (section_ == Section::Geometry) return fail(error_, kw + " before POINT_DATA/CELL_DATA");
+            if (!readAttribute(kw)) return false;
+        } else if (kw == "FIELD") {
+            if (!readFieldBlock()) return false;
+        } else if (kw == "METADATA") {
+            skipMetadata();
+        } else {
+            return fail(error_, "unsupported legacy VTK keyword " + kw);
+        }
+    }
+
+    if (ds_.kind == VTKDataset::Kind::None) {
+        return fail(error_, "no DATASET section");
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// XML format
+// ----------------------------------------------------------------------------
+
+struct XmlTag {
+    std::string name;          // Without '/' for closing tags
+    bool closing = false;
+    bool self_closing = false;
+    std::map<std::string, std::string> attrs;
+    const char* content_begin = nullptr;  // Just past '>'
+};
+
+// Read the next tag starting at or after p. Returns false at end of input.
+bool nextXmlTag(const char*& p, const char* end, XmlTag& tag) {
+    while (p < end) {
+        const char* lt = static_cast<const char*>(std::memchr(p, '<', end - p));
+        if (!lt) return false;
+        p = lt + 1;
+        if (p < end && (*p == '?' || *p == '!')) {
+            const char* gt = static_cast<const char*>(std::memchr(p, '>', end - p));
+            if (!gt) return false;
+            p = gt + 1;
+            continue;  // Declaration or comment
+        }
+        break;
+    }
+    if (p >= end) return false;
+
+    tag = XmlTag();
+    if (*p == '/') {
+        tag.closing = true;
+        ++p;
+    }
+    const char* s = p;
+    while (p < end && !isSpace(*p) && *p != '>' && *p != '/') ++p;
+    tag.name.assign(s, p);
+
+    while (p < end) {
+        p = skipSpace(p, end);
+        if (p >= end) return false;
+        if (*p == '>') { ++p; break; }
+        if (*p == '/') {
+            tag.self_closing = true;
+            ++p;
+            continue;
+        }
+        const char* ks = p;
+        while (p < end && *p != '=' && !isSpace(*p) && *p != '>') ++p;
+        std::string key(ks, p);
+        p = skipSpace(p, end);
+        if (p < end && *p == '=') {
+            ++p;
+            p = skipSpace(p, end);
+            if (p < end && (*p == '"' || *p == '\'')) {
+                const char quote = *p++;
+                const char* vs = p;
+                while (p < end && *p != quote) ++p;
+                tag.attrs[key] = std::string(vs, p);
+                if (p < end) ++p;
+            }
+        }
+    }
+    tag.content_begin = p;
+    return true;
+}
+
+std::string attr(const XmlTag& tag, const char* key, const char* def = "") {
+    auto it = tag.attrs.find(key);
+    return it == tag.attrs.end() ? std::string(def) : it->second;
+}
+
+bool parseNumbers(const std::string& text, double* out, int n) {
+    std::istringstream iss(text);
+    for (int i = 0; i < n; ++i) {
+        if (!(iss >> out[i])) return false;
+    }
+    return true;
+}
+
+int base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+std::vector<uint8_t> base64Decode(const char* p, const char* end) {
+    std::vector<uint8_t> out;
+    out.reserve((end - p) * 3 / 4);
+    uint32_t acc = 0;
+    int bits = 0;
+    for (; p < end; ++p) {
+        const int v = base64Value(*p);
+        if (v < 0) continue;  // Whitespace / padding
+        acc = (acc << 6) | static_cast<uint32_t>(v);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back(static_cast<uint8_t>((acc >> bits) & 0xFF));
+        }
+    }
+    return out;
+}
+
+class XmlParser {
+public:
+    XmlParser(const char* begin, const char* end, VTKDataset& ds, std::string* error)
+        : begin_(begin), end_(end), ds_(ds), error_(error) {}
+
+    bool parse();
+
+private:
+    const char* begin_;
+    const char* end_;
+    VTKDataset& ds_;
+    std::string* error_;
+
+    bool swap_ = false;
+    size_t header_bytes_ = 4;
+    const char* appended_ = nullptr;    // First byte after '_'
+    size_t num_points_ = 0;
+
+    struct PendingArray {
+        VTKFieldView* target;
+        std::string name;
+        VTKScalarType type;
+        int components;
+        size_t tuples;
+        std::string format;
+        size_t offset;
+        const char* inline_begin;
+    };
+
+    bool resolve(const PendingArray& a);
+};
+
+bool XmlParser::resolve(const PendingArray& a) {
+    VTKFieldView& v = *a.target;
+    v.num_tuples = a.tuples;
+    v.num_components = a.components;
+    v.type = a.type;
+    size_t bytes = 0;
+    // Also bounds the Float64 copy made for ASCII arrays
+    if (!arrayBytes(a.tuples, static_cast<size_t>(a.components), VTKScalarType::Float64, bytes)) {
+        return fail(error_, "array '" + a.name + "' size overflows");
+    }
+    bytes = a.tuples * a.components * vtkScalarSize(a.type);
+
+    if (a.format == "appended") {
+        if (!appended_) return fail(error_, "missing AppendedData block");
+        const size_t available = static_cast<size_t>(end_ - appended_);
+        if (a.offset > available || available - a.offset < header_bytes_) {
+            return fail(error_, "appended offset out of range");
+        }
+        const char* block = appended_ + a.offset;
+        uint64_t nbytes = 0;
+        if (header_bytes_ == 8) {
+            nbytes = loadElement<uint64_t>(reinterpret_cast<const uint8_t*>(block), swap_);
+        } else {
+            nbytes = loadElement<uint32_t>(reinterpret_cast<const uint8_t*>(block), swap_);
+        }
+        if (nbytes < bytes || available - a.offset - header_bytes_ < bytes) {
+            return fail(error_, "appended array '" + a.name + "' is truncated");
+        }
+        v.data = reinterpret_cast<const uint8_t*>(block + header_bytes_);
+        v.swap_bytes = swap_;
+        return true;
+    }
+
+    if (a.format == "ascii") {
+        const VTKScalarType stored = (a.type == VTKScalarType::Float32) ? VTKScalarType::Float32
+                                                                        : VTKScalarType::Float64;
+        ds_.owned.emplace_back(a.tuples * a.components * vtkScalarSize(stored));
+        if (!VTKReader::parseAsciiNumbers(a.inline_begin, end_, a.tuples * a.components,
+                                          stored, ds_.owned.back().data())) {
+            return fail(error_, "failed to parse ASCII array '" + a.name + "'");
+        }
+        v.data = ds_.owned.back().data();
+        v.type = stored;
+        v.swap_bytes = false;
+        return true;
+    }
+
+    if (a.format == "binary") {
+        const char* close = a.inline_begin;
+        while (close < end_ && *close != '<') ++close;
+        std::vector<uint8_t> decoded = base64Decode(a.inline_begin, close);
+        if (decoded.size() < header_bytes_ + bytes) {
+            return fail(error_, "base64 array '" + a.name + "' is truncated");
+        }
+        decoded.erase(decoded.begin(), decoded.begin() + header_bytes_);
+        ds_.owned.push_back(std::move(decoded));
+        v.data = ds_.owned.back().data();
+        v.swap_bytes = swap_;
+        return true;
+    }
+
+    return fail(error_, "unsupported DataArray format '" + a.format + "'");
+}
+
+bool XmlParser::parse() {
+    const char* p = begin_;
+    XmlTag tag;
+
+    // Locate the raw appended block first so array offsets can be resolved
+    {
+        const char* scan = begin_;
+        const char* needle = "<AppendedData";
+        const size_t nlen = std::strlen(needle);
+        while (scan + nlen <= end_) {
+            const char* hit = static_cast<const char*>(std::memchr(scan, '<', end_ - scan));
+            if (!hit || hit + nlen > end_) break;
+            if (std::memcmp(hit, needle, nlen) == 0) {
+                const char* q = hit;
+                XmlTag app;
+                if (!nextXmlTag(q, end_, app)) break;
+                if (attr(app, "encoding", "raw") != "raw") {
+                    return fail(error_, "only raw AppendedData encoding is supported");
+                }
+                const char* us = static_cast<const char*>(std::memchr(q, '_', end_ - q));
+                if (!us) return fail(error_, "AppendedData missing '_' marker");
+                appended_ = us + 1;
+                break;
+            }
+            scan = hit + 1;
+        }
+    }
+
+    std::vector<PendingArray> pending;
+    enum class Block { None, PointData, CellData, Points, Coordinates };
+    Block block = Block::None;
+    int coord_axis = 0;
+
+    while (nextXmlTag(p, appended_ ? appended_ : end_, tag)) {
+        if (tag.name == "VTKFile" && !tag.closing) {
+            const std::string type = attr(tag, "type");
+            if (type == "ImageData") ds_.kind = VTKDataset::Kind::ImageData;
+            else if (type == "RectilinearGrid") ds_.kind = VTKDataset::Kind::RectilinearGrid;
+            else if (type == "StructuredGrid") ds_.kind = VTKDataset::Kind::StructuredGrid;
+            else if (type == "UnstructuredGrid" || type == "PolyData") ds_.kind = VTKDataset::Kind::PointSet;
+            else return fail(error_, "unsupported XML VTK type " + type);
+
+            if (!attr(tag, "compressor").empty()) {
+                return fail(error_, "compressed XML VTK files are not supported");
+            }
+            const bool file_little = attr(tag, "byte_order", "LittleEndian") == "LittleEndian";
+            swap_ = (file_little != hostIsLittleEndian());
+            header_bytes_ = (attr(tag, "header_type", "UInt32") == "UInt64") ? 8 : 4;
+            ds_.binary_source = true;
+        } else if ((tag.name == "ImageData" || tag.name == "RectilinearGrid" ||
+                    tag.name == "StructuredGrid") && !tag.closing) {
+            double ext[6];
+            if (!parseNumbers(attr(tag, "WholeExtent"), ext, 6)) {
+                return fail(error_, "missing WholeExtent");
+            }
+            for (int i = 0; i < 3; ++i) {
+                ds_.dims[i] = static_cast<int>(ext[2 * i + 1] - ext[2 * i]) + 1;
+            }
+            num_points_ = static_cast<size_t>(ds_.dims[0]) * ds_.dims[1] * ds_.dims[2];
+            if (tag.name == "ImageData") {
+                parseNumbers(attr(tag, "Origin", "0 0 0"), ds_.origin, 3);
+                parseNumbers(attr(tag, "Spacing", "1 1 1"), ds_.spacing, 3);
+                // Extents may start at non-zero indices
+                for (int i = 0; i < 3; ++i) ds_.origin[i] += ext[2 * i] * ds_.spacing[i];
+            }
+        } else if (tag.name == "Piece" && !tag.closing) {
+            const std::string npts = attr(tag, "NumberOfPoints");
+            if (!npts.empty()) num_points_ = std::strtoull(npts.c_str(), nullptr, 10);
+        } else if (tag.name == "PointData") {
+            block = tag.closing || tag.self_closing ? Block::None : Block::PointData;
+        } else if (tag.name == "CellData") {
+            block = tag.closing || tag.self_closing ? Block::None : Block::CellData;
+        } else if (tag.name == "Points") {
+            block = tag.closing || tag.self_closing ? Block::None : Block::Points;
+        } else if (tag.name == "Coordinates") {
+            block = tag.closing || tag.self_closing ? Block::None : Block::Coordinates;
+            coord_axis = 0;
+        } else if (tag.name == "Cells" || tag.name == "Verts" || tag.name == "Lines" ||
+                   tag.name == "Strips" || tag.name == "Polys") {
+            block = Block::None;  // Topology arrays are not needed
+        } else if (tag.name == "DataArray" && !tag.closing) {
+            PendingArray a;
+            a.name = attr(tag, "Name");
+            a.type = xmlType(attr(tag, "type"));
+            a.components = std::max(1, std::atoi(attr(tag, "NumberOfComponents", "1").c_str()));
+            a.format = attr(tag, "format", "ascii");
+            a.offset = std::strtoull(attr(tag, "offset", "0").c_str(), nullptr, 10);
+            a.inline_begin = tag.content_begin;
+            if (a.type == VTKScalarType::Unknown) {
+                return fail(error_, "unsupported DataArray type for '" + a.name + "'");
+            }
+
+            switch (block) {
+                case Block::PointData:
+                    a.tuples = num_points_;
+                    a.target = &ds_.point_data[a.name];
+                    break;
+                case Block::Points:
+                    a.tuples = num_points_;
+                    a.components = 3;
+                    a.target = &ds_.points;
+                    break;
+                case Block::Coordinates: {
+                    if (coord_axis > 2) return fail(error_, "too many coordinate arrays");
+                    a.tuples = static_cast<size_t>(ds_.dims[coord_axis]);
+                    a.target = &ds_.coords[coord_axis];
+                    ++coord_axis;
+                    break;
+                }
+                default:
+                    a.target = nullptr;  // Cell data / topology: skipped
+                    break;
+            }
+            if (a.target) pending.push_back(a);
+        }
+    }
+
+    if (ds_.kind == VTKDataset::Kind::None) {
+        return fail(error_, "missing VTKFile element");
+    }
+    for (const PendingArray& a : pending) {
+        if (!resolve(a)) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// FIELD VIEWS
+// ============================================================================
+
+size_t vtkScalarSize(VTKScalarType type) {
+    switch (type) {
+        case VTKScalarType::Int8:
+        case VTKScalarType::UInt8: return 1;
+        case VTKScalarType::Int16:
+        case VTKScalarType::UInt16: return 2;
+        case VTKScalarType::Int32:
+        case VTKScalarType::UInt32:
+        case VTKScalarType::Float32: return 4;
+        case VTKScalarType::Int64:
+        case VTKScalarType::UInt64:
+        case VTKScalarType::Float64: return 8;
+        default: return 0;
+    }
+}
+
+double VTKFieldView::get(size_t i) const {
+    const uint8_t* p = data + i * vtkScalarSize(type);
+    switch (type) {
+        case VTKScalarType::Int8:    return static_cast<double>(loadElement<int8_t>(p, swap_bytes));
+        case VTKScalarType::UInt8:   return static_cast<double>(loadElement<uint8_t>(p, swap_bytes));
+        case VTKScalarType::Int16:   return static_cast<double>(loadElement<int16_t>(p, swap_bytes));
+        case VTKScalarType::UInt16:  return static_cast<double>(loadElement<uint16_t>(p, swap_bytes));
+        case VTKScalarType::Int32:   return static_cast<double>(loadElement<int32_t>(p, swap_bytes));
+        case VTKScalarType::UInt32:  return static_cast<double>(loadElement<uint32_t>(p, swap_bytes));
+        case VTKScalarType::Int64:   return static_cast<double>(loadElement<int64_t>(p, swap_bytes));
+        case VTKScalarType::UInt64:  return static_cast<double>(loadElement<uint64_t>(p, swap_bytes));
+        case VTKScalarType::Float32: return static_cast<double>(loadElement<float>(p, swap_bytes));
+        case VTKScalarType::Float64: return loadElement<double>(p, swap_bytes);
+        default: return 0.0;
+    }
+}
+
+void VTKFieldView::copyComponent(int component, double* out) const {
+    decodeComponentAny(*this, component, out);
+}
+
+void VTKFieldView::copyComponent(int component, float* out) const {
+    decodeComponentAny(*this, component, out);
+}
+
+template <typename T>
+const T* VTKFieldView::nativePointer() const {
+    VTKScalarType expected = VTKScalarType::Unknown;
+    if (std::is_same<T, float>::value) expected = VTKScalarType::Float32;
+    else if (std::is_same<T, double>::value) expected = VTKScalarType::Float64;
+    else if (std::is_same<T, int32_t>::value) expected = VTKScalarType::Int32;
+    if (type != expected || swap_bytes || !data) return nullptr;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) return nullptr;
+    return reinterpret_cast<const T*>(data);
+}
+
+template const float* VTKFieldView::nativePointer<float>() const;
+template const double* VTKFieldView::nativePointer<double>() const;
+template const int32_t* VTKFieldView::nativePointer<int32_t>() const;
+
+// ============================================================================
+// DATASET
+// ============================================================================
+
+size_t VTKDataset::numPoints() const {
+    switch (kind) {
+        case Kind::ImageData:
+        case Kind::RectilinearGrid:
+        case Kind::StructuredGrid:
+            return static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+        case Kind::PointSet:
+            return points.num_tuples;
+        default:
+            return 0;
+    }
+}
+
+const VTKFieldView* VTKDataset::findPointField(std::initializer_list<const char*> names,
+                                               int components) const {
+    for (const char* want : names) {
+        for (const auto& kv : point_data) {
+            if (iequals(kv.first, want) && kv.second.valid() &&
+                (components == 0 || kv.second.num_components == components)) {
+                return &kv.second;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+const char* VTKReader::parseAsciiNumbers(const char* p, const char* end, size_t count,
+                                         VTKScalarType out_type, uint8_t* out) {
+    if (out_type != VTKScalarType::Float32 && out_type != VTKScalarType::Float64) {
+        return nullptr;
+    }
+    if (count == 0) {
+        return p;
+    }
+
+    // Pass 1 (serial, cheap): find token boundaries, remembering where each
+    // block of ASCII_TOKENS_PER_BLOCK tokens starts.
+    std::vector<const char*> block_starts;
+    block_starts.reserve(count / ASCII_TOKENS_PER_BLOCK + 2);
+    size_t tokens = 0;
+    while (tokens < count) {
+        p = skipSpace(p, end);
+        if (p >= end) return nullptr;
+        if (tokens % ASCII_TOKENS_PER_BLOCK == 0) block_starts.push_back(p);
+        while (p < end && !isSpace(*p)) ++p;
+        ++tokens;
+    }
+    const char* data_end = p;
+
+    // Pass 2 (parallel): convert each block
+    const size_t num_blocks = block_starts.size();
+    std::vector<uint8_t> block_ok(num_blocks, 1);
+    parallelFor(num_blocks, 1, [&](size_t b_begin, size_t b_end) {
+        for (size_t b = b_begin; b < b_end; ++b) {
+            const char* q = block_starts[b];
+            const size_t first = b * ASCII_TOKENS_PER_BLOCK;
+            const size_t last = std::min(count, first + ASCII_TOKENS_PER_BLOCK);
+            for (size_t i = first; i < last; ++i) {
+                q = skipSpace(q, data_end);
+                if (q < data_end && *q == '+') ++q;
+                std::from_chars_result res;
+                if (out_type == VTKScalarType::Float32) {
+                    float v;
+                    res = std::from_chars(q, data_end, v);
+                    std::memcpy(out + i * sizeof(float), &v, sizeof(float));
+                } else {
+                    double v;
+                    res = std::from_chars(q, data_end, v);
+                    std::memcpy(out + i * sizeof(double), &v, sizeof(double));
+                }
+                if (res.ec != std::errc()) {
+                    block_ok[b] = 0;
+                    break;
+                }
+                q = res.ptr;
+            }
+        }
+    });
+
+    for (uint8_t ok : block_ok) {
+        if (!ok) return nullptr;
+    }
+    return data_end;
+}
+
+bool VTKReader::read(const std::string& path, VTKDataset& out, std::string* error) {
+    out = VTKDataset();
+
+    auto mapping = std::make_shared<MappedFile>();
+    if (!mapping->open(path)) {
+        return fail(error, "cannot open " + path);
+    }
+    if (mapping->size() == 0) {
+        return fail(error, "empty file " + path);
+    }
+    out.mapping = mapping;
+
+    const char* begin = reinterpret_cast<const char*>(mapping->data());
+    const char* end = begin + mapping->size();
+    const char* first = skipSpace(begin, end);
+
+    bool ok;
+    if (first < end && *first == '<') {
+        XmlParser parser(begin, end, out, error);
+        ok = parser.parse();
+    } else {
+        LegacyParser parser(begin, end, out, error);
+        ok = parser.parse();
+    }
+
+    if (ok) {
+        // Rectilinear coordinates are indexed by grid position, one per grid line
+        if (out.kind == VTKDataset::Kind::RectilinearGrid) {
+            for (int a = 0; a < 3; ++a) {
+                if (out.dims[a] < 1 || !out.coords[a].valid() ||
+                    out.coords[a].num_tuples != static_cast<size_t>(out.dims[a])) {
+                    return fail(error, std::string(1, static_cast<char>('X' + a)) +
+                                           "_COORDINATES length does not match DIMENSIONS");
+                }
+            }
+        }
+        // Views must cover every point
+        const size_t n = out.numPoints();
+        for (const auto& kv : out.point_data) {
+            if (kv.second.valid() && kv.second.num_tuples != n) {
+                return fail(error, "point array '" + kv.first + "' size mismatch");
+            }
+        }
+    }
+    return ok;
+}
+
+// ============================================================================
+// WRITERS
+// ============================================================================
+
+bool VTKWriter::writeLegacyStructuredPoints(const std::string& path,
+                                            const int dims[3], const double origin[3],
+                                            const double spacing[3],
+                                            const std::vector<VTKWriteField>& fields,
+                                            bool binary) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open()) return false;
+
+    const size_t n = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+    ofs << "# vtk DataFile Version 3.0\n";
+    ofs << "VFEP Export\n";
+    ofs << (binary ? "BINARY\n" : "ASCII\n");
+    ofs << "DATASET STRUCTURED_POINTS\n";
+    ofs << "DIMENSIONS " << dims[0] << " " << dims[1] << " " << dims[2] << "\n";
+    ofs << std::setprecision(9);
+    ofs << "ORIGIN " << origin[0] << " " << origin[1] << " " << origin[2] << "\n";
+    ofs << "SPACING " << spacing[0] << " " << spacing[1] << " " << spacing[2] << "\n";
+    ofs << "POINT_DATA " << n << "\n";
+
+    std::vector<char> buffer;
+    for (const auto& f : fields) {
+        if (f.num_components == 3) {
+            ofs << "VECTORS " << f.name << " float\n";
+        } else {
+            ofs << "SCALARS " << f.name << " float " << f.num_components << "\n";
+            ofs << "LOOKUP_TABLE default\n";
+        }
+        const size_t count = n * static_cast<size_t>(f.num_components);
+        if (binary) {
+            buffer.resize(count * sizeof(float));
+            const bool swap = hostIsLittleEndian();
+            for (size_t i = 0; i < count; ++i) {
+                float v = static_cast<float>(f.data[i]);
+                uint8_t bytes[4];
+                std::memcpy(bytes, &v, 4);
+                if (swap) std::reverse(bytes, bytes + 4);
+                std::memcpy(buffer.data() + i * 4, bytes, 4);
+            }
+            ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            ofs << "\n";
+        } else {
+            char num[32];
+            for (size_t i = 0; i < count; ++i) {
+                auto res = std::to_chars(num, num + sizeof(num), static_cast<float>(f.data[i]));
+                *res.ptr++ = ((i + 1) % f.num_components == 0) ? '\n' : ' ';
+                ofs.write(num, res.ptr - num);
+            }
+        }
+    }
+    return static_cast<bool>(ofs);
+}
+
+bool VTKWriter::writeImageData(const std::string& path,
+                               const int dims[3], const double origin[3],
+                               const double spacing[3],
+                               const std::vector<VTKWriteField>& fields) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open()) return false;
+
+    const size_t n = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+    ofs << std::setprecision(9);
+    ofs << "<?xml version=\"1.0\"?>\n";
+    ofs << "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\""
+        << (hostIsLittleEndian() ? "LittleEndian" : "BigEndian")
+        << "\" header_type=\"UInt64\">\n";
+    ofs << "  <ImageData WholeExtent=\"0 " << dims[0] - 1 << " 0 " << dims[1] - 1
+        << " 0 " << dims[2] - 1 << "\" Origin=\"" << origin[0] << " " << origin[1] << " " << origin[2]
+        << "\" Spacing=\"" << spacing[0] << " " << spacing[1] << " " << spacing[2] << "\">\n";
+    ofs << "    <Piece Extent=\"0 " << dims[0] - 1 << " 0 " << dims[1] - 1
+        << " 0 " << dims[2] - 1 << "\">\n";
+    ofs << "      <PointData>\n";
+    uint64_t offset = 0;
+    for (const auto& f : fields) {
+        ofs << "        <DataArray type=\"Float32\" Name=\"" << f.name
+            << "\" NumberOfComponents=\"" << f.num_components
+            << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += sizeof(uint64_t) + n * f.num_components * sizeof(float);
+    }
+    ofs << "      </PointData>\n";
+    ofs << "      <CellData/>\n";
+    ofs << "    </Piece>\n";
+    ofs << "  </ImageData>\n";
+    ofs << "  <AppendedData encoding=\"raw\">\n   _";
+
+    std::vector<float> buffer;
+    for (const auto& f : fields) {
+        const size_t count = n * static_cast<size_t>(f.num_components);
+        const uint64_t nbytes = count * sizeof(float);
+        ofs.write(reinterpret_cast<const char*>(&nbytes), sizeof(nbytes));
+        buffer.resize(count);
+        for (size_t i = 0; i < count; ++i) buffer[i] = static_cast<float>(f.data[i]);
+        ofs.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(nbytes));
+    }
+    ofs << "\n  </AppendedData>\n</VTKFile>\n";
+    return static_cast<bool>(ofs);
+}
+
+} // namespace vfep
@@ -31,6 +31,7 @@ struct ScenarioGeometry {
 
 static RunMetrics runScenario(double dt, double t_end, double ignite_at, double suppress_at, bool enable_suppression, double ach, double pyrolysis_max = 0.01, double heat_release_J_per_mol = -1.0, ScenarioGeometry geom = {}) {
     vfep::Simulation sim;
+    sim.enableTelemetryHistory(false);  // Only end-of-run metrics are read
     sim.resetToDataCenterRackScenario();
     if (ach > 0.0) {
         sim.setVentilationACH(ach);
@@ -0,0 +1,96 @@
+#include "WorkerPool.h"
+
+namespace vfep {
+
+WorkerPool::WorkerPool(size_t helpers) {
+    threads_.reserve(helpers);
+    for (size_t i = 0; i < helpers; ++i) {
+        threads_.emplace_back([this] { helperLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+WorkerPool& WorkerPool::shared() {
+    static WorkerPool pool(std::max<size_t>(1, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void WorkerPool::claim(Job& job) {
+    for (;;) {
+        const size_t c = job.next.fetch_add(1, std::memory_order_relaxed);
+        if (c >= job.chunks) {
+            return;
+        }
+        try {
+            (*job.run)(c);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.mu);
+            if (!job.error) job.error = std::current_exception();
+        }
+    }
+}
+
+void WorkerPool::execute(size_t chunks, const std::function<void(size_t)>& run) {
+    Job job;
+    job.run = &run;
+    job.chunks = chunks;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        jobs_.push_back(&job);
+    }
+    cv_.notify_all();
+
+    claim(job);
+
+    // No helper can pick the job up once it is off the queue; wait for the
+    // ones already inside it to finish their chunks
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = std::find(jobs_.begin(), jobs_.end(), &job);
+        if (it != jobs_.end()) jobs_.erase(it);
+    }
+    {
+        std::unique_lock<std::mutex> lock(job.mu);
+        job.cv.wait(lock, [&job] { return job.users.load(std::memory_order_acquire) == 0; });
+    }
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+void WorkerPool::helperLoop() {
+    std::unique_lock<std::mutex> lock(mu_);
+    for (;;) {
+        cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (stopping_) {
+            return;
+        }
+        Job* job = jobs_.front();
+        if (job->next.load(std::memory_order_relaxed) >= job->chunks) {
+            jobs_.pop_front();  // Fully claimed; its caller waits on users alone
+            continue;
+        }
+        job->users.fetch_add(1, std::memory_order_relaxed);
+        lock.unlock();
+        claim(*job);
+        {
+            // Last access to the job: its caller may destroy it once users is 0
+            std::lock_guard<std::mutex> job_lock(job->mu);
+            job->users.fetch_sub(1, std::memory_order_release);
+            job->cv.notify_all();
+        }
+        lock.lock();
+    }
+}
+
+} // namespace vfep
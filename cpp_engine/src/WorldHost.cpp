@@ -0,0 +1,398 @@
+#include "WorldHost.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vfep {
+namespace host {
+
+namespace {
+
+std::uint64_t nanosBetween(Clock::time_point a, Clock::time_point b) {
+    return b > a ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count()) : 0;
+}
+
+Clock::duration periodOf(double hz) {
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / hz));
+}
+
+// Last published tick and sim time; readable under the host mutex while a
+// worker steps the world (sim_time_s_ itself is not)
+std::uint64_t publishedTick(const World& w) {
+    const auto snap = w.publisher().latest();
+    return snap ? snap->tick : 0;
+}
+
+double publishedTime(const World& w) {
+    const auto snap = w.publisher().latest();
+    return snap ? snap->sim_time_s : 0.0;
+}
+
+constexpr double kSeekEps = 1e-9;
+
+} // namespace
+
+// ============================================================================
+// World
+// ============================================================================
+
+World::World(std::string id, std::uint64_t serial, vfep::obj::ObjectStore store, double tick_hz, bool fire_sim)
+    : id_(std::move(id))
+    , serial_(serial)
+    , tick_hz_(tick_hz)
+    , layout_(std::make_shared<const vfep::obj::ObjectStore>(store))
+    , store_(std::move(store))
+    , fanout_(publisher_, /*own_thread=*/false) {
+    registry_.build(store_);
+    if (fire_sim) {
+        fire_ = std::make_unique<vfep::mech::FireSimBridge>();
+        params_.external_rack_fire = true;
+    }
+    // Publish tick 0 so readers never see an empty world
+    publisher_.publish(store_, sim_time_s_);
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+WorldHost::WorldHost(std::size_t workers, double max_tick_hz, std::size_t max_worlds)
+    : max_tick_hz_(max_tick_hz > 0.0 ? max_tick_hz : 100.0)
+    , max_worlds_(std::max<std::size_t>(1, max_worlds)) {
+    if (workers == 0) {
+        workers = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+WorldHost::~WorldHost() {
+    stop();
+}
+
+std::shared_ptr<World> WorldHost::create(const WorldConfig& cfg, std::string* error) {
+    auto fail = [error](const std::string& msg) -> std::shared_ptr<World> {
+        if (error) *error = msg;
+        return nullptr;
+    };
+
+    std::uint64_t serial;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (stopping_) return fail("Host is stopping");
+        if (!cfg.world_id.empty() && worlds_.count(cfg.world_id)) return fail("World already exists: " + cfg.world_id);
+        if (worlds_.size() >= max_worlds_) return fail("World limit reached (" + std::to_string(max_worlds_) + ")");
+        serial = next_serial_++;
+    }
+
+    // Building a large store takes a while; do it unlocked and re-check
+    const std::string id = cfg.world_id.empty() ? "world-" + std::to_string(serial) : cfg.world_id;
+    const double hz = std::min(max_tick_hz_, cfg.tick_hz > 0.0 ? cfg.tick_hz : 20.0);
+    auto world = std::make_shared<World>(id, serial,
+                                         cfg.synthetic_racks > 0 ? vfep::obj::makeSyntheticObjectStore(cfg.synthetic_racks)
+                                                                 : vfep::obj::makeDefault4x4ObjectStore(),
+                                         hz, cfg.fire_sim);
+
+    std::lock_guard<std::mutex> lk(mu_);
+    if (stopping_) return fail("Host is stopping");
+    if (worlds_.size() >= max_worlds_) return fail("World limit reached (" + std::to_string(max_worlds_) + ")");
+    if (!worlds_.emplace(id, world).second) return fail("World already exists: " + id);
+    return world;
+}
+
+bool WorldHost::destroy(const std::string& world_id) {
+    std::shared_ptr<World> world;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        auto it = worlds_.find(world_id);
+        if (it == worlds_.end()) return false;
+        world = std::move(it->second);
+        worlds_.erase(it);
+        world->destroyed_.store(true);
+        // A worker cancels whatever is still queued
+        wakeLocked(world, Clock::now());
+    }
+    world->publisher_.close();
+    world->fanout_.deliver();
+    return true;
+}
+
+std::shared_ptr<World> WorldHost::find(const std::string& world_id) const {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = worlds_.find(world_id);
+    return it == worlds_.end() ? nullptr : it->second;
+}
+
+std::vector<std::shared_ptr<World>> WorldHost::list() const {
+    std::vector<std::shared_ptr<World>> out;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        out.reserve(worlds_.size());
+        for (const auto& [id, w] : worlds_) out.push_back(w);
+    }
+    std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) { return a->id() < b->id(); });
+    return out;
+}
+
+void WorldHost::closeTelemetry() {
+    for (const auto& world : list()) {
+        world->publisher_.close();
+        world->fanout_.deliver();
+    }
+}
+
+void WorldHost::stop() {
+    std::vector<std::string> ids;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stopping_ = true;
+        for (const auto& [id, w] : worlds_) ids.push_back(id);
+    }
+    for (const auto& id : ids) destroy(id);
+    cv_.notify_all();
+    // Workers exit once the destroyed worlds have been finalized
+    for (auto& t : workers_) {
+        if (t.joinable()) t.join();
+    }
+}
+
+// ============================================================================
+// Subscriptions and commands
+// ============================================================================
+
+std::uint64_t WorldHost::subscribe(const std::shared_ptr<World>& world, vfep::telemetry::TelemetryFanout::Callback cb) {
+    const std::uint64_t id = world->fanout_.subscribe(std::move(cb));
+    std::lock_guard<std::mutex> lk(mu_);
+    wakeLocked(world, Clock::now());
+    return id;
+}
+
+void WorldHost::unsubscribe(const std::shared_ptr<World>& world, std::uint64_t subscriber) {
+    world->fanout_.unsubscribe(subscriber);
+    // The remaining subscribers may all have acked already
+    std::lock_guard<std::mutex> lk(mu_);
+    if (readyLocked(*world)) wakeLocked(world, Clock::now());
+}
+
+void WorldHost::ack(const std::shared_ptr<World>& world, std::uint64_t subscriber, std::uint64_t tick) {
+    world->fanout_.ack(subscriber, tick);
+    std::lock_guard<std::mutex> lk(mu_);
+    if (world->clock_.mode == ClockMode::Lockstep && readyLocked(*world)) wakeLocked(world, Clock::now());
+}
+
+// ============================================================================
+// Clock control
+// ============================================================================
+
+bool WorldHost::setClockMode(const std::shared_ptr<World>& world, ClockMode mode, double speed, std::string* error) {
+    if (mode == ClockMode::Scaled && !(speed > 0.0 && std::isfinite(speed))) {
+        if (error) *error = "Scaled clock needs a positive speed";
+        return false;
+    }
+    std::lock_guard<std::mutex> lk(mu_);
+    world->clock_.mode = mode;
+    world->clock_.speed = (mode == ClockMode::Scaled) ? speed : 1.0;
+    // Re-pace from now; a scheduled world picks the mode up after its step
+    wakeLocked(world, Clock::now());
+    return true;
+}
+
+void WorldHost::setPaused(const std::shared_ptr<World>& world, bool paused) {
+    std::lock_guard<std::mutex> lk(mu_);
+    world->clock_.paused = paused;
+    if (!paused) world->clock_.pending_steps = 0;
+    wakeLocked(world, Clock::now());
+}
+
+void WorldHost::stepTicks(const std::shared_ptr<World>& world, std::uint64_t ticks) {
+    std::lock_guard<std::mutex> lk(mu_);
+    world->clock_.paused = true;
+    world->clock_.pending_steps += ticks;
+    if (ticks > 0) wakeLocked(world, Clock::now());
+}
+
+bool WorldHost::seek(const std::shared_ptr<World>& world, double sim_time_s, std::string* error) {
+    std::lock_guard<std::mutex> lk(mu_);
+    const double now_s = publishedTime(*world);
+    if (!std::isfinite(sim_time_s) || sim_time_s + kSeekEps < now_s) {
+        if (error) *error = "Cannot seek behind the current sim time (" + std::to_string(now_s) + " s)";
+        return false;
+    }
+    world->clock_.seek_to_s = sim_time_s;
+    wakeLocked(world, Clock::now());
+    return true;
+}
+
+ClockState WorldHost::clock(const World& world) const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return world.clock_;
+}
+
+void WorldHost::enqueue(const std::shared_ptr<World>& world, std::unique_ptr<WorldCommand> cmd) {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (!world->destroyed_.load()) {
+            // Pushed under the lock so a destroy() after this point is
+            // guaranteed to see it when it cancels the queue
+            world->pending_.fetch_add(1);
+            world->commands_.push(std::move(cmd));
+            wakeLocked(world, Clock::now());
+            return;
+        }
+    }
+    cmd->run(nullptr);
+}
+
+bool WorldHost::ticking(const World& world) const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return world.scheduled_;
+}
+
+std::size_t WorldHost::worldCount() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return worlds_.size();
+}
+
+std::size_t WorldHost::tickingCount() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return ticking_;
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+void WorldHost::wakeLocked(const std::shared_ptr<World>& world, Clock::time_point due) {
+    if (world->scheduled_) return;  // Queued or being stepped; the worker re-checks afterwards
+    world->scheduled_ = true;
+    ++ticking_;
+    heap_.push(Due{due, next_seq_++, world});
+    cv_.notify_one();
+}
+
+bool WorldHost::readyLocked(const World& w) const {
+    const ClockState& c = w.clock_;
+    if (c.seek_to_s >= 0.0 && publishedTime(w) + kSeekEps < c.seek_to_s) return true;
+    if (c.pending_steps > 0) return true;
+    if (c.paused || w.fanout_.subscriberCount() == 0) return false;
+    return c.mode != ClockMode::Lockstep || w.fanout_.allAcked(publishedTick(w));
+}
+
+Clock::duration WorldHost::pacedPeriodLocked(const World& w) const {
+    return periodOf(w.tick_hz_ * (w.clock_.mode == ClockMode::Scaled ? w.clock_.speed : 1.0));
+}
+
+void WorldHost::endSeekLocked(World& w) {
+    if (w.clock_.seek_to_s >= 0.0 && publishedTime(w) + kSeekEps >= w.clock_.seek_to_s) w.clock_.seek_to_s = -1.0;
+}
+
+WorldHost::Advance WorldHost::takeAdvanceLocked(World& w) {
+    ClockState& c = w.clock_;
+    endSeekLocked(w);
+    if (c.seek_to_s >= 0.0) return Advance::Free;
+    if (c.pending_steps > 0) {
+        --c.pending_steps;
+        return Advance::Free;
+    }
+    if (!readyLocked(w)) return Advance::No;
+    return (c.mode == ClockMode::RealTime || c.mode == ClockMode::Scaled) ? Advance::Paced : Advance::Free;
+}
+
+void WorldHost::workerLoop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    for (;;) {
+        if (heap_.empty()) {
+            if (stopping_) return;
+            cv_.wait(lk);
+            continue;
+        }
+        const Clock::time_point due = heap_.top().due;
+        if (Clock::now() < due) {
+            cv_.wait_until(lk, due);
+            continue;
+        }
+        Due item = heap_.top();
+        heap_.pop();
+        World& w = *item.world;
+        const Advance advance = w.destroyed_.load() ? Advance::No : takeAdvanceLocked(w);
+        const Clock::duration period = pacedPeriodLocked(w);
+        lk.unlock();
+
+        step(w, item.due, advance, period);
+
+        lk.lock();
+        const Clock::time_point now = Clock::now();
+        endSeekLocked(w);
+        const ClockState& c = w.clock_;
+        if (w.finalized_) {
+            w.scheduled_ = false;
+            --ticking_;
+        } else if (w.destroyed_.load()) {
+            heap_.push(Due{now, next_seq_++, item.world});
+        } else if (!readyLocked(w)) {
+            if (w.pending_.load() > 0) {
+                heap_.push(Due{now, next_seq_++, item.world});  // Commands only
+            } else {
+                // Nobody listening, paused, or waiting for acks: park until
+                // subscribe()/enqueue()/ack()/clock control
+                w.scheduled_ = false;
+                --ticking_;
+            }
+        } else if (c.seek_to_s >= 0.0 || c.pending_steps > 0 || advance != Advance::Paced ||
+                   c.mode == ClockMode::MaxThroughput || c.mode == ClockMode::Lockstep) {
+            heap_.push(Due{now, next_seq_++, item.world});
+            cv_.notify_one();
+        } else {
+            const Clock::duration next_period = pacedPeriodLocked(w);
+            Clock::time_point next = item.due + next_period;
+            if (next + next_period < now) next = now;  // Too far behind: skip, don't burst
+            heap_.push(Due{next, next_seq_++, item.world});
+            cv_.notify_one();
+        }
+    }
+}
+
+void WorldHost::step(World& w, Clock::time_point due, Advance advance, Clock::duration period) {
+    if (w.destroyed_.load()) {
+        w.commands_.drain([&w](std::unique_ptr<WorldCommand> cmd) {
+            w.pending_.fetch_sub(1);
+            cmd->run(nullptr);
+        });
+        w.finalized_ = true;
+        return;
+    }
+
+    const Clock::time_point start = Clock::now();
+    const std::size_t applied = w.commands_.drain([this, &w](std::unique_ptr<WorldCommand> cmd) {
+        w.pending_.fetch_sub(1);
+        cmd->run(&w.store_);
+        command_latency_.record(nanosBetween(cmd->enqueued, Clock::now()));
+    });
+    if (applied > 0) w.registry_.load();  // Commands edit the store
+
+    if (advance == Advance::Paced) {
+        tick_jitter_.record(nanosBetween(due, start));
+        if (start - due > period) overruns_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (advance != Advance::No) {
+        const double dt = 1.0 / w.tick_hz_;
+        vfep::mech::tick(w.registry_, w.sim_time_s_, dt, w.params_);
+        if (w.fire_) {
+            w.fire_->step(w.registry_, w.sim_time_s_, dt);
+            w.active_fires_.store(w.fire_->activeFires(), std::memory_order_relaxed);
+        }
+        w.registry_.save();
+        w.sim_time_s_ += dt;
+        w.ticks_.fetch_add(1, std::memory_order_relaxed);
+        ticks_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (advance != Advance::No || applied > 0) {
+        w.publisher_.publish(w.store_, w.sim_time_s_);
+        w.fanout_.deliver();
+    }
+}
+
+} // namespace host
+} // namespace vfep
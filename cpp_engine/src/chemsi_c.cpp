@@ -0,0 +1,210 @@
+#include "chemsi_c.h"
+
+#include "ObservationShm.h"
+#include "ScenarioBatch.h"
+#include "Simulation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+struct chemsi_sim {
+    vfep::Simulation sim;
+};
+
+namespace {
+
+thread_local std::string g_last_error;
+
+int fail(int code, const char* what) {
+    g_last_error = what ? what : "unknown error";
+    return code;
+}
+
+// Run fn at the ABI boundary: exceptions become CHEMSI_E_* codes
+template <typename Fn>
+int guarded(Fn&& fn) {
+    try {
+        g_last_error.clear();
+        return fn();
+    } catch (const std::invalid_argument& e) {
+        return fail(CHEMSI_E_INVALID, e.what());
+    } catch (const std::bad_alloc&) {
+        return fail(CHEMSI_E_INTERNAL, "out of memory");
+    } catch (const std::exception& e) {
+        return fail(CHEMSI_E_INTERNAL, e.what());
+    } catch (...) {
+        return fail(CHEMSI_E_INTERNAL, "unknown exception");
+    }
+}
+
+constexpr int kObservationColumns = static_cast<int>(sizeof(vfep::ObservationFrameV1) / sizeof(double));
+constexpr int kTelemetryFloats = static_cast<int>(sizeof(vfep::TelemetrySampleV1) / sizeof(float));
+
+} // namespace
+
+// ============================================================
+// Library
+// ============================================================
+
+int chemsi_abi_version(void) {
+    return CHEMSI_C_ABI_VERSION;
+}
+
+const char* chemsi_last_error(void) {
+    return g_last_error.c_str();
+}
+
+// ============================================================
+// Single simulation
+// ============================================================
+
+chemsi_sim* chemsi_sim_create(void) {
+    chemsi_sim* handle = nullptr;
+    guarded([&] {
+        handle = new chemsi_sim;
+        handle->sim.resetToDataCenterRackScenario();
+        return CHEMSI_OK;
+    });
+    return handle;
+}
+
+void chemsi_sim_destroy(chemsi_sim* sim) {
+    delete sim;
+}
+
+int chemsi_sim_configure(chemsi_sim* sim, const double* params, int cols) {
+    if (!sim || cols < 0 || (cols > 0 && !params)) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_configure: null handle or bad parameter row");
+    }
+    return guarded([&] {
+        vfep::ScenarioParams p{};
+        if (cols > 0) {
+            p = vfep::scenarioParamsFromRow(params, static_cast<size_t>(cols));
+        }
+        vfep::configureScenario(sim->sim, p);
+        return CHEMSI_OK;
+    });
+}
+
+int chemsi_sim_ignite(chemsi_sim* sim, double pyrolysis_kgps) {
+    if (!sim) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_ignite: null handle");
+    }
+    return guarded([&] {
+        sim->sim.commandIgniteOrIncreasePyrolysis();
+        if (pyrolysis_kgps > 0.0) {
+            sim->sim.setPyrolysisRate(pyrolysis_kgps);
+        }
+        return CHEMSI_OK;
+    });
+}
+
+int chemsi_sim_start_suppression(chemsi_sim* sim, double agent_mdot_kgps, double knockdown_0_1) {
+    if (!sim) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_start_suppression: null handle");
+    }
+    return guarded([&] {
+        sim->sim.commandStartSuppression();
+        if (agent_mdot_kgps >= 0.0) {
+            sim->sim.setAgentDeliveryRate(agent_mdot_kgps);
+        }
+        if (knockdown_0_1 >= 0.0) {
+            sim->sim.setKnockdown(knockdown_0_1);
+        }
+        return CHEMSI_OK;
+    });
+}
+
+int chemsi_sim_step(chemsi_sim* sim, double dt_s, int64_t n_steps) {
+    if (!sim || !(std::isfinite(dt_s) && dt_s > 0.0) || n_steps < 0) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_step: null handle, non-positive dt or negative step count");
+    }
+    return guarded([&] {
+        for (int64_t i = 0; i < n_steps; ++i) {
+            sim->sim.step(dt_s);
+        }
+        return CHEMSI_OK;
+    });
+}
+
+double chemsi_sim_time(const chemsi_sim* sim) {
+    return sim ? sim->sim.time_s() : 0.0;
+}
+
+int chemsi_observation_column_count(void) {
+    return kObservationColumns;
+}
+
+const char* chemsi_observation_column_name(int column) {
+    const auto& fields = vfep::observationShmFields();
+    return column >= 0 && static_cast<size_t>(column) < fields.size() ? fields[column].name : nullptr;
+}
+
+int chemsi_sim_observe(const chemsi_sim* sim, double* out, int cap) {
+    if (!sim || !out || cap < 0) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_observe: null handle or buffer");
+    }
+    return guarded([&] {
+        vfep::ObservationFrameV1 frame{};
+        vfep::toObservationFrame(sim->sim.time_s(), sim->sim.observe(), frame);
+        const int n = std::min(cap, kObservationColumns);
+        std::memcpy(out, &frame, static_cast<size_t>(n) * sizeof(double));
+        return n;
+    });
+}
+
+int chemsi_sim_telemetry(const chemsi_sim* sim, float* out, int cap_rows) {
+    if (!sim || !out || cap_rows < 0) {
+        return fail(CHEMSI_E_INVALID, "chemsi_sim_telemetry: null handle or buffer");
+    }
+    static_assert(sizeof(vfep::TelemetrySampleV1) == kTelemetryFloats * sizeof(float), "packed telemetry rows");
+    return guarded([&] {
+        return sim->sim.getTelemetrySamples(reinterpret_cast<vfep::TelemetrySampleV1*>(out), cap_rows);
+    });
+}
+
+// ============================================================
+// Batched scenarios
+// ============================================================
+
+int chemsi_param_count(void) {
+    return static_cast<int>(vfep::kScenarioParamCount);
+}
+
+const char* chemsi_param_name(int column) {
+    return column >= 0 ? vfep::scenarioParamName(static_cast<size_t>(column)) : nullptr;
+}
+
+double chemsi_param_default(int column) {
+    static const vfep::ScenarioParams defaults{};
+    if (column < 0 || static_cast<size_t>(column) >= vfep::kScenarioParamCount) {
+        return 0.0;
+    }
+    return reinterpret_cast<const double*>(&defaults)[column];
+}
+
+int chemsi_metric_count(void) {
+    return static_cast<int>(vfep::kScenarioMetricCount);
+}
+
+const char* chemsi_metric_name(int column) {
+    return column >= 0 ? vfep::scenarioMetricName(static_cast<size_t>(column)) : nullptr;
+}
+
+int chemsi_run_batch(const double* params, int64_t rows, int param_cols, double* metrics, float* telemetry,
+                     int telemetry_cap, int32_t* telemetry_rows, int threads) {
+    if (rows < 0 || param_cols < 0 || telemetry_cap < 0 || threads < 0) {
+        return fail(CHEMSI_E_INVALID, "chemsi_run_batch: negative size");
+    }
+    return guarded([&] {
+        vfep::runScenarioBatch(params, static_cast<size_t>(rows), static_cast<size_t>(param_cols), metrics,
+                               telemetry, static_cast<size_t>(telemetry_cap), telemetry_rows,
+                               static_cast<size_t>(threads));
+        return CHEMSI_OK;
+    });
+}
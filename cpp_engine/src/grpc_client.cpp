@@ -1,6 +1,15 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 #ifdef CHEMSI_ENABLE_GRPC
 #include <grpcpp/grpcpp.h>
@@ -8,35 +17,291 @@
 #endif
 
 static void usage(const char* exe) {
-    std::cout << "Usage: " << exe << " --addr <host:port> [--frames N]\n";
+    std::cout << "Usage: " << exe << " --addr <host:port> [--world ID] [--frames N] [--delta]\n"
+              << "       " << exe << " --addr <host:port> --clients N [--worlds W] [--seconds S] [--delta]   (load test)\n"
+              << "       " << exe << " --addr <host:port> --create_world ID [--tick_hz HZ] [--racks N] [--fire_sim]\n"
+              << "       " << exe << " --addr <host:port> [--world ID] --ignite RACK_ID\n"
+              << "       " << exe << " --addr <host:port> [--world ID] --clock [realtime|scaled|max|lockstep] [--speed X]\n"
+              << "                 [--pause | --resume | --step N | --seek T]\n"
+              << "       " << exe << " --addr <host:port> --destroy_world ID\n"
+              << "       " << exe << " --addr <host:port> --list_worlds\n";
 }
 
+#ifdef CHEMSI_ENABLE_GRPC
+// Load generator: N concurrent telemetry streams driven by the callback
+// API from one process (gRPC's own threads, not one thread per stream).
+template <class Msg>
+class LoadStream final : public grpc::ClientReadReactor<Msg> {
+public:
+    void start(chemsi::vfep::v1::VFEPUnitySimServiceV1::Stub& stub, const std::string& world_id) {
+        req_.set_world_id(world_id);
+        if constexpr (std::is_same<Msg, chemsi::vfep::v1::TelemetryDeltaV1>::value) {
+            stub.async()->StreamTelemetryDelta(&ctx_, &req_, this);
+        } else {
+            stub.async()->StreamTelemetry(&ctx_, &req_, this);
+        }
+        this->StartRead(&msg_);
+        this->StartCall();
+    }
+
+    void OnReadDone(bool ok) override {
+        if (!ok) return;  // OnDone follows
+        ++messages_;
+        this->StartRead(&msg_);
+    }
+
+    void OnDone(const grpc::Status& status) override {
+        std::lock_guard<std::mutex> lk(mu_);
+        status_ = status;
+        done_ = true;
+        cv_.notify_all();
+    }
+
+    void cancel() { ctx_.TryCancel(); }
+
+    grpc::Status wait() {
+        std::unique_lock<std::mutex> lk(mu_);
+        cv_.wait(lk, [this]() { return done_; });
+        return status_;
+    }
+
+    std::uint64_t messages() const { return messages_; }
+
+private:
+    grpc::ClientContext ctx_;
+    chemsi::vfep::v1::WorldRequestV1 req_;
+    Msg msg_;
+    std::uint64_t messages_ = 0;  // Reactions for one stream are serialized
+
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    grpc::Status status_;
+};
+
+// With worlds > 0, creates worlds load-0 .. load-(W-1), spreads the
+// clients over them round-robin and destroys them afterwards.
+template <class Msg>
+static int runLoad(chemsi::vfep::v1::VFEPUnitySimServiceV1::Stub& stub, int clients, int worlds, double seconds) {
+    std::vector<std::string> world_ids;
+    for (int w = 0; w < worlds; ++w) {
+        grpc::ClientContext ctx;
+        chemsi::vfep::v1::CreateWorldV1 req;
+        chemsi::vfep::v1::WorldInfoV1 info;
+        req.set_world_id("load-" + std::to_string(w));
+        const auto st = stub.CreateWorld(&ctx, req, &info);
+        if (!st.ok()) {
+            std::cerr << "CreateWorld " << req.world_id() << " failed: " << st.error_message() << "\n";
+            return 3;
+        }
+        world_ids.push_back(info.world_id());
+    }
+    if (world_ids.empty()) world_ids.push_back("");
+
+    std::vector<std::unique_ptr<LoadStream<Msg>>> streams;
+    streams.reserve(static_cast<size_t>(clients));
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < clients; ++i) {
+        streams.push_back(std::make_unique<LoadStream<Msg>>());
+        streams.back()->start(stub, world_ids[static_cast<size_t>(i) % world_ids.size()]);
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    for (auto& s : streams) s->cancel();
+
+    int failed = 0;
+    std::uint64_t total = 0, lo = UINT64_MAX, hi = 0;
+    for (auto& s : streams) {
+        const auto st = s->wait();
+        if (!st.ok() && st.error_code() != grpc::StatusCode::CANCELLED) ++failed;
+        total += s->messages();
+        lo = std::min(lo, s->messages());
+        hi = std::max(hi, s->messages());
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    for (int w = 0; w < worlds; ++w) {
+        grpc::ClientContext ctx;
+        chemsi::vfep::v1::WorldRequestV1 req;
+        chemsi::vfep::v1::WorldInfoV1 info;
+        req.set_world_id(world_ids[static_cast<size_t>(w)]);
+        stub.DestroyWorld(&ctx, req, &info);
+    }
+    std::cout << "Load clients=" << clients
+              << " worlds=" << std::max(1, worlds)
+              << " seconds=" << elapsed
+              << " messages=" << total
+              << " msgs_per_s=" << (elapsed > 0.0 ? total / elapsed : 0.0)
+              << " per_client_min=" << (clients > 0 ? lo : 0)
+              << " per_client_max=" << hi
+              << " failed=" << failed
+              << "\n";
+    return failed ? 4 : 0;
+}
+#endif
+
 int main(int argc, char** argv) {
+#ifndef CHEMSI_ENABLE_GRPC
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        if (a == "-h" || a == "--help") { usage(argv[0]); return 0; }
+    }
+    std::cerr << "CHEMSI_ENABLE_GRPC not enabled.\n";
+    return 2;
+#else
     std::string addr = "127.0.0.1:50051";
     int frames = 10;
+    bool delta = false;
+    int clients = 0;
+    int worlds = 0;
+    double seconds = 10.0;
+    std::string world_id;
+    std::string create_world, destroy_world;
+    bool list_worlds = false;
+    double tick_hz = 0.0;
+    int racks = 0;
+    bool fire_sim = false;
+    std::string ignite_rack;
+    bool clock = false;
+    std::string clock_mode;
+    double speed = 0.0;
+    int pause = -1;  // -1: unchanged
+    int step_ticks = 0;
+    double seek_to = -1.0;
 
     for (int i = 1; i < argc; ++i) {
         std::string a = argv[i];
         if (a == "--addr" && i + 1 < argc) { addr = argv[++i]; continue; }
         if (a == "--frames" && i + 1 < argc) { frames = std::atoi(argv[++i]); continue; }
+        if (a == "--delta") { delta = true; continue; }
+        if (a == "--clients" && i + 1 < argc) { clients = std::atoi(argv[++i]); continue; }
+        if (a == "--seconds" && i + 1 < argc) { seconds = std::atof(argv[++i]); continue; }
+        if (a == "--worlds" && i + 1 < argc) { worlds = std::atoi(argv[++i]); continue; }
+        if (a == "--world" && i + 1 < argc) { world_id = argv[++i]; continue; }
+        if (a == "--create_world" && i + 1 < argc) { create_world = argv[++i]; continue; }
+        if (a == "--destroy_world" && i + 1 < argc) { destroy_world = argv[++i]; continue; }
+        if (a == "--list_worlds") { list_worlds = true; continue; }
+        if (a == "--tick_hz" && i + 1 < argc) { tick_hz = std::atof(argv[++i]); continue; }
+        if (a == "--racks" && i + 1 < argc) { racks = std::atoi(argv[++i]); continue; }
+        if (a == "--fire_sim") { fire_sim = true; continue; }
+        if (a == "--ignite" && i + 1 < argc) { ignite_rack = argv[++i]; continue; }
+        if (a == "--clock") {
+            clock = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') clock_mode = argv[++i];
+            continue;
+        }
+        if (a == "--speed" && i + 1 < argc) { speed = std::atof(argv[++i]); continue; }
+        if (a == "--pause") { clock = true; pause = 1; continue; }
+        if (a == "--resume") { clock = true; pause = 0; continue; }
+        if (a == "--step" && i + 1 < argc) { clock = true; step_ticks = std::atoi(argv[++i]); continue; }
+        if (a == "--seek" && i + 1 < argc) { clock = true; seek_to = std::atof(argv[++i]); continue; }
         if (a == "-h" || a == "--help") { usage(argv[0]); return 0; }
     }
 
-#ifndef CHEMSI_ENABLE_GRPC
-    std::cerr << "CHEMSI_ENABLE_GRPC not enabled.\n";
-    return 2;
-#else
     using chemsi::vfep::v1::VFEPUnitySimServiceV1;
     using chemsi::vfep::v1::EmptyV1;
+    using chemsi::vfep::v1::WorldRequestV1;
+    using chemsi::vfep::v1::WorldInfoV1;
     using chemsi::vfep::v1::TelemetryFrameV1;
 
     auto channel = grpc::CreateChannel(addr, grpc::InsecureChannelCredentials());
     auto stub = VFEPUnitySimServiceV1::NewStub(channel);
 
+    auto printWorld = [](const WorldInfoV1& w) {
+        std::cout << "World id=" << w.world_id()
+                  << " tick_hz=" << w.tick_hz()
+                  << " ticks=" << w.ticks()
+                  << " subscribers=" << w.subscribers()
+                  << " ticking=" << (w.ticking() ? "yes" : "no")
+                  << " fire_sim=" << (w.fire_sim() ? "yes" : "no")
+                  << " active_fires=" << w.active_fires()
+                  << "\n";
+    };
+
+    // World management
+    if (!create_world.empty() || !destroy_world.empty() || list_worlds) {
+        grpc::ClientContext ctx;
+        grpc::Status st;
+        if (!create_world.empty()) {
+            chemsi::vfep::v1::CreateWorldV1 req;
+            WorldInfoV1 info;
+            req.set_world_id(create_world);
+            req.set_tick_hz(tick_hz);
+            req.set_synthetic_racks(static_cast<std::uint32_t>(std::max(0, racks)));
+            req.set_fire_sim(fire_sim);
+            st = stub->CreateWorld(&ctx, req, &info);
+            if (st.ok()) printWorld(info);
+        } else if (!destroy_world.empty()) {
+            WorldRequestV1 req;
+            WorldInfoV1 info;
+            req.set_world_id(destroy_world);
+            st = stub->DestroyWorld(&ctx, req, &info);
+            if (st.ok()) printWorld(info);
+        } else {
+            chemsi::vfep::v1::WorldListV1 list;
+            st = stub->ListWorlds(&ctx, EmptyV1(), &list);
+            for (const auto& w : list.worlds()) printWorld(w);
+        }
+        if (!st.ok()) {
+            std::cerr << "World request failed: " << st.error_message() << "\n";
+            return 3;
+        }
+        return 0;
+    }
+
+    if (clock) {
+        grpc::ClientContext ctx;
+        chemsi::vfep::v1::ClockControlV1 req;
+        chemsi::vfep::v1::ClockStateV1 state;
+        req.set_world_id(world_id);
+        if (clock_mode == "realtime") req.set_mode(chemsi::vfep::v1::CLOCK_MODE_REAL_TIME);
+        else if (clock_mode == "scaled") req.set_mode(chemsi::vfep::v1::CLOCK_MODE_SCALED);
+        else if (clock_mode == "max") req.set_mode(chemsi::vfep::v1::CLOCK_MODE_MAX_THROUGHPUT);
+        else if (clock_mode == "lockstep") req.set_mode(chemsi::vfep::v1::CLOCK_MODE_LOCKSTEP);
+        else if (!clock_mode.empty()) {
+            std::cerr << "Unknown clock mode: " << clock_mode << "\n";
+            return 2;
+        }
+        req.set_speed(speed);
+        if (step_ticks > 0) req.set_step_ticks(static_cast<std::uint32_t>(step_ticks));
+        else if (seek_to >= 0.0) req.set_seek_to_s(seek_to);
+        else if (pause >= 0) req.set_paused(pause == 1);
+        const auto st = stub->ClockControl(&ctx, req, &state);
+        if (!st.ok()) {
+            std::cerr << "ClockControl failed: " << st.error_message() << "\n";
+            return 3;
+        }
+        std::cout << "Clock world=" << state.world_id()
+                  << " mode=" << chemsi::vfep::v1::ClockModeV1_Name(state.mode())
+                  << " speed=" << state.speed()
+                  << " paused=" << (state.paused() ? "yes" : "no")
+                  << " pending_steps=" << state.pending_steps()
+                  << " seeking=" << (state.seeking() ? std::to_string(state.seek_to_s()) : std::string("no"))
+                  << " sim_time_s=" << state.sim_time_s()
+                  << " ticks=" << state.ticks()
+                  << "\n";
+        return 0;
+    }
+
+    if (!ignite_rack.empty()) {
+        grpc::ClientContext ctx;
+        chemsi::vfep::v1::CommandV1 cmd;
+        chemsi::vfep::v1::CommandAckV1 ack;
+        cmd.set_schema_version("1.0");
+        cmd.set_world_id(world_id);
+        cmd.mutable_ignite_rack()->set_rack_id(ignite_rack);
+        const auto st = stub->SendCommand(&ctx, cmd, &ack);
+        if (!st.ok()) {
+            std::cerr << "SendCommand failed: " << st.error_message() << "\n";
+            return 3;
+        }
+        std::cout << "Ack ok=" << (ack.ok() ? "yes" : "no") << " message=" << ack.message() << "\n";
+        return 0;
+    }
+
     // Snapshot
     {
         grpc::ClientContext ctx;
-        EmptyV1 req;
+        WorldRequestV1 req;
+        req.set_world_id(world_id);
         chemsi::vfep::v1::WorldSnapshotV1 snap;
         const auto st = stub->GetWorldSnapshot(&ctx, req, &snap);
         if (!st.ok()) {
@@ -44,6 +309,7 @@ int main(int argc, char** argv) {
             return 3;
         }
         std::cout << "Snapshot schema=" << snap.schema_version()
+                  << " world=" << snap.world_id()
                   << " rooms=" << snap.rooms_size()
                   << " racks=" << snap.racks_size()
                   << " vfeps=" << snap.vfeps_size()
@@ -53,10 +319,46 @@ int main(int argc, char** argv) {
                   << "\n";
     }
 
+    if (clients > 0) {
+        return delta ? runLoad<chemsi::vfep::v1::TelemetryDeltaV1>(*stub, clients, worlds, seconds)
+                     : runLoad<TelemetryFrameV1>(*stub, clients, worlds, seconds);
+    }
+
+    // Delta telemetry stream (keyframe, then changed entities only)
+    if (delta) {
+        grpc::ClientContext ctx;
+        WorldRequestV1 req;
+        req.set_world_id(world_id);
+        auto reader = stub->StreamTelemetryDelta(&ctx, req);
+        chemsi::vfep::v1::TelemetryDeltaV1 d;
+        int count = 0;
+        while (count < frames && reader->Read(&d)) {
+            const int changed = d.racks_size() + d.tanks_size() + d.arms_size() + d.nozzles_size() +
+                                d.interlocks_size() + d.incidents_size() + d.alerts_size() + d.vfeps_size();
+            std::cout << "Delta tick=" << d.tick()
+                      << " base=" << d.base_tick()
+                      << " t=" << d.sim_time_s()
+                      << " new_ids=" << d.new_handles_size()
+                      << " changed=" << changed
+                      << " removed=" << d.removed_handles_size()
+                      << "\n";
+            ++count;
+        }
+        ctx.TryCancel();
+        const auto st = reader->Finish();
+        if (!st.ok() && st.error_code() != grpc::StatusCode::CANCELLED) {
+            std::cerr << "StreamTelemetryDelta ended with error: " << st.error_message() << "\n";
+            return 4;
+        }
+        std::cout << "Read " << count << " deltas.\n";
+        return 0;
+    }
+
     // Telemetry stream (read N frames)
     {
         grpc::ClientContext ctx;
-        EmptyV1 req;
+        WorldRequestV1 req;
+        req.set_world_id(world_id);
         auto reader = stub->StreamTelemetry(&ctx, req);
         TelemetryFrameV1 frame;
         int count = 0;
@@ -70,8 +372,9 @@ int main(int argc, char** argv) {
                       << "\n";
             ++count;
         }
+        ctx.TryCancel();
         auto st = reader->Finish();
-        if (!st.ok()) {
+        if (!st.ok() && st.error_code() != grpc::StatusCode::CANCELLED) {
             std::cerr << "StreamTelemetry ended with error: " << st.error_message() << "\n";
             return 4;
         }
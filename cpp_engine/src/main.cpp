@@ -1,3 +1,4 @@
+#include <chrono>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
@@ -9,6 +10,9 @@
 #include "Simulation.h"
 #include "ObjectModel.h"
 #include "GrpcSimServer.h"
+#include "ObservationLog.h"
+#include "ObservationShm.h"
+#include "TelemetryRecording.h"
 
 #if defined(_WIN32)
   #include <conio.h>
@@ -26,8 +30,12 @@ namespace {
             << "Options:\n"
             << "  --dt <seconds>            Integration timestep (default: 0.02)\n"
             << "  --t_end <seconds>         Hard stop time (default: 60)\n"
-            << "  --log_dt <seconds>        CSV logging interval (default: 0.10)\n"
-            << "  --out <path>              CSV output path (default: high_fidelity_ml.csv)\n"
+            << "  --log_dt <seconds>        Logging interval (default: 0.10)\n"
+            << "  --log_format <fmt>        Log format: csv | bin | parquet-lite (default: csv)\n"
+            << "  --out <path>              Log output path (default: high_fidelity_ml.csv/.bin/.vfrec)\n"
+            << "  --record <path>           Also record every step's Observation to a binary recording\n"
+            << "  --shm [path]              Publish every step's Observation to a shared-memory ring\n"
+            << "                            (default: /dev/shm/vfep_observations on Linux)\n"
             << "  --ignite_at <seconds>     Auto-ignite/increase pyrolysis at time (default: 2.0)\n"
             << "  --suppress_at <seconds>   Auto-start suppression at time (default: 5.0)\n"
             << "  --no_auto                 Disable auto ignition/suppression (Windows keys remain)\n"
@@ -35,7 +43,12 @@ namespace {
             << "  --dump_objects <path>      Write object-store summary/validation report to a file (implies --init_objects)\n"
             << "  --grpc_port <port>         Start gRPC server for Unity integration (default: disabled)\n"
             << "  --grpc_bind <addr>         Bind address for gRPC server (default: 127.0.0.1)\n"
-            << "  --tick_hz <N>              Fixed update rate when gRPC is enabled (default: 20)\n"
+            << "  --tick_hz <N>              Tick rate of the default gRPC world (default: 20)\n"
+            << "  --grpc_max_stream_hz <hz>  Per-client telemetry stream rate cap (default: 0 = every tick)\n"
+            << "  --grpc_workers <N>         Worker threads shared by all hosted worlds (default: 0 = one per core)\n"
+            << "  --grpc_max_worlds <N>      Maximum hosted worlds (default: 256)\n"
+            << "  --grpc_max_tick_hz <hz>    Tick-rate cap for any world (default: 100)\n"
+            << "  --grpc_fire_sim            Burning racks in the default world run the high-fidelity Simulation\n"
             << "  -h, --help                Show this help\n\n"
             << "Windows interactive keys (when available): F=ignite/increase pyrolysis | S=start suppression | Q=quit\n";
     }
@@ -66,7 +79,10 @@ int main(int argc, char** argv) {
     double dt = 0.02;
     double t_end = 60.0;
     double log_dt = 0.10;
-    std::filesystem::path outPath = "high_fidelity_ml.csv";
+    std::filesystem::path outPath;
+    vfep::ObservationLogFormat logFormat = vfep::ObservationLogFormat::Csv;
+    std::filesystem::path recordPath;
+    std::string shmPath;
     double ignite_at = 2.0;
     double suppress_at = 5.0;
     bool autoActions = true;
@@ -77,6 +93,11 @@ int main(int argc, char** argv) {
     // gRPC (Unity integration)
     int grpc_port = 0;
     std::string grpc_bind = "127.0.0.1";
+    double grpc_max_stream_hz = 0.0;
+    int grpc_workers = 0;
+    int grpc_max_worlds = 256;
+    double grpc_max_tick_hz = 100.0;
+    bool grpc_fire_sim = false;
     int tick_hz = 20;
 
     // ----------------------------
@@ -128,6 +149,30 @@ int main(int argc, char** argv) {
     grpc_port = std::atoi(args[i + 1].c_str());
     if (grpc_port <= 0 || grpc_port > 65535) { std::cerr << "Invalid --grpc_port\n"; return 2; }
     ++i;
+} else if (a == "--grpc_max_stream_hz") {
+    if (i + 1 >= args.size()) { std::cerr << "Missing value for --grpc_max_stream_hz\n"; return 2; }
+    if (!parseDouble(args[i + 1], grpc_max_stream_hz) || grpc_max_stream_hz < 0.0) {
+        std::cerr << "Invalid --grpc_max_stream_hz\n"; return 2;
+    }
+    ++i;
+} else if (a == "--grpc_workers") {
+    if (i + 1 >= args.size()) { std::cerr << "Missing value for --grpc_workers\n"; return 2; }
+    grpc_workers = std::atoi(args[i + 1].c_str());
+    if (grpc_workers < 0) { std::cerr << "Invalid --grpc_workers\n"; return 2; }
+    ++i;
+} else if (a == "--grpc_max_worlds") {
+    if (i + 1 >= args.size()) { std::cerr << "Missing value for --grpc_max_worlds\n"; return 2; }
+    grpc_max_worlds = std::atoi(args[i + 1].c_str());
+    if (grpc_max_worlds <= 0) { std::cerr << "Invalid --grpc_max_worlds\n"; return 2; }
+    ++i;
+} else if (a == "--grpc_max_tick_hz") {
+    if (i + 1 >= args.size()) { std::cerr << "Missing value for --grpc_max_tick_hz\n"; return 2; }
+    if (!parseDouble(args[i + 1], grpc_max_tick_hz) || grpc_max_tick_hz <= 0.0) {
+        std::cerr << "Invalid --grpc_max_tick_hz\n"; return 2;
+    }
+    ++i;
+} else if (a == "--grpc_fire_sim") {
+    grpc_fire_sim = true;
 } else if (a == "--grpc_bind") {
     if (i + 1 >= args.size()) { std::cerr << "Missing value for --grpc_bind\n"; return 2; }
     grpc_bind = args[i + 1];
@@ -136,6 +181,26 @@ int main(int argc, char** argv) {
             if (i + 1 >= args.size()) { std::cerr << "Missing value for --out\n"; return 2; }
             outPath = args[i + 1];
             ++i;
+        } else if (a == "--log_format" || a.rfind("--log_format=", 0) == 0) {
+            std::string name;
+            if (a == "--log_format") {
+                if (i + 1 >= args.size()) { std::cerr << "Missing value for --log_format\n"; return 2; }
+                name = args[++i];
+            } else {
+                name = a.substr(std::string("--log_format=").size());
+            }
+            if (!vfep::parseObservationLogFormat(name, logFormat)) { std::cerr << "Invalid --log_format\n"; return 2; }
+        } else if (a == "--record") {
+            if (i + 1 >= args.size()) { std::cerr << "Missing value for --record\n"; return 2; }
+            recordPath = args[i + 1];
+            ++i;
+        } else if (a == "--shm") {
+            // Optional value: the next argument unless it is another option
+            if (i + 1 < args.size() && args[i + 1].rfind("--", 0) != 0) {
+                shmPath = args[++i];
+            } else {
+                shmPath = vfep::ObservationShmWriter::defaultPath();
+            }
         } else if (a == "--dump_objects") {
             if (i + 1 >= args.size()) { std::cerr << "Missing value for --dump_objects\n"; return 2; }
             dumpObjectsPath = args[i + 1];
@@ -206,8 +271,13 @@ int main(int argc, char** argv) {
 
 if (grpc_port != 0) {
     // gRPC server mode: fixed timestep object-store mechanics loop + telemetry streaming.
-    // This mode is separate from the high-fidelity chemical/ventilation simulation.
+    // Rack fires use the built-in cooling model unless --grpc_fire_sim (or
+    // CreateWorld's fire_sim) gives each burning rack its own high-fidelity Simulation.
     vfep::grpcsim::GrpcSimServer server;
+    server.setMaxStreamHz(grpc_max_stream_hz);
+    server.setWorkerThreads(static_cast<std::size_t>(grpc_workers));
+    server.setWorldLimits(static_cast<std::size_t>(grpc_max_worlds), grpc_max_tick_hz);
+    server.setDefaultFireSim(grpc_fire_sim);
     const bool ok = server.Run(grpc_bind, grpc_port, tick_hz);
     return ok ? 0 : 4;
 }
@@ -216,20 +286,47 @@ if (grpc_port != 0) {
         std::cout << "Auto-actions: ignite_at=" << ignite_at << "s, suppress_at=" << suppress_at
                   << "s (use --no_auto to disable)\n";
     }
+    if (outPath.empty()) {
+        outPath = std::string("high_fidelity_ml") + vfep::observationLogExtension(logFormat);
+    }
     std::cout << "Run controls: dt=" << dt << "s, t_end=" << t_end << "s, log_dt=" << log_dt
               << "s, out=" << outPath.string() << "\n";
 
     vfep::Simulation sim;
     sim.resetToDataCenterRackScenario();
 
+    // Rows are formatted and written on the log's own thread
     ensureParentDirExists(outPath);
-    std::ofstream csv(outPath);
-    csv << "time_s,T_K,HRR_kW,O2_volpct,CO2_volpct,H2O_volpct,fuel_kg,inhib_kgm3,inert_kgm3,ACH,agent_mdot_kgps,reward\n";
-    csv << std::fixed << std::setprecision(6);
+    vfep::ObservationLogWriter log;
+    if (!log.open(outPath.string(), logFormat)) {
+        std::cerr << "ERROR: Could not open --out path: " << outPath.string() << "\n";
+        return 2;
+    }
+
+    // Full-rate binary recording; encoding and I/O happen off this thread
+    vfep::TelemetryRecorder recorder;
+    if (!recordPath.empty()) {
+        ensureParentDirExists(recordPath);
+        if (!recorder.open(recordPath.string(), vfep::RecordingSchema::Observation)) {
+            std::cerr << "ERROR: Could not open --record path: " << recordPath.string() << "\n";
+            return 2;
+        }
+    }
+
+    // Live frames for co-located readers; never waits on them
+    vfep::ObservationShmWriter shm;
+    if (!shmPath.empty()) {
+        if (!shm.open(shmPath)) {
+            std::cerr << "ERROR: Could not create --shm ring: " << shmPath << "\n";
+            return 2;
+        }
+        std::cout << "Shared-memory ring: " << shmPath << " (" << shm.capacity() << " frames)\n";
+    }
 
     double t = 0.0;
     double next_log_t = 0.0;
     double next_status_t = 0.0;
+    auto next_status_wall = std::chrono::steady_clock::now();
 
     bool didIgnite = false;
     bool didSuppress = false;
@@ -258,16 +355,16 @@ if (grpc_port != 0) {
         t += dt;
 
         const auto o = sim.observe();
+        recorder.append(t, o);
+        shm.publish(t, o);
 
         if (t >= next_log_t) {
-            csv << t << "," << o.T_K << "," << (o.HRR_W / 1000.0) << ","
-                << o.O2_volpct << "," << o.CO2_volpct << "," << o.H2O_volpct << ","
-                << o.fuel_kg << "," << o.inhibitor_kgm3 << "," << o.inert_kgm3 << ","
-                << o.ACH << "," << o.agent_mdot_kgps << "," << o.reward << "\n";
+            log.push(t, o);
             next_log_t += log_dt;
         }
 
-        if (t >= next_status_t) {
+        // Every 0.5 s of sim time, but at most ~10 lines per wall second
+        if (t >= next_status_t && std::chrono::steady_clock::now() >= next_status_wall) {
             std::cout << "\r"
                       << "t=" << std::setw(7) << std::setprecision(2) << t << " s | "
                       << "T=" << std::setw(7) << std::setprecision(1) << (o.T_K - 273.15) << " C | "
@@ -276,7 +373,8 @@ if (grpc_port != 0) {
                       << "Fuel=" << std::setw(7) << std::setprecision(3) << o.fuel_kg << " kg | "
                       << "Agent=" << std::setw(6) << std::setprecision(3) << o.agent_mdot_kgps << " kg/s   "
                       << std::flush;
-            next_status_t += 0.5;
+            next_status_t = t + 0.5;
+            next_status_wall = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
         }
 
         if (sim.isConcluded()) {
@@ -290,7 +388,22 @@ if (grpc_port != 0) {
         }
     }
 
-    csv.close();
-    std::cout << "\nCSV written to " << outPath.string() << "\n";
+    const uint64_t logRows = log.rowsPushed();
+    if (!log.close()) {
+        std::cerr << "ERROR: Write failed for " << outPath.string() << "\n";
+        return 2;
+    }
+    std::cout << "\nLog written to " << outPath.string() << " (" << logRows << " rows";
+    if (log.producerStalls() > 0) std::cout << ", " << log.producerStalls() << " writer stalls";
+    std::cout << ")\n";
+    if (recorder.isOpen()) {
+        const uint64_t rows = recorder.rowsAppended();
+        if (!recorder.close()) {
+            std::cerr << "ERROR: Write failed for recording " << recordPath.string() << "\n";
+            return 2;
+        }
+        std::cout << "Recording written to " << recordPath.string() << " (" << rows << " rows, "
+                  << recorder.bytesWritten() << " bytes)\n";
+    }
     return 0;
 }
@@ -4,20 +4,56 @@
 #include <limits>
 #include <string>
 #include <vector>
+#include <array>
 #include <algorithm>
 #include <functional>
 #include <type_traits>
 #include <memory>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <filesystem>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
 
 #include "Simulation.h"
 #include "SensitivityAnalysis.h"
 #include "UncertaintyQuantification.h"
 #include "ThreeZoneModel.h"
 #include "CFDInterface.h"
+#include "VTKIO.h"
 #include "RadiationModel.h"
 #include "CompartmentNetwork.h"
 #include "CFDCoupler.h"
+#include "CFDAsyncChannel.h"
+#include "CFDTimeSeries.h"
+#include "OctreeField.h"
 #include "FlameSpreadModel.h"
+#include "SurfaceMesh.h"
+#include "ObjectModel.h"
+#include "MechanicsSim.h"
+#include "TelemetryPublisher.h"
+#include "MpscQueue.h"
+#include "LatencyHistogram.h"
+#include "WorldHost.h"
+#include "FireSimBridge.h"
+#include "TelemetryRecording.h"
+#include "ObservationLog.h"
+#include "ObservationShm.h"
+#include "SpscRing.h"
+#include "TelemetryHistory.h"
+#include "Crc32.h"
+#include "ScenarioBatch.h"
+#include "MlpSurrogate.h"
+#include "WorkerPool.h"
+#include "GaussianProcess.h"
+#if defined(CHEMSI_HAVE_CAPI)
+#include "chemsi_c.h"
+#endif
 
 namespace {
 
@@ -4240,6 +4276,554 @@ static void runCFDExportAndCompare_8B2()
     std::cout << "[PASS] 8B2 CFD export and comparison functionality\n";
 }
 
+static void runCFDImportFormats_8B3()
+{
+    // Linear field: trilinear interpolation reproduces it exactly
+    const int dims[3] = {6, 5, 4};
+    const double origin[3] = {-1.0, 0.5, 0.0};
+    const double spacing[3] = {0.5, 0.25, 1.0};
+    const size_t n = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+    auto fieldT = [](double x, double y, double z) { return 300.0 + 10.0 * x + 5.0 * y + 2.0 * z; };
+
+    std::vector<double> T(n), vel(3 * n), rho(n, 1.1);
+    size_t idx = 0;
+    for (int k = 0; k < dims[2]; ++k) {
+        for (int j = 0; j < dims[1]; ++j) {
+            for (int i = 0; i < dims[0]; ++i, ++idx) {
+                const double x = origin[0] + i * spacing[0];
+                const double y = origin[1] + j * spacing[1];
+                const double z = origin[2] + k * spacing[2];
+                T[idx] = fieldT(x, y, z);
+                vel[3 * idx + 0] = 0.5;
+                vel[3 * idx + 1] = -0.25;
+                vel[3 * idx + 2] = 0.1 * z;
+            }
+        }
+    }
+    const std::vector<vfep::VTKWriteField> fields = {
+        {"Temperature", 1, T.data()}, {"Velocity", 3, vel.data()}, {"density", 1, rho.data()}
+    };
+
+    const char* files[3] = {"test_cfd_8B3_bin.vtk", "test_cfd_8B3.vti", "test_cfd_8B3_ascii.vtk"};
+    REQUIRE(vfep::VTKWriter::writeLegacyStructuredPoints(files[0], dims, origin, spacing, fields, true),
+            "8B3: failed to write legacy binary");
+    REQUIRE(vfep::VTKWriter::writeImageData(files[1], dims, origin, spacing, fields),
+            "8B3: failed to write vti");
+    REQUIRE(vfep::VTKWriter::writeLegacyStructuredPoints(files[2], dims, origin, spacing, fields, false),
+            "8B3: failed to write legacy ascii");
+
+    for (const char* file : files) {
+        vfep::CFDInterface cfd;
+        REQUIRE(cfd.importTemperatureField(file), "8B3: import failed");
+        REQUIRE(cfd.gridPointCount() == n, "8B3: wrong point count");
+        REQUIRE(cfd.gridNx() == 6 && cfd.gridNy() == 5 && cfd.gridNz() == 4, "8B3: wrong dims");
+        REQUIRE(std::abs(cfd.gridXMin() + 1.0) < 1e-9 && std::abs(cfd.gridDy() - 0.25) < 1e-9,
+                "8B3: wrong origin/spacing");
+
+        const double T_q = cfd.interpolateTemperature(0.3, 1.1, 2.4);
+        REQUIRE(std::abs(T_q - fieldT(0.3, 1.1, 2.4)) < 1e-3, "8B3: interpolated temperature mismatch");
+
+        double u, v, w;
+        cfd.interpolateVelocity(0.3, 1.1, 2.4, u, v, w);
+        REQUIRE(std::abs(u - 0.5) < 1e-6 && std::abs(v + 0.25) < 1e-6 && std::abs(w - 0.24) < 1e-6,
+                "8B3: interpolated velocity mismatch");
+        REQUIRE(std::abs(cfd.gridPoints()[7].rho_kg_m3 - 1.1) < 1e-6, "8B3: density not imported");
+        std::remove(file);
+    }
+
+    // Zero-copy view on a native-endian appended array
+    {
+        REQUIRE(vfep::VTKWriter::writeImageData(files[1], dims, origin, spacing, fields),
+                "8B3: failed to rewrite vti");
+        vfep::VTKDataset ds;
+        REQUIRE(vfep::VTKReader::read(files[1], ds), "8B3: raw vti read failed");
+        const vfep::VTKFieldView* view = ds.findPointField({"temperature"}, 1);
+        REQUIRE(view != nullptr && view->type == vfep::VTKScalarType::Float32, "8B3: temperature view");
+        REQUIRE(ds.owned.empty(), "8B3: appended arrays should not be copied");
+        REQUIRE(std::abs(view->get(n - 1) - T[n - 1]) < 1e-3, "8B3: view decode");
+        std::remove(files[1]);
+    }
+
+    // Mock ASCII export (explicit points) maps back onto its lattice
+    {
+        const std::string mock_file = "test_cfd_8B3_mock.vtk";
+        REQUIRE(vfep::CFDInterface::generateMockCFD(mock_file, 5, 5, 3, "room_fire"),
+                "8B3: failed to generate mock CFD");
+        vfep::CFDInterface cfd;
+        REQUIRE(cfd.importTemperatureField(mock_file), "8B3: mock import failed");
+        REQUIRE(cfd.gridNx() == 5 && cfd.gridNy() == 5 && cfd.gridNz() == 3, "8B3: mock lattice not inferred");
+        const double T_center = cfd.interpolateTemperature(2.5, 2.5, 1.5);
+        REQUIRE(std::abs(T_center - (293.15 + 25.0 + 300.0)) < 0.1, "8B3: mock plume temperature");
+        std::remove(mock_file.c_str());
+    }
+
+    // Malformed inputs are rejected rather than read out of bounds
+    {
+        const std::string bad_file = "test_cfd_8B3_bad.vtk";
+        {
+            std::ofstream ofs(bad_file);
+            ofs << "# vtk DataFile Version 3.0\nshort coords\nASCII\nDATASET RECTILINEAR_GRID\n"
+                << "DIMENSIONS 3 2 2\nX_COORDINATES 2 float\n0 1\nY_COORDINATES 2 float\n0 1\n"
+                << "Z_COORDINATES 2 float\n0 1\nPOINT_DATA 12\nSCALARS temperature float 1\nLOOKUP_TABLE default\n"
+                << "300 300 300 300 300 300 300 300 300 300 300 300\n";
+        }
+        vfep::VTKDataset ds;
+        std::string err;
+        REQUIRE(!vfep::VTKReader::read(bad_file, ds, &err), "8B3: coordinate count must match DIMENSIONS");
+        vfep::CFDInterface cfd;
+        REQUIRE(!cfd.importTemperatureField(bad_file), "8B3: short coordinates should not import");
+
+        {
+            std::ofstream ofs(bad_file);
+            ofs << "<?xml version=\"1.0\"?>\n<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"LittleEndian\">\n"
+                << "<ImageData WholeExtent=\"0 1 0 1 0 1\" Origin=\"0 0 0\" Spacing=\"1 1 1\"><Piece Extent=\"0 1 0 1 0 1\">\n"
+                << "<PointData><DataArray type=\"Float32\" Name=\"temperature\" format=\"appended\" offset=\"4000000000\"/>\n"
+                << "</PointData></Piece></ImageData>\n<AppendedData encoding=\"raw\">_0000</AppendedData></VTKFile>\n";
+        }
+        REQUIRE(!vfep::VTKReader::read(bad_file, ds, &err), "8B3: appended offset past the block must fail");
+        std::remove(bad_file.c_str());
+    }
+
+    vfep::CFDInterface missing;
+    REQUIRE(!missing.importTemperatureField("does_not_exist_8B3.vtk"), "8B3: missing file should fail");
+
+    std::cout << "[PASS] 8B3 CFD binary/XML/ASCII VTK import\n";
+}
+
+static void runCFDStructuredBatchInterpolation_8B4()
+{
+    // Structured grid: fields stored per array, coordinates implicit
+    const int nx = 9, ny = 7, nz = 5;
+    const double dx = 0.5, dy = 0.75, dz = 0.6;
+    std::vector<vfep::GridPoint> points;
+    for (int k = 0; k < nz; ++k) {
+        for (int j = 0; j < ny; ++j) {
+            for (int i = 0; i < nx; ++i) {
+                vfep::GridPoint p{};
+                p.x = 1.0 + i * dx;
+                p.y = -2.0 + j * dy;
+                p.z = k * dz;
+                p.T_K = 300.0 + 40.0 * std::sin(0.7 * p.x) * std::cos(0.3 * p.y) + 15.0 * p.z;
+                p.u = 0.1 * i;
+                p.v = -0.05 * j;
+                p.w = 0.2 * k;
+                p.rho_kg_m3 = 1.2;
+                p.P_Pa = 101325.0;
+                points.push_back(p);
+            }
+        }
+    }
+
+    vfep::CFDInterface cfd;
+    cfd.setGridPoints(points, nx, ny, nz, 1.0, -2.0, 0.0, dx, dy, dz);
+    REQUIRE(cfd.isStructured(), "8B4: lattice input should use structured storage");
+    REQUIRE(cfd.gridPointCount() == points.size(), "8B4: point count");
+    REQUIRE(cfd.fieldData(vfep::CFDField::Temperature) != nullptr, "8B4: temperature array");
+    REQUIRE(cfd.fieldData(vfep::CFDField::Temperature)[17] == points[17].T_K, "8B4: temperature array contents");
+
+    // Materialized records reproduce the input (coordinates from lattice)
+    const auto& records = cfd.gridPoints();
+    REQUIRE(records.size() == points.size(), "8B4: gridPoints size");
+    for (size_t i = 0; i < points.size(); ++i) {
+        REQUIRE(std::abs(records[i].x - points[i].x) < 1e-12 &&
+                std::abs(records[i].y - points[i].y) < 1e-12 &&
+                std::abs(records[i].z - points[i].z) < 1e-12, "8B4: gridPoints coordinates");
+        REQUIRE(records[i].T_K == points[i].T_K && records[i].w == points[i].w, "8B4: gridPoints fields");
+    }
+
+    // Concurrent first readers after a change share one rebuild; copies rebuild their own
+    cfd.mutableFieldData(vfep::CFDField::Temperature)[5] = 350.0;
+    const vfep::CFDInterface copy = cfd;
+    std::atomic<int> complete{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&, r] {
+            const auto& view = (r % 2 ? copy : cfd).gridPoints();
+            if (view.size() == points.size() && view[5].T_K == 350.0 && view.back().z == points.back().z) ++complete;
+        });
+    }
+    for (auto& t : readers) t.join();
+    REQUIRE(complete == 4, "8B4: concurrent gridPoints readers see the rebuilt view");
+    cfd.mutableFieldData(vfep::CFDField::Temperature)[5] = points[5].T_K;
+
+    // Batch matches the scalar path, including probes outside the grid
+    const size_t num_probes = 5000;
+    std::vector<double> px(num_probes), py(num_probes), pz(num_probes), batch(num_probes);
+    for (size_t q = 0; q < num_probes; ++q) {
+        const double t = static_cast<double>(q) / num_probes;
+        px[q] = 0.5 + 5.0 * std::fmod(t * 7.31, 1.0);
+        py[q] = -2.5 + 5.5 * std::fmod(t * 3.17, 1.0);
+        pz[q] = -0.3 + 3.0 * std::fmod(t * 5.93, 1.0);
+    }
+    px[0] = 1.0; py[0] = -2.0; pz[0] = 0.0;           // Grid corner
+    px[1] = 1e6; py[1] = 0.0; pz[1] = 1.0;            // Far outside
+    px[2] = 1.0 + 8 * dx; py[2] = 0.0; pz[2] = 1.0;   // Upper x face (outside, as findCell)
+    cfd.interpolateTemperatureBatch(px.data(), py.data(), pz.data(), num_probes, batch.data());
+
+    int inside = 0;
+    for (size_t q = 0; q < num_probes; ++q) {
+        const double scalar = cfd.interpolateTemperature(px[q], py[q], pz[q]);
+        REQUIRE(std::abs(batch[q] - scalar) < 1e-9, "8B4: batch differs from scalar interpolation");
+        if (batch[q] != 293.15) ++inside;
+    }
+    REQUIRE(std::abs(batch[0] - points[0].T_K) < 1e-9, "8B4: corner value");
+    REQUIRE(batch[1] == 293.15 && batch[2] == 293.15, "8B4: outside probes should be ambient");
+    REQUIRE(inside > 1000, "8B4: too few probes inside the grid");
+
+    double u, v, w;
+    cfd.interpolateVelocity(1.0 + 2.5 * dx, -2.0 + 1.5 * dy, 2.5 * dz, u, v, w);
+    REQUIRE(std::abs(u - 0.25) < 1e-12 && std::abs(v + 0.075) < 1e-12 && std::abs(w - 0.5) < 1e-12,
+            "8B4: structured velocity interpolation");
+
+    // Non-lattice input stays unstructured and falls back to ambient
+    std::vector<vfep::GridPoint> scattered(points.begin(), points.begin() + 10);
+    cfd.setGridPoints(scattered, nx, ny, nz, 1.0, -2.0, 0.0, dx, dy, dz);
+    REQUIRE(!cfd.isStructured() && cfd.gridPointCount() == 10, "8B4: scattered storage");
+    REQUIRE(cfd.interpolateTemperature(2.0, 0.0, 1.0) == 293.15, "8B4: scattered interpolation");
+    REQUIRE(cfd.gridPoints()[3].T_K == points[3].T_K, "8B4: scattered gridPoints");
+
+    std::cout << "[PASS] 8B4 CFD structured storage and batch interpolation\n";
+}
+
+static void runCFDOctreeField_8B5()
+{
+    // Adaptive build: refine only around a hotspot, linear field is exact
+    const double lo[3] = {0.0, 0.0, 0.0};
+    const double hi[3] = {2.0, 2.0, 2.0};
+    const int depth = 8;
+    auto linearT = [](double x, double y, double z) { return 300.0 + 10.0 * x + 5.0 * y - 2.0 * z; };
+
+    vfep::OctreeField tree;
+    tree.build(lo, hi, depth,
+               [](const double* clo, const double* chi, int level) {
+                   if (level < 2) return true;
+                   for (int a = 0; a < 3; ++a) {
+                       if (chi[a] < 0.9 || clo[a] > 1.1) return false;
+                   }
+                   return true;
+               },
+               [&](double x, double y, double z, double* values) {
+                   values[0] = linearT(x, y, z);
+                   values[1] = 0.1 * x;
+                   values[2] = 0.0;
+                   values[3] = 0.2 * z;
+                   values[4] = 1.2;
+                   values[5] = 101325.0;
+               });
+    REQUIRE(!tree.empty() && tree.maxDepth() == depth, "8B5: octree built");
+    const size_t dense_cells = size_t(1) << (3 * depth);
+    REQUIRE(tree.leafCount() * 100 < dense_cells, "8B5: leaf count should scale with refinement");
+    REQUIRE(tree.memoryBytes() < dense_cells * 6 * sizeof(double) / 10, "8B5: memory should be sparse");
+
+    int deepest = 0;
+    for (size_t l = 0; l < tree.leafCount(); ++l) {
+        if (l > 0) REQUIRE(tree.leafKey(l) > tree.leafKey(l - 1), "8B5: leaves must be in Morton order");
+        deepest = std::max(deepest, tree.leafLevel(l));
+    }
+    REQUIRE(deepest == depth, "8B5: hotspot should reach the finest level");
+
+    uint32_t seed = 12345u;
+    auto uniform = [&seed](double a, double b) {
+        seed = seed * 1664525u + 1013904223u;
+        return a + (b - a) * (seed >> 8) / double(1u << 24);
+    };
+    for (int q = 0; q < 2000; ++q) {
+        const double x = uniform(0.0, 2.0), y = uniform(0.0, 2.0), z = uniform(0.0, 2.0);
+        const long long leaf = tree.findLeaf(x, y, z);
+        REQUIRE(leaf >= 0, "8B5: point inside domain must have a leaf");
+        double blo[3], bhi[3];
+        tree.leafBounds(static_cast<size_t>(leaf), blo, bhi);
+        REQUIRE(x >= blo[0] - 1e-12 && x <= bhi[0] + 1e-12 &&
+                y >= blo[1] - 1e-12 && y <= bhi[1] + 1e-12 &&
+                z >= blo[2] - 1e-12 && z <= bhi[2] + 1e-12, "8B5: leaf bounds must contain point");
+        const double T = tree.interpolate(vfep::CFDField::Temperature, x, y, z, -1.0);
+        REQUIRE(std::abs(T - linearT(x, y, z)) < 1e-9, "8B5: trilinear leaf interpolation of linear field");
+    }
+    REQUIRE(tree.findLeaf(2.5, 1.0, 1.0) == -1, "8B5: outside point has no leaf");
+    REQUIRE(tree.interpolate(vfep::CFDField::Temperature, -0.1, 1.0, 1.0, 293.15) == 293.15, "8B5: outside fallback");
+    REQUIRE(tree.findLeaf(2.0, 2.0, 2.0) >= 0, "8B5: upper domain corner is inside");
+
+    bool threw = false;
+    try {
+        tree.build(hi, lo, depth, [](const double*, const double*, int) { return false; },
+                   [](double, double, double, double*) {});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    REQUIRE(threw, "8B5: inverted domain should throw");
+
+    // Scattered CFD output: VTK round trip resampled into the octree
+    std::vector<vfep::GridPoint> scattered;
+    for (int n = 0; n < 6000; ++n) {
+        vfep::GridPoint p{};
+        p.x = uniform(0.0, 4.0);
+        p.y = uniform(0.0, 2.0);
+        p.z = uniform(0.0, 3.0);
+        p.T_K = 300.0 + 8.0 * p.x + 4.0 * p.y + 6.0 * p.z;
+        p.u = 0.5;
+        p.v = -0.25;
+        p.w = 0.1 * p.z;
+        p.rho_kg_m3 = 1.2;
+        p.P_Pa = 101325.0;
+        scattered.push_back(p);
+    }
+    vfep::CFDInterface writer;
+    REQUIRE(writer.exportResults("test_octree_scattered.vtk", scattered), "8B5: export scattered");
+
+    vfep::CFDInterface cfd;
+    REQUIRE(cfd.importTemperatureField("test_octree_scattered.vtk"), "8B5: import scattered");
+    std::remove("test_octree_scattered.vtk");
+    REQUIRE(!cfd.isStructured() && cfd.gridPointCount() == scattered.size(), "8B5: scattered stays unstructured");
+    REQUIRE(cfd.octree() != nullptr && cfd.octree()->leafCount() > 64, "8B5: octree resampling");
+
+    const size_t num_probes = 500;
+    std::vector<double> px(num_probes), py(num_probes), pz(num_probes), batch(num_probes);
+    for (size_t q = 0; q < num_probes; ++q) {
+        px[q] = uniform(0.5, 3.5);
+        py[q] = uniform(0.5, 1.5);
+        pz[q] = uniform(0.5, 2.5);
+    }
+    cfd.interpolateTemperatureBatch(px.data(), py.data(), pz.data(), num_probes, batch.data());
+    double sum_err = 0.0;
+    for (size_t q = 0; q < num_probes; ++q) {
+        const double exact = 300.0 + 8.0 * px[q] + 4.0 * py[q] + 6.0 * pz[q];
+        const double scalar = cfd.interpolateTemperature(px[q], py[q], pz[q]);
+        REQUIRE(batch[q] == scalar, "8B5: batch differs from scalar interpolation");
+        REQUIRE(std::abs(scalar - exact) < 5.0, "8B5: resampled temperature error");
+        sum_err += std::abs(scalar - exact);
+    }
+    REQUIRE(sum_err / num_probes < 1.5, "8B5: mean resampling error");
+
+    double u, v, w;
+    cfd.interpolateVelocity(2.0, 1.0, 1.5, u, v, w);
+    REQUIRE(std::abs(u - 0.5) < 1e-9 && std::abs(v + 0.25) < 1e-9 && std::abs(w - 0.15) < 0.05,
+            "8B5: resampled velocity");
+    REQUIRE(cfd.interpolateTemperature(10.0, 1.0, 1.0) == 293.15, "8B5: outside scattered domain is ambient");
+
+    cfd.clear();
+    REQUIRE(cfd.octree() == nullptr, "8B5: clear drops the octree");
+
+    std::cout << "[PASS] 8B5 CFD octree field and scattered resampling\n";
+}
+
+static void runCFDTimeSeriesReplay_8B6()
+{
+    // Five transient frames named by output step; T rises 10 K per step
+    const std::string dir = "test_cfd_series";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const int dims[3] = {4, 3, 5};
+    const double origin[3] = {0.0, 0.0, 0.0};
+    const double spacing[3] = {0.5, 0.5, 0.5};
+    const size_t n = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+    for (int step = 0; step < 5; ++step) {
+        std::vector<double> T(n), vel(3 * n, 0.0), rho(n, 1.2), p(n, 101325.0);
+        for (size_t idx = 0; idx < n; ++idx) {
+            const double x = (idx % dims[0]) * spacing[0];
+            T[idx] = 300.0 + 10.0 * step + 4.0 * x;
+            vel[3 * idx + 2] = 0.1 * step;
+        }
+        const std::vector<vfep::VTKWriteField> fields = {
+            {"T", 1, T.data()}, {"U", 3, vel.data()}, {"rho", 1, rho.data()}, {"p", 1, p.data()}
+        };
+        const std::string file = dir + "/fire_" + std::to_string(1000 + step).substr(1) + ".vti";
+        REQUIRE(vfep::VTKWriter::writeImageData(file, dims, origin, spacing, fields), "8B6: write frame");
+    }
+    std::ofstream(dir + "/notes.txt") << "not a frame\n";
+    std::ofstream(dir + "/fire_001.vtk") << "same step in a second format\n";
+
+    double number = 0.0;
+    REQUIRE(vfep::CFDTimeSeries::parseFrameNumber("run2_t1.25.vtk", number) && number == 1.25,
+            "8B6: decimal frame number");
+    REQUIRE(!vfep::CFDTimeSeries::parseFrameNumber("final.vti", number), "8B6: name without number");
+    REQUIRE(!vfep::CFDTimeSeries::parseFrameNumber("f" + std::string(400, '9') + ".vti", number),
+            "8B6: out-of-range frame number");
+
+    auto series = std::make_shared<vfep::CFDTimeSeries>(2);
+    REQUIRE(series->openDirectory(dir, 0.5), "8B6: open series directory");
+    REQUIRE(series->frameCount() == 5, "8B6: frame count");
+    REQUIRE(std::filesystem::path(series->framePath(1)).filename() == "fire_001.vti",
+            "8B6: duplicate step resolved by path");
+    REQUIRE(series->startTime() == 0.0 && std::abs(series->endTime() - 2.0) < 1e-12, "8B6: frame times");
+    REQUIRE(series->residentFrames() == 0, "8B6: frames must load lazily");
+
+    // Blend between frames 1 and 2 (t = 0.5 and 1.0)
+    vfep::CFDInterface out;
+    REQUIRE(series->sample(0.8, out), "8B6: sample");
+    REQUIRE(out.isStructured() && out.gridPointCount() == n, "8B6: sampled grid");
+    REQUIRE(std::abs(out.interpolateTemperature(0.5, 0.5, 1.0) - (300.0 + 16.0 + 2.0)) < 1e-4,
+            "8B6: temporal interpolation");
+    REQUIRE(std::abs(series->interpolateTemperature(0.8, 0.5, 0.5, 1.0) - 318.0) < 1e-4,
+            "8B6: point temporal interpolation");
+    REQUIRE(series->residentFrames() == 2 && series->stats().page_ins == 2, "8B6: two frames paged in");
+
+    // Sweep forward: LRU cap holds, reused frames are hits, out keeps its arrays
+    const double* before = out.fieldData(vfep::CFDField::Temperature);
+    for (double t = 0.8; t <= 2.0 + 1e-9; t += 0.1) {
+        REQUIRE(series->sample(t, out), "8B6: sweep sample");
+        REQUIRE(series->residentFrames() <= 2, "8B6: LRU cap exceeded");
+    }
+    REQUIRE(out.fieldData(vfep::CFDField::Temperature) == before, "8B6: blend should reuse field arrays");
+    REQUIRE(series->stats().page_ins == 4 && series->stats().evictions == 2, "8B6: paging counts");
+    REQUIRE(series->stats().hits > 10, "8B6: resident frames should be reused");
+
+    // Clamped outside the recorded interval
+    REQUIRE(std::abs(series->interpolateTemperature(5.0, 0.0, 0.0, 0.0) - 340.0) < 1e-4, "8B6: clamp to last frame");
+    REQUIRE(std::abs(series->interpolateTemperature(-1.0, 0.0, 0.0, 0.0) - 300.0) < 1e-4, "8B6: clamp to first frame");
+
+    // Coupler replay: synchronize() samples the series at sim time + offset
+    vfep::CFDCoupler coupler;
+    coupler.setLooseCouplingTimeStep(0.1f);
+    coupler.startReplay(series, 0.5);
+    REQUIRE(coupler.isReplaying(), "8B6: replay active");
+    coupler.synchronize(0.25f);
+    REQUIRE(std::abs(coupler.cfdInterface().interpolateTemperature(0.0, 0.0, 0.0) - 315.0) < 1e-3,
+            "8B6: replayed temperature");
+    double u, v, w;
+    coupler.cfdInterface().interpolateVelocity(0.5, 0.5, 0.5, u, v, w);
+    REQUIRE(std::abs(w - 0.15) < 1e-6, "8B6: replayed velocity");
+
+    bool threw = false;
+    try {
+        coupler.startReplay(std::make_shared<vfep::CFDTimeSeries>());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    REQUIRE(threw, "8B6: empty series should throw");
+    coupler.reset();
+    REQUIRE(!coupler.isReplaying(), "8B6: reset stops replay");
+
+    std::filesystem::remove_all(dir);
+    std::cout << "[PASS] 8B6 CFD time-series cache and coupler replay\n";
+}
+
+static void runCFDParallelComparison_8B7()
+{
+    // Large offset: naive sum-of-squares correlation would lose all digits
+    const int nx = 80, ny = 60, nz = 50;
+    const size_t n = static_cast<size_t>(nx) * ny * nz;
+    std::vector<vfep::GridPoint> vfep_points(n), cfd_points(n);
+    std::vector<double> Ta(n), Tb(n);
+    for (size_t i = 0; i < n; ++i) {
+        vfep::GridPoint p{};
+        p.x = static_cast<double>(i % nx) * 0.1;
+        p.y = static_cast<double>((i / nx) % ny) * 0.1;
+        p.z = static_cast<double>(i / (nx * ny)) * 0.1;
+        p.T_K = 1e8 + 50.0 * std::sin(0.001 * i);
+        p.u = 0.3 * std::cos(0.002 * i);
+        p.v = 0.1;
+        p.w = 0.2 * std::sin(0.003 * i);
+        vfep_points[i] = p;
+        p.T_K += 0.5 + 2.0 * std::cos(0.01 * i);
+        p.u += 0.05;
+        cfd_points[i] = p;
+        Ta[i] = vfep_points[i].T_K;
+        Tb[i] = cfd_points[i].T_K;
+    }
+
+    // Reference: long double two-pass
+    long double mean_a = 0, mean_b = 0, sum_abs = 0, sum_sq = 0, max_abs = 0;
+    for (size_t i = 0; i < n; ++i) {
+        mean_a += Ta[i];
+        mean_b += Tb[i];
+        const long double e = std::abs(static_cast<long double>(Ta[i]) - Tb[i]);
+        sum_abs += e;
+        sum_sq += e * e;
+        max_abs = std::max(max_abs, e);
+    }
+    mean_a /= n;
+    mean_b /= n;
+    long double saa = 0, sbb = 0, sab = 0;
+    for (size_t i = 0; i < n; ++i) {
+        saa += (Ta[i] - mean_a) * (Ta[i] - mean_a);
+        sbb += (Tb[i] - mean_b) * (Tb[i] - mean_b);
+        sab += (Ta[i] - mean_a) * (Tb[i] - mean_b);
+    }
+    const double ref_corr = static_cast<double>(sab / std::sqrt(saa * sbb));
+
+    vfep::CFDInterface cfd;
+    const auto stats = cfd.compareTemperature(vfep_points, cfd_points);
+    REQUIRE(stats.num_points == static_cast<int>(n), "8B7: point count");
+    REQUIRE(std::abs(stats.mean_error - static_cast<double>(sum_abs / n)) < 1e-6, "8B7: mean error");
+    REQUIRE(std::abs(stats.rmse - static_cast<double>(std::sqrt(sum_sq / n))) < 1e-6, "8B7: rmse");
+    REQUIRE(std::abs(stats.max_error - static_cast<double>(max_abs)) < 1e-6, "8B7: max error");
+    REQUIRE(std::abs(stats.correlation - ref_corr) < 1e-6, "8B7: correlation with large offset");
+
+    // SoA arrays give the same statistics as the point records
+    const auto soa = cfd.compareFields(Ta.data(), Tb.data(), n);
+    REQUIRE(soa.num_points == stats.num_points && soa.mean_error == stats.mean_error &&
+            soa.rmse == stats.rmse && soa.correlation == stats.correlation, "8B7: SoA matches AoS");
+
+    // Velocity magnitude: array and record paths agree
+    std::vector<double> ua(n), va(n), wa(n), ub(n), vb(n), wb(n);
+    for (size_t i = 0; i < n; ++i) {
+        ua[i] = vfep_points[i].u; va[i] = vfep_points[i].v; wa[i] = vfep_points[i].w;
+        ub[i] = cfd_points[i].u; vb[i] = cfd_points[i].v; wb[i] = cfd_points[i].w;
+    }
+    const double* vfep_uvw[3] = {ua.data(), va.data(), wa.data()};
+    const double* cfd_uvw[3] = {ub.data(), vb.data(), wb.data()};
+    const auto vel = cfd.compareVelocity(vfep_points, cfd_points);
+    const auto vel_soa = cfd.compareVelocityFields(vfep_uvw, cfd_uvw, n);
+    REQUIRE(vel.num_points == static_cast<int>(n) && vel.mean_error > 0.0 && vel.mean_error < 0.06,
+            "8B7: velocity magnitude error");
+    REQUIRE(vel_soa.mean_error == vel.mean_error && vel_soa.correlation == vel.correlation,
+            "8B7: velocity SoA matches AoS");
+    REQUIRE(vel.correlation > 0.0 && vel.correlation <= 1.0, "8B7: velocity magnitude correlation");
+
+    // Mask and regions on the loaded grid
+    cfd.setGridPoints(cfd_points, nx, ny, nz, 0.0, 0.0, 0.0, 0.1, 0.1, 0.1);
+    REQUIRE(cfd.isStructured(), "8B7: structured grid");
+    const std::vector<vfep::ComparisonRegion> regions = {
+        {"plume", 2.0, 2.0, 0.0, 6.0, 4.0, 4.9},
+        {"ceiling", 0.0, 0.0, 4.0, 7.9, 5.9, 4.9},
+    };
+    const auto labels = cfd.regionLabels(regions);
+    REQUIRE(labels.size() == n, "8B7: one label per point");
+    const auto by_region = cfd.compareFieldsByRegion(Ta.data(), cfd.fieldData(vfep::CFDField::Temperature),
+                                                     n, labels.data(), regions.size());
+    REQUIRE(by_region.size() == 2, "8B7: per-region results");
+
+    std::vector<uint8_t> mask(n);
+    size_t expected[2] = {0, 0};
+    for (size_t i = 0; i < n; ++i) {
+        mask[i] = labels[i] == 0;
+        if (labels[i] < 2) ++expected[labels[i]];
+    }
+    REQUIRE(expected[0] > 0 && expected[1] > 0, "8B7: regions should be non-empty");
+    REQUIRE(by_region[0].num_points == static_cast<int>(expected[0]) &&
+            by_region[1].num_points == static_cast<int>(expected[1]), "8B7: region counts (first match wins)");
+    const auto masked = cfd.compareFields(Ta.data(), Tb.data(), n, mask.data());
+    REQUIRE(masked.num_points == by_region[0].num_points &&
+            std::abs(masked.rmse - by_region[0].rmse) < 1e-12 &&
+            std::abs(masked.correlation - by_region[0].correlation) < 1e-12, "8B7: mask matches region");
+
+    const auto records_by_region = cfd.compareTemperatureByRegion(vfep_points, cfd_points, regions);
+    REQUIRE(records_by_region[1].num_points == by_region[1].num_points &&
+            std::abs(records_by_region[1].mean_error - by_region[1].mean_error) < 1e-12,
+            "8B7: record and array region breakdowns agree");
+
+    // Up to 65535 labels: one accumulator per label, each region's moments exact
+    {
+        const size_t num_labels = 65535;
+        std::vector<uint16_t> many(n);
+        for (size_t i = 0; i < n; ++i) many[i] = static_cast<uint16_t>((i * 7919) % num_labels);
+        const auto fine = cfd.compareFieldsByRegion(Ta.data(), Tb.data(), n, many.data(), num_labels);
+        REQUIRE(fine.size() == num_labels, "8B7: one result per label");
+        const uint16_t probe = many[n / 2];
+        std::vector<uint8_t> probe_mask(n);
+        for (size_t i = 0; i < n; ++i) probe_mask[i] = many[i] == probe;
+        const auto probe_stats = cfd.compareFields(Ta.data(), Tb.data(), n, probe_mask.data());
+        REQUIRE(fine[probe].num_points == probe_stats.num_points &&
+                std::abs(fine[probe].rmse - probe_stats.rmse) < 1e-9 * (1.0 + probe_stats.rmse),
+                "8B7: many-label breakdown matches a mask");
+    }
+
+    const auto empty = cfd.compareFields(Ta.data(), Tb.data(), 0);
+    REQUIRE(empty.num_points == 0 && empty.rmse == 0.0, "8B7: empty comparison");
+
+    std::cout << "[PASS] 8B7 CFD one-pass parallel comparison statistics\n";
+}
+
 // =======================
 // Phase 9A: Radiation Model Tests
 // =======================
@@ -4722,6 +5306,168 @@ static void runCFDCouplerSynchronization_9C3()
     std::cout << "[PASS] 9C3 CFD coupler temporal synchronization\n";
 }
 
+static void runCFDCouplerInPlaceUpdate_9C4()
+{
+    vfep::CFDCoupler coupler;
+    vfep::ThreeZoneModel zones(3.0, 25.0, 5);
+    zones.reset(293.15, 101325.0);
+    coupler.setLooseCouplingTimeStep(0.1f);
+    coupler.exportBoundaryConditions(zones);
+
+    vfep::CFDInterface& cfd = coupler.cfdInterface();
+    REQUIRE(cfd.isStructured() && cfd.gridPointCount() == 27, "9C4: coupler grid should be structured 3x3x3");
+    const double* T_before_ptr = cfd.fieldData(vfep::CFDField::Temperature);
+    const std::vector<double> T_before(T_before_ptr, T_before_ptr + 27);
+
+    // Mock step updates the arrays in place (no reallocation)
+    coupler.synchronize(0.5f);
+    REQUIRE(cfd.fieldData(vfep::CFDField::Temperature) == T_before_ptr, "9C4: temperature array reallocated");
+    const double omega = 0.5, amp_T = 5.0;
+    for (int idx = 0; idx < 27; ++idx) {
+        const double z = (idx / 9) * 1.5;
+        const double expected = T_before[idx] + amp_T * std::sin(omega * 0.5 + 0.5 * z);
+        REQUIRE(std::abs(cfd.fieldData(vfep::CFDField::Temperature)[idx] - expected) < 1e-9,
+                "9C4: in-place mock step mismatch");
+    }
+    REQUIRE(std::abs(cfd.gridPoints()[26].T_K - cfd.fieldData(vfep::CFDField::Temperature)[26]) < 1e-12,
+            "9C4: gridPoints view out of date after in-place update");
+
+    // Double buffering: producer fills a back buffer, then swaps by pointer
+    std::vector<double> back(27, 500.0);
+    const double* back_ptr = back.data();
+    REQUIRE(cfd.swapFieldBuffer(vfep::CFDField::Temperature, back), "9C4: swap failed");
+    REQUIRE(cfd.fieldData(vfep::CFDField::Temperature) == back_ptr, "9C4: swap should exchange storage");
+    REQUIRE(back.data() == T_before_ptr, "9C4: previous array should be returned for reuse");
+    REQUIRE(std::abs(coupler.getZoneTemperatureFromCFD(1) - 500.0f) < 1e-3f, "9C4: swapped field not visible");
+    REQUIRE(cfd.gridPoints()[0].T_K == 500.0, "9C4: gridPoints view out of date after swap");
+
+    std::vector<double> wrong_size(10, 0.0);
+    REQUIRE(!cfd.swapFieldBuffer(vfep::CFDField::Temperature, wrong_size), "9C4: size mismatch should be rejected");
+
+    // Moving results in hands over the arrays without copying
+    vfep::CFDInterface solver;
+    solver.resizeStructuredGrid(4, 4, 4, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+    double* solver_T = solver.mutableFieldData(vfep::CFDField::Temperature);
+    std::fill(solver_T, solver_T + 64, 350.0);
+    coupler.importCFDResults(std::move(solver));
+    REQUIRE(coupler.cfdInterface().fieldData(vfep::CFDField::Temperature) == solver_T,
+            "9C4: moved import should keep the solver's array");
+    REQUIRE(std::abs(coupler.getZoneTemperatureFromCFD(2) - 350.0f) < 1e-3f, "9C4: moved import values");
+
+    std::cout << "[PASS] 9C4 CFD coupler in-place and double-buffered field updates\n";
+}
+
+static void runCFDCouplerAsyncPipeline_9C5()
+{
+    // Stand-in solver on a thread, attached to the coupler's shared-memory channel
+    auto startSolver = [](const std::string& name, std::atomic<bool>& stop) {
+        return std::thread([name, &stop]() {
+            vfep::CFDAsyncChannel channel;
+            while (!channel.open(name)) {
+                if (stop.load()) return;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            vfep::CFDStandInOptions options;
+            options.latency_ms = 2.0;
+            vfep::runCFDStandInSolver(channel, options, &stop);
+        });
+    };
+
+    // Pipelined: zone model keeps stepping while results trail behind
+    {
+        vfep::CFDCoupler coupler;
+        vfep::ThreeZoneModel zones(3.0, 25.0, 5);
+        zones.reset(293.15, 101325.0);
+        coupler.setLooseCouplingTimeStep(0.1f);
+
+        vfep::CFDAsyncConfig config;
+        config.channel_name = vfep::CFDAsyncChannel::uniqueName("vfep_test_9C5a");
+        config.max_staleness_s = 0.5f;
+
+        std::atomic<bool> stop{false};
+        std::thread solver = startSolver(config.channel_name, stop);
+        REQUIRE(coupler.startAsyncCoupling(config), "9C5: async coupling failed to start");
+        REQUIRE(coupler.isAsyncCoupling(), "9C5: async flag");
+
+        float sim_time = 0.0f;
+        for (int step = 0; step < 40; ++step) {
+            zones.step(0.1, 30e3, 5e3, 0.5);
+            sim_time += 0.1f;
+            coupler.exportBoundaryConditions(zones);
+            coupler.synchronize(sim_time);
+            const float T_upper = coupler.getZoneTemperatureFromCFD(0);
+            REQUIRE_FINITE(T_upper, "9C5: upper temperature from async CFD");
+            REQUIRE(T_upper >= 250.0f && T_upper < 2000.0f, "9C5: upper temperature out of range");
+        }
+
+        const vfep::CFDAsyncStats& stats = coupler.asyncStats();
+        REQUIRE(stats.boundaries_sent + stats.boundaries_dropped == 40, "9C5: every export accounted for");
+        REQUIRE(stats.results_applied > 0 && stats.results_applied <= stats.boundaries_sent,
+                "9C5: results applied");
+        REQUIRE(stats.staleness_s <= config.max_staleness_s + 1e-4f || stats.stale_syncs > 0 ||
+                stats.results_applied == stats.boundaries_sent,
+                "9C5: staleness bound not enforced");
+        REQUIRE(std::isfinite(stats.mean_solver_ms) && stats.mean_solver_ms >= 1.0,
+                "9C5: solver latency telemetry");
+        REQUIRE(stats.max_lag_s >= stats.last_lag_s && stats.last_lag_s >= 0.0f, "9C5: lag telemetry");
+
+        coupler.stopAsyncCoupling();
+        REQUIRE(!coupler.isAsyncCoupling(), "9C5: stop");
+        stop.store(true);
+        solver.join();
+    }
+
+    // Zero staleness: every sync waits for the answer to the previous export
+    {
+        vfep::CFDCoupler coupler;
+        vfep::ThreeZoneModel zones(3.0, 25.0, 5);
+        zones.reset(293.15, 101325.0);
+        coupler.setLooseCouplingTimeStep(0.05f);  // Below the step: every sync runs
+
+        vfep::CFDAsyncConfig config;
+        config.channel_name = vfep::CFDAsyncChannel::uniqueName("vfep_test_9C5b");
+        config.max_staleness_s = 0.0f;
+        config.extrapolate = false;
+
+        std::atomic<bool> stop{false};
+        std::thread solver = startSolver(config.channel_name, stop);
+        REQUIRE(coupler.startAsyncCoupling(config), "9C5: async coupling failed to start (strict)");
+
+        float sim_time = 0.0f;
+        float exported_at = 0.0f;
+        for (int step = 0; step < 10; ++step) {
+            zones.step(0.1, 30e3, 5e3, 0.5);
+            const double T_upper_zone = zones.upperZone().T_K;
+            coupler.exportBoundaryConditions(zones);
+            sim_time += 0.1f;
+            coupler.synchronize(sim_time);
+
+            const double expected = T_upper_zone + 5.0 * std::sin(0.5 * exported_at + 0.5 * 3.0);
+            const double* T = coupler.cfdInterface().fieldData(vfep::CFDField::Temperature);
+            REQUIRE(T != nullptr && std::abs(T[26] - expected) < 1e-9, "9C5: solver result not applied in place");
+            // Same zone-to-grid mapping as the blocking mock: w is 0.1 in the lower zone, 0.5 above
+            const double* w = coupler.cfdInterface().fieldData(vfep::CFDField::VelocityW);
+            for (int k = 0; k < 3; ++k) {
+                const double z = 1.5 * k;
+                const double w_zone = k == 0 ? 0.1 : 0.5;
+                REQUIRE(std::abs(w[9 * k + 4] - (w_zone + 0.1 * std::cos(0.5 * exported_at + 0.5 * z))) < 1e-9,
+                        "9C5: stand-in solver maps zones to the grid like the blocking mock");
+            }
+            exported_at = sim_time;
+        }
+        const vfep::CFDAsyncStats& stats = coupler.asyncStats();
+        REQUIRE(stats.results_applied == 10 && stats.blocking_waits == 10 && stats.stale_syncs == 0,
+                "9C5: strict mode should wait once per sync");
+        REQUIRE(std::abs(stats.staleness_s - 0.1f) < 1e-4f, "9C5: strict staleness");
+
+        stop.store(true);
+        coupler.reset();
+        solver.join();
+    }
+
+    std::cout << "[PASS] 9C5 CFD coupler asynchronous pipelined coupling\n";
+}
+
 // =======================
 // Phase 9D: Flame Spread Model Tests
 // =======================
@@ -4882,8 +5628,1882 @@ static void runFlameSpreadPropagation_9D3()
     std::cout << "[PASS] 9D3 Flame spread propagation scenario\n";
 }
 
+
+static void runFlameSpreadIgnitionPrediction_9D4()
+{
+    // Test event-queue ignition prediction: predicted time matches the step
+    // at which the surface actually ignites, and unheated surfaces stay idle
+    vfep::FlameSpreadModel flame_model;
+
+    vfep::FlammableSurface source;
+    source.x_m = 0.0f;
+    source.y_m = 0.0f;
+    source.z_m = 1.0f;
+    source.area_m2 = 1.0f;
+    source.temperature_K = 293.15f;
+    source.ignition_temp_K = 500.0f;
+    source.hrrpua_W_m2 = 400.0f;
+    source.mass_loss_rate_kg_s = 0.0f;  // Constant flux
+
+    vfep::FlammableSurface target = source;
+    target.x_m = 0.3f;
+
+    vfep::FlammableSurface remote = source;
+    remote.x_m = 5.0f;
+
+    int id_source = flame_model.addSurface(source);
+    int id_target = flame_model.addSurface(target);
+    int id_remote = flame_model.addSurface(remote);
+
+    REQUIRE(std::isinf(flame_model.getTimeToIgnition(id_target)), "9D4: no prediction without a flame");
+
+    flame_model.igniteAtLocation(id_source);
+
+    float q_target = flame_model.getIncidentHeatFluxWm2(id_target);
+    float expected_q = 400.0f / (4.0f * 3.14159f * 0.3f * 0.3f);
+    REQUIRE(std::abs(q_target - expected_q) < 1.0f, "9D4: incident flux mismatch");
+    REQUIRE(flame_model.getIncidentHeatFluxWm2(id_remote) == 0.0f, "9D4: remote surface should see no flux");
+    REQUIRE(std::isinf(flame_model.getTimeToIgnition(id_remote)), "9D4: remote surface should never ignite");
+
+    float t_pred = flame_model.getTimeToIgnition(id_target);
+    REQUIRE_FINITE(t_pred, "9D4: predicted ignition time");
+    REQUIRE(t_pred > 0.0f, "9D4: prediction should be in the future");
+
+    float dt = 0.1f;
+    float t_ignite = -1.0f;
+    float prev_T = flame_model.getSurfaceTemperature(id_target);
+    for (int step = 0; step < 1000; ++step) {
+        flame_model.updateFlameSpread(dt);
+        if (flame_model.isSurfaceBurning(id_target)) {
+            t_ignite = static_cast<float>(flame_model.getModelTime());
+            break;
+        }
+        float T = flame_model.getSurfaceTemperature(id_target);
+        REQUIRE(T >= prev_T, "9D4: heated surface temperature must not decrease");
+        prev_T = T;
+    }
+
+    REQUIRE(t_ignite > 0.0f, "9D4: target should ignite");
+    REQUIRE(t_ignite >= t_pred - 1e-3f && t_ignite <= t_pred + dt + 1e-3f,
+            "9D4: ignition should occur at the first step past the predicted time");
+    REQUIRE(!flame_model.isSurfaceBurning(id_remote), "9D4: remote surface must not ignite");
+
+    // Extinguishing the flames removes the flux and the prediction
+    flame_model.extinguish(id_source);
+    flame_model.extinguish(id_target);
+    REQUIRE(flame_model.getNumBurningSurfaces() == 0, "9D4: all extinguished");
+    REQUIRE(flame_model.getIncidentHeatFluxWm2(id_remote) == 0.0f, "9D4: flux cleared");
+
+    std::cout << "[PASS] 9D4 Flame spread event-queue ignition prediction\n";
+}
+
+
+// =======================
+// Phase 9E: Surface Mesh Import Tests
+// =======================
+
+static void writeCubeSTL(const std::string& path, float side_m, bool binary)
+{
+    // 12 triangles, two per face of an axis-aligned cube at the origin
+    const float s = side_m;
+    const float quads[6][4][3] = {
+        {{0,0,0},{s,0,0},{s,s,0},{0,s,0}}, {{0,0,s},{0,s,s},{s,s,s},{s,0,s}},
+        {{0,0,0},{0,0,s},{s,0,s},{s,0,0}}, {{0,s,0},{s,s,0},{s,s,s},{0,s,s}},
+        {{0,0,0},{0,s,0},{0,s,s},{0,0,s}}, {{s,0,0},{s,0,s},{s,s,s},{s,s,0}},
+    };
+    std::vector<std::array<float, 12>> tris;
+    for (const auto& q : quads) {
+        tris.push_back({0,0,0, q[0][0],q[0][1],q[0][2], q[1][0],q[1][1],q[1][2], q[2][0],q[2][1],q[2][2]});
+        tris.push_back({0,0,0, q[0][0],q[0][1],q[0][2], q[2][0],q[2][1],q[2][2], q[3][0],q[3][1],q[3][2]});
+    }
+
+    if (binary) {
+        std::ofstream out(path, std::ios::binary);
+        char header[80] = {};
+        std::strncpy(header, "solid cube written as binary", sizeof(header) - 1);
+        out.write(header, 80);
+        uint32_t n = static_cast<uint32_t>(tris.size());
+        out.write(reinterpret_cast<const char*>(&n), 4);
+        for (const auto& t : tris) {
+            out.write(reinterpret_cast<const char*>(t.data()), 48);
+            uint16_t attr = 0;
+            out.write(reinterpret_cast<const char*>(&attr), 2);
+        }
+    } else {
+        std::ofstream out(path);
+        out << "solid cube\n";
+        for (const auto& t : tris) {
+            out << "  facet normal 0 0 0\n    outer loop\n";
+            for (int v = 0; v < 3; ++v) {
+                out << "      vertex " << t[3 + 3*v] << " " << t[4 + 3*v] << " " << t[5 + 3*v] << "\n";
+            }
+            out << "    endloop\n  endfacet\n";
+        }
+        out << "endsolid cube\n";
+    }
+}
+
+static void runSurfaceMeshImport_9E1()
+{
+    // Test binary and ASCII STL import and patch coarsening
+    const std::string bin_file = "test_mesh_9E1_bin.stl";
+    const std::string txt_file = "test_mesh_9E1_ascii.stl";
+    writeCubeSTL(bin_file, 2.0f, true);
+    writeCubeSTL(txt_file, 2.0f, false);
+
+    vfep::SurfaceMesh bin_mesh;
+    REQUIRE(bin_mesh.loadSTL(bin_file), "9E1: failed to load binary STL");
+    REQUIRE(bin_mesh.isBinarySource(), "9E1: binary STL not detected as binary");
+    REQUIRE(bin_mesh.getNumTriangles() == 12, "9E1: binary triangle count");
+
+    vfep::SurfaceMesh txt_mesh;
+    REQUIRE(txt_mesh.loadSTL(txt_file), "9E1: failed to load ASCII STL");
+    REQUIRE(!txt_mesh.isBinarySource(), "9E1: ASCII STL detected as binary");
+    REQUIRE(txt_mesh.getNumTriangles() == 12, "9E1: ASCII triangle count");
+
+    REQUIRE(std::abs(bin_mesh.getTotalArea() - 24.0f) < 1e-3f, "9E1: cube area should be 24 m²");
+    REQUIRE(std::abs(txt_mesh.getTotalArea() - bin_mesh.getTotalArea()) < 1e-3f,
+            "9E1: ASCII and binary areas differ");
+    REQUIRE(std::abs(bin_mesh.getBoundsMax().z - 2.0f) < 1e-6f, "9E1: bounds mismatch");
+
+    // Unit scaling (file in millimetres)
+    vfep::SurfaceMesh mm_mesh;
+    REQUIRE(mm_mesh.loadSTL(bin_file, 0.001f), "9E1: failed to load scaled STL");
+    REQUIRE(std::abs(mm_mesh.getTotalArea() - 24.0e-6f) < 1e-9f, "9E1: unit scale not applied");
+
+    // Binary with trailing padding, and with a count short of the records present
+    {
+        std::ofstream pad(bin_file, std::ios::binary | std::ios::app);
+        const char zeros[37] = {};
+        pad.write(zeros, sizeof(zeros));
+    }
+    vfep::SurfaceMesh padded_mesh;
+    REQUIRE(padded_mesh.loadSTL(bin_file), "9E1: padded binary STL should load");
+    REQUIRE(padded_mesh.isBinarySource() && padded_mesh.getNumTriangles() == 12, "9E1: padded binary triangles");
+    {
+        std::fstream patch(bin_file, std::ios::binary | std::ios::in | std::ios::out);
+        patch.seekp(80);
+        const uint32_t short_count = 10;
+        patch.write(reinterpret_cast<const char*>(&short_count), 4);
+    }
+    vfep::SurfaceMesh short_mesh;
+    REQUIRE(short_mesh.loadSTL(bin_file), "9E1: short-count binary STL should load");
+    REQUIRE(short_mesh.isBinarySource() && short_mesh.getNumTriangles() == 10, "9E1: short count honoured");
+
+    // Coarse target: one patch per cube face; fine target: area preserved
+    auto face_patches = bin_mesh.coarsenToPatches(16.0f);
+    REQUIRE(face_patches.size() == 6, "9E1: expected one patch per face");
+    for (const auto& p : face_patches) {
+        REQUIRE(std::abs(p.area_m2 - 4.0f) < 1e-3f, "9E1: face patch area");
+        REQUIRE(p.triangle_count == 2, "9E1: face patch triangle count");
+        float nlen = std::sqrt(p.normal.x*p.normal.x + p.normal.y*p.normal.y + p.normal.z*p.normal.z);
+        REQUIRE(std::abs(nlen - 1.0f) < 1e-4f, "9E1: patch normal not unit length");
+    }
+    auto fine_patches = bin_mesh.coarsenToPatches(0.5f);
+    REQUIRE(fine_patches.size() >= face_patches.size(), "9E1: finer target should not reduce patches");
+    float fine_area = 0.0f;
+    for (const auto& p : fine_patches) fine_area += p.area_m2;
+    REQUIRE(std::abs(fine_area - 24.0f) < 1e-3f, "9E1: coarsening must preserve area");
+
+    // Populate both models with matching IDs
+    vfep::FlameSpreadModel flame_model;
+    vfep::RadiationModel radiation_model;
+    vfep::FlammableSurface material;
+    material.fuel_load_kg = 2.0f;           // kg/m²
+    material.initial_fuel_load_kg = 2.0f;
+    vfep::Surface radiative(1.0f, 298.15f, 0.9f, 0.9f, 0);
+
+    int first = vfep::SurfaceMesh::populateModels(face_patches, material, radiative,
+                                                  &flame_model, &radiation_model);
+    REQUIRE(first == 0, "9E1: first patch ID should be 0");
+    REQUIRE(flame_model.getNumSurfaces() == 6, "9E1: flame surface count");
+    REQUIRE(radiation_model.getNumSurfaces() == 6, "9E1: radiation surface count");
+    for (int i = 0; i < 6; ++i) {
+        REQUIRE(std::abs(radiation_model.getSurface(i).area_m2 - face_patches[i].area_m2) < 1e-6f,
+                "9E1: radiation surface area mismatch");
+    }
+
+    flame_model.igniteAtLocation(0);
+    float expected_hrr = material.hrrpua_W_m2 * face_patches[0].area_m2;
+    REQUIRE(std::abs(flame_model.getTotalHeatReleaseRate() - expected_hrr) < 1.0f,
+            "9E1: HRR from imported patch");
+
+    // Mismatched models are rejected
+    vfep::RadiationModel other_rad;
+    bool threw = false;
+    try {
+        vfep::SurfaceMesh::populateModels(face_patches, material, radiative, &flame_model, &other_rad);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    REQUIRE(threw, "9E1: mismatched surface counts should throw");
+
+    std::cout << "[PASS] 9E1 Surface mesh STL import and patch coarsening\n";
+}
+
 } // namespace
 
+// =======================
+// Phase 10A: Unity Telemetry Streaming Tests
+// =======================
+
+static void runTelemetryPublisherDelta_10A1()
+{
+    using vfep::telemetry::EntityKind;
+    vfep::obj::ObjectStore store = vfep::obj::makeDefault4x4ObjectStore();
+    vfep::telemetry::TelemetryPublisher publisher;
+    REQUIRE(publisher.latest() == nullptr, "10A1: nothing published yet");
+
+    auto s1 = publisher.publish(store, 0.05);
+    REQUIRE(s1->tick == 1 && publisher.latest() == s1, "10A1: first tick");
+    REQUIRE(s1->racks.size() == store.rack_telemetry.size() && s1->arms.size() == store.arm_telemetry.size() &&
+            s1->vfeps.size() == store.vfeps.size(), "10A1: snapshot entity counts");
+    for (size_t i = 0; i < s1->racks.size(); ++i) {
+        if (i > 0) REQUIRE(s1->racks[i].handle > s1->racks[i - 1].handle, "10A1: entities sorted by handle");
+        REQUIRE(store.rack_telemetry.count(s1->id(s1->racks[i].handle)) == 1, "10A1: handle maps back to ID");
+    }
+
+    // Keyframe lists everything and introduces every handle
+    const auto key = vfep::telemetry::computeDelta(nullptr, *s1);
+    size_t total = 0;
+    for (size_t k = 0; k < vfep::telemetry::kEntityKinds; ++k) {
+        total += s1->entityCount(static_cast<EntityKind>(k));
+    }
+    REQUIRE(key.base_tick == 0 && key.changedCount() == total, "10A1: keyframe lists all entities");
+    REQUIRE(key.first_new_handle == 0 && key.end_new_handle == s1->handleCount(), "10A1: keyframe handle range");
+
+    // No change: empty delta; handles stay stable
+    auto s2 = publisher.publish(store, 0.10);
+    const auto quiet = vfep::telemetry::computeDelta(s1.get(), *s2);
+    REQUIRE(quiet.base_tick == 1 && quiet.tick == 2, "10A1: delta ticks");
+    REQUIRE(quiet.changedCount() == 0 && quiet.removed_handles.empty() &&
+            quiet.first_new_handle == quiet.end_new_handle, "10A1: unchanged store gives empty delta");
+    REQUIRE(s2->racks[0].handle == s1->racks[0].handle, "10A1: handles are stable");
+
+    // One rack heats up, one alert is raised
+    const std::string hot_rack = s2->id(s2->racks[3].handle);
+    store.rack_telemetry[hot_rack].surface_temp_C += 25.0;
+    store.rack_telemetry[hot_rack].is_on_fire = true;
+    vfep::obj::Alert alert;
+    alert.alert_id = "alert-10A1";
+    alert.rack_id = hot_rack;
+    alert.severity = vfep::obj::AlertSeverity::Critical;
+    store.upsert(alert);
+    auto s3 = publisher.publish(store, 0.15);
+    const auto d3 = vfep::telemetry::computeDelta(s2.get(), *s3);
+    REQUIRE(d3.changed[static_cast<size_t>(EntityKind::Rack)].size() == 1, "10A1: one rack changed");
+    REQUIRE(s3->id(s3->racks[d3.changed[static_cast<size_t>(EntityKind::Rack)][0]].handle) == hot_rack,
+            "10A1: changed rack identity");
+    REQUIRE(d3.changed[static_cast<size_t>(EntityKind::Alert)].size() == 1 && d3.changedCount() == 2,
+            "10A1: new alert only other change");
+    REQUIRE(d3.end_new_handle - d3.first_new_handle == 1 && s3->id(d3.first_new_handle) == "alert-10A1",
+            "10A1: new alert handle introduced once");
+    REQUIRE(s2->handleCount() + 1 == s3->handleCount(), "10A1: older snapshots keep their ID table");
+
+    // Alert removed: reported by handle
+    store.alerts.clear();
+    auto s4 = publisher.publish(store, 0.20);
+    const auto d4 = vfep::telemetry::computeDelta(s3.get(), *s4);
+    REQUIRE(d4.removed_handles.size() == 1 && d4.removed_handles[0] == d3.first_new_handle,
+            "10A1: removed alert handle");
+
+    // Streams waiting on the publisher wake once per tick
+    std::shared_ptr<const vfep::telemetry::TelemetrySnapshot> seen;
+    std::thread waiter([&]() { seen = publisher.waitForNewer(4, 2000); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    vfep::mech::MechanicsParams params;
+    vfep::mech::tick(store, 0.20, 0.05, params);
+    publisher.publish(store, 0.25);
+    waiter.join();
+    REQUIRE(seen && seen->tick == 5, "10A1: waiter receives the new tick");
+
+    std::thread closer([&]() { seen = publisher.waitForNewer(5, 5000); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto t0 = std::chrono::steady_clock::now();
+    publisher.close();
+    closer.join();
+    REQUIRE(publisher.closed() && std::chrono::steady_clock::now() - t0 < std::chrono::seconds(2),
+            "10A1: close wakes waiters");
+
+    std::cout << "[PASS] 10A1 telemetry snapshot publication and delta encoding\n";
+}
+
+static void runSimLoopQueueAndLatency_10A2()
+{
+    // MPSC queue: concurrent producers, one consumer draining as it goes
+    struct Item { int producer = -1; int seq = -1; };
+    vfep::MpscQueue<Item> queue;
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    std::atomic<int> producers_done{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) queue.push(Item{p, i});
+            producers_done.fetch_add(1);
+        });
+    }
+    std::vector<int> next_seq(PRODUCERS, 0);
+    bool in_order = true;
+    size_t received = 0;
+    auto consume = [&](Item it) {
+        if (it.producer < 0 || it.producer >= PRODUCERS || it.seq != next_seq[it.producer]) in_order = false;
+        else ++next_seq[it.producer];
+        ++received;
+    };
+    while (producers_done.load() < PRODUCERS) {
+        queue.drain(consume);
+    }
+    for (auto& t : producers) t.join();
+    queue.drain(consume);
+    REQUIRE(received == size_t(PRODUCERS) * PER_PRODUCER, "10A2: every command dequeued once");
+    REQUIRE(in_order, "10A2: per-producer FIFO order");
+    Item none;
+    REQUIRE(!queue.pop(none), "10A2: queue empty after drain");
+
+    // Histogram buckets cover every value within ~1/16
+    for (uint64_t v : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull}) {
+        const size_t b = vfep::LatencyHistogram::bucketIndex(v);
+        REQUIRE(b < vfep::LatencyHistogram::BUCKETS, "10A2: bucket in range");
+        REQUIRE(vfep::LatencyHistogram::bucketLow(b) <= v && v <= vfep::LatencyHistogram::bucketHigh(b),
+                "10A2: bucket bounds contain value");
+        REQUIRE(vfep::LatencyHistogram::bucketHigh(b) - vfep::LatencyHistogram::bucketLow(b) <= v / 16,
+                "10A2: bucket relative width");
+    }
+
+    vfep::LatencyHistogram hist;
+    REQUIRE(hist.percentile(0.99) == 0 && hist.count() == 0, "10A2: empty histogram");
+    std::vector<std::thread> recorders;
+    for (int t = 0; t < 4; ++t) {
+        recorders.emplace_back([&]() {
+            for (uint64_t v = 1; v <= 10000; ++v) hist.record(v * 1000);  // 1 us .. 10 ms
+        });
+    }
+    for (auto& t : recorders) t.join();
+    REQUIRE(hist.count() == 40000 && hist.max() == 10000000, "10A2: concurrent records counted");
+    const double p50 = static_cast<double>(hist.percentile(0.50));
+    const double p99 = static_cast<double>(hist.percentile(0.99));
+    REQUIRE(std::abs(p50 - 5.0e6) < 0.07 * 5.0e6, "10A2: p50 within bucket resolution");
+    REQUIRE(std::abs(p99 - 9.9e6) < 0.07 * 9.9e6, "10A2: p99 within bucket resolution");
+    REQUIRE(std::abs(hist.mean() - 5.0005e6) < 1.0, "10A2: exact mean");
+    hist.reset();
+    REQUIRE(hist.count() == 0 && hist.percentile(0.5) == 0, "10A2: reset");
+
+    std::cout << "[PASS] 10A2 MPSC command queue and latency histogram\n";
+}
+
+static void runTelemetryFanoutBackpressure_10A3()
+{
+    using Clock = vfep::telemetry::StreamGate::Clock;
+    vfep::obj::ObjectStore store = vfep::obj::makeDefault4x4ObjectStore();
+    vfep::telemetry::TelemetryPublisher publisher;
+    std::vector<std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>> snaps;
+    for (int i = 0; i < 4; ++i) snaps.push_back(publisher.publish(store, 0.05 * (i + 1)));
+
+    // Drop-to-latest: one write in flight, newest held snapshot wins
+    const auto t0 = Clock::now();
+    vfep::telemetry::StreamGate gate;
+    REQUIRE(gate.offer(snaps[0], t0) == snaps[0] && gate.writing(), "10A3: idle gate writes immediately");
+    REQUIRE(gate.offer(snaps[1], t0) == nullptr, "10A3: held while writing");
+    REQUIRE(gate.offer(snaps[2], t0) == nullptr && gate.dropped() == 1, "10A3: newer tick replaces held one");
+    REQUIRE(gate.writeDone(t0) == snaps[2], "10A3: latest held tick written next");
+    REQUIRE(gate.offer(snaps[1], t0) == nullptr, "10A3: stale tick ignored");
+    REQUIRE(gate.writeDone(t0) == nullptr && !gate.writing() && gate.sent() == 2, "10A3: gate idle");
+
+    // Rate cap: 10 Hz
+    vfep::telemetry::StreamGate capped(10.0);
+    REQUIRE(capped.offer(snaps[0], t0) == snaps[0], "10A3: first write not rate-limited");
+    REQUIRE(capped.writeDone(t0 + std::chrono::milliseconds(5)) == nullptr, "10A3: nothing held");
+    REQUIRE(capped.offer(snaps[1], t0 + std::chrono::milliseconds(50)) == nullptr, "10A3: too soon");
+    REQUIRE(capped.offer(snaps[2], t0 + std::chrono::milliseconds(120)) == snaps[2], "10A3: after interval");
+    REQUIRE(capped.dropped() == 1, "10A3: rate-limited tick dropped");
+
+    // Fan-out: many subscribers, one thread
+    constexpr int SUBSCRIBERS = 300;
+    struct Sub {
+        std::atomic<uint64_t> last_tick{0};
+        std::atomic<int> calls{0};
+        std::atomic<int> closes{0};
+        uint64_t id = 0;
+    };
+    std::vector<Sub> subs(SUBSCRIBERS);
+    vfep::telemetry::TelemetryFanout fanout(publisher);
+    for (auto& sub : subs) {
+        Sub* p = &sub;
+        sub.id = fanout.subscribe([p](const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& snap) {
+            p->calls.fetch_add(1);
+            if (!snap) p->closes.fetch_add(1);
+            else p->last_tick.store(snap->tick);
+        });
+    }
+    // Subscriber that drops itself from inside its callback
+    std::atomic<int> self_calls{0};
+    uint64_t self_id = 0;
+    self_id = fanout.subscribe([&](const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>&) {
+        self_calls.fetch_add(1);
+        fanout.unsubscribe(self_id);
+    });
+    REQUIRE(fanout.subscriberCount() == SUBSCRIBERS + 1, "10A3: subscribers registered");
+
+    auto waitAll = [&](uint64_t tick) {
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (Clock::now() < deadline) {
+            bool all = true;
+            for (int i = 0; i < SUBSCRIBERS / 2; ++i) all = all && subs[i].last_tick.load() >= tick;
+            if (all) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return false;
+    };
+    auto s5 = publisher.publish(store, 0.25);
+    REQUIRE(waitAll(s5->tick), "10A3: every subscriber sees the tick");
+    REQUIRE(self_calls.load() == 1 && fanout.subscriberCount() == SUBSCRIBERS, "10A3: self-unsubscribe");
+
+    for (int i = SUBSCRIBERS / 2; i < SUBSCRIBERS; ++i) fanout.unsubscribe(subs[i].id);
+    std::vector<int> frozen;
+    for (int i = SUBSCRIBERS / 2; i < SUBSCRIBERS; ++i) frozen.push_back(subs[i].calls.load());
+
+    for (int k = 0; k < 20; ++k) publisher.publish(store, 0.30 + 0.05 * k);
+    const uint64_t last = publisher.latest()->tick;
+    REQUIRE(waitAll(last), "10A3: subscribers converge on the latest tick");
+    for (int i = 0; i < SUBSCRIBERS / 2; ++i) {
+        REQUIRE(subs[i].calls.load() <= 22, "10A3: at most one callback per tick");
+    }
+    for (int i = SUBSCRIBERS / 2; i < SUBSCRIBERS; ++i) {
+        REQUIRE(subs[i].calls.load() == frozen[i - SUBSCRIBERS / 2], "10A3: no callbacks after unsubscribe");
+    }
+
+    publisher.close();
+    fanout.stop();
+    for (int i = 0; i < SUBSCRIBERS / 2; ++i) {
+        REQUIRE(subs[i].closes.load() == 1, "10A3: close delivered once");
+    }
+    REQUIRE(self_calls.load() == 1, "10A3: self-unsubscribed callback not rerun");
+
+    std::cout << "[PASS] 10A3 telemetry fan-out with drop-to-latest backpressure\n";
+}
+
+static void runEntityRegistryMechTick_10A4()
+{
+    using vfep::obj::kNoHandle;
+    vfep::obj::ObjectStore store = vfep::obj::makeDefault4x4ObjectStore();
+    vfep::obj::EntityRegistry reg;
+    reg.build(store);
+
+    REQUIRE(reg.racks.ids.size() == store.rack_telemetry.size(), "10A4: every rack indexed");
+    REQUIRE(reg.arms.ids.size() == store.arm_telemetry.size() && reg.nozzles.ids.size() == store.nozzle_telemetry.size(),
+            "10A4: arms and nozzles indexed");
+    for (const auto& [id, rt] : store.rack_telemetry) {
+        const uint32_t h = reg.racks.ids.find(id);
+        REQUIRE(h != kNoHandle && reg.racks.ids.id(h) == id && reg.racks.store[h] == &rt, "10A4: rack handle round trip");
+    }
+    REQUIRE(reg.racks.ids.find("no-such-rack") == kNoHandle, "10A4: unknown ID");
+
+    const uint32_t v = reg.vfeps.ids.find("vfep-01");
+    REQUIRE(v != kNoHandle && reg.vfeps.tank[v] == reg.tanks.ids.find("tank-01"), "10A4: vfep -> tank relation");
+    REQUIRE(reg.vfeps.interlock[v] == reg.interlocks.ids.find("interlock-vfep-01"), "10A4: vfep -> interlock relation");
+    REQUIRE(reg.vfeps.coverage_begin[v + 1] - reg.vfeps.coverage_begin[v] == store.vfeps["vfep-01"].coverage_rack_ids.size(),
+            "10A4: coverage racks resolved");
+
+    // Fire on a covered rack; select it and start suppression; command an arm
+    const std::string rack_id = store.vfeps["vfep-01"].coverage_rack_ids[5];
+    store.rack_telemetry[rack_id].is_on_fire = true;
+    store.rack_telemetry[rack_id].surface_temp_C = 70.0;
+    store.vfeps["vfep-01"].selected_rack_id = rack_id;
+    store.vfeps["vfep-01"].suppression_active = true;
+    store.arm_telemetry["arm-1"].target_s_0_1 = 0.8;
+    store.arm_telemetry["arm-1"].has_target = true;
+    vfep::obj::ObjectStore reference = store;  // Ticked through the string-keyed overload
+    reg.load();
+
+    const uint32_t r = reg.racks.ids.find(rack_id);
+    REQUIRE(reg.vfeps.selected_rack[v] == r, "10A4: selection resolved on load");
+
+    vfep::mech::MechanicsParams params;
+    const double dt = 0.05;
+    double t = 0.0;
+    for (int k = 0; k < 60; ++k, t += dt) {
+        vfep::mech::tick(reg, t, dt, params);
+        vfep::mech::tick(reference, t, dt, params);
+    }
+    reg.save();
+
+    REQUIRE(reg.incidents.ids.size() == 1 && store.incidents.size() == 1, "10A4: one incident opened");
+    const auto& inc = store.incidents.begin()->second;
+    REQUIRE(inc.rack_id == rack_id && inc.state == vfep::obj::IncidentState::Resolved && inc.resolved_at_s > 0.0,
+            "10A4: incident resolved by suppression");
+    REQUIRE(reg.racks.open_incident[r] == kNoHandle && !store.rack_telemetry[rack_id].is_on_fire, "10A4: rack extinguished");
+    REQUIRE(store.tank_telemetry["tank-01"].valve_state == "discharging" &&
+            store.tank_telemetry["tank-01"].remaining_agent_mass_kg < reference.tanks["tank-01"].initial_agent_mass_kg,
+            "10A4: agent discharged");
+    REQUIRE(store.arm_telemetry["arm-1"].s_0_1 > 0.5, "10A4: arm moved toward target");
+
+    // Persistent registry and per-call overload agree exactly
+    for (const auto& [id, rt] : store.rack_telemetry) {
+        const auto& ref = reference.rack_telemetry.at(id);
+        REQUIRE(rt.is_on_fire == ref.is_on_fire && rt.surface_temp_C == ref.surface_temp_C &&
+                rt.risk_to_assets_pct == ref.risk_to_assets_pct, "10A4: rack telemetry matches");
+    }
+    for (const auto& [id, at] : store.arm_telemetry) {
+        const auto& ref = reference.arm_telemetry.at(id);
+        REQUIRE(at.s_0_1 == ref.s_0_1 && at.v_s_0_1_per_s == ref.v_s_0_1_per_s && at.state == ref.state,
+                "10A4: arm telemetry matches");
+    }
+    const auto& tt = store.tank_telemetry["tank-01"];
+    const auto& tref = reference.tank_telemetry["tank-01"];
+    REQUIRE(tt.remaining_agent_mass_kg == tref.remaining_agent_mass_kg && tt.current_pressure_bar == tref.current_pressure_bar,
+            "10A4: tank telemetry matches");
+    REQUIRE(reference.incidents.size() == 1 && reference.incidents.begin()->first == store.incidents.begin()->first &&
+            reference.incidents.begin()->second.resolved_at_s == inc.resolved_at_s, "10A4: incident matches");
+
+    // Re-ignition opens a second incident exactly once
+    store.rack_telemetry[rack_id].is_on_fire = true;
+    store.rack_telemetry[rack_id].surface_temp_C = 90.0;
+    store.vfeps["vfep-01"].suppression_active = false;
+    reg.load();
+    for (int k = 0; k < 5; ++k, t += dt) vfep::mech::tick(reg, t, dt, params);
+    reg.save();
+    REQUIRE(store.incidents.size() == 2 && reg.racks.open_incident[r] != kNoHandle, "10A4: new incident on re-ignition");
+
+    std::cout << "[PASS] 10A4 entity registry handles and array-based mechanics tick\n";
+}
+
+static void runMechTickScaling_10A5()
+{
+    using vfep::obj::kNoHandle;
+    const size_t n = 5000;
+    vfep::obj::ObjectStore store = vfep::obj::makeSyntheticObjectStore(n, 16);
+    REQUIRE(store.racks.size() == n && store.rack_telemetry.size() == n, "10A5: synthetic racks");
+    REQUIRE(store.vfeps.size() == (n + 15) / 16 && store.arm_telemetry.size() == 2 * store.vfeps.size() &&
+            store.nozzle_telemetry.size() == 2 * store.vfeps.size() && store.interlocks.size() == store.vfeps.size(),
+            "10A5: one tank/interlock/two arms per VFEP");
+    REQUIRE(store.validate().ok(), "10A5: synthetic store validates");
+
+    // Every 50th rack burning, its VFEP suppressing; vfep-1 also aims at rack-0 (two VFEPs, one rack)
+    for (size_t i = 0; i < n; i += 50) {
+        store.rack_telemetry["rack-" + std::to_string(i)].is_on_fire = true;
+        store.rack_telemetry["rack-" + std::to_string(i)].surface_temp_C = 400.0;
+        store.vfeps["vfep-" + std::to_string(i / 16)].suppression_active = true;
+    }
+    store.vfeps["vfep-1"].selected_rack_id = "rack-0";
+    store.vfeps["vfep-1"].suppression_active = true;
+    for (auto& [id, at] : store.arm_telemetry) {
+        at.has_target = true;
+        at.target_s_0_1 = 0.9;
+    }
+    vfep::obj::ObjectStore serial_store = store;
+
+    vfep::obj::EntityRegistry par, ser;
+    par.build(store);
+    ser.build(serial_store);
+    vfep::WorkerPool pool(3);
+    vfep::mech::MechanicsParams pp;
+    pp.min_entities_per_thread = 64;
+    pp.pool = &pool;
+    vfep::mech::MechanicsParams sp;
+    sp.min_entities_per_thread = static_cast<size_t>(-1);
+
+    const double dt = 0.01;
+    vfep::mech::tick(par, 0.0, dt, pp);
+    vfep::mech::tick(ser, 0.0, dt, sp);
+    const uint32_t r0 = par.racks.ids.find("rack-0");
+    const uint32_t r50 = par.racks.ids.find("rack-50");
+    REQUIRE(std::abs(par.racks.surface_temp_C[r0] - (400.0 - 2.0 * pp.cooling_degC_per_s * dt)) < 1e-9,
+            "10A5: rack hit by two VFEPs cooled twice");
+    REQUIRE(std::abs(par.racks.surface_temp_C[r50] - (400.0 - pp.cooling_degC_per_s * dt)) < 1e-9,
+            "10A5: rack hit by one VFEP cooled once");
+    REQUIRE(par.incidents.ids.size() == n / 50, "10A5: one incident per burning rack");
+
+    double t = dt;
+    for (int k = 0; k < 200; ++k, t += dt) {
+        vfep::mech::tick(par, t, dt, pp);
+        vfep::mech::tick(ser, t, dt, sp);
+    }
+
+    // Parallel and serial ticks agree exactly
+    REQUIRE(par.racks.surface_temp_C == ser.racks.surface_temp_C && par.racks.on_fire == ser.racks.on_fire &&
+            par.racks.open_incident == ser.racks.open_incident, "10A5: racks match serial");
+    REQUIRE(par.arms.s == ser.arms.s && par.arms.v == ser.arms.v, "10A5: arms match serial");
+    REQUIRE(par.nozzles.pan == ser.nozzles.pan && par.nozzles.tilt == ser.nozzles.tilt, "10A5: nozzles match serial");
+    REQUIRE(par.tanks.remaining_kg == ser.tanks.remaining_kg, "10A5: tanks match serial");
+    REQUIRE(par.incidents.ids.size() == ser.incidents.ids.size() && par.incidents.resolved_at_s == ser.incidents.resolved_at_s,
+            "10A5: incidents match serial");
+
+    // 2 s at 15 C/s is far from extinguishing a 400 C rack
+    REQUIRE(par.racks.on_fire[r50] && par.racks.open_incident[r50] != kNoHandle, "10A5: slow rack still suppressing");
+    REQUIRE(par.incidents.state[par.racks.open_incident[r50]] == vfep::obj::IncidentState::Suppressing,
+            "10A5: incident suppressing");
+    REQUIRE(par.arms.s[par.arms.ids.find("arm-7-1")] > 0.5, "10A5: arms moving");
+
+    std::cout << "[PASS] 10A5 parallel mechanics tick matches serial on a synthetic store\n";
+}
+
+static void runWorldHostScheduling_10A6()
+{
+    using Clock = std::chrono::steady_clock;
+    auto waitFor = [](const std::function<bool()>& pred) {
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (Clock::now() < deadline) {
+            if (pred()) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return false;
+    };
+
+    vfep::host::WorldHost host(2, 200.0, 3);
+    vfep::host::WorldConfig cfg;
+    cfg.world_id = "fast";
+    cfg.tick_hz = 100.0;
+    auto fast = host.create(cfg);
+    cfg.world_id = "slow";
+    cfg.tick_hz = 25.0;
+    cfg.synthetic_racks = 64;
+    auto slow = host.create(cfg);
+    REQUIRE(fast && slow && slow->layout()->racks.size() == 64, "10A6: worlds created");
+
+    std::string error;
+    cfg.world_id = "fast";
+    REQUIRE(!host.create(cfg, &error) && !error.empty(), "10A6: duplicate world_id rejected");
+    cfg.world_id.clear();
+    cfg.tick_hz = 1000.0;
+    auto named = host.create(cfg);
+    REQUIRE(named && named->id().rfind("world-", 0) == 0 && named->tickHz() == 200.0, "10A6: generated ID, rate capped");
+    REQUIRE(!host.create(cfg, &error) && host.worldCount() == 3, "10A6: world limit");
+    REQUIRE(host.find("fast") == fast && host.list().size() == 3 && host.list()[0]->id() == "fast", "10A6: lookup");
+
+    // Idle: nobody subscribed, nothing ticks; a command is still applied
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(fast->ticks() == 0 && !host.ticking(*fast) && host.tickingCount() == 0, "10A6: idle worlds do not tick");
+    std::atomic<int> applied{0};
+    auto cmd = std::make_unique<vfep::host::WorldCommand>();
+    cmd->run = [&applied](vfep::obj::ObjectStore* store) {
+        if (store) store->vfeps["vfep-01"].suppression_active = true;
+        applied.fetch_add(store ? 1 : -100);
+    };
+    const uint64_t tick0 = fast->publisher().latest()->tick;
+    host.enqueue(fast, std::move(cmd));
+    REQUIRE(waitFor([&]() { return applied.load() == 1 && fast->publisher().latest()->tick > tick0; }),
+            "10A6: command applied and published on an idle world");
+    REQUIRE(waitFor([&]() { return !host.ticking(*fast); }) && fast->ticks() == 0, "10A6: back to idle without ticking");
+
+    // Subscribers start ticking, each world at its own rate
+    std::atomic<int> fast_msgs{0}, slow_msgs{0}, slow_closed{0};
+    const uint64_t fast_sub = host.subscribe(fast, [&](const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& s) {
+        if (s) fast_msgs.fetch_add(1);
+    });
+    host.subscribe(slow, [&](const std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>& s) {
+        if (s) slow_msgs.fetch_add(1); else slow_closed.fetch_add(1);
+    });
+    const auto t0 = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    const double elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+    const uint64_t fast_ticks = fast->ticks(), slow_ticks = slow->ticks();
+    REQUIRE(host.tickingCount() == 2 && named->ticks() == 0, "10A6: only subscribed worlds tick");
+    REQUIRE(fast_ticks >= 10 && fast_ticks <= static_cast<uint64_t>(100.0 * elapsed) + 2, "10A6: fast world rate-limited");
+    REQUIRE(slow_ticks >= 3 && slow_ticks <= static_cast<uint64_t>(25.0 * elapsed) + 2, "10A6: slow world rate-limited");
+    REQUIRE(fast_ticks > slow_ticks && fast_msgs.load() > 0 && slow_msgs.load() > 0, "10A6: both worlds served");
+    const auto snap = fast->publisher().latest();
+    REQUIRE(snap->vfeps.size() == 1 && snap->vfeps[0].value.suppression_active, "10A6: command state carried into ticks");
+
+    // Last subscriber leaves: the world stops ticking
+    fast->fanout().unsubscribe(fast_sub);
+    REQUIRE(waitFor([&]() { return !host.ticking(*fast); }), "10A6: unsubscribed world goes idle");
+    const uint64_t frozen = fast->ticks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(fast->ticks() == frozen && host.ticking(*slow), "10A6: idle world frozen, other keeps ticking");
+
+    // Destroy: streams get the final nullptr, later commands are cancelled
+    REQUIRE(host.destroy("slow") && !host.destroy("slow") && !host.find("slow"), "10A6: destroy");
+    REQUIRE(slow_closed.load() == 1 && slow->destroyed(), "10A6: subscribers told the world closed");
+    std::atomic<int> cancelled{0};
+    auto late = std::make_unique<vfep::host::WorldCommand>();
+    late->run = [&cancelled](vfep::obj::ObjectStore* store) { if (!store) cancelled.fetch_add(1); };
+    host.enqueue(slow, std::move(late));
+    REQUIRE(cancelled.load() == 1, "10A6: command to a destroyed world cancelled");
+    REQUIRE(waitFor([&]() { return host.tickingCount() == 0; }), "10A6: destroyed world leaves the schedule");
+
+    cfg.world_id = "after";
+    host.stop();
+    REQUIRE(!host.create(cfg) && host.worldCount() == 0 && applied.load() == 1, "10A6: stopped host");
+
+    std::cout << "[PASS] 10A6 multi-world host: idle worlds park, per-world rate limits, destroy\n";
+}
+
+static void runFireSimBridge_10A7()
+{
+    using vfep::obj::kNoHandle;
+    using Clock = std::chrono::steady_clock;
+
+    // WorkerPool: every index once, chunk count as documented, concurrent
+    // callers share the helpers, and an exception reaches the caller
+    {
+        vfep::WorkerPool workers(3);
+        REQUIRE(workers.chunkCount(1000, 100) == 4 && workers.chunkCount(150, 100) == 1, "10A7: pool chunk count");
+        std::vector<std::thread> callers;
+        std::atomic<int> bad{0};
+        for (int c = 0; c < 4; ++c) {
+            callers.emplace_back([&workers, &bad] {
+                for (int rep = 0; rep < 200; ++rep) {
+                    std::vector<int> hits(1000, 0);
+                    const size_t chunks = workers.parallelForChunks(1000, 10, [&](size_t, size_t b, size_t e) {
+                        for (size_t i = b; i < e; ++i) ++hits[i];
+                    });
+                    if (chunks != 4 || std::count(hits.begin(), hits.end(), 1) != 1000) ++bad;
+                }
+            });
+        }
+        for (auto& t : callers) t.join();
+        REQUIRE(bad.load() == 0, "10A7: pool covers every index exactly once");
+        bool threw = false;
+        try {
+            workers.parallelFor(1000, 10, [](size_t b, size_t) {
+                if (b > 0) throw std::runtime_error("chunk failed");
+            });
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        REQUIRE(threw, "10A7: pool rethrows a chunk's exception");
+    }
+
+    // 200-rack hall, five fires; vfep-0 and vfep-2 discharge onto theirs, the rest burn freely
+    vfep::obj::ObjectStore store = vfep::obj::makeSyntheticObjectStore(200, 16);
+    for (size_t i = 0; i < 200; i += 40) {
+        auto& rt = store.rack_telemetry["rack-" + std::to_string(i)];
+        rt.is_on_fire = true;
+        rt.surface_temp_C = 22.0;
+    }
+    store.vfeps["vfep-0"].suppression_active = true;
+    store.vfeps["vfep-2"].suppression_active = true;
+    vfep::obj::ObjectStore serial_store = store;
+
+    vfep::obj::EntityRegistry par, ser;
+    par.build(store);
+    ser.build(serial_store);
+    vfep::mech::MechanicsParams mp;
+    mp.external_rack_fire = true;
+    // A pool with helpers exercises the threaded path even on a single core
+    vfep::WorkerPool pool(3);
+    vfep::mech::FireBridgeParams pp;
+    pp.min_fires_per_thread = 1;
+    pp.pool = &pool;
+    vfep::mech::FireBridgeParams sp;
+    sp.min_fires_per_thread = static_cast<size_t>(-1);
+    vfep::mech::FireSimBridge par_fire(pp), ser_fire(sp);
+
+    const double dt = 0.05;  // 20 Hz
+    double t = 0.0;
+    double worst_s = 0.0;
+    for (int k = 0; k < 600; ++k, t += dt) {
+        const auto t0 = Clock::now();
+        vfep::mech::tick(par, t, dt, mp);
+        par_fire.step(par, t, dt);
+        worst_s = std::max(worst_s, std::chrono::duration<double>(Clock::now() - t0).count());
+        vfep::mech::tick(ser, t, dt, mp);
+        ser_fire.step(ser, t, dt);
+    }
+    REQUIRE(worst_s < dt, "10A7: every tick fits the 20 Hz budget");
+    REQUIRE(par_fire.activeFires() == 5, "10A7: one Simulation per burning rack");
+
+    const uint32_t r0 = par.racks.ids.find("rack-0");
+    const uint32_t r80 = par.racks.ids.find("rack-80");
+    REQUIRE(par_fire.simulationFor(r0) && !par_fire.simulationFor(par.racks.ids.find("rack-1")),
+            "10A7: only burning racks own a Simulation");
+    REQUIRE_FINITE(par.racks.surface_temp_C[r80], "10A7: temperature finite");
+    REQUIRE(par.racks.surface_temp_C[r80] > 25.0, "10A7: free-burning rack heats up");
+    REQUIRE(par.racks.risk_pct[r80] > par.racks.risk_pct[r0], "10A7: suppression lowers the fire's risk");
+    REQUIRE(par.racks.on_fire[r0] && par.racks.open_incident[r0] != kNoHandle &&
+            par.incidents.state[par.racks.open_incident[r0]] == vfep::obj::IncidentState::Suppressing,
+            "10A7: suppressed fire still open");
+
+    // Tanks draw the agent the rack's Simulation delivered
+    const uint32_t tank0 = par.vfeps.tank[par.vfeps.ids.find("vfep-0")];
+    const uint32_t tank5 = par.vfeps.tank[par.vfeps.ids.find("vfep-5")];
+    REQUIRE(par.racks.agent_flow_kg_s[r0] > 0.0 && par.racks.agent_flow_kg_s[r80] == 0.0, "10A7: agent only where discharged");
+    REQUIRE(std::abs(par.tanks.flow_kg_s[tank0] - par.racks.agent_flow_kg_s[r0]) < 1e-12, "10A7: tank flow from Simulation");
+    REQUIRE(par.tanks.remaining_kg[tank0] < par.tanks.initial_mass_kg[tank0] &&
+            par.tanks.remaining_kg[tank5] == par.tanks.initial_mass_kg[tank5], "10A7: only discharging tanks drain");
+
+    // Independent Simulations: parallel and serial agree exactly
+    REQUIRE(par.racks.surface_temp_C == ser.racks.surface_temp_C && par.racks.risk_pct == ser.racks.risk_pct &&
+            par.racks.on_fire == ser.racks.on_fire, "10A7: racks match serial");
+    REQUIRE(par.tanks.remaining_kg == ser.tanks.remaining_kg, "10A7: tanks match serial");
+
+    // Knockdown below the threshold puts the fire out, resolves the incident
+    // and returns the Simulation to the pool
+    vfep::obj::ObjectStore out_store = store;
+    vfep::obj::EntityRegistry reg;
+    reg.build(out_store);
+    vfep::mech::FireBridgeParams op;
+    op.extinguished_HRR_W = 60000.0;  // ~71 kW free burn, well under once suppressed
+    vfep::mech::FireSimBridge fire(op);
+    for (int k = 0; k < 600 && reg.racks.on_fire[r0]; ++k, t += dt) {
+        vfep::mech::tick(reg, t, dt, mp);
+        fire.step(reg, t, dt);
+    }
+    REQUIRE(!reg.racks.on_fire[r0] && reg.racks.open_incident[r0] == kNoHandle, "10A7: suppressed fire out");
+    REQUIRE(reg.racks.on_fire[r80], "10A7: unsuppressed fire keeps burning");
+    bool resolved = false;
+    for (uint32_t i = 0; i < reg.incidents.ids.size(); ++i) {
+        resolved = resolved || (reg.incidents.rack[i] == r0 && reg.incidents.state[i] == vfep::obj::IncidentState::Resolved);
+    }
+    REQUIRE(resolved, "10A7: incident resolved");
+    REQUIRE(fire.pooledSimulations() >= 1 && !fire.simulationFor(r0), "10A7: Simulation pooled");
+
+    // Re-ignition reuses the pooled Simulation from a fresh start
+    const size_t pooled = fire.pooledSimulations();
+    reg.racks.on_fire[r0] = 1;
+    vfep::mech::tick(reg, t, dt, mp);
+    fire.step(reg, t, dt);
+    REQUIRE(fire.pooledSimulations() == pooled - 1 && fire.simulationFor(r0), "10A7: pooled Simulation reused");
+    REQUIRE(fire.simulationFor(r0)->time_s() < 2.0 * dt && reg.racks.open_incident[r0] != kNoHandle,
+            "10A7: re-ignited fire restarts with a new incident");
+
+    std::cout << "[PASS] 10A7 fire-sim bridge: per-rack Simulations, tank coupling, extinguish and pooling\n";
+}
+
+static void runWorldClockControl_10A8()
+{
+    using Clock = std::chrono::steady_clock;
+    using Snap = std::shared_ptr<const vfep::telemetry::TelemetrySnapshot>;
+    auto waitFor = [](const std::function<bool()>& pred) {
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (Clock::now() < deadline) {
+            if (pred()) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    };
+
+    vfep::host::WorldHost host(2, 100.0, 4);
+    vfep::host::WorldConfig cfg;
+    cfg.world_id = "ci";
+    cfg.tick_hz = 20.0;
+    auto w = host.create(cfg);
+    REQUIRE(w && host.clock(*w).mode == vfep::host::ClockMode::RealTime, "10A8: worlds start in real time");
+
+    std::string error;
+    REQUIRE(!host.setClockMode(w, vfep::host::ClockMode::Scaled, 0.0, &error) && !error.empty(),
+            "10A8: scaled clock needs a positive speed");
+
+    // Max throughput: far more than 20 ticks per second of wall clock
+    std::atomic<uint64_t> seen{0};
+    const uint64_t sub = host.subscribe(w, [&](const Snap& s) { if (s) seen.store(s->tick); });
+    REQUIRE(host.setClockMode(w, vfep::host::ClockMode::MaxThroughput), "10A8: max throughput");
+    const auto t0 = Clock::now();
+    REQUIRE(waitFor([&]() { return w->ticks() >= 200; }), "10A8: back-to-back ticks");
+    REQUIRE(std::chrono::duration<double>(Clock::now() - t0).count() < 200.0 / 20.0 / 2.0,
+            "10A8: faster than real time");
+
+    // Pause freezes the clock; single steps run exactly that many ticks
+    host.setPaused(w, true);
+    REQUIRE(waitFor([&]() { return !host.ticking(*w); }), "10A8: paused world parks");
+    const uint64_t frozen = w->ticks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    REQUIRE(w->ticks() == frozen, "10A8: paused world does not tick");
+    host.stepTicks(w, 5);
+    REQUIRE(waitFor([&]() { return !host.ticking(*w) && host.clock(*w).pending_steps == 0; }) && w->ticks() == frozen + 5,
+            "10A8: step runs exactly N ticks");
+    REQUIRE(host.clock(*w).paused, "10A8: still paused after stepping");
+
+    // Seek runs forward to the target sim time, then stays paused
+    const double t_now = w->publisher().latest()->sim_time_s;
+    REQUIRE(!host.seek(w, t_now - 1.0, &error), "10A8: cannot seek backwards");
+    REQUIRE(host.seek(w, t_now + 10.0), "10A8: seek forward");
+    REQUIRE(waitFor([&]() { return host.clock(*w).seek_to_s < 0.0 && !host.ticking(*w); }), "10A8: seek completes");
+    REQUIRE(std::abs(w->publisher().latest()->sim_time_s - (t_now + 10.0)) < 1e-6 && w->ticks() == frozen + 5 + 200,
+            "10A8: seek lands on the target tick");
+
+    // Lockstep: every tick waits for the slowest subscriber's ack, and that
+    // subscriber sees every tick
+    std::mutex mu;
+    std::vector<uint64_t> got;
+    const uint64_t slow = host.subscribe(w, [&](const Snap& s) {
+        if (!s) return;
+        std::lock_guard<std::mutex> lk(mu);
+        got.push_back(s->tick);
+    });
+    // The first subscriber acks from inside its callback
+    host.unsubscribe(w, sub);
+    std::atomic<uint64_t> fast_seen{0};
+    uint64_t fast = 0;
+    fast = host.subscribe(w, [&](const Snap& s) {
+        if (!s) return;
+        fast_seen.store(s->tick);
+        host.ack(w, fast, s->tick);
+    });
+    REQUIRE(host.setClockMode(w, vfep::host::ClockMode::Lockstep), "10A8: lockstep");
+    host.setPaused(w, false);
+    const uint64_t start_tick = w->publisher().latest()->tick;
+    for (uint64_t k = 1; k <= 50; ++k) {
+        REQUIRE(waitFor([&]() { std::lock_guard<std::mutex> lk(mu); return got.size() == k; }), "10A8: next frame arrives");
+        uint64_t last;
+        {
+            std::lock_guard<std::mutex> lk(mu);
+            last = got.back();
+        }
+        if (k == 1) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            std::lock_guard<std::mutex> lk(mu);
+            REQUIRE(got.size() == 1, "10A8: no tick without the ack");
+        }
+        host.ack(w, slow, last);
+    }
+    {
+        std::lock_guard<std::mutex> lk(mu);
+        bool consecutive = true;
+        for (size_t i = 0; i < got.size(); ++i) consecutive = consecutive && got[i] == start_tick + 1 + i;
+        REQUIRE(consecutive, "10A8: lockstep subscriber sees every tick in order");
+    }
+    REQUIRE(fast_seen.load() >= start_tick + 50, "10A8: fast subscriber kept up");
+
+    // Dropping the slow subscriber releases the world
+    host.unsubscribe(w, slow);
+    const uint64_t before = w->ticks();
+    REQUIRE(waitFor([&]() { return w->ticks() > before + 20; }), "10A8: unsubscribe releases a lockstep world");
+
+    // Scaled: 4x real time
+    host.setClockMode(w, vfep::host::ClockMode::Scaled, 4.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t s0 = w->ticks();
+    const auto ts = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    const double secs = std::chrono::duration<double>(Clock::now() - ts).count();
+    const uint64_t scaled = w->ticks() - s0;
+    REQUIRE(scaled > static_cast<uint64_t>(20.0 * secs * 2.0) && scaled <= static_cast<uint64_t>(80.0 * secs) + 3,
+            "10A8: scaled clock runs at speed x tick_hz");
+    host.unsubscribe(w, fast);
+    host.stop();
+
+    std::cout << "[PASS] 10A8 world clock: max throughput, pause/step/seek, lockstep acks, scaled\n";
+}
+
+static void runTelemetryRecording_10A9()
+{
+    using Clock = std::chrono::steady_clock;
+    const std::string path = "test_recording_10A9.vfrec";
+
+    // 2 s of the rack scenario at 10 kHz: ignition at once, suppression at 1 s
+    vfep::Simulation sim;
+    sim.resetToDataCenterRackScenario();
+    sim.commandIgniteOrIncreasePyrolysis();
+    const double dt = 1e-4;
+    const int steps = 20000;
+    std::vector<vfep::RecordedObservation> truth;
+    truth.reserve(steps);
+    for (int i = 0; i < steps; ++i) {
+        if (i == steps / 2) sim.commandStartSuppression();
+        sim.step(dt);
+        truth.push_back({(i + 1) * dt, sim.observe()});
+    }
+
+    vfep::TelemetryRecorder rec(1024);
+    REQUIRE(rec.open(path, vfep::RecordingSchema::Observation), "10A9: recording opens");
+    // Median per-row cost: the few appends that hand a chunk to the flush
+    // thread (or lose the core to it) are the outliers
+    std::vector<double> append_cost_ns;
+    append_cost_ns.reserve(truth.size());
+    for (const auto& row : truth) {
+        const auto t0 = Clock::now();
+        rec.append(row.t_s, row.obs);
+        append_cost_ns.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count());
+    }
+    std::nth_element(append_cost_ns.begin(), append_cost_ns.begin() + steps / 2, append_cost_ns.end());
+    const double append_ns = append_cost_ns[steps / 2];
+    bool threw = false;
+    try { rec.append(vfep::TelemetrySampleV2{}); } catch (const std::invalid_argument&) { threw = true; }
+    REQUIRE(threw, "10A9: a row of the wrong schema is rejected");
+    REQUIRE(rec.close(), "10A9: recording closes cleanly");
+    REQUIRE(rec.rowsAppended() == static_cast<uint64_t>(steps), "10A9: every row appended");
+    REQUIRE(rec.chunksWritten() == 20, "10A9: 1024-row chunks");
+    // Encoding runs on the flush thread; the step only pays for the copy
+    REQUIRE(append_ns < 500.0, "10A9: append costs well under a 10 kHz step budget");
+
+    const size_t columns = vfep::recordingColumns(vfep::RecordingSchema::Observation).size();
+    const double raw_bytes = static_cast<double>(steps) * columns * sizeof(double);
+    const double file_bytes = static_cast<double>(std::filesystem::file_size(path));
+    REQUIRE(file_bytes == static_cast<double>(rec.bytesWritten()), "10A9: byte counter matches the file");
+    REQUIRE(file_bytes < 0.75 * raw_bytes, "10A9: columnar delta/XOR chunks compress");
+
+    // Round trip is bit-exact, and time seeks land in the right chunk
+    {
+        vfep::TelemetryRecordingReader reader;
+        REQUIRE(reader.open(path), "10A9: reader maps the recording");
+        REQUIRE(!reader.recovered(), "10A9: footer index present");
+        REQUIRE(reader.schema() == vfep::RecordingSchema::Observation && reader.columns().size() == columns,
+                "10A9: self-describing header");
+        REQUIRE(reader.columns()[2].name == "HRR_W", "10A9: column names stored");
+        REQUIRE(reader.rowCount() == static_cast<uint64_t>(steps) && reader.chunkCount() == 20, "10A9: index covers all rows");
+        REQUIRE(reader.startTime() == truth.front().t_s && reader.endTime() == truth.back().t_s, "10A9: time range");
+
+        std::vector<vfep::RecordedObservation> all;
+        REQUIRE(reader.readObservations(0.0, 10.0, all) && all.size() == truth.size(), "10A9: full replay");
+        bool exact = true;
+        for (size_t i = 0; i < all.size(); ++i) {
+            const auto& a = all[i];
+            const auto& b = truth[i];
+            exact = exact && a.t_s == b.t_s && a.obs.T_K == b.obs.T_K && a.obs.HRR_W == b.obs.HRR_W
+                && a.obs.O2_volpct == b.obs.O2_volpct && a.obs.agent_mdot_kgps == b.obs.agent_mdot_kgps
+                && a.obs.knockdown_0_1 == b.obs.knockdown_0_1 && a.obs.reward == b.obs.reward;
+        }
+        REQUIRE(exact, "10A9: replayed values are bit-exact");
+
+        const size_t c = reader.findChunk(1.0);
+        REQUIRE(c < reader.chunkCount() && reader.chunkInfo(c).t_first <= 1.0 && reader.chunkInfo(c).t_last >= 1.0,
+                "10A9: seek finds the chunk holding t");
+        REQUIRE(reader.findChunk(99.0) == reader.chunkCount(), "10A9: seek past the end");
+        std::vector<vfep::RecordedObservation> window;
+        REQUIRE(reader.readObservations(1.0, 1.01, window), "10A9: windowed read");
+        REQUIRE(window.size() >= 99 && window.size() <= 101 && window.front().t_s >= 1.0 && window.back().t_s <= 1.01,
+                "10A9: window holds only rows in range");
+    }
+
+    // A flipped payload byte fails that chunk's CRC only
+    std::vector<char> bytes(static_cast<size_t>(file_bytes));
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    {
+        vfep::TelemetryRecordingReader reader;
+        REQUIRE(reader.open(path), "10A9: reopen");
+        const size_t corrupt_at = static_cast<size_t>(reader.chunkInfo(1).offset) + 100;
+        std::vector<char> damaged = bytes;
+        damaged[corrupt_at] ^= 0x10;
+        std::ofstream out("test_recording_10A9_bad.vfrec", std::ios::binary);
+        out.write(damaged.data(), static_cast<std::streamsize>(damaged.size()));
+    }
+    {
+        vfep::TelemetryRecordingReader reader;
+        REQUIRE(reader.open("test_recording_10A9_bad.vfrec"), "10A9: damaged payload still opens");
+        vfep::RecordingChunkData data;
+        REQUIRE(reader.readChunk(0, data) && data.rows == 1024, "10A9: intact chunk decodes");
+        REQUIRE(!reader.readChunk(1, data), "10A9: CRC catches the damaged chunk");
+        std::vector<vfep::RecordedObservation> rows;
+        REQUIRE(!reader.readObservations(0.0, 10.0, rows), "10A9: replay over a damaged chunk fails");
+    }
+
+    // Writer that never closed: no footer, complete chunks recovered by scanning
+    {
+        vfep::TelemetryRecordingReader reader;
+        REQUIRE(reader.open(path), "10A9: reopen");
+        const size_t cut = static_cast<size_t>(reader.chunkInfo(3).offset) + 200;
+        std::ofstream out("test_recording_10A9_torn.vfrec", std::ios::binary);
+        out.write(bytes.data(), static_cast<std::streamsize>(cut));
+    }
+    {
+        vfep::TelemetryRecordingReader reader;
+        REQUIRE(reader.open("test_recording_10A9_torn.vfrec"), "10A9: torn file opens");
+        REQUIRE(reader.recovered() && reader.chunkCount() == 3 && reader.rowCount() == 3 * 1024,
+                "10A9: torn chunk dropped, earlier chunks recovered");
+    }
+
+    // TelemetrySampleV2 stream round-trips field for field
+    {
+        vfep::TelemetryRecorder v2(256);
+        REQUIRE(v2.open(path, vfep::RecordingSchema::TelemetryV2), "10A9: v2 recording opens");
+        std::vector<vfep::TelemetrySampleV2> samples(1000);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            auto& s = samples[i];
+            s.t_s = 0.1f * static_cast<float>(i);
+            s.HRR_kW = 70.0f - 0.05f * static_cast<float>(i);
+            s.KD_actual_0_1 = std::min(1.0f, 0.001f * static_cast<float>(i));
+            s.events_u32 = (i % 7 == 0) ? vfep::Event_KD_ge_0p5 : 0u;
+            s.blocked_sector_count_u32 = static_cast<uint32_t>(i % 3);
+            v2.append(s);
+        }
+        REQUIRE(v2.close(), "10A9: v2 recording closes");
+        vfep::TelemetryRecordingReader reader;
+        std::vector<vfep::TelemetrySampleV2> back;
+        REQUIRE(reader.open(path) && reader.schema() == vfep::RecordingSchema::TelemetryV2, "10A9: v2 schema");
+        REQUIRE(reader.readSamplesV2(0.0, 1000.0, back) && back.size() == samples.size(), "10A9: v2 replay");
+        REQUIRE(std::memcmp(back.data(), samples.data(), samples.size() * sizeof(vfep::TelemetrySampleV2)) == 0,
+                "10A9: v2 samples identical");
+        std::vector<vfep::RecordedObservation> wrong;
+        REQUIRE(!reader.readObservations(0.0, 1000.0, wrong), "10A9: schema mismatch on read");
+    }
+
+    std::remove(path.c_str());
+    std::remove("test_recording_10A9_bad.vfrec");
+    std::remove("test_recording_10A9_torn.vfrec");
+    std::cout << "[PASS] 10A9 binary telemetry recording: compression, seek, CRC, torn-file recovery\n";
+}
+
+static void runObservationLog_10A10()
+{
+    // SPSC ring: FIFO across threads, full/empty at the edges
+    {
+        vfep::SpscRing<uint64_t> ring(5);
+        REQUIRE(ring.capacity() == 8, "10A10: capacity rounds up to a power of two");
+        for (uint64_t i = 0; i < 8; ++i) REQUIRE(ring.tryPush(i), "10A10: push into free slot");
+        REQUIRE(!ring.tryPush(99), "10A10: full ring refuses");
+        REQUIRE(ring.front() && *ring.front() == 0, "10A10: oldest first");
+        ring.pop();
+        REQUIRE(ring.tryPush(8), "10A10: popped slot reused");
+
+        const uint64_t n = 200000;
+        std::atomic<bool> ordered{true};
+        std::thread consumer([&] {
+            uint64_t expect = 1;
+            while (expect <= n + 7) {
+                if (const uint64_t* v = ring.front()) {
+                    if (*v != expect) ordered = false;
+                    ring.pop();
+                    ++expect;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        for (uint64_t i = 9; i <= n + 7; ++i) {
+            while (!ring.tryPush(i)) std::this_thread::yield();
+        }
+        consumer.join();
+        REQUIRE(ordered.load() && ring.front() == nullptr, "10A10: every item once, in order");
+    }
+
+    vfep::Simulation sim;
+    sim.resetToDataCenterRackScenario();
+    sim.commandIgniteOrIncreasePyrolysis();
+    std::vector<std::pair<double, vfep::Observation>> rows;
+    for (int i = 1; i <= 3000; ++i) {
+        if (i == 1500) sim.commandStartSuppression();
+        sim.step(0.01);
+        rows.push_back({i * 0.01, sim.observe()});
+    }
+
+    // CSV through a tiny ring (forces stalls) matches the old ostream output byte for byte
+    {
+        std::ostringstream expect;
+        expect << "time_s,T_K,HRR_kW,O2_volpct,CO2_volpct,H2O_volpct,fuel_kg,inhib_kgm3,inert_kgm3,ACH,agent_mdot_kgps,reward\n";
+        expect << std::fixed << std::setprecision(6);
+        for (const auto& r : rows) {
+            const auto& o = r.second;
+            expect << r.first << "," << o.T_K << "," << (o.HRR_W / 1000.0) << ","
+                   << o.O2_volpct << "," << o.CO2_volpct << "," << o.H2O_volpct << ","
+                   << o.fuel_kg << "," << o.inhibitor_kgm3 << "," << o.inert_kgm3 << ","
+                   << o.ACH << "," << o.agent_mdot_kgps << "," << o.reward << "\n";
+        }
+
+        vfep::ObservationLogWriter log(4);
+        REQUIRE(log.open("test_obslog_10A10.csv", vfep::ObservationLogFormat::Csv), "10A10: csv log opens");
+        for (const auto& r : rows) log.push(r.first, r.second);
+        REQUIRE(log.close(), "10A10: csv log closes");
+        REQUIRE(log.rowsWritten() == rows.size(), "10A10: every row written");
+
+        std::ifstream in("test_obslog_10A10.csv", std::ios::binary);
+        const std::string got((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        REQUIRE(got == expect.str(), "10A10: to_chars CSV identical to std::fixed/setprecision(6)");
+    }
+
+    // Flat binary: numpy-style fixed offset, one float64 per column
+    {
+        vfep::ObservationLogWriter log;
+        REQUIRE(log.open("test_obslog_10A10.bin", vfep::ObservationLogFormat::Binary), "10A10: bin log opens");
+        for (const auto& r : rows) log.push(r.first, r.second);
+        REQUIRE(log.close(), "10A10: bin log closes");
+
+        const size_t cols = vfep::ObservationLogWriter::columnNames().size();
+        std::ifstream in("test_obslog_10A10.bin", std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        const size_t off = vfep::ObservationLogWriter::dataOffset();
+        REQUIRE(bytes.size() == off + rows.size() * cols * sizeof(double), "10A10: bin size is header + rows");
+        REQUIRE(std::memcmp(bytes.data(), "VFEPLOG1", 8) == 0 && std::string(bytes.data() + 16 + 2 * 32) == "HRR_kW",
+                "10A10: bin header names its columns");
+        bool exact = true;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            double v[3];
+            std::memcpy(v, bytes.data() + off + i * cols * sizeof(double), sizeof(v));
+            exact = exact && v[0] == rows[i].first && v[1] == rows[i].second.T_K
+                && v[2] == rows[i].second.HRR_W / 1000.0;
+        }
+        REQUIRE(exact, "10A10: bin values bit-exact");
+    }
+
+    // parquet-lite is the columnar recording
+    {
+        vfep::ObservationLogFormat fmt = vfep::ObservationLogFormat::Csv;
+        REQUIRE(vfep::parseObservationLogFormat("parquet-lite", fmt) && fmt == vfep::ObservationLogFormat::ParquetLite,
+                "10A10: format names parse");
+        REQUIRE(!vfep::parseObservationLogFormat("xlsx", fmt), "10A10: unknown format rejected");
+
+        vfep::ObservationLogWriter log;
+        REQUIRE(log.open("test_obslog_10A10.vfrec", fmt), "10A10: parquet-lite log opens");
+        for (const auto& r : rows) log.push(r.first, r.second);
+        REQUIRE(log.close(), "10A10: parquet-lite log closes");
+        vfep::TelemetryRecordingReader reader;
+        std::vector<vfep::RecordedObservation> back;
+        REQUIRE(reader.open("test_obslog_10A10.vfrec") && reader.readObservations(0.0, 1e9, back)
+                && back.size() == rows.size() && back.back().obs.HRR_W == rows.back().second.HRR_W,
+                "10A10: parquet-lite replays through TelemetryRecordingReader");
+    }
+
+    std::remove("test_obslog_10A10.csv");
+    std::remove("test_obslog_10A10.bin");
+    std::remove("test_obslog_10A10.vfrec");
+    std::cout << "[PASS] 10A10 async observation log: SPSC ring, to_chars CSV, bin, parquet-lite\n";
+}
+
+namespace vfep {
+struct TelemetryHistoryTestAccess {
+    static std::vector<uint8_t>& chunkBytes(TelemetryHistory& h, size_t chunk) { return h.tiers_[0].chunks[chunk].bytes; }
+};
+} // namespace vfep
+
+static void runTelemetryHistory_10A11()
+{
+    vfep::TelemetryHistoryConfig cfg;
+    cfg.hot_rows = 16;
+    cfg.chunk_rows = 8;
+    cfg.full_rate_chunks = 4;
+    cfg.decimated_chunks = 2;
+    vfep::TelemetryHistory history(vfep::RecordingSchema::TelemetryV1, cfg);
+    REQUIRE(history.memoryBytes() == 0 && history.fullRateRows() == 0, "10A11: nothing allocated before first push");
+
+    bool threw = false;
+    try { vfep::TelemetryHistory bad(vfep::RecordingSchema::Observation); } catch (const std::invalid_argument&) { threw = true; }
+    REQUIRE(threw, "10A11: 8-byte Observation schema rejected");
+
+    std::vector<vfep::TelemetrySampleV1> pushed;
+    for (int i = 0; i < 2000; ++i) {
+        vfep::TelemetrySampleV1 s{};
+        s.t_s = static_cast<float>(i) * 0.1f;
+        s.exposure_kg = static_cast<float>(i) * 0.001f;
+        s.KD_actual_0_1 = static_cast<float>(i % 7) / 7.0f;
+        s.HRR_kW = 500.0f + 100.0f * std::sin(static_cast<float>(i) * 0.05f);
+        history.push(s);
+        pushed.push_back(s);
+    }
+    threw = false;
+    try { history.push(vfep::TelemetrySampleV2{}); } catch (const std::invalid_argument&) { threw = true; }
+    REQUIRE(threw, "10A11: sample of the wrong schema rejected");
+
+    // 1984 rows left the ring: tier 0 keeps its last 4 chunks of 8, plus 16 hot
+    REQUIRE(history.totalRows() == 2000, "10A11: every push counted");
+    REQUIRE(history.fullRateRows() == 16 + 4 * 8, "10A11: tier 0 drops its oldest chunks beyond budget");
+    std::vector<vfep::TelemetrySampleV1> full(history.fullRateRows() + 5);
+    const size_t got = history.copyFullRate(0, full.size(), full.data());
+    REQUIRE(got == history.fullRateRows(), "10A11: copy clamped to retained rows");
+    REQUIRE(std::memcmp(full.data(), pushed.data() + (2000 - got), got * sizeof(vfep::TelemetrySampleV1)) == 0,
+            "10A11: tier 0 + hot ring bit-exact, oldest first");
+    vfep::TelemetrySampleV1 mid{};
+    REQUIRE(history.copyFullRate(20, 1, &mid) == 1 && mid.t_s == pushed[2000 - got + 20].t_s,
+            "10A11: copy from an offset inside a compressed chunk");
+
+    // Summaries: group g of tier k covers evicted rows [g * 10^k, (g + 1) * 10^k)
+    auto check = [&](int tier, size_t expect_count, size_t first_group) {
+        std::vector<vfep::TelemetrySummary> sums;
+        if (!history.summaries(tier, sums) || sums.size() != expect_count) return false;
+        const size_t span = tier == 1 ? 10 : 100;
+        for (size_t k = 0; k < sums.size(); ++k) {
+            const size_t g0 = (first_group + k) * span;
+            float lo = pushed[g0].HRR_kW, hi = lo;
+            double sum = 0.0;
+            for (size_t i = g0; i < g0 + span; ++i) {
+                lo = std::min(lo, pushed[i].HRR_kW);
+                hi = std::max(hi, pushed[i].HRR_kW);
+                sum += pushed[i].HRR_kW;
+            }
+            const auto& s = sums[k];
+            if (s.rows != span || s.min[7] != lo || s.max[7] != hi) return false;
+            if (std::fabs(s.mean[7] - sum / span) > 1e-3) return false;
+            if (s.min[0] != pushed[g0].t_s || s.max[0] != pushed[g0 + span - 1].t_s) return false;
+        }
+        return true;
+    };
+    // Tier 1: 198 summaries, budget keeps 2 chunks of 8 plus 6 open
+    REQUIRE(check(1, 22, 198 - 22), "10A11: 10x min/max/mean, oldest chunks dropped");
+    // Tier 2 is unbounded: all 19 complete 100-sample groups
+    REQUIRE(check(2, 19, 0), "10A11: 100x min/max/mean spans the whole run");
+    std::vector<vfep::TelemetrySummary> none;
+    REQUIRE(!history.summaries(0, none), "10A11: tier 0 has no summaries");
+
+    // A tier-0 chunk that fails to decode ends the copy instead of shifting later rows
+    vfep::TelemetryHistoryTestAccess::chunkBytes(history, 1).pop_back();
+    REQUIRE(history.copyFullRate(0, full.size(), full.data()) == 8 &&
+            std::memcmp(full.data(), pushed.data() + (2000 - got), 8 * sizeof(vfep::TelemetrySampleV1)) == 0,
+            "10A11: copy stops at a corrupted chunk");
+    REQUIRE(history.copyFullRate(10, 1, &mid) == 0, "10A11: copy starting inside a corrupted chunk returns nothing");
+    REQUIRE(history.copyFullRate(20, 1, &mid) == 1 && mid.t_s == pushed[2000 - got + 20].t_s,
+            "10A11: rows after a corrupted chunk keep their index");
+
+    history.clear();
+    REQUIRE(history.fullRateRows() == 0 && history.totalRows() == 0, "10A11: clear drops every sample");
+
+    // Simulation keeps the old 2048-sample window API on top of the history
+    vfep::Simulation sim;
+    sim.resetToDataCenterRackScenario();
+    sim.commandIgniteOrIncreasePyrolysis();
+    REQUIRE(sim.telemetryHistory() == nullptr, "10A11: no history before the first sample");
+    for (int i = 0; i < 30000; ++i) sim.step(0.01);  // 300 s at 10 Hz sampling
+    const vfep::TelemetryHistory* h = sim.telemetryHistory();
+    REQUIRE(h && h->totalRows() > static_cast<uint64_t>(vfep::Simulation::kTelemetryWindow),
+            "10A11: simulation history outgrows the old ring");
+    std::vector<vfep::TelemetrySampleV1> window(4096);
+    const int n = sim.getTelemetrySamples(window.data(), static_cast<int>(window.size()));
+    REQUIRE(n == vfep::Simulation::kTelemetryWindow, "10A11: getTelemetrySamples still returns a 2048 window");
+    bool contiguous = true;
+    for (int i = 1; i < n; ++i) contiguous = contiguous && std::fabs(window[i].t_s - window[i - 1].t_s - 0.1f) < 1e-3f;
+    REQUIRE(contiguous && std::fabs(window[n - 1].t_s - 300.0f) < 0.15f, "10A11: window is the newest samples, in order");
+    vfep::TelemetrySampleV1 first{};
+    REQUIRE(sim.getTelemetrySamples(&first, 1) == 1 && first.t_s == window[0].t_s, "10A11: small cap returns the oldest");
+    std::vector<vfep::TelemetrySummary> sums;
+    REQUIRE(h->summaries(2, sums) && sums.size() == (h->totalRows() - h->config().hot_rows) / 100, "10A11: 100x tier covers the run");
+
+    vfep::Simulation quiet;
+    quiet.enableTelemetryHistory(false);
+    quiet.resetToDataCenterRackScenario();
+    for (int i = 0; i < 1000; ++i) quiet.step(0.01);
+    REQUIRE(quiet.telemetryHistory() == nullptr && quiet.getTelemetrySamples(window.data(), 10) == 0,
+            "10A11: disabled history holds no memory");
+
+    std::cout << "[PASS] 10A11 telemetry history: hot ring, full-rate/10x/100x tiers, 2048-window compat\n";
+}
+
+static void runCrc32Digest_10A12()
+{
+    // Bit-at-a-time reference
+    auto reference = [](uint32_t crc, const uint8_t* p, size_t n) {
+        uint32_t c = ~crc;
+        for (size_t i = 0; i < n; ++i) {
+            c ^= p[i];
+            for (int k = 0; k < 8; ++k) c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        return ~c;
+    };
+    REQUIRE(vfep::crc32_update(0, "123456789", 9) == 0xCBF43926u, "10A12: CRC-32/IEEE check value");
+    static_assert(vfep::detail::kCrc32Tables[0][1] == 0x77073096u, "10A12: table built at compile time");
+
+    uint32_t seed = 0x9E3779B9u;
+    auto next = [&seed] {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    };
+    std::vector<uint8_t> buf(3000);
+    for (auto& b : buf) b = static_cast<uint8_t>(next());
+    bool match = true;
+    for (size_t n = 0; n + 3 <= buf.size(); n += (n < 300 ? 1 : 97)) {
+        for (size_t off = 0; off < 3; ++off) {
+            const uint32_t crc = next();
+            match = match && vfep::crc32_update(crc, buf.data() + off, n) == reference(crc, buf.data() + off, n);
+        }
+    }
+    REQUIRE(match, "10A12: slicing-by-8 and folded paths match the bitwise CRC (all lengths / alignments)");
+    const uint32_t whole = vfep::crc32_update(0, buf.data(), buf.size());
+    uint32_t pieces = 0;
+    for (size_t at = 0; at < buf.size(); at += 333) {
+        pieces = vfep::crc32_update(pieces, buf.data() + at, std::min<size_t>(333, buf.size() - at));
+    }
+    REQUIRE(pieces == whole, "10A12: streaming in pieces equals one call");
+
+    // Signatures from simulations running concurrently equal the serial ones
+    auto signatures = [](int id) {
+        vfep::Simulation sim;
+        sim.runVerificationTest(static_cast<vfep::VerificationTestId>(id));
+        return sim.getRunSignatures();
+    };
+    std::array<vfep::RunSignatures, 3> serial;
+    for (int id = 0; id < 3; ++id) serial[id] = signatures(id);
+    std::array<vfep::RunSignatures, 6> parallel;
+    std::vector<std::thread> threads;
+    for (int k = 0; k < 6; ++k) threads.emplace_back([&, k] { parallel[k] = signatures(k % 3); });
+    for (auto& t : threads) t.join();
+    bool same = true;
+    for (int k = 0; k < 6; ++k) {
+        const auto& a = parallel[k];
+        const auto& b = serial[k % 3];
+        same = same && a.run_param_hash_u32 == b.run_param_hash_u32 && a.telemetry_crc_u32 == b.telemetry_crc_u32
+            && a.state_digest_u32 == b.state_digest_u32;
+    }
+    REQUIRE(same && serial[0].telemetry_crc_u32 != 0, "10A12: concurrent verification runs give the serial signatures");
+
+    std::cout << "[PASS] 10A12 CRC-32: constexpr slicing-by-8, streaming, thread-safe run signatures\n";
+}
+
+static void runObservationShm_10A13()
+{
+    const auto& fields = vfep::observationShmFields();
+    REQUIRE(!fields.empty() && std::string(fields[0].name) == "t_s" && fields[0].offset == 8,
+            "10A13: t_s is the first column, after the slot's seq");
+    bool packed = true;
+    for (size_t i = 1; i < fields.size(); ++i) packed = packed && fields[i].offset == fields[i - 1].offset + 8;
+    REQUIRE(packed && fields.size() * sizeof(double) == sizeof(vfep::ObservationFrameV1),
+            "10A13: frame is contiguous float64 columns");
+    REQUIRE(std::string(fields.back().name) == "sector_knockdown_target_0_1_3", "10A13: sector arrays flattened");
+
+    const std::string path = "test_obsshm_10A13.shm";
+    vfep::ObservationShmWriter writer;
+    REQUIRE(writer.open(path, 5) && writer.capacity() == 8, "10A13: ring created, capacity rounded to 8");
+    vfep::ObservationShmReader reader;
+    REQUIRE(reader.open(path) && reader.capacity() == 8 && reader.published() == 0 && reader.writerOpen(),
+            "10A13: reader attaches to an empty ring");
+
+    vfep::Simulation sim;
+    sim.enableTelemetryHistory(false);
+    sim.resetToDataCenterRackScenario();
+    sim.commandIgniteOrIncreasePyrolysis();
+    std::vector<vfep::Observation> obs;
+    for (int i = 0; i < 23; ++i) {
+        sim.step(0.05);
+        obs.push_back(sim.observe());
+    }
+
+    for (int i = 0; i < 3; ++i) writer.publish(i * 0.05, obs[i]);
+    uint64_t cursor = 0, dropped = 0;
+    std::vector<vfep::ObservationFrameV1> frames;
+    REQUIRE(reader.poll(cursor, frames, &dropped) == 3 && cursor == 3 && dropped == 0, "10A13: poll returns new frames");
+    vfep::ObservationFrameV1 expect;
+    vfep::toObservationFrame(0.10, obs[2], expect);
+    REQUIRE(std::memcmp(&frames[2], &expect, sizeof(expect)) == 0 && frames[2].HRR_W == obs[2].HRR_W
+            && frames[2].sector_occlusion_0_1[3] == obs[2].sector_occlusion_0_1[3],
+            "10A13: frame matches the Observation");
+
+    // The writer never waits: 20 more frames lap an idle reader
+    for (int i = 3; i < 23; ++i) writer.publish(i * 0.05, obs[i]);
+    frames.clear();
+    REQUIRE(reader.poll(cursor, frames, &dropped) == 8 && dropped == 12 && cursor == 23
+            && frames.front().t_s == 15 * 0.05, "10A13: lapped reader skips to the oldest retained frame");
+    REQUIRE(!reader.read(14, expect) && reader.read(22, expect) && expect.t_s == 22 * 0.05,
+            "10A13: overwritten frames are refused");
+
+    // The header is plain little-endian data a numpy reader can parse
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> head(vfep::kObservationShmHeaderBytes);
+        in.read(head.data(), static_cast<std::streamsize>(head.size()));
+        uint32_t u[6];
+        std::memcpy(u, head.data() + 8, sizeof(u));
+        vfep::ObservationShmField first;
+        std::memcpy(&first, head.data() + u[5], sizeof(first));
+        REQUIRE(std::memcmp(head.data(), "VFEPOBS1", 8) == 0 && u[0] == vfep::kObservationShmVersion
+                && u[2] == 8 + sizeof(vfep::ObservationFrameV1) && u[3] == 8 && u[4] == fields.size()
+                && std::string(first.name) == "t_s", "10A13: self-describing header");
+    }
+
+    // Concurrent reader: never a torn frame, and received + dropped = published
+    {
+        vfep::ObservationShmWriter w;
+        REQUIRE(w.open(path, 64), "10A13: ring re-created");
+        vfep::ObservationShmReader r;
+        REQUIRE(r.open(path), "10A13: reader re-attaches");
+        const uint64_t total = 200000;
+        std::atomic<bool> done{false};
+        uint64_t got = 0, lost = 0;
+        bool consistent = true;
+        std::thread consumer([&] {
+            uint64_t c = 0;
+            std::vector<vfep::ObservationFrameV1> batch;
+            for (;;) {
+                const bool last = done.load();
+                batch.clear();
+                uint64_t d = 0;
+                got += r.poll(c, batch, &d);
+                lost += d;
+                for (const auto& f : batch) consistent = consistent && f.T_K == f.t_s * 2.0 && f.reward == -f.t_s;
+                if (last) break;
+                std::this_thread::yield();
+            }
+        });
+        vfep::Observation o;
+        for (uint64_t i = 0; i < total; ++i) {
+            o.T_K = static_cast<double>(i) * 2.0;
+            o.reward = -static_cast<double>(i);
+            w.publish(static_cast<double>(i), o);
+        }
+        done = true;
+        consumer.join();
+        REQUIRE(consistent, "10A13: seqlock rejects torn frames");
+        REQUIRE(got + lost == total && got > 0, "10A13: every frame either received or counted as dropped");
+        w.close();
+        REQUIRE(!r.writerOpen() && r.published() == total, "10A13: ring outlives the writer");
+    }
+
+    // A ring from another layout is refused
+    {
+        reader.close();
+        writer.close();
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(32);
+        const uint64_t bogus = 0;
+        f.write(reinterpret_cast<const char*>(&bogus), sizeof(bogus));
+        f.close();
+        REQUIRE(!reader.open(path), "10A13: layout hash mismatch refused");
+    }
+    std::remove(path.c_str());
+
+    std::cout << "[PASS] 10A13 shared-memory observation ring: generated layout, seqlock, lapping\n";
+}
+
+static void runScenarioBatch_10A14()
+{
+    using vfep::kScenarioMetricCount;
+    using vfep::kScenarioParamCount;
+    REQUIRE(std::string(vfep::scenarioParamName(0)) == "dt_s" && vfep::scenarioParamName(kScenarioParamCount) == nullptr
+            && std::string(vfep::scenarioMetricName(1)) == "peak_HRR_W", "10A14: column names");
+
+    // Six short scenarios; later rows differ in ventilation, fuel, geometry and suppression
+    const size_t rows = 6;
+    std::vector<double> params;
+    for (size_t r = 0; r < rows; ++r) {
+        vfep::ScenarioParams p{};
+        p.t_end_s = 12.0 + 2.0 * static_cast<double>(r);
+        p.ignite_at_s = 1.0;
+        p.suppress_at_s = (r % 2) ? 6.0 : -1.0;
+        p.ach_1_per_h = (r == 3) ? 8.0 : -1.0;
+        p.pyrolysis_max_kgps = 0.02 + 0.01 * static_cast<double>(r);
+        p.volume_m3 = 80.0 + 20.0 * static_cast<double>(r);
+        const double* d = reinterpret_cast<const double*>(&p);
+        params.insert(params.end(), d, d + kScenarioParamCount);
+    }
+
+    // Reference: the MonteCarloUQ drive written out by hand for row 1
+    {
+        vfep::Simulation sim;
+        sim.enableTelemetryHistory(false);
+        sim.resetToDataCenterRackScenario();
+        sim.setPyrolysisMax(0.03);
+        sim.setCombustionHeatRelease(1.0e5);
+        sim.setReactorGeometry(100.0, 180.0, 10.0);
+        sim.setLiIonEnabled(false);
+        double peak_T = 0.0, peak_HRR = 0.0, t_peak = 0.0, t = 0.0;
+        int steps = 0;
+        while (t + 0.05 <= 14.0 + 1e-12) {
+            const double t_next = t + 0.05;
+            if (t < 1.0 && t_next >= 1.0) {
+                sim.commandIgniteOrIncreasePyrolysis();
+                sim.setPyrolysisRate(0.03);
+            }
+            if (t < 6.0 && t_next >= 6.0) {
+                sim.commandStartSuppression();
+                sim.setAgentDeliveryRate(1.0);
+                sim.setKnockdown(0.55);
+            }
+            sim.step(0.05);
+            t = t_next;
+            ++steps;
+            const auto o = sim.observe();
+            peak_T = std::max(peak_T, o.T_K);
+            if (o.HRR_W > peak_HRR) {
+                peak_HRR = o.HRR_W;
+                t_peak = t;
+            }
+        }
+        const auto m = vfep::runScenario(vfep::scenarioParamsFromRow(params.data() + kScenarioParamCount,
+                                                                     kScenarioParamCount));
+        REQUIRE(m.peak_T_K == peak_T && m.peak_HRR_W == peak_HRR && m.t_peak_HRR_s == t_peak
+                && m.steps == steps && peak_HRR > 0.0, "10A14: runScenario matches the UQ drive");
+    }
+
+    // Serial and threaded batches are identical, telemetry included
+    const size_t cap = 64;
+    std::vector<double> serial(rows * kScenarioMetricCount), threaded(rows * kScenarioMetricCount);
+    std::vector<float> tel_serial(rows * cap * 8), tel_threaded(rows * cap * 8);
+    std::vector<int32_t> n_serial(rows), n_threaded(rows);
+    vfep::runScenarioBatch(params.data(), rows, kScenarioParamCount, serial.data(), tel_serial.data(), cap,
+                           n_serial.data(), 1);
+    vfep::runScenarioBatch(params.data(), rows, kScenarioParamCount, threaded.data(), tel_threaded.data(), cap,
+                           n_threaded.data(), 4);
+    REQUIRE(serial == threaded && tel_serial == tel_threaded && n_serial == n_threaded,
+            "10A14: results do not depend on the thread count");
+    REQUIRE(n_serial[0] == 64 && tel_serial[8] > tel_serial[0] && tel_serial[63 * 8 + 7] > 0.0f,
+            "10A14: telemetry rows are oldest first and capped");
+
+    // Short rows keep their defaults
+    {
+        std::vector<double> narrow = {0.05, 14.0, 1.0, 6.0, -1.0, 0.03, 1.0e5, 100.0};
+        double m[kScenarioMetricCount];
+        vfep::runScenarioBatch(narrow.data(), 1, narrow.size(), m);
+        REQUIRE(std::equal(m, m + kScenarioMetricCount, serial.begin() + kScenarioMetricCount),
+                "10A14: missing columns take defaults");
+    }
+
+    bool threw = false;
+    try {
+        std::vector<double> bad = params;
+        bad[2 * kScenarioParamCount] = 0.0;  // dt_s of row 2
+        vfep::runScenarioBatch(bad.data(), rows, kScenarioParamCount, threaded.data());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    REQUIRE(threw, "10A14: invalid row rejected before running");
+
+#if defined(CHEMSI_HAVE_CAPI)
+    // C ABI: same numbers through the shared library, errors as codes
+    REQUIRE(chemsi_abi_version() == CHEMSI_C_ABI_VERSION && chemsi_param_count() == int(kScenarioParamCount)
+            && chemsi_metric_count() == int(kScenarioMetricCount)
+            && std::string(chemsi_metric_name(2)) == "t_peak_HRR_s" && chemsi_param_default(1) == 120.0,
+            "10A14: C ABI describes the matrices");
+    std::vector<double> via_c(rows * kScenarioMetricCount);
+    REQUIRE(chemsi_run_batch(params.data(), rows, int(kScenarioParamCount), via_c.data(), nullptr, 0, nullptr, 2)
+                == CHEMSI_OK && via_c == serial, "10A14: chemsi_run_batch matches");
+    REQUIRE(chemsi_run_batch(params.data(), rows, int(kScenarioParamCount) + 1, via_c.data(), nullptr, 0, nullptr, 0)
+                == CHEMSI_E_INVALID && std::strlen(chemsi_last_error()) > 0, "10A14: errors become codes");
+
+    chemsi_sim* h = chemsi_sim_create();
+    REQUIRE(h != nullptr && chemsi_sim_configure(h, params.data(), int(kScenarioParamCount)) == CHEMSI_OK
+            && chemsi_sim_ignite(h, 0.02) == CHEMSI_OK && chemsi_sim_step(h, 0.05, 100) == CHEMSI_OK,
+            "10A14: handle configured and stepped");
+    vfep::Simulation sim;
+    vfep::configureScenario(sim, vfep::scenarioParamsFromRow(params.data(), kScenarioParamCount));
+    sim.commandIgniteOrIncreasePyrolysis();
+    sim.setPyrolysisRate(0.02);
+    for (int i = 0; i < 100; ++i) sim.step(0.05);
+    vfep::ObservationFrameV1 expect{};
+    vfep::toObservationFrame(sim.time_s(), sim.observe(), expect);
+    std::vector<double> cols(static_cast<size_t>(chemsi_observation_column_count()));
+    REQUIRE(chemsi_sim_observe(h, cols.data(), int(cols.size())) == int(cols.size())
+            && std::memcmp(cols.data(), &expect, sizeof(expect)) == 0
+            && std::string(chemsi_observation_column_name(1)) == "T_K" && chemsi_sim_time(h) == sim.time_s(),
+            "10A14: observe() columns match ObservationFrameV1");
+    std::vector<float> tel(16 * 8);
+    REQUIRE(chemsi_sim_telemetry(h, tel.data(), 16) == 16, "10A14: handle telemetry");
+    REQUIRE(chemsi_sim_step(h, -1.0, 1) == CHEMSI_E_INVALID, "10A14: bad step refused");
+    chemsi_sim_destroy(h);
+#endif
+
+    std::cout << "[PASS] 10A14 Scenario batch runner and C ABI\n";
+}
+
+static void runMlpSurrogate_10A15()
+{
+    // A 5 -> 16 -> 16 -> 3 network in SurrogateModel.save() layout, with a double-precision reference
+    const std::vector<size_t> sizes = {5, 16, 16, 3};
+    std::vector<std::vector<std::vector<double>>> W;  // fan_in x fan_out
+    std::vector<std::vector<double>> B;
+    for (size_t k = 0; k + 1 < sizes.size(); ++k) {
+        W.emplace_back(sizes[k], std::vector<double>(sizes[k + 1]));
+        B.emplace_back(sizes[k + 1]);
+        for (size_t i = 0; i < sizes[k]; ++i)
+            for (size_t j = 0; j < sizes[k + 1]; ++j) W[k][i][j] = 0.4 * std::sin(1.3 * double(i + 7 * j + 31 * k) + 0.2);
+        for (size_t j = 0; j < sizes[k + 1]; ++j) B[k][j] = 0.1 * std::cos(double(j + 5 * k));
+    }
+    const std::vector<double> in_mean = {300.0, 0.5, 200.0, 3.0, 100.0}, in_std = {10.0, 0.2, 150.0, 3.0, 50.0};
+    const std::vector<double> out_mean = {350.0, 180.0, 60.0}, out_std = {30.0, 120.0, 20.0};
+
+    auto modelJson = [&](const char* activation, bool with_range) {
+        std::ostringstream js;
+        js << std::setprecision(17) << "{\"model_type\": \"mlp\", \"activation\": \"" << activation << "\",\n"
+           << " \"input_names\": [\"init_temp\", \"humidity\", \"hrr_kW\", \"ach\", \"volume_m3\"],\n"
+           << " \"output_names\": [\"peak_temp_K\", \"peak_hrr_kW\", \"t_peak_s\"], \"weights\": [";
+        for (size_t k = 0; k < W.size(); ++k) {
+            js << (k ? ", [" : "[");
+            for (size_t i = 0; i < W[k].size(); ++i) {
+                js << (i ? ", [" : "[");
+                for (size_t j = 0; j < W[k][i].size(); ++j) js << (j ? ", " : "") << W[k][i][j];
+                js << "]";
+            }
+            js << "]";
+        }
+        auto vec = [&](const std::vector<double>& v) {
+            std::ostringstream o;
+            o << std::setprecision(17) << "[";
+            for (size_t i = 0; i < v.size(); ++i) o << (i ? ", " : "") << v[i];
+            return o.str() + "]";
+        };
+        js << "], \"biases\": [" << vec(B[0]) << ", " << vec(B[1]) << ", " << vec(B[2]) << "],\n"
+           << " \"input_mean\": " << vec(in_mean) << ", \"input_std\": " << vec(in_std)
+           << ", \"output_mean\": " << vec(out_mean) << ", \"output_std\": " << vec(out_std)
+           << ", \"output_sigma\": null";
+        if (with_range) {
+            js << ", \"input_min\": [285.0, 0.2, 50.0, 0.1, 30.0], \"input_max\": [315.0, 0.8, 600.0, 12.0, 200.0]";
+        }
+        js << ", \"trained\": true}";
+        return js.str();
+    };
+    auto reference = [&](const double* x, bool tanh_act, double* y) {
+        std::vector<double> a(x, x + 5);
+        for (size_t i = 0; i < 5; ++i) a[i] = (a[i] - in_mean[i]) / in_std[i];
+        for (size_t k = 0; k < W.size(); ++k) {
+            std::vector<double> z(B[k]);
+            for (size_t j = 0; j < z.size(); ++j)
+                for (size_t i = 0; i < a.size(); ++i) z[j] += a[i] * W[k][i][j];
+            if (k + 1 < W.size())
+                for (double& v : z) v = tanh_act ? std::tanh(v) : std::max(0.0, v);
+            a = z;
+        }
+        for (size_t j = 0; j < 3; ++j) y[j] = a[j] * out_std[j] + out_mean[j];
+    };
+
+    // 37 rows: four full blocks of 8 and a partial one
+    const size_t rows = 37;
+    std::vector<double> X(rows * 5);
+    for (size_t r = 0; r < rows; ++r) {
+        const double u = double(r) / double(rows - 1);
+        const double x[5] = {290.0 + 20.0 * u, 0.3 + 0.4 * u * u, 100.0 + 450.0 * std::sin(3.0 * u) * std::sin(3.0 * u),
+                             0.5 + 10.0 * (1.0 - u), 40.0 + 150.0 * u};
+        std::copy(x, x + 5, X.begin() + r * 5);
+    }
+
+    for (const char* act : {"relu", "tanh"}) {
+        vfep::MlpSurrogate m;
+        std::string err;
+        REQUIRE(m.loadJson(modelJson(act, true), &err) && m.inputCount() == 5 && m.outputCount() == 3
+                && m.outputIndex("t_peak_s") == 2 && m.inputNames()[4] == "volume_m3",
+                std::string("10A15: model loads (") + act + ") " + err);
+        std::vector<double> Y(rows * 3), one(3);
+        m.predictBatch(X.data(), rows, Y.data());
+        double worst = 0.0;
+        for (size_t r = 0; r < rows; ++r) {
+            double ref[3];
+            reference(&X[r * 5], act[0] == 't', ref);
+            m.predict(&X[r * 5], one.data());
+            for (size_t j = 0; j < 3; ++j) {
+                worst = std::max(worst, std::fabs(Y[r * 3 + j] - ref[j]) / out_std[j]);
+                REQUIRE(one[j] == Y[r * 3 + j], "10A15: single prediction equals its batch row");
+            }
+        }
+        REQUIRE(worst < 1e-5, std::string("10A15: batched float32 inference matches the double reference (") + act + ")");
+    }
+
+    // A file without "activation" is relu, as SurrogateModel.load() reads it
+    {
+        std::string no_act = modelJson("relu", true);
+        const std::string key = "\"activation\": \"relu\",";
+        no_act.erase(no_act.find(key), key.size());
+        vfep::MlpSurrogate m;
+        std::string err;
+        REQUIRE(m.loadJson(no_act, &err), "10A15: model without activation loads " + err);
+        double worst = 0.0;
+        for (size_t r = 0; r < rows; ++r) {
+            double ref[3], one[3];
+            reference(&X[r * 5], false, ref);
+            m.predict(&X[r * 5], one);
+            for (size_t j = 0; j < 3; ++j) worst = std::max(worst, std::fabs(one[j] - ref[j]) / out_std[j]);
+        }
+        REQUIRE(worst < 1e-5, "10A15: missing activation defaults to relu");
+    }
+
+    // Envelope: saved training range, else mean +- 3 sigma; outside it the full simulation answers
+    vfep::MlpSurrogate m;
+    REQUIRE(m.loadJson(modelJson("relu", true)) && m.envelopeLow(2) == 50.0 && m.envelopeHigh(4) == 200.0,
+            "10A15: envelope from input_min/input_max");
+    std::vector<double> probe = {300.0, 0.5, 200.0, 3.0, 100.0,   300.0, 0.5, 900.0, 3.0, 100.0,
+                                 300.0, 0.5, 200.0, 3.0, std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> out(9);
+    uint8_t used[3] = {};
+    size_t sims = m.predictOrRun(probe.data(), 3, out.data(), [](const double* in, double* o) {
+        o[0] = -1.0; o[1] = in[2]; o[2] = -3.0;
+    }, used);
+    REQUIRE(sims == 2 && used[0] == 1 && used[1] == 0 && used[2] == 0 && out[3] == -1.0 && out[4] == 900.0
+            && out[0] > 0.0, "10A15: out-of-envelope rows fall back to full simulation");
+    m.setEnvelopeMargin(1.0);
+    REQUIRE(m.inEnvelope(&probe[5]) && m.envelopeHigh(2) == 1150.0, "10A15: envelope margin widens the range");
+    vfep::MlpSurrogate sigma;
+    REQUIRE(sigma.loadJson(modelJson("relu", false)) && sigma.envelopeLow(0) == 270.0 && sigma.envelopeHigh(0) == 330.0,
+            "10A15: envelope defaults to mean +- 3 sigma");
+
+    // Malformed files are refused with a reason, and the previous model stays
+    vfep::MlpSurrogate fresh;
+    fresh.loadJson(modelJson("relu", true));
+    const std::string good = modelJson("relu", true);
+    std::string err;
+    REQUIRE(!fresh.loadJson(good.substr(0, good.size() / 2), &err) && !err.empty() && fresh.loaded(),
+            "10A15: truncated JSON refused");
+    std::string ragged = good;
+    ragged.replace(ragged.find("\"output_mean\": [350"), 19, "\"output_mean\": [350, 1");
+    REQUIRE(!fresh.loadJson(ragged, &err) && err.find("normalization") != std::string::npos,
+            "10A15: inconsistent shapes refused");
+    std::string numeric_act = good;
+    numeric_act.replace(numeric_act.find("\"relu\""), 6, "1");
+    REQUIRE(!fresh.loadJson(numeric_act, &err) && err.find("activation") != std::string::npos && fresh.loaded(),
+            "10A15: non-string activation refused");
+    REQUIRE(!fresh.loadFile("does_not_exist_10A15.json", &err) && err.find("cannot open") == 0,
+            "10A15: missing file refused");
+    bool threw = false;
+    try {
+        vfep::MlpSurrogate empty;
+        empty.predict(probe.data(), out.data());
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    REQUIRE(threw, "10A15: predicting without a model throws");
+
+    std::cout << "[PASS] 10A15 MLP surrogate: JSON load, batched inference, envelope fallback\n";
+}
+
+static void runAdaptiveUQ_10A16()
+{
+    // GaussianProcess: interpolates a smooth 2-D function and generalizes between points
+    auto f = [](double a, double b) { return std::sin(3.0 * a) + b * b; };
+    std::vector<double> x, y;
+    for (int i = 0; i < 5; ++i)
+        for (int j = 0; j < 5; ++j) {
+            x.push_back(0.25 * i);
+            x.push_back(0.25 * j);
+            y.push_back(f(0.25 * i, 0.25 * j));
+        }
+    vfep::GaussianProcess gp;
+    gp.fit(x, 2, y);
+    REQUIRE(gp.size() == 25 && gp.dim() == 2, "10A16: GP keeps its design");
+    double mean = 0.0, var = 0.0;
+    gp.predict(&x[12 * 2], mean, var);
+    REQUIRE(absd(mean - y[12]) < 1e-3 && var < 1e-4, "10A16: GP interpolates a design point");
+    double worst = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        const double p[2] = {0.125 + 0.25 * i, 0.4 + 0.1 * i};
+        gp.predict(p, mean, var);
+        REQUIRE(var > 0.0, "10A16: GP variance is positive between design points");
+        worst = std::max(worst, absd(mean - f(p[0], p[1])));
+    }
+    REQUIRE(worst < 0.02, "10A16: GP predicts between design points");
+    REQUIRE(gp.leaveOneOutRmse() < 0.05, "10A16: GP leave-one-out error is small");
+    const double extra[2] = {0.6, 0.6};
+    gp.addPoint(extra, f(0.6, 0.6));
+    gp.predict(extra, mean, var);
+    REQUIRE(gp.size() == 26 && absd(mean - f(0.6, 0.6)) < 1e-3, "10A16: GP conditions on an added point");
+    bool threw = false;
+    try {
+        vfep::GaussianProcess bad;
+        bad.fit(std::vector<double>(5, 0.0), 2, std::vector<double>(3, 0.0));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    REQUIRE(threw, "10A16: GP rejects mismatched shapes");
+
+    // Adaptive Monte Carlo against a plain LHS reference with five times the simulations
+    vfep::MonteCarloUQ uq;
+    vfep::MonteCarloUQ::ScenarioConfig scenario;
+    scenario.t_end_s = 30.0;
+    scenario.dt_s = 0.1;
+    uq.setScenario(scenario);
+    const auto reference = uq.runMonteCarlo(160);
+
+    vfep::MonteCarloUQ::AdaptiveOptions options;
+    options.max_simulations = 32;
+    options.population = 1024;
+    options.flashover_T_K = 600.0;
+    const auto adaptive = uq.runAdaptiveMonteCarlo(options);
+    REQUIRE(adaptive.simulations >= options.initial_samples && adaptive.simulations <= options.max_simulations,
+            "10A16: simulations stay within the budget");
+    REQUIRE(adaptive.rounds >= 1, "10A16: at least one surrogate round");
+    const auto& T = adaptive.summary.peak_T_K;
+    const auto& Tref = reference.peak_T_K;
+    REQUIRE_FINITE(T.mean, "10A16: adaptive peak_T_K.mean");
+    REQUIRE_FINITE(adaptive.summary.peak_HRR_W.mean, "10A16: adaptive peak_HRR_W.mean");
+    REQUIRE_FINITE(adaptive.summary.t_peak_HRR_s.mean, "10A16: adaptive t_peak_HRR_s.mean");
+    REQUIRE(absd(T.mean - Tref.mean) < 0.03 * Tref.mean, "10A16: adaptive mean peak T matches the reference");
+    REQUIRE(absd(T.ci_lower_95 - Tref.ci_lower_95) < 0.08 * Tref.ci_lower_95 &&
+                absd(T.ci_upper_95 - Tref.ci_upper_95) < 0.08 * Tref.ci_upper_95,
+            "10A16: adaptive peak T interval matches the reference");
+    REQUIRE(absd(adaptive.summary.peak_HRR_W.median - reference.peak_HRR_W.median) <
+                0.2 * reference.peak_HRR_W.median,
+            "10A16: adaptive median peak HRR matches the reference");
+    REQUIRE(adaptive.loo_rmse_peak_T_K < 0.25 * Tref.std_dev, "10A16: peak T surrogate error is small");
+    REQUIRE(adaptive.flashover_probability > 0.1 && adaptive.flashover_probability < 0.4,
+            "10A16: flashover probability near the sampled 0.23");
+    REQUIRE(adaptive.flashover_uncertain_fraction < 0.1, "10A16: few points left near the threshold");
+
+    // A loose tolerance stops early
+    options.std_tolerance = 0.5;
+    options.flashover_T_K = 0.0;
+    const auto early = uq.runAdaptiveMonteCarlo(options);
+    REQUIRE(early.simulations < options.max_simulations && early.mean_relative_std < 0.5,
+            "10A16: stopping rule ends refinement before the budget");
+
+    std::cout << "[PASS] 10A16 Adaptive UQ: GP surrogate refinement vs 160-sample LHS\n";
+}
+
 int main() {
     // Canary: prove the test fails in Release when checks are active.
     if (std::getenv("CHEMSI_CANARY_NAN")) {
@@ -4970,6 +7590,11 @@ int main() {
     runThreeZoneEnergyBalance_8A3();
     runCFDImportBasic_8B1();
     runCFDExportAndCompare_8B2();
+    runCFDImportFormats_8B3();
+    runCFDStructuredBatchInterpolation_8B4();
+    runCFDOctreeField_8B5();
+    runCFDTimeSeriesReplay_8B6();
+    runCFDParallelComparison_8B7();
 
     // =======================
     // Phase 9A: Radiation Model Tests
@@ -4991,6 +7616,8 @@ int main() {
     runCFDCouplerBasic_9C1();
     runCFDCouplerDataExchange_9C2();
     runCFDCouplerSynchronization_9C3();
+    runCFDCouplerInPlaceUpdate_9C4();
+    runCFDCouplerAsyncPipeline_9C5();
 
     // =======================
     // Phase 9D: Flame Spread Model Tests
@@ -4998,6 +7625,32 @@ int main() {
     runFlameSpreadBasic_9D1();
     runFlameSpreadIgnition_9D2();
     runFlameSpreadPropagation_9D3();
+    runFlameSpreadIgnitionPrediction_9D4();
+
+    // =======================
+    // Phase 9E: Surface Mesh Import Tests
+    // =======================
+    runSurfaceMeshImport_9E1();
+
+    // =======================
+    // Phase 10A: Unity Telemetry Streaming Tests
+    // =======================
+    runTelemetryPublisherDelta_10A1();
+    runSimLoopQueueAndLatency_10A2();
+    runTelemetryFanoutBackpressure_10A3();
+    runEntityRegistryMechTick_10A4();
+    runMechTickScaling_10A5();
+    runWorldHostScheduling_10A6();
+    runFireSimBridge_10A7();
+    runWorldClockControl_10A8();
+    runTelemetryRecording_10A9();
+    runObservationLog_10A10();
+    runTelemetryHistory_10A11();
+    runCrc32Digest_10A12();
+    runObservationShm_10A13();
+    runScenarioBatch_10A14();
+    runMlpSurrogate_10A15();
+    runAdaptiveUQ_10A16();
 
     return 0;
     
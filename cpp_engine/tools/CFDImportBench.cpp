@@ -0,0 +1,178 @@
+#include "CFDInterface.h"
+#include "VTKIO.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+void printUsage() {
+    std::cout << "CFDImportBench usage:\n"
+              << "  CFDImportBench [--n points_per_axis] [--format legacy-ascii|legacy-binary|vti] [--out file] [--keep]\n"
+              << "                 [--probes count]\n";
+}
+
+double peakRssMB() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+        return static_cast<double>(pmc.PeakWorkingSetSize) / (1024.0 * 1024.0);
+    }
+    return 0.0;
+#else
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;             // KiB
+#endif
+#endif
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    int n = 100;
+    std::string format = "legacy-binary";
+    std::string out;
+    bool keep = false;
+    size_t probes = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--n" && i + 1 < argc) {
+            n = std::stoi(argv[++i]);
+        } else if (arg == "--format" && i + 1 < argc) {
+            format = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            out = argv[++i];
+        } else if (arg == "--probes" && i + 1 < argc) {
+            probes = static_cast<size_t>(std::stoull(argv[++i]));
+        } else if (arg == "--keep") {
+            keep = true;
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::cout << "Unknown argument: " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (n < 2 || (format != "legacy-ascii" && format != "legacy-binary" && format != "vti")) {
+        printUsage();
+        return 1;
+    }
+    if (out.empty()) {
+        out = (format == "vti") ? "cfd_import_bench.vti" : "cfd_import_bench.vtk";
+    }
+
+    // Synthetic room-fire field on an n^3 lattice
+    const size_t count = static_cast<size_t>(n) * n * n;
+    const int dims[3] = {n, n, n};
+    const double origin[3] = {0.0, 0.0, 0.0};
+    const double spacing[3] = {5.0 / (n - 1), 5.0 / (n - 1), 3.0 / (n - 1)};
+    {
+        std::vector<double> T(count), vel(count * 3), rho(count), p(count);
+        size_t idx = 0;
+        for (int k = 0; k < n; ++k) {
+            for (int j = 0; j < n; ++j) {
+                for (int i = 0; i < n; ++i, ++idx) {
+                    const double x = i * spacing[0] - 2.5;
+                    const double y = j * spacing[1] - 2.5;
+                    const double z = k * spacing[2];
+                    const double r2 = x * x + y * y;
+                    T[idx] = 293.15 + 50.0 * z / 3.0 + 300.0 * std::exp(-r2);
+                    vel[3 * idx + 0] = 0.1 * x;
+                    vel[3 * idx + 1] = 0.1 * y;
+                    vel[3 * idx + 2] = std::exp(-r2);
+                    rho[idx] = 353.0 / T[idx];
+                    p[idx] = 101325.0 - 11.8 * z;
+                }
+            }
+        }
+        const std::vector<vfep::VTKWriteField> fields = {
+            {"T", 1, T.data()}, {"U", 3, vel.data()}, {"rho", 1, rho.data()}, {"p", 1, p.data()}
+        };
+        const bool ok = (format == "vti")
+            ? vfep::VTKWriter::writeImageData(out, dims, origin, spacing, fields)
+            : vfep::VTKWriter::writeLegacyStructuredPoints(out, dims, origin, spacing, fields,
+                                                           format == "legacy-binary");
+        if (!ok) {
+            std::cout << "Failed to write " << out << "\n";
+            return 1;
+        }
+    }
+    const double rss_before = peakRssMB();
+
+    vfep::CFDInterface cfd;
+    const auto t0 = std::chrono::steady_clock::now();
+    const bool imported = cfd.importTemperatureField(out);
+    const auto t1 = std::chrono::steady_clock::now();
+    if (!imported || cfd.gridPointCount() != count) {
+        std::cout << "Import failed for " << out << "\n";
+        return 1;
+    }
+
+    const double seconds = std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "format=" << format
+              << " points=" << count
+              << " import_s=" << seconds
+              << " Mpts_per_s=" << (count / seconds) * 1e-6
+              << " peak_rss_MB=" << peakRssMB()
+              << " (after write: " << rss_before << ")"
+              << " T_center=" << cfd.interpolateTemperature(2.5, 2.5, 1.5)
+              << "\n";
+
+    if (probes > 0) {
+        // Probe sampling: scalar calls vs batched structured-grid path
+        std::vector<double> px(probes), py(probes), pz(probes), sampled(probes);
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        auto next = [&state]() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<double>(state >> 11) * (1.0 / 9007199254740992.0);
+        };
+        for (size_t q = 0; q < probes; ++q) {
+            px[q] = 5.0 * next();
+            py[q] = 5.0 * next();
+            pz[q] = 3.0 * next();
+        }
+
+        const auto s0 = std::chrono::steady_clock::now();
+        for (size_t q = 0; q < probes; ++q) {
+            sampled[q] = cfd.interpolateTemperature(px[q], py[q], pz[q]);
+        }
+        const auto s1 = std::chrono::steady_clock::now();
+        const double checksum_scalar = sampled[probes / 2];
+        cfd.interpolateTemperatureBatch(px.data(), py.data(), pz.data(), probes, sampled.data());
+        const auto s2 = std::chrono::steady_clock::now();
+
+        const double scalar_s = std::chrono::duration<double>(s1 - s0).count();
+        const double batch_s = std::chrono::duration<double>(s2 - s1).count();
+        std::cout << "probes=" << probes
+                  << " scalar_Mprobes_per_s=" << (probes / scalar_s) * 1e-6
+                  << " batch_Mprobes_per_s=" << (probes / batch_s) * 1e-6
+                  << " match=" << (checksum_scalar == sampled[probes / 2] ? "yes" : "no")
+                  << "\n";
+    }
+
+    if (!keep) {
+        std::remove(out.c_str());
+    }
+    return 0;
+}
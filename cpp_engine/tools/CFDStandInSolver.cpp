@@ -0,0 +1,55 @@
+#include "CFDAsyncChannel.h"
+
+#include <iostream>
+#include <string>
+
+namespace {
+void printUsage() {
+    std::cout << "CFDStandInSolver usage:\n"
+              << "  CFDStandInSolver --channel <name> [--latency_ms v] [--nx n] [--ny n] [--nz n]\n"
+              << "Serves CFDCoupler boundary conditions with the mock CFD step until the\n"
+              << "coupler closes the channel.\n";
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string channel_name;
+    vfep::CFDStandInOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--channel" && i + 1 < argc) {
+            channel_name = argv[++i];
+        } else if (arg == "--latency_ms" && i + 1 < argc) {
+            options.latency_ms = std::stod(argv[++i]);
+        } else if (arg == "--nx" && i + 1 < argc) {
+            options.nx = std::stoi(argv[++i]);
+        } else if (arg == "--ny" && i + 1 < argc) {
+            options.ny = std::stoi(argv[++i]);
+        } else if (arg == "--nz" && i + 1 < argc) {
+            options.nz = std::stoi(argv[++i]);
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::cout << "Unknown argument: " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (channel_name.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    vfep::CFDAsyncChannel channel;
+    if (!channel.open(channel_name)) {
+        std::cerr << "CFDStandInSolver: cannot open channel " << channel_name << "\n";
+        return 1;
+    }
+
+    const uint64_t published = vfep::runCFDStandInSolver(channel, options);
+    std::cout << "CFDStandInSolver: published " << published << " results\n";
+    return 0;
+}
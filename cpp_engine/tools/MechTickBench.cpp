@@ -0,0 +1,155 @@
+#include "EntityRegistry.h"
+#include "FireSimBridge.h"
+#include "LatencyHistogram.h"
+#include "MechanicsSim.h"
+#include "ObjectModel.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr size_t kRacksPerVfep = 16;
+
+void printUsage() {
+    std::cout << "MechTickBench usage:\n"
+              << "  MechTickBench [--racks n[,n...]] [--ticks count] [--hz rate] [--fire_pct pct]\n"
+              << "                [--min_per_thread n] [--fire_sim]\n"
+              << "  --fire_sim  burning racks run a vfep::Simulation (FireSimBridge) inside the tick\n";
+}
+
+std::vector<size_t> parseList(const std::string& s) {
+    std::vector<size_t> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(static_cast<size_t>(std::stoull(item)));
+    }
+    return out;
+}
+
+struct RunResult {
+    double mean_us = 0.0;
+    double p99_us = 0.0;
+    double max_us = 0.0;
+    size_t open_incidents = 0;
+    size_t fires = 0;
+};
+
+RunResult run(size_t rack_count, int ticks, double dt, double fire_pct, const vfep::mech::MechanicsParams& p,
+              const vfep::mech::FireBridgeParams* fire) {
+    vfep::obj::ObjectStore store = vfep::obj::makeSyntheticObjectStore(rack_count, kRacksPerVfep);
+
+    // Every VFEP whose block contains a burning rack is discharging
+    const size_t stride = static_cast<size_t>(100.0 / fire_pct);
+    for (size_t i = 0; i < rack_count; i += stride) {
+        auto& rt = store.rack_telemetry.at("rack-" + std::to_string(i));
+        rt.is_on_fire = true;
+        rt.surface_temp_C = 400.0;
+        rt.risk_to_assets_pct = 80.0;
+        store.vfeps.at("vfep-" + std::to_string(i / kRacksPerVfep)).suppression_active = true;
+    }
+    for (auto& [id, arm] : store.arm_telemetry) {
+        arm.has_target = true;
+        arm.target_s_0_1 = 1.0 - arm.s_0_1;
+    }
+
+    vfep::obj::EntityRegistry reg;
+    reg.build(store);
+    std::unique_ptr<vfep::mech::FireSimBridge> bridge;
+    if (fire) bridge = std::make_unique<vfep::mech::FireSimBridge>(*fire);
+
+    vfep::LatencyHistogram hist;
+    double t = 0.0;
+    for (int k = 0; k < ticks; ++k) {
+        const auto t0 = std::chrono::steady_clock::now();
+        vfep::mech::tick(reg, t, dt, p);
+        if (bridge) bridge->step(reg, t, dt);
+        const auto t1 = std::chrono::steady_clock::now();
+        hist.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()));
+        t += dt;
+    }
+
+    RunResult r;
+    r.mean_us = hist.mean() * 1e-3;
+    r.p99_us = static_cast<double>(hist.percentile(0.99)) * 1e-3;
+    r.max_us = static_cast<double>(hist.max()) * 1e-3;
+    for (auto rack : reg.racks.open_incident) r.open_incidents += (rack != vfep::obj::kNoHandle);
+    if (bridge) r.fires = bridge->activeFires();
+    return r;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<size_t> rack_counts = {16, 10000, 100000};
+    int ticks = 200;
+    double hz = 100.0;
+    double fire_pct = 1.0;
+    vfep::mech::MechanicsParams params;
+    bool fire_sim = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--racks" && i + 1 < argc) {
+            rack_counts = parseList(argv[++i]);
+        } else if (arg == "--ticks" && i + 1 < argc) {
+            ticks = std::stoi(argv[++i]);
+        } else if (arg == "--hz" && i + 1 < argc) {
+            hz = std::stod(argv[++i]);
+        } else if (arg == "--fire_pct" && i + 1 < argc) {
+            fire_pct = std::stod(argv[++i]);
+        } else if (arg == "--min_per_thread" && i + 1 < argc) {
+            params.min_entities_per_thread = static_cast<size_t>(std::stoull(argv[++i]));
+        } else if (arg == "--fire_sim") {
+            fire_sim = true;
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::cout << "Unknown argument: " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
+    if (!(fire_pct > 0.0 && fire_pct <= 100.0)) {
+        std::cout << "--fire_pct must be in (0, 100]\n";
+        return 1;
+    }
+    if (rack_counts.empty() || ticks < 1 || hz <= 0.0) {
+        printUsage();
+        return 1;
+    }
+
+    // Serial baseline: a grain larger than any store keeps every loop on one thread
+    params.external_rack_fire = fire_sim;
+    vfep::mech::MechanicsParams serial = params;
+    serial.min_entities_per_thread = static_cast<size_t>(-1);
+    vfep::mech::FireBridgeParams fire_par;
+    vfep::mech::FireBridgeParams fire_serial;
+    fire_serial.min_fires_per_thread = static_cast<size_t>(-1);
+
+    const double dt = 1.0 / hz;
+    const double budget_us = 1e6 / hz;
+    for (const size_t n : rack_counts) {
+        const RunResult s = run(n, ticks, dt, fire_pct, serial, fire_sim ? &fire_serial : nullptr);
+        const RunResult par = run(n, ticks, dt, fire_pct, params, fire_sim ? &fire_par : nullptr);
+        std::cout << "racks=" << n
+                  << " serial_mean_us=" << s.mean_us
+                  << " parallel_mean_us=" << par.mean_us
+                  << " parallel_p99_us=" << par.p99_us
+                  << " parallel_max_us=" << par.max_us
+                  << " speedup=" << (par.mean_us > 0.0 ? s.mean_us / par.mean_us : 0.0)
+                  << " max_hz=" << (par.mean_us > 0.0 ? 1e6 / par.mean_us : 0.0)
+                  << " budget_pct=" << 100.0 * par.p99_us / budget_us
+                  << " incidents=" << par.open_incidents
+                  << (fire_sim ? " fires=" + std::to_string(par.fires) : std::string())
+                  << (s.open_incidents == par.open_incidents && s.fires == par.fires ? "" : " MISMATCH")
+                  << "\n";
+    }
+    return 0;
+}
@@ -22,6 +22,7 @@
 #include <filesystem>
 
 #include "Simulation.h"
+#include "SurfaceMesh.h"
 
 // Step 1: model-backed ceiling rail (no UI dependencies)
 #include "../world/ceiling_rail.h"
@@ -577,103 +578,29 @@ static Vec3f auto_align_stl_rotation_deg(const STLMesh& mesh) {
     return Vec3f{90.0f, 0.0f, 0.0f};
 }
 
-static bool load_stl_ascii(const char* filepath, STLMesh& mesh) {
-    std::ifstream txt(filepath);
-    if (!txt) {
+// Parsing lives in the core library (vfep::SurfaceMesh) so the physics
+// modules and the visualizer read geometry the same way.
+static bool load_stl(const char* filepath, STLMesh& mesh) {
+    vfep::SurfaceMesh core_mesh;
+    if (!core_mesh.loadSTL(filepath)) {
+        std::fprintf(stderr, "Failed to load STL file: %s\n", filepath);
         return false;
     }
 
+    const auto& src = core_mesh.getTriangles();
     mesh.triangles.clear();
-
-    std::string line;
-    STLTriangle tri{};
-    int vertex_count = 0;
-    while (std::getline(txt, line)) {
-        std::istringstream iss(line);
-        std::string token;
-        if (!(iss >> token)) {
-            continue;
-        }
-
-        if (token == "facet") {
-            std::string normal_kw;
-            if (iss >> normal_kw && normal_kw == "normal") {
-                iss >> tri.normal.x >> tri.normal.y >> tri.normal.z;
-            }
-            vertex_count = 0;
-        } else if (token == "vertex") {
-            Vec3f v{};
-            if (!(iss >> v.x >> v.y >> v.z)) {
-                continue;
-            }
-
-            if (vertex_count == 0) tri.v0 = v;
-            else if (vertex_count == 1) tri.v1 = v;
-            else if (vertex_count == 2) tri.v2 = v;
-            vertex_count++;
-        } else if (token == "endfacet") {
-            if (vertex_count >= 3) {
-                mesh.triangles.push_back(tri);
-            }
-            vertex_count = 0;
-        }
-    }
-
-    if (mesh.triangles.empty()) {
-        return false;
-    }
-
-    finalize_stl_mesh(mesh);
-    std::fprintf(stderr, "Loaded ASCII STL: %s (%zu triangles)\n", filepath, mesh.triangles.size());
-    return true;
-}
-
-static bool load_stl_binary(const char* filepath, STLMesh& mesh) {
-    std::ifstream file(filepath, std::ios::binary);
-    if (!file) {
-        std::fprintf(stderr, "Failed to open STL file: %s\n", filepath);
-        return false;
-    }
-
-    // Read 80-byte header (ignored)
-    char header[80];
-    file.read(header, 80);
-    if (!file) return false;
-
-    // Read triangle count
-    uint32_t num_triangles = 0;
-    file.read(reinterpret_cast<char*>(&num_triangles), sizeof(uint32_t));
-    if (!file || num_triangles == 0 || num_triangles > 10000000) {
-        std::fprintf(stderr, "Binary STL parse failed for %s (triangle count=%u). Trying ASCII fallback...\n", filepath, num_triangles);
-        return load_stl_ascii(filepath, mesh);
-    }
-
-    mesh.triangles.clear();
-    mesh.triangles.reserve(num_triangles);
-
-    // Read each triangle (50 bytes: 12 floats + 2 bytes attribute)
-    for (uint32_t i = 0; i < num_triangles; ++i) {
-        float data[12];
-        file.read(reinterpret_cast<char*>(data), 12 * sizeof(float));
-        if (!file) {
-            std::fprintf(stderr, "Failed reading triangle %u from binary STL. Trying ASCII fallback...\n", i);
-            return load_stl_ascii(filepath, mesh);
-        }
-
-        STLTriangle tri;
-        tri.normal = {data[0], data[1], data[2]};
-        tri.v0 = {data[3], data[4], data[5]};
-        tri.v1 = {data[6], data[7], data[8]};
-        tri.v2 = {data[9], data[10], data[11]};
-        mesh.triangles.push_back(tri);
-
-        // Skip 2-byte attribute count
-        uint16_t attr;
-        file.read(reinterpret_cast<char*>(&attr), sizeof(uint16_t));
+    mesh.triangles.resize(src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        STLTriangle& tri = mesh.triangles[i];
+        tri.normal = {src[i].normal.x, src[i].normal.y, src[i].normal.z};
+        tri.v0 = {src[i].v0.x, src[i].v0.y, src[i].v0.z};
+        tri.v1 = {src[i].v1.x, src[i].v1.y, src[i].v1.z};
+        tri.v2 = {src[i].v2.x, src[i].v2.y, src[i].v2.z};
     }
 
     finalize_stl_mesh(mesh);
-    std::fprintf(stderr, "Loaded STL: %s (%zu triangles)\n", filepath, mesh.triangles.size());
+    std::fprintf(stderr, "Loaded %s STL: %s (%zu triangles)\n",
+                 core_mesh.isBinarySource() ? "binary" : "ASCII", filepath, mesh.triangles.size());
     return true;
 }
 
@@ -1631,7 +1558,7 @@ int main(int argc, char** argv) {
 
         bool loaded_standard = false;
         for (const char* candidate : stl_candidates) {
-            if (load_stl_binary(candidate, temp_mesh)) {
+            if (load_stl(candidate, temp_mesh)) {
                 stl_mesh = temp_mesh;
                 stl_rotation_deg = auto_align_stl_rotation_deg(stl_mesh);
                 stl_rotation_deg.y += 180.0f;
@@ -1686,7 +1613,7 @@ int main(int argc, char** argv) {
         };
 
         for (const char* candidate : vfb_projectile_candidates) {
-            if (load_stl_binary(candidate, temp_mesh)) {
+            if (load_stl(candidate, temp_mesh)) {
                 vfb_projectile_mesh = temp_mesh;
                 vfb_projectile_mesh_loaded = true;
                 break;
@@ -0,0 +1,299 @@
+"""
+VFEP Native Bindings
+--------------------
+In-process access to the C++ engine through the chemsi_c shared library
+(cpp_engine/include/chemsi_c.h): no subprocess per run, no files. numpy
+arrays are handed to the library as raw pointers, and ctypes releases the
+GIL for every foreign call, so stepping and batches run at full C++ speed
+while other Python threads keep going.
+
+Build the library with the engine (CHEMSI_BUILD_CAPI is on by default):
+  cmake -S cpp_engine -B cpp_engine/build && cmake --build cpp_engine/build --target chemsi_c
+It is found through $CHEMSI_C_LIB, then cpp_engine/build*/ and
+cpp_engine/_gate_build/, then the system library path.
+
+Batched scenarios (one row per scenario, columns = param_names()):
+  params = scenario_params(6, pyrolysis_max_kgps=np.linspace(0.01, 0.1, 6))
+  result = run_batch(params, threads=0, telemetry=256)
+  result["peak_HRR_W"], result["t_peak_HRR_s"], result.telemetry  # (6, 256, 8)
+
+One simulation, stepped from Python:
+  with Simulation(volume_m3=80.0) as sim:
+      sim.ignite(0.03)
+      sim.step(0.05, 200)
+      sim.observe()["T_K"]
+"""
+
+from __future__ import annotations
+
+import ctypes
+import os
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional, Sequence
+
+import numpy as np
+
+ABI_VERSION = 1
+OK = 0
+E_INVALID = -1
+
+# TelemetrySampleV1 order (Simulation.h)
+TELEMETRY_COLUMNS = ("t_s", "raw_mdot_kgps", "net_mdot_kgps", "exposure_kg", "effective_exposure_kg",
+                     "KD_target_0_1", "KD_actual_0_1", "HRR_kW")
+
+_c_double_p = ctypes.POINTER(ctypes.c_double)
+_c_float_p = ctypes.POINTER(ctypes.c_float)
+_c_int32_p = ctypes.POINTER(ctypes.c_int32)
+
+
+class ChemsiError(RuntimeError):
+    """A chemsi_c call failed; the message comes from chemsi_last_error()."""
+
+
+def _library_names() -> List[str]:
+    if sys.platform == "win32":
+        return ["chemsi_c.dll", "libchemsi_c.dll"]
+    if sys.platform == "darwin":
+        return ["libchemsi_c.dylib"]
+    return ["libchemsi_c.so"]
+
+
+def find_library() -> Optional[Path]:
+    """Path of the chemsi_c shared library, or None."""
+    env = os.environ.get("CHEMSI_C_LIB")
+    if env:
+        return Path(env)
+    engine = Path(__file__).resolve().parent.parent / "cpp_engine"
+    build_dirs = sorted(engine.glob("build*")) + [engine / "_gate_build"]
+    for d in build_dirs:
+        for name in _library_names():
+            for sub in ("", "Release", "RelWithDebInfo", "Debug"):
+                candidate = d / sub / name
+                if candidate.is_file():
+                    return candidate
+    import ctypes.util
+
+    found = ctypes.util.find_library("chemsi_c")
+    return Path(found) if found else None
+
+
+_lib = None
+
+
+def load(path: Optional[os.PathLike] = None) -> ctypes.CDLL:
+    """Load (once) and type the chemsi_c library."""
+    global _lib
+    if _lib is not None and path is None:
+        return _lib
+    lib_path = Path(path) if path is not None else find_library()
+    if lib_path is None:
+        raise ChemsiError("chemsi_c shared library not found; build the chemsi_c target or set CHEMSI_C_LIB")
+    lib = ctypes.CDLL(str(lib_path))
+
+    def sig(name, restype, *argtypes):
+        fn = getattr(lib, name)
+        fn.restype = restype
+        fn.argtypes = list(argtypes)
+
+    p = ctypes.c_void_p
+    sig("chemsi_abi_version", ctypes.c_int)
+    sig("chemsi_last_error", ctypes.c_char_p)
+    sig("chemsi_sim_create", p)
+    sig("chemsi_sim_destroy", None, p)
+    sig("chemsi_sim_configure", ctypes.c_int, p, _c_double_p, ctypes.c_int)
+    sig("chemsi_sim_ignite", ctypes.c_int, p, ctypes.c_double)
+    sig("chemsi_sim_start_suppression", ctypes.c_int, p, ctypes.c_double, ctypes.c_double)
+    sig("chemsi_sim_step", ctypes.c_int, p, ctypes.c_double, ctypes.c_int64)
+    sig("chemsi_sim_time", ctypes.c_double, p)
+    sig("chemsi_observation_column_count", ctypes.c_int)
+    sig("chemsi_observation_column_name", ctypes.c_char_p, ctypes.c_int)
+    sig("chemsi_sim_observe", ctypes.c_int, p, _c_double_p, ctypes.c_int)
+    sig("chemsi_sim_telemetry", ctypes.c_int, p, _c_float_p, ctypes.c_int)
+    sig("chemsi_param_count", ctypes.c_int)
+    sig("chemsi_param_name", ctypes.c_char_p, ctypes.c_int)
+    sig("chemsi_param_default", ctypes.c_double, ctypes.c_int)
+    sig("chemsi_metric_count", ctypes.c_int)
+    sig("chemsi_metric_name", ctypes.c_char_p, ctypes.c_int)
+    sig("chemsi_run_batch", ctypes.c_int, _c_double_p, ctypes.c_int64, ctypes.c_int, _c_double_p,
+        _c_float_p, ctypes.c_int, _c_int32_p, ctypes.c_int)
+
+    version = lib.chemsi_abi_version()
+    if version != ABI_VERSION:
+        raise ChemsiError(f"{lib_path}: chemsi_c ABI {version}, bindings expect {ABI_VERSION}")
+    _lib = lib
+    return lib
+
+
+def _check(rc: int) -> int:
+    if rc < 0:
+        raise ChemsiError(load().chemsi_last_error().decode("utf-8", "replace"))
+    return rc
+
+
+def _ptr(array: Optional[np.ndarray], ctype):
+    return None if array is None else array.ctypes.data_as(ctypes.POINTER(ctype))
+
+
+# ---- Column metadata -------------------------------------------------------
+
+def param_names() -> List[str]:
+    lib = load()
+    return [lib.chemsi_param_name(i).decode() for i in range(lib.chemsi_param_count())]
+
+
+def param_defaults() -> np.ndarray:
+    lib = load()
+    return np.array([lib.chemsi_param_default(i) for i in range(lib.chemsi_param_count())])
+
+
+def metric_names() -> List[str]:
+    lib = load()
+    return [lib.chemsi_metric_name(i).decode() for i in range(lib.chemsi_metric_count())]
+
+
+def observation_columns() -> List[str]:
+    lib = load()
+    return [lib.chemsi_observation_column_name(i).decode() for i in range(lib.chemsi_observation_column_count())]
+
+
+def scenario_params(rows: int, **columns) -> np.ndarray:
+    """(rows, n_params) matrix of defaults with the named columns broadcast in."""
+    names = param_names()
+    matrix = np.tile(param_defaults(), (rows, 1))
+    for name, values in columns.items():
+        if name not in names:
+            raise KeyError(f"unknown scenario parameter {name!r}; expected one of {names}")
+        matrix[:, names.index(name)] = values
+    return matrix
+
+
+# ---- Batched scenarios -----------------------------------------------------
+
+class BatchResult:
+    """Metrics (rows, n_metrics) plus optional telemetry (rows, cap, 8)."""
+
+    def __init__(self, metrics: np.ndarray, names: Sequence[str],
+                 telemetry: Optional[np.ndarray], telemetry_rows: Optional[np.ndarray]) -> None:
+        self.metrics = metrics
+        self.metric_names = list(names)
+        self.telemetry = telemetry
+        self.telemetry_rows = telemetry_rows
+
+    def __getitem__(self, name: str) -> np.ndarray:
+        return self.metrics[:, self.metric_names.index(name)]
+
+    def __len__(self) -> int:
+        return self.metrics.shape[0]
+
+    def as_dict(self) -> Dict[str, np.ndarray]:
+        return {name: self.metrics[:, i] for i, name in enumerate(self.metric_names)}
+
+
+def run_batch(params, threads: int = 0, telemetry: int = 0) -> BatchResult:
+    """
+    Run one scenario per row of `params` on `threads` worker threads (0 = one per core).
+
+    params: (rows, k) array with k <= len(param_names()) (missing trailing columns take
+            defaults), a single row, or a dict of column arrays for scenario_params().
+    telemetry: if > 0, also return up to that many 10 Hz v1 telemetry samples per row.
+    """
+    lib = load()
+    if isinstance(params, dict):
+        rows = max((np.size(v) for v in params.values()), default=1)
+        params = scenario_params(rows, **params)
+    matrix = np.ascontiguousarray(np.atleast_2d(np.asarray(params, dtype=np.float64)))
+    if matrix.ndim != 2:
+        raise ValueError(f"params must be 2-D, got shape {matrix.shape}")
+    rows, cols = matrix.shape
+
+    names = metric_names()
+    metrics = np.zeros((rows, len(names)), dtype=np.float64)
+    tel = tel_rows = None
+    if telemetry > 0:
+        tel = np.zeros((rows, telemetry, len(TELEMETRY_COLUMNS)), dtype=np.float32)
+        tel_rows = np.zeros(rows, dtype=np.int32)
+
+    _check(lib.chemsi_run_batch(_ptr(matrix, ctypes.c_double), rows, cols, _ptr(metrics, ctypes.c_double),
+                                _ptr(tel, ctypes.c_float), int(telemetry), _ptr(tel_rows, ctypes.c_int32),
+                                int(threads)))
+    return BatchResult(metrics, names, tel, tel_rows)
+
+
+# ---- Single simulation -----------------------------------------------------
+
+class Simulation:
+    """One engine Simulation in the data-center rack scenario."""
+
+    def __init__(self, **params) -> None:
+        self._lib = load()
+        self._columns = observation_columns()
+        self._handle = self._lib.chemsi_sim_create()
+        if not self._handle:
+            _check(-2)
+        if params:
+            self.configure(**params)
+
+    def configure(self, **params) -> None:
+        """Reset and apply scenario parameters by name (schedule columns are ignored)."""
+        row = np.ascontiguousarray(scenario_params(1, **params)[0])
+        _check(self._lib.chemsi_sim_configure(self._handle, _ptr(row, ctypes.c_double), row.size))
+
+    def ignite(self, pyrolysis_kgps: float = 0.0) -> None:
+        _check(self._lib.chemsi_sim_ignite(self._handle, pyrolysis_kgps))
+
+    def start_suppression(self, agent_mdot_kgps: float = -1.0, knockdown_0_1: float = -1.0) -> None:
+        _check(self._lib.chemsi_sim_start_suppression(self._handle, agent_mdot_kgps, knockdown_0_1))
+
+    def step(self, dt_s: float = 0.05, n: int = 1) -> None:
+        """Advance n steps in one call (the GIL is released for the whole loop)."""
+        _check(self._lib.chemsi_sim_step(self._handle, dt_s, int(n)))
+
+    @property
+    def time_s(self) -> float:
+        return self._lib.chemsi_sim_time(self._handle)
+
+    def observe_array(self) -> np.ndarray:
+        """Current observation as float64 columns in observation_columns() order."""
+        out = np.empty(len(self._columns), dtype=np.float64)
+        _check(self._lib.chemsi_sim_observe(self._handle, _ptr(out, ctypes.c_double), out.size))
+        return out
+
+    def observe(self) -> Dict[str, float]:
+        return dict(zip(self._columns, self.observe_array().tolist()))
+
+    def telemetry(self, cap: int = 2048) -> np.ndarray:
+        """Recent v1 telemetry, (n, 8) float32 in TELEMETRY_COLUMNS order, oldest first."""
+        out = np.empty((cap, len(TELEMETRY_COLUMNS)), dtype=np.float32)
+        n = _check(self._lib.chemsi_sim_telemetry(self._handle, _ptr(out, ctypes.c_float), cap))
+        return out[:n]
+
+    def close(self) -> None:
+        if self._handle:
+            self._lib.chemsi_sim_destroy(self._handle)
+            self._handle = None
+
+    def __enter__(self) -> "Simulation":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+    def __del__(self) -> None:
+        try:
+            self.close()
+        except Exception:
+            pass
+
+
+if __name__ == "__main__":
+    import time
+
+    params = scenario_params(8, pyrolysis_max_kgps=np.linspace(0.01, 0.08, 8), t_end_s=60.0)
+    start = time.perf_counter()
+    result = run_batch(params)
+    elapsed = time.perf_counter() - start
+    for row, (peak_T, peak_HRR, t_peak) in enumerate(zip(result["peak_T_K"], result["peak_HRR_W"],
+                                                         result["t_peak_HRR_s"])):
+        print(f"row {row}: peak_T={peak_T:.1f} K  peak_HRR={peak_HRR / 1e3:.1f} kW  t_peak={t_peak:.2f} s")
+    print(f"{len(result)} scenarios in {elapsed * 1e3:.1f} ms")
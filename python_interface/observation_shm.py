@@ -0,0 +1,197 @@
+"""
+VFEP Shared-Memory Observation Reader
+-------------------------------------
+Attaches read-only to the Observation ring that VFEP_Sim publishes with
+--shm (cpp_engine/include/ObservationShm.h) and reads live frames with no
+file I/O or parsing: the ring is mapped with numpy.memmap and the column
+layout comes from the descriptors in the file header.
+
+Frames are validated with the ring's seqlock: slot seq must be 2n+2 for
+frame n before and after the copy, so frames the simulation overwrote
+while we were reading are dropped rather than returned torn.
+
+Usage:
+  python observation_shm.py                       # default ring, newest frame
+  python observation_shm.py --follow              # print frames as they arrive
+  python observation_shm.py --path /dev/shm/vfep_observations --columns T_K HRR_W
+
+In code:
+  ring = ObservationRing()               # or ObservationRing(path)
+  frames = ring.snapshot()               # numpy structured array, oldest first
+  frames["t_s"], frames["HRR_W"]
+"""
+
+from __future__ import annotations
+
+import argparse
+import mmap
+import os
+import struct
+import sys
+import tempfile
+import time
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+MAGIC = b"VFEPOBS1"
+VERSION = 1
+# magic, version, header_bytes, slot_bytes, capacity, field_count, descriptor_offset, layout_hash, writer_pid
+HEADER = struct.Struct("<8s6IQQ")
+PUBLISHED_OFFSET = 64
+WRITER_OPEN_OFFSET = 72
+FIELD = struct.Struct("<48sII")
+TYPE_F64 = 1
+
+
+def default_path() -> Path:
+    """Same default as ObservationShmWriter::defaultPath()."""
+    if sys.platform.startswith("linux"):
+        return Path("/dev/shm/vfep_observations")
+    return Path(tempfile.gettempdir()) / "vfep_observations.shm"
+
+
+class ObservationRing:
+    """Read-only view of a VFEP shared-memory Observation ring."""
+
+    def __init__(self, path: Optional[os.PathLike] = None) -> None:
+        self.path = Path(path) if path is not None else default_path()
+        with open(self.path, "rb") as f:
+            self._mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+        (magic, version, self.header_bytes, self.slot_bytes, self.capacity, field_count,
+         descriptor_offset, self.layout_hash, self.writer_pid) = HEADER.unpack_from(self._mm, 0)
+        if magic != MAGIC:
+            raise ValueError(f"{self.path}: not a VFEP observation ring")
+        if version != VERSION:
+            raise ValueError(f"{self.path}: ring version {version}, reader supports {VERSION}")
+
+        self.fields: List[Tuple[str, int]] = []
+        for i in range(field_count):
+            raw, offset, kind = FIELD.unpack_from(self._mm, descriptor_offset + i * FIELD.size)
+            if kind != TYPE_F64:
+                raise ValueError(f"{self.path}: unsupported column type {kind}")
+            self.fields.append((raw.split(b"\0", 1)[0].decode("ascii"), offset))
+        self._frames = None
+
+    # ---- header counters -------------------------------------------------
+
+    def published(self) -> int:
+        """Frames completed since the writer opened the ring."""
+        return struct.unpack_from("<Q", self._mm, PUBLISHED_OFFSET)[0]
+
+    def writer_open(self) -> bool:
+        return struct.unpack_from("<I", self._mm, WRITER_OPEN_OFFSET)[0] != 0
+
+    # ---- numpy views -----------------------------------------------------
+
+    def dtype(self):
+        import numpy as np
+
+        names = ["seq"] + [name for name, _ in self.fields]
+        formats = ["<u8"] + ["<f8"] * len(self.fields)
+        offsets = [0] + [offset for _, offset in self.fields]
+        return np.dtype({"names": names, "formats": formats, "offsets": offsets, "itemsize": self.slot_bytes})
+
+    def frames(self):
+        """Zero-copy memmap of every slot, in slot order (unvalidated, live)."""
+        if self._frames is None:
+            import numpy as np
+
+            self._frames = np.memmap(self.path, dtype=self.dtype(), mode="r",
+                                     offset=self.header_bytes, shape=(self.capacity,))
+        return self._frames
+
+    def snapshot(self, last: Optional[int] = None):
+        """Copy of the retained frames (or the newest `last`), oldest first, torn frames removed."""
+        import numpy as np
+
+        newest = self.published()
+        first = max(0, newest - self.capacity)
+        if last is not None:
+            first = max(first, newest - last)
+        n = np.arange(first, newest, dtype=np.uint64)
+        slots = (n % np.uint64(self.capacity)).astype(np.int64)
+        view = self.frames()
+        copy = view[slots].copy()
+        expect = n * np.uint64(2) + np.uint64(2)
+        valid = (copy["seq"] == expect) & (view["seq"][slots] == expect)
+        return copy[valid]
+
+    # ---- no-numpy access -------------------------------------------------
+
+    def read(self, n: int) -> Optional[Dict[str, float]]:
+        """Frame n as a dict, or None if not written yet or overwritten."""
+        base = self.header_bytes + (n % self.capacity) * self.slot_bytes
+        expect = 2 * n + 2
+        if struct.unpack_from("<Q", self._mm, base)[0] != expect:
+            return None
+        raw = self._mm[base:base + self.slot_bytes]
+        if struct.unpack_from("<Q", self._mm, base)[0] != expect:
+            return None
+        return {name: struct.unpack_from("<d", raw, offset)[0] for name, offset in self.fields}
+
+    def latest(self) -> Optional[Dict[str, float]]:
+        newest = self.published()
+        return self.read(newest - 1) if newest > 0 else None
+
+    def close(self) -> None:
+        self._frames = None
+        self._mm.close()
+
+    def __enter__(self) -> "ObservationRing":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Read VFEP Observation frames from shared memory")
+    ap.add_argument("--path", type=str, default=None, help=f"Ring file (default: {default_path()})")
+    ap.add_argument("--columns", nargs="+", default=["t_s", "T_K", "HRR_W", "O2_volpct", "agent_mdot_kgps"])
+    ap.add_argument("--follow", action="store_true", help="Print new frames until the writer closes")
+    ap.add_argument("--interval", type=float, default=0.1, help="Poll interval for --follow (s)")
+    args = ap.parse_args()
+
+    try:
+        ring = ObservationRing(args.path)
+    except (OSError, ValueError) as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 2
+
+    with ring:
+        known = {name for name, _ in ring.fields}
+        missing = [c for c in args.columns if c not in known]
+        if missing:
+            print(f"ERROR: unknown column(s): {', '.join(missing)}", file=sys.stderr)
+            return 2
+
+        def show(frame: Dict[str, float]) -> None:
+            print("  ".join(f"{c}={frame[c]:.6g}" for c in args.columns))
+
+        if not args.follow:
+            frame = ring.latest()
+            if frame is None:
+                print("No frames published yet")
+                return 1
+            show(frame)
+            return 0
+
+        cursor = max(0, ring.published() - 1)
+        while True:
+            newest = ring.published()
+            if newest < cursor:
+                cursor = 0  # Writer restarted the ring
+            cursor = max(cursor, newest - ring.capacity)
+            for n in range(cursor, newest):
+                frame = ring.read(n)
+                if frame is not None:
+                    show(frame)
+            cursor = newest
+            if not ring.writer_open():
+                return 0
+            time.sleep(args.interval)
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
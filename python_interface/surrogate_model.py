@@ -46,6 +46,10 @@ class SurrogateModel:
         self.output_mean: Optional[np.ndarray] = None
         self.output_std: Optional[np.ndarray] = None
         self.output_sigma: Optional[np.ndarray] = None
+        # Training envelope (per-input range); the native engine (MlpSurrogate.h)
+        # falls back to full simulation outside it
+        self.input_min: Optional[np.ndarray] = None
+        self.input_max: Optional[np.ndarray] = None
 
         self._trained: bool = False
         self._training_cache: Dict[str, np.ndarray] = {}
@@ -232,6 +236,8 @@ class SurrogateModel:
 
         self._trained = True
         self._training_cache = {"X": X, "y": y}
+        self.input_min = X.min(axis=0)
+        self.input_max = X.max(axis=0)
 
         train_pred = self.predict(X)
         residuals = train_pred - y
@@ -383,6 +389,8 @@ class SurrogateModel:
             "output_mean": None if self.output_mean is None else self.output_mean.tolist(),
             "output_std": None if self.output_std is None else self.output_std.tolist(),
             "output_sigma": None if self.output_sigma is None else self.output_sigma.tolist(),
+            "input_min": None if self.input_min is None else self.input_min.tolist(),
+            "input_max": None if self.input_max is None else self.input_max.tolist(),
             "trained": self._trained,
         }
         if include_training_cache and self._training_cache:
@@ -417,6 +425,8 @@ class SurrogateModel:
         self.output_mean = np.asarray(payload.get("output_mean"), dtype=float) if payload.get("output_mean") else None
         self.output_std = np.asarray(payload.get("output_std"), dtype=float) if payload.get("output_std") else None
         self.output_sigma = np.asarray(payload.get("output_sigma"), dtype=float) if payload.get("output_sigma") else None
+        self.input_min = np.asarray(payload.get("input_min"), dtype=float) if payload.get("input_min") else None
+        self.input_max = np.asarray(payload.get("input_max"), dtype=float) if payload.get("input_max") else None
 
         self._trained = bool(payload.get("trained", False))
         cache = payload.get("training_cache")